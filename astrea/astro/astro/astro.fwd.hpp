@@ -46,6 +46,10 @@ class DirectionCosineMatrix;
 
 class EarthCenteredInertial;
 class EarthCenteredEarthFixed;
+class InternationalTerrestrialReferenceFrame;
+
+class CelestialIntermediatePoleCache;
+class EarthRotationProvider;
 
 // Platforms
 template <class Spacecraft_T>
@@ -65,6 +69,8 @@ class Vehicle;
 // Propagation
 class EquationsOfMotion;
 class Integrator;
+class MonteCarloPropagator;
+class BatchLambertSolver;
 class LambertSolver;
 class Event;
 class EventDetector;
@@ -83,6 +89,9 @@ class RiseSetArray;
 class Date;
 class Interval;
 struct JulianDateClock;
+class TwoPartJulianDate;
+class LeapSecondTable;
+class EarthOrientationTable;
 
 } // namespace astro
 } // namespace astrea
\ No newline at end of file
@@ -17,14 +17,19 @@
 #include <astro/state/orbital_data_formats/orbital_data_formats.hpp>
 #include <astro/state/orbital_elements/orbital_elements.hpp>
 
+#include <astro/state/frames/CelestialIntermediatePoleCache.hpp>
+#include <astro/state/frames/EarthRotationProvider.hpp>
 #include <astro/state/frames/Frame.hpp>
 #include <astro/state/frames/FrameReference.hpp>
+#include <astro/state/frames/earth_orientation.hpp>
 #include <astro/state/frames/frames.hpp>
 #include <astro/state/frames/instances/EarthCenteredEarthFixed.hpp>
 #include <astro/state/frames/instances/EarthCenteredInertial.hpp>
+#include <astro/state/frames/instances/InternationalTerrestrialReferenceFrame.hpp>
 #include <astro/state/frames/types/DirectionCosineMatrix.hpp>
 #include <astro/state/frames/types/InertialFrame.hpp>
 #include <astro/state/frames/types/RotatingFrame.hpp>
+#include <astro/state/frames/types/dcm_kernels.hpp>
 
 #include <astro/platforms/Vehicle.hpp>
 #include <astro/platforms/space/Constellation.hpp>
@@ -34,6 +39,7 @@
 #include <astro/platforms/vehicles/NullVehicle.hpp>
 #include <astro/platforms/vehicles/Spacecraft.hpp>
 
+#include <astro/propagation/analytic/BatchLambertSolver.hpp>
 #include <astro/propagation/analytic/LambertSolver.hpp>
 
 #include <astro/propagation/force_models/AtmosphericForce.hpp>
@@ -55,6 +61,7 @@
 #include <astro/propagation/event_detection/events/ImpulsiveBurn.hpp>
 
 #include <astro/propagation/numerical/Integrator.hpp>
+#include <astro/propagation/numerical/MonteCarloPropagator.hpp>
 #include <astro/propagation/numerical/butcher_tableau.hpp>
 
 #include <astro/systems/AstrodynamicsSystem.hpp>
@@ -63,8 +70,11 @@
 #include <astro/systems/CelestialBodyFactory.hpp>
 
 #include <astro/time/Date.hpp>
+#include <astro/time/epoch_parsing.hpp>
 #include <astro/time/Interval.hpp>
 #include <astro/time/JulianDateClock.hpp>
+#include <astro/time/TimeScales.hpp>
+#include <astro/time/TwoPartJulianDate.hpp>
 
 #include <astro/types/tuple_hash.hpp>
 #include <astro/types/typedefs.hpp>
\ No newline at end of file
@@ -10,11 +10,13 @@
  */
 #pragma once
 
+#include <ranges>
 #include <string>
 #include <vector>
 
 #include <units/units.hpp>
 
+#include <astro/platforms/space/JoinIterator.hpp>
 #include <astro/platforms/space/Shell.hpp>
 #include <astro/propagation/numerical/Integrator.hpp>
 
@@ -33,6 +35,20 @@ class Constellation {
     static_assert(std::is_base_of<Spacecraft, Spacecraft_T>::value, "Constellations must be built of Spacecraft or Derived classes.");
 
   public:
+    /**
+     * @brief Iterator over all Spacecraft in the Constellation, returning references in place.
+     *
+     * This iterator allows iteration over all Spacecraft in the Constellation, regardless of their Shell or Plane.
+     */
+    using iterator = JoinIterator<typename std::vector<Shell<Spacecraft_T>>::iterator>;
+
+    /**
+     * @brief Const iterator over all Spacecraft in the Constellation, returning const references in place.
+     *
+     * This const iterator allows iteration over all Spacecraft in the Constellation, regardless of their Shell or Plane.
+     */
+    using const_iterator = JoinIterator<typename std::vector<Shell<Spacecraft_T>>::const_iterator>;
+
     /**
      * @brief Default constructor for Constellation.
      */
@@ -62,10 +78,14 @@ class Constellation {
     /**
      * @brief Construct a Constellation from a vector of GeneralPerturbations objects.
      *
+     * Records are converted in parallel, each directly into its place in a single default Shell and Plane, so building
+     * a Constellation from a whole catalog makes no intermediate copies of the Spacecraft.
+     *
      * @param gp A vector of GeneralPerturbations objects to initialize the Constellation.
      * @param system The AstrodynamicsSystem to use for the Constellation.
+     * @param nThreads The number of threads to use. Zero uses the hardware concurrency.
      */
-    Constellation(const std::vector<GeneralPerturbations>& gp, const AstrodynamicsSystem& system);
+    Constellation(const std::vector<GeneralPerturbations>& gp, const AstrodynamicsSystem& system, const std::size_t& nThreads = 0);
 
     /**
      * @brief Construct a Constellation with a specific configuration.
@@ -97,6 +117,26 @@ class Constellation {
      */
     ~Constellation() = default;
 
+    /**
+     * @brief Copy constructor for Constellation.
+     */
+    Constellation(const Constellation&) = default;
+
+    /**
+     * @brief Move constructor for Constellation.
+     */
+    Constellation(Constellation&&) = default;
+
+    /**
+     * @brief Copy assignment operator for Constellation.
+     */
+    Constellation& operator=(const Constellation&) = default;
+
+    /**
+     * @brief Move assignment operator for Constellation.
+     */
+    Constellation& operator=(Constellation&&) = default;
+
     /**
      * @brief Get the size of the Constellation.
      *
@@ -172,18 +212,63 @@ class Constellation {
     const std::vector<Shell<Spacecraft_T>>& get_shells() const;
 
     /**
-     * @brief Get all Planes in the Constellation.
+     * @brief Get a view of all Planes in the Constellation, in place.
+     *
+     * @return auto A view over references to every Plane in every Shell.
+     */
+    auto get_planes()
+    {
+        return shells | std::views::transform([](Shell<Spacecraft_T>& shell) -> auto& { return shell.planes; }) | std::views::join;
+    }
+
+    /**
+     * @brief Get a const view of all Planes in the Constellation, in place.
      *
-     * @return std::vector<Plane<Spacecraft_T>>& A reference to the vector of Planes in the Constellation.
+     * @return auto A view over const references to every Plane in every Shell.
      */
-    const std::vector<Plane<Spacecraft_T>> get_planes() const;
+    auto get_planes() const
+    {
+        return shells | std::views::transform([](const Shell<Spacecraft_T>& shell) -> auto& { return shell.planes; }) |
+               std::views::join;
+    }
 
     /**
-     * @brief Get all Spacecraft in the Constellation.
+     * @brief Get a view of all Spacecraft in the Constellation, in place.
      *
-     * @return std::vector<Spacecraft_T> A vector of all Spacecraft in the Constellation.
+     * @return std::ranges::subrange<iterator> A view over references to every Spacecraft in the Constellation.
      */
-    const std::vector<Spacecraft_T> get_all_spacecraft() const;
+    std::ranges::subrange<iterator> get_all_spacecraft() { return { begin(), end() }; }
+
+    /**
+     * @brief Get a const view of all Spacecraft in the Constellation, in place.
+     *
+     * @return std::ranges::subrange<const_iterator> A view over const references to every Spacecraft in the
+     * Constellation.
+     */
+    std::ranges::subrange<const_iterator> get_all_spacecraft() const { return { begin(), end() }; }
+
+    /**
+     * @brief Run a function on every Spacecraft in the Constellation, split across threads.
+     *
+     * Each Spacecraft is passed by reference, so the function may update it in place. The function must be safe to
+     * call concurrently on different Spacecraft.
+     *
+     * @tparam Function_T Callable taking a Spacecraft_T&.
+     * @param function The function to run for each Spacecraft.
+     * @param nThreads The number of threads to use. Zero uses the hardware concurrency.
+     */
+    template <class Function_T>
+    void parallel_for_each(Function_T&& function, const std::size_t& nThreads = 0);
+
+    /**
+     * @brief Run a function on every Spacecraft in the Constellation, split across threads.
+     *
+     * @tparam Function_T Callable taking a const Spacecraft_T&.
+     * @param function The function to run for each Spacecraft.
+     * @param nThreads The number of threads to use. Zero uses the hardware concurrency.
+     */
+    template <class Function_T>
+    void parallel_for_each(Function_T&& function, const std::size_t& nThreads = 0) const;
 
     /**
      * @brief Get a specific Shell by its ID.
@@ -229,16 +314,6 @@ class Constellation {
     void propagate(const Date& epoch, EquationsOfMotion& eom, Integrator& integrator, const Interval& interval = Integrator::defaultInterval);
 
 
-    // using iterator       = std::vector<Shell<Spacecraft_T>>::iterator;
-    // using const_iterator = std::vector<Shell<Spacecraft_T>>::const_iterator;
-
-    // iterator begin() { return shells.begin(); }
-    // iterator end() { return shells.end(); }
-    // const_iterator begin() const { return shells.begin(); }
-    // const_iterator end() const { return shells.end(); }
-    // const_iterator cbegin() const { return shells.cbegin(); }
-    // const_iterator cend() const { return shells.cend(); }
-
     /**
      * @brief Access the Spacecraft at a specific index in the Constellation.
      *
@@ -255,221 +330,47 @@ class Constellation {
      */
     const Spacecraft_T& operator[](const std::size_t idx) const;
 
-    class sat_iterator; // Forward declaration of the iterator class
-
-    /**
-     * @brief Iterator for iterating over all Spacecraft in the Constellation.
-     *
-     * This iterator allows iteration over all Spacecraft in the Constellation, regardless of their Shell or Plane.
-     */
-    using iterator = sat_iterator;
-
-    /**
-     * @brief Const iterator for iterating over all Spacecraft in the Constellation.
-     *
-     * This const iterator allows iteration over all Spacecraft in the Constellation, regardless of their Shell or Plane.
-     */
-    using const_iterator = const sat_iterator;
-
     /**
      * @brief Get an iterator to the beginning of the Constellation.
      *
      * @return iterator An iterator pointing to the first Spacecraft in the Constellation.
      */
-    iterator begin() { return sat_iterator(shells.begin(), shells.begin()->begin()); }
+    iterator begin() { return iterator(shells.begin(), shells.end()); }
 
     /**
      * @brief Get an iterator to the end of the Constellation.
      *
      * @return iterator An iterator pointing to one past the last Spacecraft in the Constellation.
      */
-    iterator end() { return sat_iterator(shells.end(), shells.end()->end()); }
+    iterator end() { return iterator(shells.end(), shells.end()); }
 
     /**
      * @brief Get a const iterator to the beginning of the Constellation.
      *
      * @return const_iterator A const iterator pointing to the first Spacecraft in the Constellation.
      */
-    const_iterator begin() const { return sat_iterator(shells.begin(), shells.begin()->begin()); }
+    const_iterator begin() const { return const_iterator(shells.begin(), shells.end()); }
 
     /**
      * @brief Get a const iterator to the end of the Constellation.
      *
      * @return const_iterator A const iterator pointing to one past the last Spacecraft in the Constellation.
      */
-    const_iterator end() const { return sat_iterator(shells.end(), shells.end()->end()); }
+    const_iterator end() const { return const_iterator(shells.end(), shells.end()); }
 
     /**
      * @brief Get a const iterator to the beginning of the Constellation.
      *
      * @return const_iterator A const iterator pointing to the first Spacecraft in the Constellation.
      */
-    const_iterator cbegin() const { return sat_iterator(shells.cbegin(), shells.cbegin()->cbegin()); }
+    const_iterator cbegin() const { return begin(); }
 
     /**
      * @brief Get a const iterator to the end of the Constellation.
      *
      * @return const_iterator A const iterator pointing to one past the last Spacecraft in the Constellation.
      */
-    const_iterator cend() const { return sat_iterator(shells.cend(), shells.cend()->cend()); }
-
-    /**
-     * @brief Iterator class for iterating over all Spacecraft in the Constellation.
-     */
-    class sat_iterator {
-      private:
-        std::vector<Shell<Spacecraft_T>>::iterator iterShell; // Iterator for the Shells in the Constellation
-        Shell<Spacecraft_T>::sat_iterator iterSat;            // Iterator for the Spacecraft within the current Shell
-
-      public:
-        /**
-         * @brief Construct a sat_iterator from a Shell iterator and a Spacecraft iterator.
-         *
-         * @param _iterShell The iterator for the Shells in the Constellation.
-         * @param _iterSat The iterator for the Spacecraft within the current Shell.
-         */
-        sat_iterator(std::vector<Shell<Spacecraft_T>>::iterator _iterShell, Shell<Spacecraft_T>::sat_iterator _iterSat) :
-            iterShell(_iterShell),
-            iterSat(_iterSat)
-        {
-        } // TODO: Sanitize inputs
-
-        /**
-         * @brief Pre-increment operator for the sat_iterator.
-         *
-         * @return sat_iterator& A reference to the incremented iterator.
-         */
-        sat_iterator& operator++()
-        {
-            ++iterSat;
-            if (iterSat == iterShell->end()) {
-                ++iterShell;
-                iterSat = iterShell->begin();
-            }
-            return *this;
-        }
-
-        /**
-         * @brief Post-increment operator for the sat_iterator.
-         *
-         * @return sat_iterator A copy of the iterator before incrementing.
-         */
-        sat_iterator operator++(int)
-        {
-            sat_iterator retval = *this;
-            ++(*this);
-            return retval;
-        }
-
-        /**
-         * @brief Pre-decrement operator for the sat_iterator.
-         *
-         * @return sat_iterator& A reference to the decremented iterator.
-         */
-        sat_iterator& operator--()
-        {
-            --iterSat;
-            if (iterSat < iterShell->begin()) {
-                --iterShell;
-                iterSat = iterShell->end();
-            }
-            return *this;
-        }
-
-        /**
-         * @brief Post-decrement operator for the sat_iterator.
-         *
-         * @return sat_iterator A copy of the iterator before decrementing.
-         */
-        sat_iterator operator--(int)
-        {
-            sat_iterator retval = *this;
-            --(*this);
-            return retval;
-        }
-
-        /**
-         * @brief Equality operator for the sat_iterator.
-         *
-         * @param other The other sat_iterator to compare with.
-         * @return true if both iterators point to the same Spacecraft, false otherwise.
-         */
-        bool operator==(const sat_iterator& other) const
-        {
-            return iterShell == other.iterShell && iterSat == other.iterSat;
-        }
-
-        /**
-         * @brief Inequality operator for the sat_iterator.
-         *
-         * @param other The other sat_iterator to compare with.
-         * @return true if both iterators do not point to the same Spacecraft, false otherwise.
-         */
-        bool operator!=(const sat_iterator& other) const { return !(*this == other); }
-
-        /**
-         * @brief Less than operator for the sat_iterator.
-         *
-         * @param other The other sat_iterator to compare with.
-         * @return true if this iterator is less than the other, false otherwise.
-         * @return false if this iterator is greater than or equal to the other.
-         */
-        bool operator<(const sat_iterator& other) const
-        {
-            return iterShell < other.iterShell || (iterShell == other.iterShell && iterSat < other.iterSat);
-        }
-
-        /**
-         * @brief Greater than operator for the sat_iterator.
-         *
-         * @param other The other sat_iterator to compare with.
-         * @return true if this iterator is greater than the other, false otherwise.
-         * @return false if this iterator is less than or equal to the other.
-         */
-        bool operator>(const sat_iterator& other) const
-        {
-            return iterShell > other.iterShell || (iterShell == other.iterShell && iterSat > other.iterSat);
-        }
-
-        /**
-         * @brief Less than or equal to operator for the sat_iterator.
-         *
-         * @param other The other sat_iterator to compare with.
-         * @return true if this iterator is less than or equal to the other, false otherwise.
-         * @return false if this iterator is greater than the other.
-         */
-        bool operator<=(const sat_iterator& other) const
-        {
-            return iterShell < other.iterShell || (iterShell == other.iterShell && iterSat <= other.iterSat);
-        }
-
-        /**
-         * @brief Greater than or equal to operator for the sat_iterator.
-         *
-         * @param other The other sat_iterator to compare with.
-         * @return true if this iterator is greater than or equal to the other, false otherwise.
-         * @return false if this iterator is less than the other.
-         */
-        bool operator>=(const sat_iterator& other) const
-        {
-            return iterShell > other.iterShell || (iterShell == other.iterShell && iterSat >= other.iterSat);
-        }
-
-        /**
-         * @brief Dereference operator for the sat_iterator.
-         *
-         * @return Spacecraft_T& A reference to the Spacecraft pointed to by the iterator.
-         */
-        Spacecraft_T operator*() { return *iterSat; }
-
-      private:
-        // iterator traits
-        using difference_type = Plane<Spacecraft_T>::iterator;  // Use the iterator type of Plane as the difference type
-        using value_type      = Plane<Spacecraft_T>::iterator;  // Use the iterator type of Plane as the value type
-        using pointer   = const Plane<Spacecraft_T>::iterator*; // Use the iterator type of Plane as the pointer type
-        using reference = const Plane<Spacecraft_T>::iterator&; // Use the iterator type of Plane as the reference type
-        using iterator_category = std::forward_iterator_tag;    // Use forward iterator tag for the iterator category
-    };
+    const_iterator cend() const { return end(); }
 
   private:
     std::size_t id;                          // Unique identifier for the Constellation
@@ -1,12 +1,16 @@
+#include <utility>
+
+#include <utilities/parallel.hpp>
+
 namespace astrea {
 namespace astro {
 
 static const size_t DEFAULT_SHELL_ID = SIZE_MAX;
 
 template <class Spacecraft_T>
-Constellation<Spacecraft_T>::Constellation(std::vector<Shell<Spacecraft_T>> _shells)
+Constellation<Spacecraft_T>::Constellation(std::vector<Shell<Spacecraft_T>> _shells) :
+    shells(std::move(_shells))
 {
-    shells = _shells;
     generate_id_hash();
 }
 
@@ -14,11 +18,9 @@ Constellation<Spacecraft_T>::Constellation(std::vector<Shell<Spacecraft_T>> _she
 template <class Spacecraft_T>
 Constellation<Spacecraft_T>::Constellation(std::vector<Plane<Spacecraft_T>> planes)
 {
-    Shell<Spacecraft_T> noShell(planes);
-    noShell.name = "DEFAULT";
-    noShell.id   = DEFAULT_SHELL_ID;
-
-    shells.push_back(noShell);
+    Shell<Spacecraft_T>& noShell = shells.emplace_back(std::move(planes));
+    noShell.name                 = "DEFAULT";
+    noShell.id                   = DEFAULT_SHELL_ID;
 
     generate_id_hash();
 }
@@ -27,23 +29,35 @@ Constellation<Spacecraft_T>::Constellation(std::vector<Plane<Spacecraft_T>> plan
 template <class Spacecraft_T>
 Constellation<Spacecraft_T>::Constellation(std::vector<Spacecraft_T> satellites)
 {
-    Plane<Spacecraft_T> noPlane(satellites);
-    Shell<Spacecraft_T> noShell(std::vector<Plane<Spacecraft_T>>{ noPlane });
-    noShell.name = "DEFAULT";
-
-    shells.push_back(noShell);
+    Shell<Spacecraft_T>& noShell = shells.emplace_back(std::move(satellites));
+    noShell.name                 = "DEFAULT";
 
     generate_id_hash();
 }
 
 template <class Spacecraft_T>
-Constellation<Spacecraft_T>::Constellation(const std::vector<GeneralPerturbations>& gps, const AstrodynamicsSystem& system)
+Constellation<Spacecraft_T>::Constellation(
+    const std::vector<GeneralPerturbations>& gps,
+    const AstrodynamicsSystem& system,
+    const std::size_t& nThreads
+)
 {
-    std::vector<Spacecraft_T> satellites;
-    for (const auto& gp : gps) {
-        satellites.push_back(Spacecraft_T(gp, system));
-    }
-    *this = Constellation(satellites);
+    if (gps.empty()) { return; }
+
+    // Lay out the single default shell and plane first, so each record converts straight into its final slot
+    Shell<Spacecraft_T>& noShell = shells.emplace_back();
+    noShell.name                 = "DEFAULT";
+    Plane<Spacecraft_T>& noPlane = noShell.planes.emplace_back();
+    noPlane.satellites.resize(gps.size());
+
+    utilities::parallel_for(gps.size(), nThreads, [&](const std::size_t& ii) {
+        noPlane.satellites[ii] = Spacecraft_T(gps[ii], system);
+    });
+
+    noPlane.update_elements();
+    noPlane.generate_id_hash();
+    noShell.generate_id_hash();
+    generate_id_hash();
 }
 
 
@@ -69,13 +83,12 @@ Constellation<Spacecraft_T>::Constellation(
 template <class Spacecraft_T>
 Spacecraft_T& Constellation<Spacecraft_T>::operator[](const std::size_t idx)
 {
-    std::size_t ii = 0;
+    // Skip whole planes rather than walking every satellite before the index
+    std::size_t offset = idx;
     for (auto& shell : shells) {
         for (auto& plane : shell.planes) {
-            for (auto& sat : plane.satellites) {
-                if (ii == idx) { return sat; }
-                ++ii;
-            }
+            if (offset < plane.size()) { return plane.satellites[offset]; }
+            offset -= plane.size();
         }
     }
     throw std::runtime_error("Satellite requested outside of constellation bounds.");
@@ -84,13 +97,11 @@ Spacecraft_T& Constellation<Spacecraft_T>::operator[](const std::size_t idx)
 template <class Spacecraft_T>
 const Spacecraft_T& Constellation<Spacecraft_T>::operator[](const std::size_t idx) const
 {
-    std::size_t ii = 0;
-    for (auto& shell : shells) {
-        for (auto& plane : shell.planes) {
-            for (auto& sat : plane.satellites) {
-                if (ii == idx) { return sat; }
-                ++ii;
-            }
+    std::size_t offset = idx;
+    for (const auto& shell : shells) {
+        for (const auto& plane : shell.planes) {
+            if (offset < plane.size()) { return plane.satellites[offset]; }
+            offset -= plane.size();
         }
     }
     throw std::runtime_error("Satellite requested outside of constellation bounds.");
@@ -204,26 +215,28 @@ const std::vector<Shell<Spacecraft_T>>& Constellation<Spacecraft_T>::get_shells(
 
 
 template <class Spacecraft_T>
-const std::vector<Plane<Spacecraft_T>> Constellation<Spacecraft_T>::get_planes() const
+template <class Function_T>
+void Constellation<Spacecraft_T>::parallel_for_each(Function_T&& function, const std::size_t& nThreads)
 {
-    std::vector<Plane<Spacecraft_T>> allPlanes;
-    for (auto& shell : shells) {
-        const auto& shellPlanes = shell.get_planes();
-        allPlanes.insert(allPlanes.end(), shellPlanes.begin(), shellPlanes.end());
+    std::vector<Spacecraft_T*> satellites;
+    satellites.reserve(size());
+    for (auto& sat : *this) {
+        satellites.push_back(&sat);
     }
-    return allPlanes;
+    utilities::parallel_for(satellites.size(), nThreads, [&](const std::size_t& ii) { function(*satellites[ii]); });
 }
 
 
 template <class Spacecraft_T>
-const std::vector<Spacecraft_T> Constellation<Spacecraft_T>::get_all_spacecraft() const
+template <class Function_T>
+void Constellation<Spacecraft_T>::parallel_for_each(Function_T&& function, const std::size_t& nThreads) const
 {
-    std::vector<Spacecraft_T> allSpacecraft;
-    for (auto& shell : shells) {
-        const auto shellSpacecraft = shell.get_all_spacecraft();
-        allSpacecraft.insert(allSpacecraft.end(), shellSpacecraft.begin(), shellSpacecraft.end());
+    std::vector<const Spacecraft_T*> satellites;
+    satellites.reserve(size());
+    for (const auto& sat : *this) {
+        satellites.push_back(&sat);
     }
-    return allSpacecraft;
+    utilities::parallel_for(satellites.size(), nThreads, [&](const std::size_t& ii) { function(*satellites[ii]); });
 }
 
 
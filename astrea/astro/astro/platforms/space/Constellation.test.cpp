@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <units/units.hpp>
+
+#include <astro/platforms/space/Constellation.hpp>
+#include <astro/platforms/vehicles/Spacecraft.hpp>
+#include <astro/systems/AstrodynamicsSystem.hpp>
+#include <astro/time/Date.hpp>
+
+using namespace astrea;
+using namespace astro;
+
+using mp_units::angular::unit_symbols::deg;
+using mp_units::si::unit_symbols::km;
+
+class ConstellationTest : public testing::Test {
+  public:
+    ConstellationTest() = default;
+
+    void SetUp() override
+    {
+        // Three planes of two spacecraft, spread over shells with empty shells and planes between them
+        Shell<Spacecraft> walker(sys, epoch, 7000.0 * km, 45.0 * deg, 6, 3, 1.0);
+        const std::vector<Plane<Spacecraft>>& planes = walker.get_planes();
+
+        constellation = Constellation<Spacecraft>(std::vector<Shell<Spacecraft>>{
+            Shell<Spacecraft>(std::vector<Plane<Spacecraft>>{ planes[0], Plane<Spacecraft>(), Plane<Spacecraft>(), planes[1] }),
+            Shell<Spacecraft>(),
+            Shell<Spacecraft>(std::vector<Plane<Spacecraft>>{ planes[2], Plane<Spacecraft>() }),
+            Shell<Spacecraft>() });
+
+        for (auto& shell : constellation.get_shells()) {
+            for (auto& plane : shell.get_planes()) {
+                for (auto& sat : plane.get_all_spacecraft()) {
+                    expected.push_back(&sat);
+                }
+            }
+        }
+    }
+
+    AstrodynamicsSystem sys;
+    Date epoch;
+    Constellation<Spacecraft> constellation;
+    std::vector<Spacecraft*> expected;
+};
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST_F(ConstellationTest, EmptyConstellation)
+{
+    Constellation<Spacecraft> empty;
+    ASSERT_TRUE(empty.begin() == empty.end());
+    ASSERT_TRUE(std::as_const(empty).begin() == std::as_const(empty).end());
+    ASSERT_TRUE(empty.cbegin() == empty.cend());
+    ASSERT_TRUE(empty.get_all_spacecraft().empty());
+    ASSERT_TRUE(std::ranges::empty(empty.get_planes()));
+
+    std::size_t nVisited = 0;
+    empty.parallel_for_each([&](Spacecraft&) { ++nVisited; });
+    ASSERT_EQ(nVisited, 0);
+}
+
+TEST_F(ConstellationTest, SkipsEmptyShellsAndPlanes)
+{
+    ASSERT_EQ(expected.size(), 6);
+    ASSERT_EQ(constellation.size(), 6);
+
+    std::size_t ii = 0;
+    for (auto& sat : constellation) {
+        ASSERT_LT(ii, expected.size());
+        ASSERT_EQ(&sat, expected[ii]);
+        ASSERT_EQ(&constellation[ii], expected[ii]);
+        ++ii;
+    }
+    ASSERT_EQ(ii, expected.size());
+
+    ii = 0;
+    for (const auto& sat : std::as_const(constellation).get_all_spacecraft()) {
+        ASSERT_EQ(&sat, expected[ii++]);
+    }
+    ASSERT_EQ(ii, expected.size());
+}
+
+TEST_F(ConstellationTest, ConvertsToConstIterator)
+{
+    Constellation<Spacecraft>::iterator it = constellation.begin();
+    ++it;
+    ++it;
+
+    const Constellation<Spacecraft>::const_iterator converted = it;
+    ASSERT_EQ(&*converted, expected[2]);
+    ASSERT_TRUE(converted == Constellation<Spacecraft>::const_iterator(it));
+    ASSERT_TRUE(Constellation<Spacecraft>::const_iterator(constellation.end()) == constellation.cend());
+    ASSERT_EQ(std::distance(converted, constellation.cend()), 4);
+}
+
+TEST_F(ConstellationTest, GetPlanesJoinsShells)
+{
+    std::vector<const Plane<Spacecraft>*> planes;
+    for (const auto& shell : constellation.get_shells()) {
+        for (const auto& plane : shell.get_planes()) {
+            planes.push_back(&plane);
+        }
+    }
+    ASSERT_EQ(planes.size(), constellation.n_planes());
+
+    std::size_t ii = 0;
+    for (auto& plane : constellation.get_planes()) {
+        ASSERT_EQ(&plane, planes[ii++]);
+    }
+    ASSERT_EQ(ii, planes.size());
+
+    ii = 0;
+    for (const auto& plane : std::as_const(constellation).get_planes()) {
+        ASSERT_EQ(&plane, planes[ii++]);
+    }
+    ASSERT_EQ(ii, planes.size());
+}
+
+TEST_F(ConstellationTest, ParallelForEachVisitsEachSpacecraftOnce)
+{
+    std::unordered_map<const Spacecraft*, std::size_t> index;
+    std::vector<std::string> names;
+    for (std::size_t ii = 0; ii < expected.size(); ++ii) {
+        index[expected[ii]] = ii;
+        names.push_back(expected[ii]->get_name());
+    }
+
+    std::vector<std::atomic<std::size_t>> visits(expected.size());
+    constellation.parallel_for_each(
+        [&](Spacecraft& sat) {
+            ++visits[index.at(&sat)];
+            sat.set_name(sat.get_name() + "-visited");
+        },
+        4
+    );
+    for (std::size_t ii = 0; ii < expected.size(); ++ii) {
+        ASSERT_EQ(visits[ii].load(), 1);
+        ASSERT_EQ(expected[ii]->get_name(), names[ii] + "-visited");
+    }
+
+    std::vector<std::atomic<std::size_t>> constVisits(expected.size());
+    std::as_const(constellation).parallel_for_each([&](const Spacecraft& sat) { ++constVisits[index.at(&sat)]; }, 4);
+    for (std::size_t ii = 0; ii < expected.size(); ++ii) {
+        ASSERT_EQ(constVisits[ii].load(), 1);
+    }
+}
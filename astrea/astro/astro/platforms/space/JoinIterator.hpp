@@ -0,0 +1,149 @@
+/**
+ * @file JoinIterator.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief Iterator flattening a range of ranges, used to walk the Spacecraft of Shells and Constellations
+ * @version 0.1
+ * @date 2025-08-02
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace astrea {
+namespace astro {
+
+/**
+ * @brief Forward iterator over the elements of a range of ranges, such as the Spacecraft in a vector of Planes.
+ *
+ * Dereferencing returns a reference to the element in place, so iterating never copies the elements. Empty inner
+ * ranges are skipped. Iterators over mutable ranges convert to iterators over const ranges.
+ *
+ * @tparam OuterIterator_T The iterator type of the outer range. Its elements must provide begin() and end().
+ */
+template <class OuterIterator_T>
+class JoinIterator {
+
+    template <class>
+    friend class JoinIterator;
+
+    using Inner_T         = std::remove_reference_t<std::iter_reference_t<OuterIterator_T>>;
+    using InnerIterator_T = decltype(std::declval<Inner_T&>().begin());
+
+  public:
+    using iterator_concept  = std::forward_iterator_tag;
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = std::iter_value_t<InnerIterator_T>;
+    using difference_type   = std::ptrdiff_t;
+    using reference         = std::iter_reference_t<InnerIterator_T>;
+    using pointer           = std::add_pointer_t<reference>;
+
+    /**
+     * @brief Default constructor for JoinIterator.
+     */
+    JoinIterator() = default;
+
+    /**
+     * @brief Construct a JoinIterator at the first element at or after an outer position.
+     *
+     * @param outer The position in the outer range.
+     * @param outerEnd The end of the outer range.
+     */
+    JoinIterator(OuterIterator_T outer, OuterIterator_T outerEnd) :
+        _outer(outer),
+        _outerEnd(outerEnd)
+    {
+        if (_outer != _outerEnd) {
+            _inner = _outer->begin();
+            skip_empty();
+        }
+    }
+
+    /**
+     * @brief Convert an iterator over a mutable range into one over a const range.
+     *
+     * @param other The iterator to convert.
+     */
+    template <class Other_T>
+        requires(!std::is_same_v<Other_T, OuterIterator_T> && std::is_convertible_v<Other_T, OuterIterator_T>)
+    JoinIterator(const JoinIterator<Other_T>& other) :
+        _outer(other._outer),
+        _outerEnd(other._outerEnd),
+        _inner(other._inner)
+    {
+    }
+
+    /**
+     * @brief Dereference operator for the JoinIterator.
+     *
+     * @return reference A reference to the current element.
+     */
+    reference operator*() const { return *_inner; }
+
+    /**
+     * @brief Member access operator for the JoinIterator.
+     *
+     * @return pointer A pointer to the current element.
+     */
+    pointer operator->() const { return std::addressof(*_inner); }
+
+    /**
+     * @brief Pre-increment operator for the JoinIterator.
+     *
+     * @return JoinIterator& A reference to the incremented iterator.
+     */
+    JoinIterator& operator++()
+    {
+        ++_inner;
+        skip_empty();
+        return *this;
+    }
+
+    /**
+     * @brief Post-increment operator for the JoinIterator.
+     *
+     * @return JoinIterator A copy of the iterator before incrementing.
+     */
+    JoinIterator operator++(int)
+    {
+        JoinIterator retval = *this;
+        ++(*this);
+        return retval;
+    }
+
+    /**
+     * @brief Equality operator for the JoinIterator.
+     *
+     * @param other The other JoinIterator to compare with.
+     * @return true if both iterators point to the same element, or are both at the end.
+     */
+    bool operator==(const JoinIterator& other) const
+    {
+        return _outer == other._outer && (_outer == _outerEnd || _inner == other._inner);
+    }
+
+  private:
+    OuterIterator_T _outer{};    //!< Current position in the outer range
+    OuterIterator_T _outerEnd{}; //!< End of the outer range
+    InnerIterator_T _inner{};    //!< Current position in the current inner range
+
+    /**
+     * @brief Move past the ends of inner ranges until reaching an element or the end of the outer range.
+     */
+    void skip_empty()
+    {
+        while (_inner == _outer->end()) {
+            ++_outer;
+            if (_outer == _outerEnd) { return; }
+            _inner = _outer->begin();
+        }
+    }
+};
+
+} // namespace astro
+} // namespace astrea
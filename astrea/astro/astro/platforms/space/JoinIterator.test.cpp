@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <ranges>
+#include <vector>
+
+#include <astro/platforms/space/JoinIterator.hpp>
+
+using namespace astrea;
+using namespace astro;
+
+class JoinIteratorTest : public testing::Test {
+  public:
+    JoinIteratorTest() = default;
+
+    using Ranges         = std::vector<std::vector<int>>;
+    using iterator       = JoinIterator<Ranges::iterator>;
+    using const_iterator = JoinIterator<Ranges::const_iterator>;
+
+    static std::vector<int> collect(const Ranges& ranges)
+    {
+        std::vector<int> values;
+        for (auto it = const_iterator(ranges.begin(), ranges.end()); it != const_iterator(ranges.end(), ranges.end()); ++it) {
+            values.push_back(*it);
+        }
+        return values;
+    }
+
+    Ranges ranges{ {}, { 1, 2 }, {}, {}, { 3 }, { 4, 5, 6 }, {} };
+};
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST_F(JoinIteratorTest, ModelsForwardIterator)
+{
+    static_assert(std::forward_iterator<iterator>);
+    static_assert(std::forward_iterator<const_iterator>);
+    static_assert(std::ranges::forward_range<std::ranges::subrange<iterator>>);
+}
+
+TEST_F(JoinIteratorTest, SkipsEmptyRanges) { ASSERT_EQ(collect(ranges), std::vector<int>({ 1, 2, 3, 4, 5, 6 })); }
+
+TEST_F(JoinIteratorTest, EmptyOuterRange)
+{
+    const Ranges empty;
+    ASSERT_TRUE(const_iterator(empty.begin(), empty.end()) == const_iterator(empty.end(), empty.end()));
+}
+
+TEST_F(JoinIteratorTest, AllInnerRangesEmpty)
+{
+    const Ranges allEmpty{ {}, {}, {} };
+    ASSERT_TRUE(const_iterator(allEmpty.begin(), allEmpty.end()) == const_iterator(allEmpty.end(), allEmpty.end()));
+    ASSERT_TRUE(collect(allEmpty).empty());
+}
+
+TEST_F(JoinIteratorTest, ReferencesInPlace)
+{
+    for (auto it = iterator(ranges.begin(), ranges.end()); it != iterator(ranges.end(), ranges.end()); ++it) {
+        *it *= 10;
+    }
+    ASSERT_EQ(collect(ranges), std::vector<int>({ 10, 20, 30, 40, 50, 60 }));
+    ASSERT_EQ(&*iterator(ranges.begin(), ranges.end()), &ranges[1][0]);
+}
+
+TEST_F(JoinIteratorTest, PostIncrement)
+{
+    iterator it     = iterator(ranges.begin(), ranges.end());
+    iterator before = it++;
+    ASSERT_EQ(*before, 1);
+    ASSERT_EQ(*it, 2);
+    it++;
+    ASSERT_EQ(*it, 3);
+}
+
+TEST_F(JoinIteratorTest, ConvertsToConstIterator)
+{
+    static_assert(std::is_convertible_v<iterator, const_iterator>);
+    static_assert(!std::is_convertible_v<const_iterator, iterator>);
+
+    iterator it = iterator(ranges.begin(), ranges.end());
+    ++it;
+    ++it;
+
+    const const_iterator converted = it;
+    ASSERT_EQ(&*converted, &*it);
+    ASSERT_EQ(*converted, 3);
+
+    const const_iterator end = iterator(ranges.end(), ranges.end());
+    ASSERT_TRUE(end == const_iterator(ranges.cend(), ranges.cend()));
+    ASSERT_EQ(std::distance(converted, end), 4);
+}
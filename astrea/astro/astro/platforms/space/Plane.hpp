@@ -51,6 +51,26 @@ class Plane {
      */
     ~Plane() = default;
 
+    /**
+     * @brief Copy constructor for Plane.
+     */
+    Plane(const Plane&) = default;
+
+    /**
+     * @brief Move constructor for Plane.
+     */
+    Plane(Plane&&) = default;
+
+    /**
+     * @brief Copy assignment operator for Plane.
+     */
+    Plane& operator=(const Plane&) = default;
+
+    /**
+     * @brief Move assignment operator for Plane.
+     */
+    Plane& operator=(Plane&&) = default;
+
     /**
      * @brief Add a Spacecraft to the Plane.
      *
@@ -162,6 +182,11 @@ class Plane {
 
     bool strict; // Flag to indicate if the Plane is strict (all Spacecraft must have the same orbital elements)
 
+    /**
+     * @brief Set the shared orbital elements from the first Spacecraft and check whether the rest are in-plane.
+     */
+    void update_elements();
+
     /**
      * @brief Generate a unique ID hash for the Plane.
      *
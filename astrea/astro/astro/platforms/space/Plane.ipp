@@ -1,3 +1,5 @@
+#include <utility>
+
 #include <astro/utilities/conversions.hpp>
 
 #include <utilities/ProgressBar.hpp>
@@ -7,9 +9,16 @@ namespace astro {
 
 template <class Spacecraft_T>
 Plane<Spacecraft_T>::Plane(std::vector<Spacecraft_T> _satellites) :
-    satellites(_satellites)
+    satellites(std::move(_satellites))
 {
+    update_elements();
+    generate_id_hash();
+}
+
 
+template <class Spacecraft_T>
+void Plane<Spacecraft_T>::update_elements()
+{
     // Assume Earth-system for now. TODO: Fix this
     AstrodynamicsSystem sys;
 
@@ -25,8 +34,6 @@ Plane<Spacecraft_T>::Plane(std::vector<Spacecraft_T> _satellites) :
             break;
         }
     }
-
-    generate_id_hash();
 }
 
 
@@ -10,12 +10,14 @@
  */
 #pragma once
 
+#include <ranges>
 #include <string>
 #include <vector>
 
 #include <units/units.hpp>
 
 #include <astro/astro.fwd.hpp>
+#include <astro/platforms/space/JoinIterator.hpp>
 #include <astro/platforms/space/Plane.hpp>
 #include <astro/propagation/numerical/Integrator.hpp>
 #include <astro/state/orbital_elements/instances/Keplerian.hpp>
@@ -38,6 +40,16 @@ class Shell {
     friend class Constellation<Spacecraft_T>;
 
   public:
+    /**
+     * @brief Iterator over all Spacecraft in the Shell, returning references in place.
+     */
+    using iterator = JoinIterator<typename std::vector<Plane<Spacecraft_T>>::iterator>;
+
+    /**
+     * @brief Const iterator over all Spacecraft in the Shell, returning const references in place.
+     */
+    using const_iterator = JoinIterator<typename std::vector<Plane<Spacecraft_T>>::const_iterator>;
+
     /**
      * @brief Default constructor for Shell.
      * Initializes an empty shell with no planes or spacecraft.
@@ -86,6 +98,26 @@ class Shell {
      */
     ~Shell() = default;
 
+    /**
+     * @brief Copy constructor for Shell.
+     */
+    Shell(const Shell&) = default;
+
+    /**
+     * @brief Move constructor for Shell.
+     */
+    Shell(Shell&&) = default;
+
+    /**
+     * @brief Copy assignment operator for Shell.
+     */
+    Shell& operator=(const Shell&) = default;
+
+    /**
+     * @brief Move assignment operator for Shell.
+     */
+    Shell& operator=(Shell&&) = default;
+
     /**
      * @brief Returns the size of the shell, which is the number of spacecraft it contains.
      *
@@ -137,11 +169,18 @@ class Shell {
     const std::vector<Plane<Spacecraft_T>>& get_planes() const;
 
     /**
-     * @brief Returns a vector of all spacecraft in the shell.
+     * @brief Returns a view of all spacecraft in the shell, in place.
+     *
+     * @return std::ranges::subrange<iterator> A view over references to the spacecraft in the shell.
+     */
+    std::ranges::subrange<iterator> get_all_spacecraft() { return { begin(), end() }; }
+
+    /**
+     * @brief Returns a const view of all spacecraft in the shell, in place.
      *
-     * @return const std::vector<Spacecraft_T> A vector containing all spacecraft in the shell.
+     * @return std::ranges::subrange<const_iterator> A view over const references to the spacecraft in the shell.
      */
-    const std::vector<Spacecraft_T> get_all_spacecraft() const;
+    std::ranges::subrange<const_iterator> get_all_spacecraft() const { return { begin(), end() }; }
 
     /**
      * @brief Returns a reference to a specific plane in the shell by its ID.
@@ -170,218 +209,47 @@ class Shell {
     void propagate(const Date& epoch, EquationsOfMotion& eom, Integrator& integrator, const Interval& interval = Integrator::defaultInterval);
 
 
-    // using iterator       = std::vector<Plane<Spacecraft_T>>::iterator;
-    // using const_iterator = std::vector<Plane<Spacecraft_T>>::const_iterator;
-
-    // iterator begin() { return planes.begin(); }
-    // iterator end() { return planes.end(); }
-    // const_iterator begin() const { return planes.begin(); }
-    // const_iterator end() const { return planes.end(); }
-    // const_iterator cbegin() const { return planes.cbegin(); }
-    // const_iterator cend() const { return planes.cend(); }
-
-    class sat_iterator; // Forward declaration of the iterator class for iterating over spacecraft in the shell
-
-    /**
-     * @brief Iterator for iterating over all Planes in the Shell.
-     */
-    using iterator = sat_iterator;
-
-    /**
-     * @brief Const iterator for iterating over all Planes in the Shell.
-     */
-    using const_iterator = const sat_iterator;
-
     /**
      * @brief Get an iterator to the beginning of the Shell.
-     * @return iterator An iterator pointing to the first Plane in the Shell.
+     *
+     * @return iterator An iterator pointing to the first Spacecraft in the Shell.
      */
-    iterator begin() { return sat_iterator(planes.begin(), planes.begin()->begin()); }
+    iterator begin() { return iterator(planes.begin(), planes.end()); }
 
     /**
      * @brief Get an iterator to the end of the Shell.
-     * @return iterator An iterator pointing to one past the last Plane in the Shell.
+     *
+     * @return iterator An iterator pointing to one past the last Spacecraft in the Shell.
      */
-    iterator end() { return sat_iterator(planes.end(), planes.end()->end()); }
+    iterator end() { return iterator(planes.end(), planes.end()); }
 
     /**
      * @brief Get a const iterator to the beginning of the Shell.
-     * @return const_iterator A const iterator pointing to the first Plane in the Shell.
+     *
+     * @return const_iterator A const iterator pointing to the first Spacecraft in the Shell.
      */
-    const_iterator begin() const { return sat_iterator(planes.begin(), planes.begin()->begin()); }
+    const_iterator begin() const { return const_iterator(planes.begin(), planes.end()); }
 
     /**
      * @brief Get a const iterator to the end of the Shell.
-     * @return const_iterator A const iterator pointing to one past the last Plane in the Shell.
+     *
+     * @return const_iterator A const iterator pointing to one past the last Spacecraft in the Shell.
      */
-    const_iterator end() const { return sat_iterator(planes.end(), planes.end()->end()); }
+    const_iterator end() const { return const_iterator(planes.end(), planes.end()); }
 
     /**
      * @brief Get a const iterator to the beginning of the Shell.
-     * @return const_iterator A const iterator pointing to the first Plane in the Shell.
+     *
+     * @return const_iterator A const iterator pointing to the first Spacecraft in the Shell.
      */
-    const_iterator cbegin() const { return sat_iterator(planes.cbegin(), planes.cbegin()->cbegin()); }
+    const_iterator cbegin() const { return begin(); }
 
     /**
      * @brief Get a const iterator to the end of the Shell.
-     * @return const_iterator A const iterator pointing to one past the last Plane in the Shell.
-     */
-    const_iterator cend() const { return sat_iterator(planes.cend(), planes.cend()->cend()); }
-
-    /**
-     * @brief Iterator for iterating over all Spacecraft in the Shell.
+     *
+     * @return const_iterator A const iterator pointing to one past the last Spacecraft in the Shell.
      */
-    class sat_iterator {
-      private:
-        std::vector<Plane<Spacecraft_T>>::iterator iterPlane; // Iterator for the vector of planes
-        Plane<Spacecraft_T>::iterator iterSat;                // Iterator for the current plane's spacecraft
-
-      public:
-        /**
-         * @brief Default constructor for sat_iterator.
-         * Initializes the iterator to the beginning of the first plane's spacecraft.
-         */
-        sat_iterator(std::vector<Plane<Spacecraft_T>>::iterator _iterPlane, Plane<Spacecraft_T>::iterator _iterSat) :
-            iterPlane(_iterPlane),
-            iterSat(_iterSat)
-        {
-        } // TODO: Sanitize inputs
-
-        /**
-         * @brief Increment operator for the sat_iterator.
-         *
-         * @return sat_iterator& A reference to the incremented iterator.
-         */
-        sat_iterator& operator++()
-        {
-            ++iterSat;
-            if (iterSat == iterPlane->end()) {
-                ++iterPlane;
-                iterSat = iterPlane->begin();
-            }
-            return *this;
-        }
-
-        /**
-         * @brief Post-increment operator for the sat_iterator.
-         *
-         * @return sat_iterator A copy of the iterator before incrementing.
-         */
-        sat_iterator operator++(int)
-        {
-            sat_iterator retval = *this;
-            ++(*this);
-            return retval;
-        }
-
-        /**
-         * @brief Decrement operator for the sat_iterator.
-         *
-         * @return sat_iterator& A reference to the decremented iterator.
-         */
-        sat_iterator& operator--()
-        {
-            --iterSat;
-            if (iterSat < iterPlane->begin()) {
-                --iterPlane;
-                iterSat = iterPlane->end();
-            }
-            return *this;
-        }
-
-        /**
-         * @brief Post-decrement operator for the sat_iterator.
-         *
-         * @return sat_iterator A copy of the iterator before decrementing.
-         */
-        sat_iterator operator--(int)
-        {
-            sat_iterator retval = *this;
-            --(*this);
-            return retval;
-        }
-
-        /**
-         * @brief Comparison operators for the sat_iterator.
-         *
-         * @param other The other iterator to compare against.
-         * @return bool True if the iterators are equal, false otherwise.
-         */
-        bool operator==(const sat_iterator& other) const
-        {
-            return iterPlane == other.iterPlane && iterSat == other.iterSat;
-        }
-
-        /**
-         * @brief Inequality operator for the sat_iterator.
-         *
-         * @param other The other iterator to compare against.
-         * @return bool True if the iterators are not equal, false otherwise.
-         */
-        bool operator!=(const sat_iterator& other) const { return !(*this == other); }
-
-        /**
-         * @brief Less than operator for the sat_iterator.
-         *
-         * @param other The other iterator to compare against.
-         * @return true if this iterator is less than the other, false otherwise.
-         * @return false if this iterator is not less than the other.
-         */
-        bool operator<(const sat_iterator& other) const
-        {
-            return iterPlane < other.iterPlane || (iterPlane == other.iterPlane && iterSat < other.iterSat);
-        }
-
-        /**
-         * @brief Greater than operator for the sat_iterator.
-         *
-         * @param other The other iterator to compare against.
-         * @return true if this iterator is greater than the other, false otherwise.
-         * @return false if this iterator is not greater than the other.
-         */
-        bool operator>(const sat_iterator& other) const
-        {
-            return iterPlane > other.iterPlane || (iterPlane == other.iterPlane && iterSat > other.iterSat);
-        }
-
-        /**
-         * @brief Less than or equal to operator for the sat_iterator.
-         *
-         * @param other The other iterator to compare against.
-         * @return true if this iterator is less than or equal to the other, false otherwise.
-         * @return false if this iterator is not less than or equal to the other.
-         */
-        bool operator<=(const sat_iterator& other) const
-        {
-            return iterPlane < other.iterPlane || (iterPlane == other.iterPlane && iterSat <= other.iterSat);
-        }
-
-        /**
-         * @brief Greater than or equal to operator for the sat_iterator.
-         *
-         * @param other The other iterator to compare against.
-         * @return true if this iterator is greater than or equal to the other, false otherwise.
-         * @return false if this iterator is not greater than or equal to the other.
-         */
-        bool operator>=(const sat_iterator& other) const
-        {
-            return iterPlane > other.iterPlane || (iterPlane == other.iterPlane && iterSat >= other.iterSat);
-        }
-
-        /**
-         * @brief Dereference operator for the sat_iterator.
-         *
-         * @return Spacecraft_T& A reference to the spacecraft at the current iterator position.
-         */
-        Spacecraft_T operator*() { return *iterSat; }
-
-        // iterator traits
-        using difference_type = Plane<Spacecraft_T>::iterator;  // Use the iterator type of Plane as the difference type
-        using value_type      = Plane<Spacecraft_T>::iterator;  // Use the iterator type of Plane as the value type
-        using pointer   = const Plane<Spacecraft_T>::iterator*; // Use the iterator type of Plane as the pointer type
-        using reference = const Plane<Spacecraft_T>::iterator&; // Use the iterator type of Plane as the reference type
-        using iterator_category = std::forward_iterator_tag;    // Use forward iterator tag for the iterator category
-    };
+    const_iterator cend() const { return end(); }
 
     const std::size_t get_id() const { return id; }
 
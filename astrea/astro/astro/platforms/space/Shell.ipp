@@ -1,11 +1,12 @@
 #include <stdexcept>
+#include <utility>
 
 namespace astrea {
 namespace astro {
 
 template <class Spacecraft_T>
 Shell<Spacecraft_T>::Shell(std::vector<Plane<Spacecraft_T>> _planes) :
-    planes(_planes)
+    planes(std::move(_planes))
 {
     generate_id_hash();
 }
@@ -14,9 +15,7 @@ Shell<Spacecraft_T>::Shell(std::vector<Plane<Spacecraft_T>> _planes) :
 template <class Spacecraft_T>
 Shell<Spacecraft_T>::Shell(std::vector<Spacecraft_T> satellites)
 {
-    Plane<Spacecraft_T> noPlane(satellites);
-
-    planes.push_back(noPlane);
+    planes.emplace_back(std::move(satellites));
 
     generate_id_hash();
 }
@@ -126,18 +125,6 @@ std::vector<Plane<Spacecraft_T>>& Shell<Spacecraft_T>::get_planes()
     return planes;
 }
 
-template <class Spacecraft_T>
-const std::vector<Spacecraft_T> Shell<Spacecraft_T>::get_all_spacecraft() const
-{
-    std::vector<Spacecraft_T> allSpacecraft_T;
-    for (auto& plane : planes) {
-        const auto& shellSpacecraft_T = plane.get_all_spacecraft();
-        allSpacecraft_T.insert(allSpacecraft_T.end(), shellSpacecraft_T.begin(), shellSpacecraft_T.end());
-    }
-    return allSpacecraft_T;
-}
-
-
 template <class Spacecraft_T>
 const Plane<Spacecraft_T>& Shell<Spacecraft_T>::get_plane(const size_t& planeId) const
 {
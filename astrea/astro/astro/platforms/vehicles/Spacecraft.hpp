@@ -55,6 +55,26 @@ class Spacecraft : public ThrusterPlatform {
      */
     virtual ~Spacecraft() = default;
 
+    /**
+     * @brief Copy constructor for Spacecraft.
+     */
+    Spacecraft(const Spacecraft&) = default;
+
+    /**
+     * @brief Move constructor for Spacecraft.
+     */
+    Spacecraft(Spacecraft&&) = default;
+
+    /**
+     * @brief Copy assignment operator for Spacecraft.
+     */
+    Spacecraft& operator=(const Spacecraft&) = default;
+
+    /**
+     * @brief Move assignment operator for Spacecraft.
+     */
+    Spacecraft& operator=(Spacecraft&&) = default;
+
     /**
      * @brief Equality operator to compare two Spacecraft objects.
      *
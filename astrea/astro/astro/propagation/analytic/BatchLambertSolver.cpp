@@ -0,0 +1,440 @@
+#include <astro/propagation/analytic/BatchLambertSolver.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+
+#include <mp-units/systems/si.h>
+
+#include <utilities/parallel.hpp>
+
+#include <astro/state/State.hpp>
+#include <astro/state/frames/frames.hpp>
+#include <astro/state/orbital_elements/instances/Cartesian.hpp>
+#include <astro/systems/AstrodynamicsSystem.hpp>
+#include <astro/systems/CelestialBody.hpp>
+
+namespace astrea {
+namespace astro {
+
+using mp_units::si::unit_symbols::km;
+using mp_units::si::unit_symbols::s;
+
+namespace {
+
+using Vector3 = std::array<double, 3>;
+
+constexpr double PI = std::numbers::pi;
+
+// Householder iterations stop once x changes by less than this
+constexpr double DIRECT_TOLERANCE    = 1.0e-5;
+constexpr double MULTI_REV_TOLERANCE = 1.0e-8;
+constexpr std::size_t MAX_ITERATIONS = 15;
+
+// Halley iterations for the minimum time of flight of a multi-revolution transfer
+constexpr double MIN_TIME_TOLERANCE           = 1.0e-13;
+constexpr std::size_t MAX_MIN_TIME_ITERATIONS = 12;
+
+// Near x = 1 the Lancaster-Blanchard time of flight loses precision, so it is replaced by Lagrange's equation and
+// then by Battin's series
+constexpr double BATTIN_RANGE     = 0.01;
+constexpr double LAGRANGE_RANGE   = 0.2;
+constexpr double SERIES_TOLERANCE = 1.0e-11;
+
+Vector3 cross(const Vector3& a, const Vector3& b)
+{
+    return { a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0] };
+}
+
+double norm(const Vector3& a) { return std::sqrt(a[0] * a[0] + a[1] * a[1] + a[2] * a[2]); }
+
+Vector3 scale(const Vector3& a, const double& factor) { return { a[0] * factor, a[1] * factor, a[2] * factor }; }
+
+/**
+ * @brief Geometry of a Lambert problem in Izzo's nondimensional form.
+ */
+struct LambertGeometry {
+    double lambda; //!< Transfer angle parameter, sqrt(1 - c/s), negative for transfers longer than half a revolution
+    double time;   //!< Nondimensional time of flight
+    double gamma;  //!< Velocity scale, sqrt(mu s / 2)
+    double rho;    //!< (r0 - rf) / c
+    double sigma;  //!< sqrt(1 - rho^2)
+    double r0;     //!< Initial radius
+    double rf;     //!< Final radius
+    Vector3 ir0;   //!< Initial radial direction
+    Vector3 irf;   //!< Final radial direction
+    Vector3 it0;   //!< Initial transverse direction
+    Vector3 itf;   //!< Final transverse direction
+};
+
+/**
+ * @brief Gauss's hypergeometric function 2F1(3, 1, 5/2, z), used by Battin's series.
+ */
+double hypergeometric(const double& z)
+{
+    double sum  = 1.0;
+    double term = 1.0;
+    for (std::size_t jj = 0; std::abs(term) > SERIES_TOLERANCE; ++jj) {
+        term *= (3.0 + jj) * (1.0 + jj) / (2.5 + jj) * z / (jj + 1.0);
+        sum += term;
+    }
+    return sum;
+}
+
+/**
+ * @brief Nondimensional time of flight from Lagrange's equation.
+ */
+double get_lagrange_time(const double& x, const double& lambda, const unsigned& nRevolutions)
+{
+    const double a = 1.0 / (1.0 - x * x);
+    if (a > 0.0) {
+        const double alpha = 2.0 * std::acos(x);
+        double beta        = 2.0 * std::asin(std::sqrt(lambda * lambda / a));
+        if (lambda < 0.0) { beta = -beta; }
+        return a * std::sqrt(a) * ((alpha - std::sin(alpha)) - (beta - std::sin(beta)) + 2.0 * PI * nRevolutions) / 2.0;
+    }
+    const double alpha = 2.0 * std::acosh(x);
+    double beta        = 2.0 * std::asinh(std::sqrt(-lambda * lambda / a));
+    if (lambda < 0.0) { beta = -beta; }
+    return -a * std::sqrt(-a) * ((beta - std::sinh(beta)) - (alpha - std::sinh(alpha))) / 2.0;
+}
+
+/**
+ * @brief Nondimensional time of flight of the transfer with parameter x.
+ */
+double get_time(const double& x, const double& lambda, const unsigned& nRevolutions)
+{
+    const double distance = std::abs(x - 1.0);
+    if (distance < LAGRANGE_RANGE && distance > BATTIN_RANGE) { return get_lagrange_time(x, lambda, nRevolutions); }
+
+    const double energy = x * x - 1.0;
+    const double rho    = std::abs(energy);
+    const double z      = std::sqrt(1.0 + lambda * lambda * energy);
+    if (distance < BATTIN_RANGE) {
+        const double eta = z - lambda * x;
+        const double q   = 4.0 / 3.0 * hypergeometric(0.5 * (1.0 - lambda - x * eta));
+        return (eta * eta * eta * q + 4.0 * lambda * eta) / 2.0 + nRevolutions * PI / std::pow(rho, 1.5);
+    }
+
+    const double y = std::sqrt(rho);
+    const double g = x * z - lambda * energy;
+    double d;
+    if (energy < 0.0) { d = nRevolutions * PI + std::acos(g); }
+    else {
+        d = std::log(y * (z - lambda * x) + g);
+    }
+    return (x - lambda * z - d / y) / energy;
+}
+
+/**
+ * @brief First three derivatives of the time of flight with respect to x.
+ */
+std::array<double, 3> get_time_derivatives(const double& x, const double& time, const double& lambda)
+{
+    const double lambda2 = lambda * lambda;
+    const double lambda3 = lambda2 * lambda;
+    const double umx2    = 1.0 - x * x;
+    const double y       = std::sqrt(1.0 - lambda2 * umx2);
+    const double y2      = y * y;
+    const double y3      = y2 * y;
+
+    const double dT   = 1.0 / umx2 * (3.0 * time * x - 2.0 + 2.0 * lambda3 * x / y);
+    const double ddT  = 1.0 / umx2 * (3.0 * time + 5.0 * x * dT + 2.0 * (1.0 - lambda2) * lambda3 / y3);
+    const double dddT = 1.0 / umx2 * (7.0 * x * ddT + 8.0 * dT - 6.0 * (1.0 - lambda2) * lambda2 * lambda3 * x / y3 / y2);
+    return { dT, ddT, dddT };
+}
+
+/**
+ * @brief Solve for the x giving a time of flight with Householder's method.
+ */
+double solve_householder(const double& time, double x, const double& lambda, const unsigned& nRevolutions, const double& tolerance)
+{
+    for (std::size_t iteration = 0; iteration < MAX_ITERATIONS; ++iteration) {
+        const double guessTime     = get_time(x, lambda, nRevolutions);
+        const auto [dT, ddT, dddT] = get_time_derivatives(x, guessTime, lambda);
+        const double delta         = guessTime - time;
+        const double dT2           = dT * dT;
+        const double xNew  = x - delta * (dT2 - delta * ddT / 2.0) / (dT * (dT2 - delta * ddT) + dddT * delta * delta / 6.0);
+        const double error = std::abs(x - xNew);
+        x                  = xNew;
+        if (error <= tolerance) { break; }
+    }
+    return x;
+}
+
+/**
+ * @brief Build the nondimensional geometry of a problem.
+ *
+ * @return false If the problem is undefined, so has no solutions.
+ */
+bool build_geometry(const Vector3& r0, const Vector3& rf, const double& dt, const double& mu, const bool& isRetrograde, LambertGeometry& geometry)
+{
+    const Vector3 chordVector = { rf[0] - r0[0], rf[1] - r0[1], rf[2] - r0[2] };
+    const double c            = norm(chordVector);
+    geometry.r0               = norm(r0);
+    geometry.rf               = norm(rf);
+    if (dt <= 0.0 || geometry.r0 == 0.0 || geometry.rf == 0.0 || c == 0.0) { return false; }
+
+    const double semiperimeter = (geometry.r0 + geometry.rf + c) / 2.0;
+    geometry.ir0               = scale(r0, 1.0 / geometry.r0);
+    geometry.irf               = scale(rf, 1.0 / geometry.rf);
+
+    // The transfer plane is undefined when the positions are collinear
+    Vector3 ih          = cross(geometry.ir0, geometry.irf);
+    const double ihNorm = norm(ih);
+    if (ihNorm < std::numeric_limits<double>::epsilon()) { return false; }
+    ih = scale(ih, 1.0 / ihNorm);
+
+    // Transfers going the long way around have a negative lambda
+    geometry.lambda = std::sqrt(std::max(0.0, 1.0 - c / semiperimeter));
+    if (ih[2] < 0.0) {
+        geometry.lambda = -geometry.lambda;
+        geometry.it0    = cross(geometry.ir0, ih);
+        geometry.itf    = cross(geometry.irf, ih);
+    }
+    else {
+        geometry.it0 = cross(ih, geometry.ir0);
+        geometry.itf = cross(ih, geometry.irf);
+    }
+    if (isRetrograde) {
+        geometry.lambda = -geometry.lambda;
+        geometry.it0    = scale(geometry.it0, -1.0);
+        geometry.itf    = scale(geometry.itf, -1.0);
+    }
+
+    geometry.time  = std::sqrt(2.0 * mu / (semiperimeter * semiperimeter * semiperimeter)) * dt;
+    geometry.gamma = std::sqrt(mu * semiperimeter / 2.0);
+    geometry.rho   = (geometry.r0 - geometry.rf) / c;
+    geometry.sigma = std::sqrt(std::max(0.0, 1.0 - geometry.rho * geometry.rho));
+    return true;
+}
+
+/**
+ * @brief Find the most complete revolutions any transfer can make in the time of flight.
+ */
+unsigned get_max_revolutions(const LambertGeometry& geometry, const unsigned& maxRevolutions)
+{
+    const double lambda   = geometry.lambda;
+    const double time     = geometry.time;
+    unsigned nRevolutions = static_cast<unsigned>(std::min<double>(std::floor(time / PI), maxRevolutions));
+    if (nRevolutions == 0) { return 0; }
+
+    // Below the time of flight with x = 0, the fewest revolutions allowed depend on the minimum of the curve
+    const double time00 = std::acos(lambda) + lambda * std::sqrt(1.0 - lambda * lambda);
+    const double time0  = time00 + nRevolutions * PI;
+    if (time < time0) {
+        double x       = 0.0;
+        double minTime = time0;
+        for (std::size_t iteration = 0; iteration < MAX_MIN_TIME_ITERATIONS; ++iteration) {
+            const auto [dT, ddT, dddT] = get_time_derivatives(x, minTime, lambda);
+            if (dT == 0.0) { break; }
+            const double xNew  = x - dT * ddT / (ddT * ddT - dT * dddT / 2.0);
+            const double error = std::abs(x - xNew);
+            x                  = xNew;
+            minTime            = get_time(x, lambda, nRevolutions);
+            if (error < MIN_TIME_TOLERANCE) { break; }
+        }
+        if (minTime > time) { --nRevolutions; }
+    }
+    return nRevolutions;
+}
+
+/**
+ * @brief Solve a Lambert problem, passing each solution to a callback as it is found.
+ *
+ * @return false If the problem is undefined, so has no solutions.
+ */
+template <class Function_T>
+bool solve_izzo(
+    const Vector3& r0,
+    const Vector3& rf,
+    const double& dt,
+    const double& mu,
+    const bool& isRetrograde,
+    const unsigned& maxRevolutions,
+    Function_T&& function
+)
+{
+    LambertGeometry geometry;
+    if (!build_geometry(r0, rf, dt, mu, isRetrograde, geometry)) { return false; }
+
+    const double lambda  = geometry.lambda;
+    const double lambda2 = lambda * lambda;
+    const double time    = geometry.time;
+
+    const auto emit = [&](const double& x, const unsigned& nRevolutions, const bool& isLeftBranch) {
+        const double y   = std::sqrt(1.0 - lambda2 + lambda2 * x * x);
+        const double vr0 = geometry.gamma * ((lambda * y - x) - geometry.rho * (lambda * y + x)) / geometry.r0;
+        const double vrf = -geometry.gamma * ((lambda * y - x) + geometry.rho * (lambda * y + x)) / geometry.rf;
+        const double vt  = geometry.gamma * geometry.sigma * (y + lambda * x);
+        const double vt0 = vt / geometry.r0;
+        const double vtf = vt / geometry.rf;
+        const Vector3 v0 = { vr0 * geometry.ir0[0] + vt0 * geometry.it0[0],
+                             vr0 * geometry.ir0[1] + vt0 * geometry.it0[1],
+                             vr0 * geometry.ir0[2] + vt0 * geometry.it0[2] };
+        const Vector3 vf = { vrf * geometry.irf[0] + vtf * geometry.itf[0],
+                             vrf * geometry.irf[1] + vtf * geometry.itf[1],
+                             vrf * geometry.irf[2] + vtf * geometry.itf[2] };
+        function(v0, vf, nRevolutions, isLeftBranch);
+    };
+
+    // Direct transfer, starting from Izzo's guess for the region the time of flight falls in
+    const double time00 = std::acos(lambda) + lambda * std::sqrt(1.0 - lambda2);
+    const double time1  = 2.0 / 3.0 * (1.0 - lambda2 * lambda);
+    double x0;
+    if (time >= time00) { x0 = -(time - time00) / (time - time00 + 4.0); }
+    else if (time <= time1) { x0 = time1 * (time1 - time) / (2.0 / 5.0 * (1.0 - lambda2 * lambda2 * lambda) * time) + 1.0; }
+    else {
+        x0 = std::pow(time / time00, std::numbers::ln2 / std::log(time1 / time00)) - 1.0;
+    }
+    emit(solve_householder(time, x0, lambda, 0, DIRECT_TOLERANCE), 0, false);
+
+    // Both branches for each number of revolutions
+    const unsigned nRevolutions = get_max_revolutions(geometry, maxRevolutions);
+    for (unsigned ii = 1; ii <= nRevolutions; ++ii) {
+        const double left  = std::pow((ii * PI + PI) / (8.0 * time), 2.0 / 3.0);
+        const double right = std::pow((8.0 * time) / (ii * PI), 2.0 / 3.0);
+        emit(solve_householder(time, (left - 1.0) / (left + 1.0), lambda, ii, MULTI_REV_TOLERANCE), ii, true);
+        emit(solve_householder(time, (right - 1.0) / (right + 1.0), lambda, ii, MULTI_REV_TOLERANCE), ii, false);
+    }
+    return true;
+}
+
+Vector3 to_vector(const RadiusVector<ECI>& r)
+{
+    return { r[0].numerical_value_in(astrea::detail::distance_unit),
+             r[1].numerical_value_in(astrea::detail::distance_unit),
+             r[2].numerical_value_in(astrea::detail::distance_unit) };
+}
+
+VelocityVector<ECI> to_velocity(const Vector3& v) { return { v[0] * km / s, v[1] * km / s, v[2] * km / s }; }
+
+} // namespace
+
+
+std::vector<LambertSolution> BatchLambertSolver::solve(
+    const RadiusVector<ECI>& r0,
+    const RadiusVector<ECI>& rf,
+    const Time& dt,
+    const GravParam& mu,
+    const LambertSolver::OrbitDirection& direction,
+    const unsigned& maxRevolutions
+)
+{
+    std::vector<LambertSolution> solutions;
+    const bool isDefined = solve_izzo(
+        to_vector(r0),
+        to_vector(rf),
+        dt.numerical_value_in(astrea::detail::time_unit),
+        mu.numerical_value_in(mp_units::pow<3>(km) / mp_units::pow<2>(s)),
+        direction == LambertSolver::OrbitDirection::RETROGRADE,
+        maxRevolutions,
+        [&](const Vector3& v0, const Vector3& vf, const unsigned& nRevolutions, const bool& isLeftBranch) {
+            solutions.push_back({ to_velocity(v0), to_velocity(vf), nRevolutions, isLeftBranch });
+        }
+    );
+    if (!isDefined) {
+        throw std::runtime_error("BatchLambertSolver: Lambert's problem requires a positive time of flight and non-collinear positions");
+    }
+    return solutions;
+}
+
+std::vector<std::vector<LambertSolution>> BatchLambertSolver::solve(
+    std::span<const RadiusVector<ECI>> r0s,
+    std::span<const RadiusVector<ECI>> rfs,
+    std::span<const Time> dts,
+    const GravParam& mu,
+    const LambertSolver::OrbitDirection& direction,
+    const unsigned& maxRevolutions,
+    const std::size_t& nThreads
+)
+{
+    if (r0s.size() != rfs.size() || r0s.size() != dts.size()) {
+        throw std::runtime_error("BatchLambertSolver: Every problem requires an initial position, final position, and time of flight");
+    }
+
+    std::vector<std::vector<LambertSolution>> solutions(r0s.size());
+    utilities::parallel_for(r0s.size(), nThreads, [&](const std::size_t& ii) {
+        solutions[ii] = solve(r0s[ii], rfs[ii], dts[ii], mu, direction, maxRevolutions);
+    });
+    return solutions;
+}
+
+PorkchopPlot BatchLambertSolver::compute_porkchop(
+    const CelestialBody& departureBody,
+    const CelestialBody& arrivalBody,
+    std::span<const Date> departures,
+    std::span<const Date> arrivals,
+    const AstrodynamicsSystem& sys,
+    const LambertSolver::OrbitDirection& direction,
+    const unsigned& maxRevolutions,
+    const std::size_t& nThreads
+)
+{
+    const std::string& center = sys.get_center()->get_name();
+    if (departureBody.get_parent() != center || arrivalBody.get_parent() != center) {
+        throw std::runtime_error("BatchLambertSolver: Porkchop bodies must orbit the center of the system");
+    }
+
+    // Each body's state is needed once per date, not once per cell
+    using StateVector    = std::array<double, 6>;
+    const auto get_state = [&](const CelestialBody& body, const Date& date) -> StateVector {
+        const Cartesian state        = body.get_state_at(date).in_element_set<Cartesian>();
+        const Vector3 r              = to_vector(state.get_position());
+        const VelocityVector<ECI>& v = state.get_velocity();
+        return { r[0],
+                 r[1],
+                 r[2],
+                 v[0].numerical_value_in(astrea::detail::distance_unit / astrea::detail::time_unit),
+                 v[1].numerical_value_in(astrea::detail::distance_unit / astrea::detail::time_unit),
+                 v[2].numerical_value_in(astrea::detail::distance_unit / astrea::detail::time_unit) };
+    };
+    std::vector<StateVector> departureStates(departures.size());
+    std::vector<StateVector> arrivalStates(arrivals.size());
+    utilities::parallel_for(departures.size() + arrivals.size(), nThreads, [&](const std::size_t& ii) {
+        if (ii < departures.size()) { departureStates[ii] = get_state(departureBody, departures[ii]); }
+        else {
+            arrivalStates[ii - departures.size()] = get_state(arrivalBody, arrivals[ii - departures.size()]);
+        }
+    });
+
+    PorkchopPlot plot;
+    plot.departures.assign(departures.begin(), departures.end());
+    plot.arrivals.assign(arrivals.begin(), arrivals.end());
+    plot.cells.resize(departures.size() * arrivals.size());
+
+    const double mu         = sys.get_center()->get_mu().numerical_value_in(mp_units::pow<3>(km) / mp_units::pow<2>(s));
+    const bool isRetrograde = direction == LambertSolver::OrbitDirection::RETROGRADE;
+    utilities::parallel_for(departures.size(), nThreads, [&](const std::size_t& ii) {
+        const StateVector& departure = departureStates[ii];
+        const Vector3 r0             = { departure[0], departure[1], departure[2] };
+        for (std::size_t jj = 0; jj < arrivals.size(); ++jj) {
+            const StateVector& arrival = arrivalStates[jj];
+            const Vector3 rf           = { arrival[0], arrival[1], arrival[2] };
+            const double dt            = (arrivals[jj] - departures[ii]).numerical_value_in(astrea::detail::time_unit);
+
+            // Keep the transfer with the lowest total excess speed
+            double bestCost    = std::numeric_limits<double>::infinity();
+            PorkchopCell& cell = plot.cells[ii * arrivals.size() + jj];
+            solve_izzo(r0, rf, dt, mu, isRetrograde, maxRevolutions, [&](const Vector3& v0, const Vector3& vf, const unsigned& nRevolutions, const bool&) {
+                const double departureSpeed = norm({ v0[0] - departure[3], v0[1] - departure[4], v0[2] - departure[5] });
+                const double arrivalSpeed   = norm({ vf[0] - arrival[3], vf[1] - arrival[4], vf[2] - arrival[5] });
+                if (departureSpeed + arrivalSpeed < bestCost) {
+                    bestCost                  = departureSpeed + arrivalSpeed;
+                    cell.departureExcessSpeed = departureSpeed * km / s;
+                    cell.arrivalExcessSpeed   = arrivalSpeed * km / s;
+                    cell.nRevolutions         = nRevolutions;
+                    cell.isSolved             = true;
+                }
+            });
+        }
+    });
+    return plot;
+}
+
+} // namespace astro
+} // namespace astrea
@@ -0,0 +1,156 @@
+/**
+ * @file BatchLambertSolver.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief This file defines the BatchLambertSolver class, which solves large batches of Lambert problems and porkchop grids.
+ * @version 0.1
+ * @date 2025-08-03
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include <units/units.hpp>
+
+#include <astro/astro.fwd.hpp>
+#include <astro/propagation/analytic/LambertSolver.hpp>
+#include <astro/state/CartesianVector.hpp>
+#include <astro/time/Date.hpp>
+#include <astro/types/typedefs.hpp>
+
+namespace astrea {
+namespace astro {
+
+/**
+ * @brief Struct to hold one solution to Lambert's problem.
+ */
+struct LambertSolution {
+    VelocityVector<EarthCenteredInertial> v0; //!< Velocity at the initial position
+    VelocityVector<EarthCenteredInertial> vf; //!< Velocity at the final position
+    unsigned nRevolutions = 0;                //!< Number of complete revolutions made before arriving
+    bool isLeftBranch     = false; //!< For multi-revolution solutions, whether this is the left branch of the time of flight curve
+};
+
+/**
+ * @brief Struct to hold the lowest-cost transfer found for one departure and arrival date.
+ */
+struct PorkchopCell {
+    Velocity departureExcessSpeed; //!< Hyperbolic excess speed relative to the departure body
+    Velocity arrivalExcessSpeed;   //!< Hyperbolic excess speed relative to the arrival body
+    unsigned nRevolutions = 0;     //!< Number of complete revolutions made by the transfer
+    bool isSolved         = false; //!< Whether a transfer was found. False when the arrival is not after the departure.
+};
+
+/**
+ * @brief Struct to hold a grid of transfers between two bodies.
+ */
+struct PorkchopPlot {
+    std::vector<Date> departures;    //!< Departure dates, one per row
+    std::vector<Date> arrivals;      //!< Arrival dates, one per column
+    std::vector<PorkchopCell> cells; //!< Transfers by row, so cells[iDeparture * arrivals.size() + iArrival]
+};
+
+/**
+ * @brief Class for solving many Lambert problems at once.
+ *
+ * Problems are solved with Izzo's method, which iterates on a single variable with Householder's method from an
+ * initial guess that is already close for every time of flight, so each solve converges in two or three iterations.
+ * Multi-revolution transfers are solved on both branches of the time of flight curve.
+ *
+ * Izzo, D. "Revisiting Lambert's problem." Celestial Mechanics and Dynamical Astronomy 121 (2015): 1-15.
+ */
+class BatchLambertSolver {
+  public:
+    /**
+     * @brief Deleted constructor for BatchLambertSolver.
+     *
+     * This constructor is deleted to prevent instantiation of the BatchLambertSolver class.
+     */
+    BatchLambertSolver() = delete;
+
+    /**
+     * @brief Deleted destructor for BatchLambertSolver.
+     *
+     * This destructor is deleted to prevent destruction of the BatchLambertSolver class.
+     */
+    ~BatchLambertSolver() = delete;
+
+    /**
+     * @brief Solve Lambert's problem for every transfer up to a number of complete revolutions.
+     *
+     * @param r0 The initial position of the spacecraft.
+     * @param rf The final position of the spacecraft.
+     * @param dt The time of flight.
+     * @param mu The gravitational parameter of the central body.
+     * @param direction The direction of the orbit (prograde or retrograde).
+     * @param maxRevolutions The most complete revolutions to solve for.
+     * @return std::vector<LambertSolution> The direct transfer, followed by the left and right branch for each number of
+     * revolutions the time of flight allows.
+     * @throws std::runtime_error If the time of flight is not positive, or the positions are zero or collinear.
+     */
+    static std::vector<LambertSolution> solve(
+        const RadiusVector<EarthCenteredInertial>& r0,
+        const RadiusVector<EarthCenteredInertial>& rf,
+        const Time& dt,
+        const GravParam& mu,
+        const LambertSolver::OrbitDirection& direction = LambertSolver::OrbitDirection::PROGRADE,
+        const unsigned& maxRevolutions                 = 0
+    );
+
+    /**
+     * @brief Solve a batch of Lambert problems across threads.
+     *
+     * @param r0s The initial positions, one per problem.
+     * @param rfs The final positions, one per problem.
+     * @param dts The times of flight, one per problem.
+     * @param mu The gravitational parameter of the central body.
+     * @param direction The direction of the orbits (prograde or retrograde).
+     * @param maxRevolutions The most complete revolutions to solve for.
+     * @param nThreads The number of threads to use. Zero uses the hardware concurrency.
+     * @return std::vector<std::vector<LambertSolution>> The solutions to each problem, in the order of solve().
+     * @throws std::runtime_error If the inputs differ in length, or any problem is undefined.
+     */
+    static std::vector<std::vector<LambertSolution>> solve(
+        std::span<const RadiusVector<EarthCenteredInertial>> r0s,
+        std::span<const RadiusVector<EarthCenteredInertial>> rfs,
+        std::span<const Time> dts,
+        const GravParam& mu,
+        const LambertSolver::OrbitDirection& direction = LambertSolver::OrbitDirection::PROGRADE,
+        const unsigned& maxRevolutions                 = 0,
+        const std::size_t& nThreads                    = 0
+    );
+
+    /**
+     * @brief Solve the transfer between two bodies for every pair of departure and arrival dates.
+     *
+     * The state of each body is found once per date and shared across the grid. Each cell keeps the transfer with the
+     * lowest sum of departure and arrival excess speeds. Rows are split across threads.
+     *
+     * @param departureBody The body to depart from.
+     * @param arrivalBody The body to arrive at.
+     * @param departures The departure dates.
+     * @param arrivals The arrival dates.
+     * @param sys The astrodynamics system, centered on the body both bodies orbit.
+     * @param direction The direction of the transfers (prograde or retrograde).
+     * @param maxRevolutions The most complete revolutions to solve for.
+     * @param nThreads The number of threads to use. Zero uses the hardware concurrency.
+     * @return PorkchopPlot The lowest-cost transfer for each pair of dates.
+     * @throws std::runtime_error If either body does not orbit the center of the system.
+     */
+    static PorkchopPlot compute_porkchop(
+        const CelestialBody& departureBody,
+        const CelestialBody& arrivalBody,
+        std::span<const Date> departures,
+        std::span<const Date> arrivals,
+        const AstrodynamicsSystem& sys,
+        const LambertSolver::OrbitDirection& direction = LambertSolver::OrbitDirection::PROGRADE,
+        const unsigned& maxRevolutions                 = 0,
+        const std::size_t& nThreads                    = 0
+    );
+};
+
+} // namespace astro
+} // namespace astrea
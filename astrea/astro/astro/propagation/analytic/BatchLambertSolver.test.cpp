@@ -0,0 +1,180 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <math/test_util.hpp>
+#include <units/units.hpp>
+
+#include <astro/propagation/analytic/BatchLambertSolver.hpp>
+#include <astro/propagation/analytic/LambertSolver.hpp>
+#include <astro/state/CartesianVector.hpp>
+#include <astro/state/State.hpp>
+#include <astro/state/orbital_elements/instances/Cartesian.hpp>
+#include <astro/systems/AstrodynamicsSystem.hpp>
+#include <astro/time/Date.hpp>
+#include <tests/utilities/comparisons.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace mp_units;
+using mp_units::non_si::day;
+using mp_units::si::unit_symbols::km;
+using mp_units::si::unit_symbols::min;
+using mp_units::si::unit_symbols::s;
+
+class BatchLambertSolverTest : public testing::Test {
+  public:
+    BatchLambertSolverTest() {}
+
+    void SetUp() override {}
+
+    const Unitless REL_TOL = 1.0e-6;
+
+    AstrodynamicsSystem sys;
+
+    // Numbers from Vallado, 5th Ed., Ex. 7-5
+    RadiusVector<ECI> r0{ 15945.34 * km, 0.0 * km, 0.0 * km }, rf{ 12214.83899 * km, 10249.46731 * km, 0.0 * km };
+    VelocityVector<ECI> v0{ 2.058913 * km / s, 2.915964 * km / s }, vf{ -3.451565 * km / s, 0.910314 * km / s };
+    Time dt = 76.0 * min;
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(BatchLambertSolverTest, Solve)
+{
+    const std::vector<LambertSolution> solutions = BatchLambertSolver::solve(r0, rf, dt, sys.get_center()->get_mu());
+    ASSERT_EQ(solutions.size(), 1);
+    ASSERT_EQ(solutions[0].nRevolutions, 0);
+    ASSERT_EQ_CART_VEC(solutions[0].v0, v0, REL_TOL);
+    ASSERT_EQ_CART_VEC(solutions[0].vf, vf, REL_TOL);
+}
+
+TEST_F(BatchLambertSolverTest, MatchesLambertSolver)
+{
+    const GravParam mu = sys.get_center()->get_mu();
+    const std::vector<RadiusVector<ECI>> r0s = { { 7000.0 * km, 0.0 * km, 0.0 * km },
+                                                 { 7000.0 * km, 100.0 * km, 2000.0 * km },
+                                                 { 42164.0 * km, 0.0 * km, 0.0 * km } };
+    const std::vector<RadiusVector<ECI>> rfs = { { -20000.0 * km, 30000.0 * km, 5000.0 * km },
+                                                 { 0.0 * km, 42164.0 * km, 0.0 * km },
+                                                 { -30000.0 * km, -30000.0 * km, 1000.0 * km } };
+    const std::vector<Time> dts = { 20000.0 * s, 19000.0 * s, 40000.0 * s };
+
+    for (std::size_t ii = 0; ii < r0s.size(); ++ii) {
+        for (const auto& direction : { LambertSolver::OrbitDirection::PROGRADE, LambertSolver::OrbitDirection::RETROGRADE }) {
+            const auto [expected0, expectedf] = LambertSolver::solve(r0s[ii], rfs[ii], dts[ii], mu, direction);
+            const std::vector<LambertSolution> solutions = BatchLambertSolver::solve(r0s[ii], rfs[ii], dts[ii], mu, direction);
+            ASSERT_EQ(solutions.size(), 1);
+            ASSERT_EQ_CART_VEC(solutions[0].v0, expected0, REL_TOL);
+            ASSERT_EQ_CART_VEC(solutions[0].vf, expectedf, REL_TOL);
+        }
+    }
+}
+
+TEST_F(BatchLambertSolverTest, MultiRevolution)
+{
+    // Long enough for five revolutions of a LEO orbit, so both branches exist for one and two revolutions
+    const GravParam mu = sys.get_center()->get_mu();
+    const RadiusVector<ECI> start{ 7000.0 * km, 0.0 * km, 0.0 * km };
+    const RadiusVector<ECI> end{ 0.0 * km, 8000.0 * km, 1000.0 * km };
+    const Time tof = 30000.0 * s;
+
+    const std::vector<LambertSolution> solutions =
+        BatchLambertSolver::solve(start, end, tof, mu, LambertSolver::OrbitDirection::PROGRADE, 2);
+    ASSERT_EQ(solutions.size(), 5);
+    for (std::size_t ii = 0; ii < solutions.size(); ++ii) {
+        ASSERT_EQ(solutions[ii].nRevolutions, (ii + 1) / 2);
+        ASSERT_EQ(solutions[ii].isLeftBranch, ii % 2 == 1);
+
+        // Each arrives at the final position
+        const Cartesian arrival = LambertSolver::solve({ start, solutions[ii].v0 }, tof, mu);
+        ASSERT_EQ_CART_VEC(arrival.get_position(), end, REL_TOL);
+        ASSERT_EQ_CART_VEC(arrival.get_velocity(), solutions[ii].vf, REL_TOL);
+    }
+}
+
+TEST_F(BatchLambertSolverTest, InvalidInputs)
+{
+    const GravParam mu = sys.get_center()->get_mu();
+    ASSERT_ANY_THROW(BatchLambertSolver::solve(r0, rf, 0.0 * s, mu));
+    ASSERT_ANY_THROW(BatchLambertSolver::solve(r0, r0, dt, mu));
+
+    const std::vector<RadiusVector<ECI>> r0s = { r0, r0 };
+    const std::vector<RadiusVector<ECI>> rfs = { rf };
+    const std::vector<Time> dts              = { dt, dt };
+    ASSERT_ANY_THROW(BatchLambertSolver::solve(r0s, rfs, dts, mu));
+}
+
+TEST_F(BatchLambertSolverTest, SolveBatch)
+{
+    const GravParam mu = sys.get_center()->get_mu();
+    std::vector<RadiusVector<ECI>> r0s;
+    std::vector<RadiusVector<ECI>> rfs;
+    std::vector<Time> dts;
+    for (std::size_t ii = 0; ii < 100; ++ii) {
+        r0s.push_back(r0);
+        rfs.push_back(rf);
+        dts.push_back(dt + ii * 10.0 * min);
+    }
+
+    const auto serial   = BatchLambertSolver::solve(r0s, rfs, dts, mu, LambertSolver::OrbitDirection::PROGRADE, 1, 1);
+    const auto parallel = BatchLambertSolver::solve(r0s, rfs, dts, mu, LambertSolver::OrbitDirection::PROGRADE, 1, 4);
+    ASSERT_EQ(serial.size(), r0s.size());
+    ASSERT_EQ(parallel.size(), r0s.size());
+    for (std::size_t ii = 0; ii < r0s.size(); ++ii) {
+        const std::vector<LambertSolution> expected = BatchLambertSolver::solve(r0s[ii], rfs[ii], dts[ii], mu, LambertSolver::OrbitDirection::PROGRADE, 1);
+        ASSERT_EQ(serial[ii].size(), expected.size());
+        ASSERT_EQ(parallel[ii].size(), expected.size());
+        for (std::size_t jj = 0; jj < expected.size(); ++jj) {
+            ASSERT_EQ_CART_VEC(serial[ii][jj].v0, expected[jj].v0, REL_TOL);
+            ASSERT_EQ_CART_VEC(parallel[ii][jj].v0, expected[jj].v0, REL_TOL);
+        }
+    }
+}
+
+TEST_F(BatchLambertSolverTest, Porkchop)
+{
+    AstrodynamicsSystem solarSys("Sun", { "Earth", "Mars" });
+    const CelestialBody& earth = *solarSys.get("Earth");
+    const CelestialBody& mars  = *solarSys.get("Mars");
+
+    const Date launch("2026-11-01 00:00:00");
+    const std::vector<Date> departures = { launch, launch + 10.0 * day, launch + 20.0 * day };
+    const std::vector<Date> arrivals   = { launch + 15.0 * day, launch + 200.0 * day, launch + 300.0 * day };
+
+    const PorkchopPlot plot = BatchLambertSolver::compute_porkchop(earth, mars, departures, arrivals, solarSys);
+    ASSERT_EQ(plot.departures.size(), departures.size());
+    ASSERT_EQ(plot.arrivals.size(), arrivals.size());
+    ASSERT_EQ(plot.cells.size(), departures.size() * arrivals.size());
+
+    const GravParam mu = solarSys.get_center()->get_mu();
+    for (std::size_t ii = 0; ii < departures.size(); ++ii) {
+        for (std::size_t jj = 0; jj < arrivals.size(); ++jj) {
+            const PorkchopCell& cell = plot.cells[ii * arrivals.size() + jj];
+            if (arrivals[jj] <= departures[ii]) {
+                ASSERT_FALSE(cell.isSolved);
+                continue;
+            }
+            ASSERT_TRUE(cell.isSolved);
+
+            // Each cell is the direct transfer between the bodies' states
+            const Cartesian departure = earth.get_state_at(departures[ii]).in_element_set<Cartesian>();
+            const Cartesian arrival   = mars.get_state_at(arrivals[jj]).in_element_set<Cartesian>();
+            const std::vector<LambertSolution> solutions =
+                BatchLambertSolver::solve(departure.get_position(), arrival.get_position(), arrivals[jj] - departures[ii], mu);
+            const VelocityVector<ECI> departureExcess = solutions[0].v0 - departure.get_velocity();
+            const VelocityVector<ECI> arrivalExcess   = solutions[0].vf - arrival.get_velocity();
+            ASSERT_EQ_QUANTITY(cell.departureExcessSpeed, departureExcess.norm(), REL_TOL);
+            ASSERT_EQ_QUANTITY(cell.arrivalExcessSpeed, arrivalExcess.norm(), REL_TOL);
+        }
+    }
+
+    // The Sun does not orbit itself
+    ASSERT_ANY_THROW(BatchLambertSolver::compute_porkchop(*solarSys.get("Sun"), mars, departures, arrivals, solarSys));
+}
@@ -56,8 +56,7 @@ class EquinoctialVop : public EquationsOfMotion {
     constexpr std::size_t get_expected_set_id() const override { return OrbitalElements::get_set_id<Equinoctial>(); };
 
   private:
-    mutable bool checkflag = false;                 //!< Flag to check for degenerate conditions.
-    Unitless checkTol      = 1e-10 * mp_units::one; //!< Tolerance for checking conditions.
+    Unitless checkTol = 1e-10 * mp_units::one; //!< Tolerance for checking conditions.
 
     const ForceModel* forces; //!< The force model used in the equations of motion.
 
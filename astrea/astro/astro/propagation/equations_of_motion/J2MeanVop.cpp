@@ -92,10 +92,7 @@ OrbitalElementPartials J2MeanVop::operator()(const OrbitalElements& state, const
     // Loop to prevent crashes due to circular and zero inclination orbits.
     // Will cause an error
     AngularRate dincdt = _dincdt;
-    if (inc == incTol && dincdt <= incTol * one / s) {
-        dincdt    = 0.0 * rad / s;
-        checkflag = true;
-    }
+    if (inc == incTol && dincdt <= incTol * one / s) { dincdt = 0.0 * rad / s; }
 
     return KeplerianPartial(dadt, deccdt, dincdt, draandt, dwdt, dthetadt);
 }
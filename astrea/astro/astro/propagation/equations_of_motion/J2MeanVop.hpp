@@ -55,9 +55,8 @@ class J2MeanVop : public EquationsOfMotion {
     constexpr std::size_t get_expected_set_id() const override { return OrbitalElements::get_set_id<Keplerian>(); };
 
   private:
-    mutable bool checkflag = false;                                        //!< Flag to check for degenerate conditions.
-    Unitless eccTol        = 1e-10 * mp_units::one;                        //!< Tolerance for checking eccentricity.
-    Angle incTol           = 1e-10 * mp_units::angular::unit_symbols::rad; //!< Tolerance for checking inclination.
+    Unitless eccTol = 1e-10 * mp_units::one;                        //!< Tolerance for checking eccentricity.
+    Angle incTol    = 1e-10 * mp_units::angular::unit_symbols::rad; //!< Tolerance for checking inclination.
 
     GravParam mu;         //!< Gravitational parameter of the central body.
     Unitless J2;          //!< J2 coefficient of the central body.
@@ -44,12 +44,10 @@ void OblatenessForce::size_vectors(const std::size_t& N, const std::size_t& M)
 {
     C.resize(N + 1);
     S.resize(N + 1);
-    P.resize(N + 1);
     normalizingCoefficients.resize(N + 1);
     for (std::size_t n = 0; n < N + 1; ++n) {
         C[n].resize(M + 1);
         S[n].resize(M + 1);
-        P[n].resize(M + 1);
         normalizingCoefficients[n].resize(M + 1);
     }
 }
@@ -143,8 +141,10 @@ AccelerationVector<ECI>
     const Unitless sinLat = sin(latitude);
     const Unitless tanLat = tan(latitude);
 
-    // Populate Legendre polynomial array
-    assign_legendre(sinLat);
+    // Populate Legendre polynomial array. The table is scratch kept per thread, so one force can be evaluated from many
+    // threads at once without reallocating it on every call.
+    thread_local std::vector<std::vector<Unitless>> P;
+    assign_legendre(sinLat, P);
 
     // Calculate serivative of gravitational potential field with respect to
     Unitless dVdr_   = 0.0 * one; // radius
@@ -213,9 +213,11 @@ AccelerationVector<ECI>
     return accelOblatenessEcef.in_frame<ECI>(date);
 }
 
-void OblatenessForce::assign_legendre(const Unitless& x) const
+void OblatenessForce::assign_legendre(const Unitless& x, std::vector<std::vector<Unitless>>& P) const
 {
+    P.resize(N + 1);
     for (std::size_t n = 0; n < N + 1; ++n) {
+        P[n].resize(M + 1);
         for (std::size_t m = 0; m < M + 1; ++m) {
             P[n][m] = normalizingCoefficients[n][m] * math::assoc_legendre(n, m, x);
         }
@@ -58,10 +58,9 @@ class OblatenessForce : public Force {
     void set_oblateness_coefficients(const std::size_t& N, const std::size_t& M, const AstrodynamicsSystem& sys);
 
   private:
-    mutable std::vector<std::vector<Unitless>> P{};                       // !< Legendre polynomial coefficients
-    mutable std::vector<std::vector<Unitless>> normalizingCoefficients{}; //!< Normalizing coefficients for the Legendre polynomials
-    mutable std::vector<std::vector<Unitless>> C{}; //!< Cosine coefficients for the spherical harmonics
-    mutable std::vector<std::vector<Unitless>> S{}; //!< Sine coefficients for the spherical harmonics
+    std::vector<std::vector<Unitless>> normalizingCoefficients{}; //!< Normalizing coefficients for the Legendre polynomials
+    std::vector<std::vector<Unitless>> C{};                       //!< Cosine coefficients for the spherical harmonics
+    std::vector<std::vector<Unitless>> S{};                       //!< Sine coefficients for the spherical harmonics
 
     const std::size_t N;                          //!< Degree of the spherical harmonics
     const std::size_t M;                          //!< Order of the spherical harmonics
@@ -70,8 +69,9 @@ class OblatenessForce : public Force {
     /**
      * @brief Computes the Legendre polynomial coefficients for the oblateness force.
      * @param x Value at which to evaluate the Legendre polynomial
+     * @param P Table to fill with the normalized Legendre polynomials, resized to the degree and order
      */
-    void assign_legendre(const Unitless& x) const;
+    void assign_legendre(const Unitless& x, std::vector<std::vector<Unitless>>& P) const;
 
     /**
      * @brief Sets the size of the vectors used for storing oblateness coefficients.
@@ -0,0 +1,244 @@
+#include <astro/propagation/numerical/MonteCarloPropagator.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <mp-units/systems/si.h>
+
+#include <utilities/parallel.hpp>
+
+#include <astro/platforms/Vehicle.hpp>
+#include <astro/platforms/vehicles/Spacecraft.hpp>
+#include <astro/propagation/equations_of_motion/EquationsOfMotion.hpp>
+#include <astro/state/State.hpp>
+#include <astro/state/StateHistory.hpp>
+#include <astro/systems/AstrodynamicsSystem.hpp>
+
+namespace astrea {
+namespace astro {
+
+using mp_units::si::unit_symbols::km;
+using mp_units::si::unit_symbols::s;
+
+namespace {
+
+using StateVector = std::array<double, 6>;
+using Covariance  = std::array<std::array<double, 6>, 6>;
+
+/**
+ * @brief Running mean and covariance of the states at one epoch, accumulated with Welford's method.
+ */
+struct RunningMoments {
+    std::size_t count  = 0;  //!< Number of states added
+    StateVector mean   = {}; //!< Mean of the states added
+    Covariance moments = {}; //!< Sum of the outer products of the deviations from the mean
+
+    /**
+     * @brief Add a state.
+     */
+    void add(const StateVector& state)
+    {
+        ++count;
+        StateVector delta;
+        for (std::size_t ii = 0; ii < 6; ++ii) {
+            delta[ii] = state[ii] - mean[ii];
+            mean[ii] += delta[ii] / count;
+        }
+        for (std::size_t ii = 0; ii < 6; ++ii) {
+            for (std::size_t jj = 0; jj < 6; ++jj) {
+                moments[ii][jj] += delta[ii] * (state[jj] - mean[jj]);
+            }
+        }
+    }
+
+    /**
+     * @brief Merge the states added to another accumulator, with Chan's method.
+     */
+    void merge(const RunningMoments& other)
+    {
+        if (other.count == 0) { return; }
+        const std::size_t total = count + other.count;
+        const double weight     = static_cast<double>(count) * other.count / total;
+        StateVector delta;
+        for (std::size_t ii = 0; ii < 6; ++ii) {
+            delta[ii] = other.mean[ii] - mean[ii];
+        }
+        for (std::size_t ii = 0; ii < 6; ++ii) {
+            for (std::size_t jj = 0; jj < 6; ++jj) {
+                moments[ii][jj] += other.moments[ii][jj] + delta[ii] * delta[jj] * weight;
+            }
+            mean[ii] += delta[ii] * other.count / total;
+        }
+        count = total;
+    }
+};
+
+StateVector to_vector(const Cartesian& state)
+{
+    const RadiusVector<ECI>& r   = state.get_position();
+    const VelocityVector<ECI>& v = state.get_velocity();
+    return { r[0].numerical_value_in(km),     r[1].numerical_value_in(km),     r[2].numerical_value_in(km),
+             v[0].numerical_value_in(km / s), v[1].numerical_value_in(km / s), v[2].numerical_value_in(km / s) };
+}
+
+Cartesian to_cartesian(const StateVector& state)
+{
+    return Cartesian(
+        RadiusVector<ECI>{ state[0] * km, state[1] * km, state[2] * km },
+        VelocityVector<ECI>{ state[3] * km / s, state[4] * km / s, state[5] * km / s }
+    );
+}
+
+/**
+ * @brief Find a percentile of a set of values, interpolating between the closest ranks. Reorders the values.
+ */
+double get_percentile(std::span<double> values, const double& percentile)
+{
+    const double rank       = percentile / 100.0 * (values.size() - 1);
+    const std::size_t lower = static_cast<std::size_t>(rank);
+    std::nth_element(values.begin(), values.begin() + lower, values.end());
+    const double lowerValue = values[lower];
+    if (lower + 1 >= values.size()) { return lowerValue; }
+
+    // nth_element leaves every larger value after the lower rank
+    const double upperValue = *std::min_element(values.begin() + lower + 1, values.end());
+    return lowerValue + (rank - lower) * (upperValue - lowerValue);
+}
+
+} // namespace
+
+
+MonteCarloPropagator::MonteCarloPropagator(const Integrator& integrator, const EquationsOfMotion& eom) :
+    _integrator(integrator),
+    _eom(&eom)
+{
+}
+
+void MonteCarloPropagator::set_seed(const std::uint64_t& seed) { _seed = seed; }
+
+void MonteCarloPropagator::set_percentiles(const std::vector<double>& percentiles)
+{
+    for (const double& percentile : percentiles) {
+        if (percentile < 0.0 || percentile > 100.0) { throw std::runtime_error("Percentiles must be between 0 and 100."); }
+    }
+    _percentiles = percentiles;
+}
+
+std::vector<MonteCarloStatistics> MonteCarloPropagator::propagate(
+    const Spacecraft& spacecraft,
+    const Dispersions& dispersions,
+    std::span<const Date> epochs,
+    const std::size_t& nSamples,
+    const std::size_t& nThreads
+) const
+{
+    if (nSamples == 0) { throw std::runtime_error("Monte Carlo propagation requires at least one sample."); }
+
+    const State& state0 = spacecraft.get_initial_state();
+    for (std::size_t ii = 0; ii < epochs.size(); ++ii) {
+        if (epochs[ii] < state0.get_epoch() || (ii > 0 && epochs[ii] < epochs[ii - 1])) {
+            throw std::runtime_error("Monte Carlo output epochs must be in increasing order and not before the initial state.");
+        }
+    }
+    const AstrodynamicsSystem& sys = state0.get_system();
+    const Cartesian cartesian0     = state0.in_element_set<Cartesian>();
+
+    // Samples only need the physical properties, not the state history. The nominal starts from the same Cartesian state
+    // as the samples so it matches them exactly when there are no dispersions.
+    Spacecraft base(State(cartesian0, state0.get_epoch(), sys));
+    base.set_name(spacecraft.get_name());
+    base.set_mass(spacecraft.get_mass());
+    base.set_coefficient_of_drag(spacecraft.get_coefficient_of_drag());
+    base.set_coefficient_of_lift(spacecraft.get_coefficient_of_lift());
+    base.set_coefficient_of_reflectivity(spacecraft.get_coefficient_of_reflectivity());
+    base.set_ram_area(spacecraft.get_ram_area());
+    base.set_solar_area(spacecraft.get_solar_area());
+    base.set_lift_area(spacecraft.get_lift_area());
+
+    // Step a vehicle through each output epoch. A fresh integrator keeps the step size of one sample from leaking into
+    // the next.
+    const auto run = [&](Vehicle& vehicle, auto&& function) {
+        Integrator integrator = _integrator;
+        for (std::size_t ii = 0; ii < epochs.size(); ++ii) {
+            if (epochs[ii] != vehicle.get_state().get_epoch()) { integrator.propagate(epochs[ii], *_eom, vehicle); }
+            function(ii, to_vector(vehicle.get_state().in_element_set<Cartesian>()));
+        }
+    };
+
+    std::vector<StateVector> nominal(epochs.size());
+    Vehicle nominalVehicle(base);
+    run(nominalVehicle, [&](const std::size_t& ii, const StateVector& state) { nominal[ii] = state; });
+
+    // Each block accumulates its own moments, and distances are written to disjoint slots, so threads share nothing
+    const std::size_t nBlocks = utilities::get_worker_count(nSamples, nThreads);
+    std::vector<std::vector<RunningMoments>> moments(nBlocks, std::vector<RunningMoments>(epochs.size()));
+    std::vector<double> distances(epochs.size() * nSamples);
+    utilities::parallel_for(nBlocks, nBlocks, [&](const std::size_t& block) {
+        Vehicle vehicle(base);
+        Spacecraft& sample = *static_cast<Spacecraft*>(vehicle.get_ptr());
+        for (std::size_t ii = block * nSamples / nBlocks; ii < (block + 1) * nSamples / nBlocks; ++ii) {
+            // Seeded by sample, so the draws do not depend on which thread runs it
+            std::seed_seq seeds{ static_cast<std::uint32_t>(_seed),
+                                 static_cast<std::uint32_t>(_seed >> 32),
+                                 static_cast<std::uint32_t>(ii),
+                                 static_cast<std::uint32_t>(static_cast<std::uint64_t>(ii) >> 32) };
+            std::mt19937_64 generator(seeds);
+            std::normal_distribution<double> normal(0.0, 1.0);
+
+            const RadiusVector<ECI>& r0   = cartesian0.get_position();
+            const VelocityVector<ECI>& v0 = cartesian0.get_velocity();
+            const RadiusVector<ECI> r{ r0[0] + normal(generator) * dispersions.positionSigma,
+                                       r0[1] + normal(generator) * dispersions.positionSigma,
+                                       r0[2] + normal(generator) * dispersions.positionSigma };
+            const VelocityVector<ECI> v{ v0[0] + normal(generator) * dispersions.velocitySigma,
+                                         v0[1] + normal(generator) * dispersions.velocitySigma,
+                                         v0[2] + normal(generator) * dispersions.velocitySigma };
+            sample.set_mass(base.get_mass() + normal(generator) * dispersions.massSigma);
+            sample.set_coefficient_of_drag(base.get_coefficient_of_drag() + normal(generator) * dispersions.coefficientOfDragSigma);
+            sample.set_coefficient_of_reflectivity(
+                base.get_coefficient_of_reflectivity() + normal(generator) * dispersions.coefficientOfReflectivitySigma
+            );
+            sample.update_state(State(Cartesian(r, v), state0.get_epoch(), sys));
+
+            run(vehicle, [&](const std::size_t& jj, const StateVector& state) {
+                moments[block][jj].add(state);
+                distances[jj * nSamples + ii] =
+                    std::hypot(state[0] - nominal[jj][0], state[1] - nominal[jj][1], state[2] - nominal[jj][2]);
+            });
+        }
+    });
+
+    std::vector<MonteCarloStatistics> statistics(epochs.size());
+    for (std::size_t ii = 0; ii < epochs.size(); ++ii) {
+        RunningMoments total;
+        for (std::size_t block = 0; block < nBlocks; ++block) {
+            total.merge(moments[block][ii]);
+        }
+
+        MonteCarloStatistics& stats = statistics[ii];
+        stats.epoch                 = epochs[ii];
+        stats.nominal               = to_cartesian(nominal[ii]);
+        stats.mean                  = to_cartesian(total.mean);
+        stats.covariance            = {};
+        if (total.count > 1) {
+            for (std::size_t jj = 0; jj < 6; ++jj) {
+                for (std::size_t kk = 0; kk < 6; ++kk) {
+                    stats.covariance[jj][kk] = total.moments[jj][kk] / (total.count - 1);
+                }
+            }
+        }
+
+        const std::span<double> epochDistances(distances.data() + ii * nSamples, nSamples);
+        for (const double& percentile : _percentiles) {
+            stats.positionErrorPercentiles.push_back(get_percentile(epochDistances, percentile) * km);
+        }
+    }
+    return statistics;
+}
+
+} // namespace astro
+} // namespace astrea
@@ -0,0 +1,118 @@
+/**
+ * @file MonteCarloPropagator.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief Propagates dispersed copies of a spacecraft across threads and reduces their statistics
+ * @version 0.1
+ * @date 2025-08-02
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <units/units.hpp>
+
+#include <astro/astro.fwd.hpp>
+#include <astro/propagation/numerical/Integrator.hpp>
+#include <astro/state/orbital_elements/instances/Cartesian.hpp>
+#include <astro/time/Date.hpp>
+#include <astro/types/typedefs.hpp>
+
+namespace astrea {
+namespace astro {
+
+/**
+ * @brief Struct to hold the 1-sigma dispersions applied to each sample. Every dispersion is Gaussian and zero-mean.
+ */
+struct Dispersions {
+    Distance positionSigma                  = 0.0 * mp_units::si::unit_symbols::km; //!< Each Cartesian position component
+    Velocity velocitySigma                  = 0.0 * mp_units::si::unit_symbols::km / mp_units::si::unit_symbols::s; //!< Each Cartesian velocity component
+    Mass massSigma                          = 0.0 * mp_units::si::unit_symbols::kg; //!< Spacecraft mass
+    Unitless coefficientOfDragSigma         = 0.0 * mp_units::one;                  //!< Coefficient of drag
+    Unitless coefficientOfReflectivitySigma = 0.0 * mp_units::one;                  //!< Coefficient of reflectivity
+};
+
+/**
+ * @brief Struct to hold the statistics of the samples at one output epoch.
+ */
+struct MonteCarloStatistics {
+    Date epoch;                                      //!< Output epoch
+    Cartesian nominal;                               //!< State of the undispersed spacecraft
+    Cartesian mean;                                  //!< Mean state of the samples
+    std::array<std::array<double, 6>, 6> covariance; //!< Sample covariance of the Cartesian state, in km and km/s
+    std::vector<Distance> positionErrorPercentiles;  //!< Percentiles of the distance from the nominal, in the order requested
+};
+
+/**
+ * @brief Class for propagating dispersed copies of a spacecraft.
+ *
+ * Each sample draws its dispersions from a generator seeded by the seed and its index, so results do not depend on the
+ * number of threads. Samples are split across threads. Each thread reuses one vehicle for all of its samples, while the
+ * equations of motion, and any force model they hold, are shared read-only, so their evaluation must not modify them.
+ *
+ * Statistics are reduced as the samples finish instead of storing state histories: the mean and covariance are
+ * accumulated per thread and merged, and only the distance from the nominal is kept per sample for the percentiles.
+ */
+class MonteCarloPropagator {
+  public:
+    /**
+     * @brief Construct a MonteCarloPropagator.
+     *
+     * @param integrator The integrator to copy for each sample, with its tolerances and step method.
+     * @param eom The equations of motion shared by every sample.
+     */
+    MonteCarloPropagator(const Integrator& integrator, const EquationsOfMotion& eom);
+
+    /**
+     * @brief Default destructor for MonteCarloPropagator.
+     */
+    ~MonteCarloPropagator() = default;
+
+    /**
+     * @brief Set the seed the samples are drawn from.
+     *
+     * @param seed The seed.
+     */
+    void set_seed(const std::uint64_t& seed);
+
+    /**
+     * @brief Set the percentiles of the distance from the nominal to report.
+     *
+     * @param percentiles The percentiles, each between 0 and 100.
+     * @throws std::runtime_error If any percentile is outside of 0 to 100.
+     */
+    void set_percentiles(const std::vector<double>& percentiles);
+
+    /**
+     * @brief Propagate dispersed copies of a spacecraft from its initial state.
+     *
+     * @param spacecraft The spacecraft to disperse.
+     * @param dispersions The dispersions to apply to each sample.
+     * @param epochs The epochs to report statistics at, in increasing order and not before the initial state.
+     * @param nSamples The number of samples.
+     * @param nThreads The number of threads to use. Zero uses the hardware concurrency.
+     * @return std::vector<MonteCarloStatistics> The statistics at each epoch.
+     * @throws std::runtime_error If there are no samples, or the epochs are out of order or before the initial state.
+     */
+    std::vector<MonteCarloStatistics> propagate(
+        const Spacecraft& spacecraft,
+        const Dispersions& dispersions,
+        std::span<const Date> epochs,
+        const std::size_t& nSamples,
+        const std::size_t& nThreads = 0
+    ) const;
+
+  private:
+    Integrator _integrator;                                  //!< Integrator copied for each sample
+    const EquationsOfMotion* _eom;                           //!< Equations of motion shared by every sample
+    std::uint64_t _seed              = 0;                    //!< Seed the samples are drawn from
+    std::vector<double> _percentiles = { 50.0, 95.0, 99.0 }; //!< Percentiles of the distance from the nominal to report
+};
+
+} // namespace astro
+} // namespace astrea
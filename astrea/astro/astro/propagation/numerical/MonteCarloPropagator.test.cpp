@@ -0,0 +1,202 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <math/test_util.hpp>
+#include <units/units.hpp>
+
+#include <astro/platforms/vehicles/Spacecraft.hpp>
+#include <astro/propagation/equations_of_motion/CowellsMethod.hpp>
+#include <astro/propagation/equations_of_motion/TwoBody.hpp>
+#include <astro/propagation/force_models/ForceModel.hpp>
+#include <astro/propagation/force_models/OblatenessForce.hpp>
+#include <astro/propagation/numerical/Integrator.hpp>
+#include <astro/propagation/numerical/MonteCarloPropagator.hpp>
+#include <astro/state/State.hpp>
+#include <astro/state/orbital_elements/instances/Cartesian.hpp>
+#include <astro/state/orbital_elements/instances/Keplerian.hpp>
+#include <astro/systems/AstrodynamicsSystem.hpp>
+#include <astro/time/Date.hpp>
+#include <tests/utilities/comparisons.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace mp_units;
+using mp_units::si::unit_symbols::kg;
+using mp_units::si::unit_symbols::km;
+using mp_units::si::unit_symbols::min;
+using mp_units::si::unit_symbols::s;
+
+class MonteCarloPropagatorTest : public testing::Test {
+  public:
+    MonteCarloPropagatorTest() :
+        eom(sys),
+        epoch(J2000),
+        spacecraft({ Keplerian::LEO(), epoch, sys }),
+        epochs({ epoch, epoch + 10.0 * min, epoch + 30.0 * min })
+    {
+    }
+
+    void SetUp() override
+    {
+        dispersions.positionSigma = 1.0 * km;
+        dispersions.velocitySigma = 1.0e-3 * km / s;
+        dispersions.massSigma     = 10.0 * kg;
+    }
+
+    const Unitless REL_TOL = 1.0e-6;
+
+    AstrodynamicsSystem sys;
+    TwoBody eom;
+    Integrator integrator;
+    Date epoch;
+    Spacecraft spacecraft;
+    std::vector<Date> epochs;
+    Dispersions dispersions;
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(MonteCarloPropagatorTest, Constructor) { ASSERT_NO_THROW(MonteCarloPropagator(integrator, eom)); }
+
+TEST_F(MonteCarloPropagatorTest, InvalidInputs)
+{
+    MonteCarloPropagator propagator(integrator, eom);
+    ASSERT_ANY_THROW(propagator.set_percentiles({ 50.0, 101.0 }));
+    ASSERT_ANY_THROW(propagator.set_percentiles({ -1.0 }));
+    ASSERT_ANY_THROW(propagator.propagate(spacecraft, dispersions, epochs, 0));
+
+    const std::vector<Date> unordered = { epoch + 10.0 * min, epoch };
+    ASSERT_ANY_THROW(propagator.propagate(spacecraft, dispersions, unordered, 10));
+
+    const std::vector<Date> early = { epoch - 10.0 * min };
+    ASSERT_ANY_THROW(propagator.propagate(spacecraft, dispersions, early, 10));
+}
+
+TEST_F(MonteCarloPropagatorTest, NoDispersions)
+{
+    MonteCarloPropagator propagator(integrator, eom);
+    const std::vector<MonteCarloStatistics> statistics = propagator.propagate(spacecraft, Dispersions(), epochs, 16);
+    ASSERT_EQ(statistics.size(), epochs.size());
+
+    // Every sample is the nominal
+    for (std::size_t ii = 0; ii < epochs.size(); ++ii) {
+        ASSERT_EQ(statistics[ii].epoch, epochs[ii]);
+        ASSERT_EQ_CART_VEC(statistics[ii].mean.get_position(), statistics[ii].nominal.get_position(), REL_TOL);
+        ASSERT_EQ_CART_VEC(statistics[ii].mean.get_velocity(), statistics[ii].nominal.get_velocity(), REL_TOL);
+        for (const auto& row : statistics[ii].covariance) {
+            for (const double& value : row) {
+                ASSERT_NEAR(value, 0.0, 1.0e-12);
+            }
+        }
+        ASSERT_EQ(statistics[ii].positionErrorPercentiles.size(), 3);
+        for (const Distance& percentile : statistics[ii].positionErrorPercentiles) {
+            ASSERT_EQ(percentile, 0.0 * km);
+        }
+    }
+
+    // The first epoch is the initial state
+    const Cartesian state0 = spacecraft.get_initial_state().in_element_set<Cartesian>();
+    ASSERT_EQ_CART_VEC(statistics[0].nominal.get_position(), state0.get_position(), REL_TOL);
+    ASSERT_EQ_CART_VEC(statistics[0].nominal.get_velocity(), state0.get_velocity(), REL_TOL);
+}
+
+TEST_F(MonteCarloPropagatorTest, InitialDispersions)
+{
+    // No propagation, so the statistics are of the draws themselves
+    MonteCarloPropagator propagator(integrator, eom);
+    propagator.set_percentiles({ 0.0, 50.0, 100.0 });
+    Dispersions positionOnly;
+    positionOnly.positionSigma = 1.0 * km;
+
+    const std::vector<Date> initial                    = { epoch };
+    const std::vector<MonteCarloStatistics> statistics = propagator.propagate(spacecraft, positionOnly, initial, 2000);
+    ASSERT_EQ(statistics.size(), 1);
+
+    const auto& covariance = statistics[0].covariance;
+    for (std::size_t ii = 0; ii < 6; ++ii) {
+        for (std::size_t jj = 0; jj < 6; ++jj) {
+            if (ii == jj && ii < 3) { ASSERT_NEAR(covariance[ii][jj], 1.0, 0.1); }
+            else {
+                ASSERT_NEAR(covariance[ii][jj], 0.0, 0.1);
+            }
+        }
+    }
+
+    // The median of a chi distribution with three degrees of freedom is about 1.54
+    const std::vector<Distance>& percentiles = statistics[0].positionErrorPercentiles;
+    ASSERT_EQ(percentiles.size(), 3);
+    ASSERT_LT(percentiles[0], percentiles[1]);
+    ASSERT_LT(percentiles[1], percentiles[2]);
+    ASSERT_NEAR(percentiles[1].numerical_value_in(km), 1.54, 0.15);
+}
+
+TEST_F(MonteCarloPropagatorTest, ThreadCountIndependent)
+{
+    MonteCarloPropagator propagator(integrator, eom);
+    propagator.set_seed(7);
+    const std::vector<MonteCarloStatistics> serial   = propagator.propagate(spacecraft, dispersions, epochs, 64, 1);
+    const std::vector<MonteCarloStatistics> parallel = propagator.propagate(spacecraft, dispersions, epochs, 64, 4);
+    ASSERT_EQ(serial.size(), parallel.size());
+
+    for (std::size_t ii = 0; ii < serial.size(); ++ii) {
+        ASSERT_EQ_CART_VEC(serial[ii].mean.get_position(), parallel[ii].mean.get_position(), REL_TOL);
+        ASSERT_EQ_CART_VEC(serial[ii].mean.get_velocity(), parallel[ii].mean.get_velocity(), REL_TOL);
+        for (std::size_t jj = 0; jj < 6; ++jj) {
+            for (std::size_t kk = 0; kk < 6; ++kk) {
+                ASSERT_NEAR(serial[ii].covariance[jj][kk], parallel[ii].covariance[jj][kk], 1.0e-9);
+            }
+        }
+
+        // Each sample is identical, only the order the moments are merged in changes
+        ASSERT_EQ(serial[ii].positionErrorPercentiles, parallel[ii].positionErrorPercentiles);
+    }
+}
+
+TEST_F(MonteCarloPropagatorTest, ThreadCountIndependentWithOblateness)
+{
+    // Oblateness fills a Legendre table on every evaluation, so this catches force models that share scratch across
+    // threads
+    ForceModel forces;
+    forces.add<OblatenessForce>(sys, 4, 4);
+    const CowellsMethod cowell(sys, forces);
+
+    MonteCarloPropagator propagator(integrator, cowell);
+    propagator.set_seed(7);
+    const std::vector<MonteCarloStatistics> serial   = propagator.propagate(spacecraft, dispersions, epochs, 32, 1);
+    const std::vector<MonteCarloStatistics> parallel = propagator.propagate(spacecraft, dispersions, epochs, 32, 4);
+    ASSERT_EQ(serial.size(), parallel.size());
+
+    for (std::size_t ii = 0; ii < serial.size(); ++ii) {
+        ASSERT_EQ_CART_VEC(serial[ii].nominal.get_position(), parallel[ii].nominal.get_position(), REL_TOL);
+        ASSERT_EQ_CART_VEC(serial[ii].mean.get_position(), parallel[ii].mean.get_position(), REL_TOL);
+        ASSERT_EQ_CART_VEC(serial[ii].mean.get_velocity(), parallel[ii].mean.get_velocity(), REL_TOL);
+        ASSERT_EQ(serial[ii].positionErrorPercentiles, parallel[ii].positionErrorPercentiles);
+    }
+
+    // The samples feel the oblateness, so they drift from the two-body ones
+    MonteCarloPropagator twoBody(integrator, eom);
+    twoBody.set_seed(7);
+    const std::vector<MonteCarloStatistics> unperturbed = twoBody.propagate(spacecraft, dispersions, epochs, 32, 4);
+    ASSERT_GT((serial.back().nominal.get_position() - unperturbed.back().nominal.get_position()).norm(), 1.0 * km);
+}
+
+TEST_F(MonteCarloPropagatorTest, Seed)
+{
+    MonteCarloPropagator propagator(integrator, eom);
+    const std::vector<MonteCarloStatistics> first  = propagator.propagate(spacecraft, dispersions, epochs, 32);
+    const std::vector<MonteCarloStatistics> repeat = propagator.propagate(spacecraft, dispersions, epochs, 32);
+    propagator.set_seed(1);
+    const std::vector<MonteCarloStatistics> reseeded = propagator.propagate(spacecraft, dispersions, epochs, 32);
+
+    for (std::size_t ii = 1; ii < epochs.size(); ++ii) {
+        ASSERT_EQ(first[ii].positionErrorPercentiles, repeat[ii].positionErrorPercentiles);
+        ASSERT_NE(first[ii].positionErrorPercentiles, reseeded[ii].positionErrorPercentiles);
+    }
+}
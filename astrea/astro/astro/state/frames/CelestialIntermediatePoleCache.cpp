@@ -0,0 +1,63 @@
+#include <astro/state/frames/CelestialIntermediatePoleCache.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include <astro/time/TimeScales.hpp>
+
+namespace astrea {
+namespace astro {
+
+using mp_units::angular::unit_symbols::rad;
+using mp_units::si::unit_symbols::s;
+
+
+CelestialIntermediatePoleCache::CelestialIntermediatePoleCache(const Date& start, const Date& end, const Time& step) :
+    _start(start.tt()),
+    _step(step.numerical_value_in(s))
+{
+    if (_step <= 0.0) { throw std::runtime_error("CelestialIntermediatePoleCache requires a positive step."); }
+    if (end < start) { throw std::runtime_error("CelestialIntermediatePoleCache requires the end date to follow the start date."); }
+
+    // Cover the end date with a whole number of steps
+    const double span        = (end - start).numerical_value_in(s);
+    const std::size_t nNodes = static_cast<std::size_t>(std::ceil(span / _step)) + 1;
+    const auto stepDuration  = JulianDateClock::duration(seconds{ _step });
+
+    _x.reserve(nNodes);
+    _y.reserve(nNodes);
+    _s.reserve(nNodes);
+    for (std::size_t ii = 0; ii < nNodes; ++ii) {
+        const CelestialIntermediatePole pole = get_celestial_intermediate_pole(_start + stepDuration * static_cast<double>(ii));
+        _x.push_back(pole.x.numerical_value_in(rad));
+        _y.push_back(pole.y.numerical_value_in(rad));
+        _s.push_back(pole.s.numerical_value_in(rad));
+    }
+}
+
+CelestialIntermediatePole CelestialIntermediatePoleCache::get_pole(const TwoPartJulianDate& tt) const
+{
+    const double x = (tt - _start).count() / _step;
+    if (_x.size() < 2 || x < 0.0 || x > static_cast<double>(_x.size() - 1)) { return get_celestial_intermediate_pole(tt); }
+
+    const std::size_t index = std::min(static_cast<std::size_t>(x), _x.size() - 2);
+    const double weight     = x - static_cast<double>(index);
+    return { (_x[index] + weight * (_x[index + 1] - _x[index])) * rad,
+             (_y[index] + weight * (_y[index + 1] - _y[index])) * rad,
+             (_s[index] + weight * (_s[index + 1] - _s[index])) * rad };
+}
+
+DCM<ECI, ITRF> CelestialIntermediatePoleCache::get_dcm(const Date& date) const
+{
+    const TwoPartJulianDate tt = date.tt();
+    return get_celestial_to_terrestrial_dcm(
+        get_pole(tt),
+        earth_rotation_angle(date.ut1()),
+        EarthOrientationTable::get_instance().polar_motion(date.two_part_jd()),
+        terrestrial_intermediate_origin_locator(tt)
+    );
+}
+
+} // namespace astro
+} // namespace astrea
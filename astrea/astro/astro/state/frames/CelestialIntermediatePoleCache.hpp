@@ -0,0 +1,112 @@
+/**
+ * @file CelestialIntermediatePoleCache.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief Interpolated cache of the CIP coordinates for fast GCRS <-> ITRS rotations.
+ * @version 0.1
+ * @date 2025-08-06
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <vector>
+
+#include <units/units.hpp>
+
+#include <astro/astro.fwd.hpp>
+#include <astro/state/CartesianVector.hpp>
+#include <astro/state/frames/earth_orientation.hpp>
+#include <astro/state/frames/instances/EarthCenteredInertial.hpp>
+#include <astro/state/frames/instances/InternationalTerrestrialReferenceFrame.hpp>
+#include <astro/state/frames/types/DirectionCosineMatrix.hpp>
+#include <astro/time/Date.hpp>
+#include <astro/time/TwoPartJulianDate.hpp>
+
+namespace astrea {
+namespace astro {
+
+/**
+ * @brief Caches the CIP coordinates X, Y and CIO locator s on an evenly spaced grid and interpolates between nodes.
+ *
+ * The precession-nutation series dominates the cost of the GCRS to ITRS rotation but varies slowly. Evaluating it
+ * only at the nodes and linearly interpolating in between introduces errors below 0.1 mas for nodes three hours
+ * apart. The Earth rotation angle and polar motion are cheap and are always evaluated exactly.
+ */
+class CelestialIntermediatePoleCache {
+  public:
+    /**
+     * @brief Construct a CelestialIntermediatePoleCache spanning two dates.
+     *
+     * @param start The first date covered by the cache.
+     * @param end The last date covered by the cache.
+     * @param step The spacing between nodes.
+     */
+    CelestialIntermediatePoleCache(const Date& start, const Date& end, const Time& step = 3.0 * mp_units::si::unit_symbols::h);
+
+    /**
+     * @brief Destructor for CelestialIntermediatePoleCache.
+     */
+    ~CelestialIntermediatePoleCache() = default;
+
+    /**
+     * @brief Get the number of nodes in the cache.
+     *
+     * @return std::size_t The number of nodes.
+     */
+    std::size_t size() const { return _x.size(); }
+
+    /**
+     * @brief Get the CIP coordinates and CIO locator at a date.
+     *
+     * @param tt The TT date. Dates outside of the cache fall back to the full series.
+     * @return CelestialIntermediatePole The interpolated CIP coordinates and CIO locator.
+     */
+    CelestialIntermediatePole get_pole(const TwoPartJulianDate& tt) const;
+
+    /**
+     * @brief Get the ECI (GCRS) to ITRF DCM at a date.
+     *
+     * @param date The UTC date.
+     * @return DCM<ECI, ITRF> The DCM from ECI to ITRF.
+     */
+    DCM<ECI, ITRF> get_dcm(const Date& date) const;
+
+    /**
+     * @brief Rotate a CartesianVector from ECI into ITRF.
+     *
+     * @tparam Value_T The type of the vector components.
+     * @param eciVec The CartesianVector in ECI coordinates.
+     * @param date The date of the rotation.
+     * @return CartesianVector<Value_T, ITRF> The CartesianVector in ITRF coordinates.
+     */
+    template <typename Value_T>
+    CartesianVector<Value_T, ITRF> rotate_into_itrf(const CartesianVector<Value_T, ECI>& eciVec, const Date& date) const
+    {
+        return get_dcm(date) * eciVec;
+    }
+
+    /**
+     * @brief Rotate a CartesianVector from ITRF into ECI.
+     *
+     * @tparam Value_T The type of the vector components.
+     * @param itrfVec The CartesianVector in ITRF coordinates.
+     * @param date The date of the rotation.
+     * @return CartesianVector<Value_T, ECI> The CartesianVector in ECI coordinates.
+     */
+    template <typename Value_T>
+    CartesianVector<Value_T, ECI> rotate_into_eci(const CartesianVector<Value_T, ITRF>& itrfVec, const Date& date) const
+    {
+        return get_dcm(date).transpose() * itrfVec;
+    }
+
+  private:
+    TwoPartJulianDate _start; //!< TT date of the first node
+    double _step;             //!< Spacing between nodes, in seconds
+    std::vector<double> _x;   //!< CIP X at each node, in radians
+    std::vector<double> _y;   //!< CIP Y at each node, in radians
+    std::vector<double> _s;   //!< CIO locator at each node, in radians
+};
+
+} // namespace astro
+} // namespace astrea
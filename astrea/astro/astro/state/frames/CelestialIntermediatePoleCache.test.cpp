@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <numbers>
+
+#include <math/test_util.hpp>
+#include <units/units.hpp>
+
+#include <astro/state/CartesianVector.hpp>
+#include <astro/state/frames/CelestialIntermediatePoleCache.hpp>
+#include <astro/state/frames/earth_orientation.hpp>
+#include <astro/state/frames/frames.hpp>
+#include <astro/time/Date.hpp>
+#include <tests/utilities/comparisons.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace mp_units;
+using mp_units::angular::unit_symbols::rad;
+using mp_units::non_si::day;
+using mp_units::si::unit_symbols::h;
+using mp_units::si::unit_symbols::km;
+using mp_units::si::unit_symbols::min;
+using mp_units::si::unit_symbols::s;
+
+class CelestialIntermediatePoleCacheTest : public testing::Test {
+  public:
+    CelestialIntermediatePoleCacheTest() {}
+
+    void SetUp() override
+    {
+        start = Date("2025-08-06 00:00:00");
+        end   = start + 2.0 * day;
+
+        vectors = { RadiusVector<ECI>(7000.0 * km, 0.0 * km, 0.0 * km),
+                    RadiusVector<ECI>(0.0 * km, -6378.0 * km, 1000.0 * km),
+                    RadiusVector<ECI>(1234.0 * km, 5678.0 * km, -4321.0 * km) };
+    }
+
+    static void assert_pole_near(const CelestialIntermediatePole& pole, const CelestialIntermediatePole& expected, const double& tol)
+    {
+        ASSERT_NEAR(pole.x.numerical_value_in(rad), expected.x.numerical_value_in(rad), tol);
+        ASSERT_NEAR(pole.y.numerical_value_in(rad), expected.y.numerical_value_in(rad), tol);
+        ASSERT_NEAR(pole.s.numerical_value_in(rad), expected.s.numerical_value_in(rad), tol);
+    }
+
+    // Interpolation error for 3 hour nodes is below 0.1 mas
+    static constexpr double INTERP_TOL = 0.1e-3 * std::numbers::pi / 648000.0;
+
+    Date start;
+    Date end;
+    std::vector<RadiusVector<ECI>> vectors;
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(CelestialIntermediatePoleCacheTest, Grid)
+{
+    const CelestialIntermediatePoleCache cache(start, end);
+    ASSERT_EQ(cache.size(), 17);
+
+    const CelestialIntermediatePoleCache partialStep(start, start + 7.5 * h);
+    ASSERT_EQ(partialStep.size(), 4);
+}
+
+TEST_F(CelestialIntermediatePoleCacheTest, InvalidGrid)
+{
+    ASSERT_ANY_THROW(CelestialIntermediatePoleCache(start, end, 0.0 * s));
+    ASSERT_ANY_THROW(CelestialIntermediatePoleCache(start, end, -1.0 * h));
+    ASSERT_ANY_THROW(CelestialIntermediatePoleCache(end, start));
+}
+
+TEST_F(CelestialIntermediatePoleCacheTest, NodesMatchDirect)
+{
+    const CelestialIntermediatePoleCache cache(start, end);
+    for (std::size_t ii = 0; ii < cache.size(); ++ii) {
+        const TwoPartJulianDate tt = (start + static_cast<double>(ii) * 3.0 * h).tt();
+        assert_pole_near(cache.get_pole(tt), get_celestial_intermediate_pole(tt), 1.0e-15);
+    }
+}
+
+TEST_F(CelestialIntermediatePoleCacheTest, Interpolation)
+{
+    // Against the full series, whose planetary terms are the fastest varying
+    ASSERT_TRUE(CelestialIntermediatePoleSeries::get_instance().has_value());
+
+    const CelestialIntermediatePoleCache cache(start, end);
+    for (Date date = start; date < end; date = date + 37.0 * min) {
+        const TwoPartJulianDate tt = date.tt();
+        assert_pole_near(cache.get_pole(tt), get_celestial_intermediate_pole(tt), INTERP_TOL);
+    }
+}
+
+TEST_F(CelestialIntermediatePoleCacheTest, OutsideGrid)
+{
+    const CelestialIntermediatePoleCache cache(start, end);
+    for (const Date& date : { start - 1.0 * day, end + 1.0 * day }) {
+        const TwoPartJulianDate tt = date.tt();
+        assert_pole_near(cache.get_pole(tt), get_celestial_intermediate_pole(tt), 0.0);
+    }
+}
+
+TEST_F(CelestialIntermediatePoleCacheTest, MatchesFullTransformation)
+{
+    // An interpolation error of 1e-9 rad moves a LEO position by less than 1e-5 km
+    const CelestialIntermediatePoleCache cache(start, end);
+    for (Date date = start; date < end; date = date + 53.0 * min) {
+        for (const auto& vector : vectors) {
+            const RadiusVector<ITRF> cached = cache.rotate_into_itrf(vector, date);
+            ASSERT_EQ_CART_VEC(cached, ITRF::rotate_into_this_frame(vector, date), 0.0 * one, 1.0e-5 * one);
+            ASSERT_EQ_CART_VEC(cache.rotate_into_eci(cached, date), vector, 1.0e-14 * one, 1.0e-9 * one);
+        }
+    }
+}
@@ -0,0 +1,113 @@
+#include <astro/state/frames/EarthRotationProvider.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+
+namespace astrea {
+namespace astro {
+
+using mp_units::angular::unit_symbols::rad;
+using mp_units::si::unit_symbols::s;
+
+
+EarthRotationProvider::EarthRotationProvider(const Date& start, const Date& end, const Time& step) :
+    EarthRotationProvider(start, [&]() {
+        if (step <= 0.0 * s) { throw std::runtime_error("EarthRotationProvider requires a positive step."); }
+
+        const Time duration = end - start;
+        std::vector<Time> times{ 0.0 * s };
+        while (times.back() < duration) {
+            times.push_back(std::min(times.back() + step, duration));
+        }
+        return times;
+    }())
+{
+}
+
+EarthRotationProvider::EarthRotationProvider(const Date& epoch, const std::vector<Time>& times) :
+    _epoch(epoch)
+{
+    if (times.empty()) { throw std::runtime_error("EarthRotationProvider requires at least one node."); }
+
+    static constexpr double TWO_PI        = 2.0 * std::numbers::pi;
+    static constexpr double ROTATION_RATE = 1.002737909350795 * TWO_PI / 86400.0; // rad/s
+
+    _dates.reserve(times.size());
+    _times.reserve(times.size());
+    _angles.reserve(times.size());
+    _dcms.reserve(times.size());
+    for (const auto& time : times) {
+        const double offset = time.numerical_value_in(s);
+        if (!_times.empty() && offset <= _times.back()) {
+            throw std::runtime_error("EarthRotationProvider node times must be strictly increasing.");
+        }
+
+        const Date date = epoch + time;
+        double angle    = julian_date_to_siderial_time(date.jd()).numerical_value_in(rad);
+
+        // Unwrap against the expected advance so neighboring nodes can be interpolated directly, however far apart
+        if (!_angles.empty()) {
+            const double expected = _angles.back() + ROTATION_RATE * (offset - _times.back());
+            angle += TWO_PI * std::round((expected - angle) / TWO_PI);
+        }
+
+        _dates.push_back(date);
+        _times.push_back(offset);
+        _angles.push_back(angle);
+        _dcms.push_back(ECEF::get_dcm(date));
+    }
+    _step = (_times.size() > 1) ? _times[1] - _times[0] : 0.0;
+}
+
+std::size_t EarthRotationProvider::find_interval(const double& time) const
+{
+    // Uniform grids resolve in one guess; fall back to a binary search otherwise
+    if (_step > 0.0) {
+        const std::size_t guess = std::min(static_cast<std::size_t>((time - _times.front()) / _step), _times.size() - 2);
+        if (_times[guess] <= time && time <= _times[guess + 1]) { return guess; }
+    }
+    const auto upper = std::upper_bound(_times.begin(), _times.end(), time);
+    return std::min(static_cast<std::size_t>(upper - _times.begin()), _times.size() - 1) - 1;
+}
+
+Angle EarthRotationProvider::get_rotation_angle(const Date& date) const
+{
+    const double time = (date - _epoch).numerical_value_in(s);
+    if (_times.size() < 2 || time < _times.front() || time > _times.back()) {
+        return julian_date_to_siderial_time(date.jd());
+    }
+
+    const std::size_t index = find_interval(time);
+    const double weight     = (time - _times[index]) / (_times[index + 1] - _times[index]);
+    return (_angles[index] + weight * (_angles[index + 1] - _angles[index])) * rad;
+}
+
+DCM<ECI, ECEF> EarthRotationProvider::get_dcm(const Date& date) const
+{
+    const double time = (date - _epoch).numerical_value_in(s);
+    if (_times.size() < 2 || time < _times.front() || time > _times.back()) {
+        return (date == _dates.front()) ? _dcms.front() : ECEF::get_dcm(date);
+    }
+
+    const std::size_t index = find_interval(time);
+    if (date == _dates[index]) { return _dcms[index]; }
+    if (date == _dates[index + 1]) { return _dcms[index + 1]; }
+
+    const double weight = (time - _times[index]) / (_times[index + 1] - _times[index]);
+    return DCM<ECI, ECEF>::Z((_angles[index] + weight * (_angles[index + 1] - _angles[index])) * rad);
+}
+
+std::vector<DCM<ECI, ECEF>> EarthRotationProvider::get_dcms(const std::vector<Date>& dates) const
+{
+    std::vector<DCM<ECI, ECEF>> dcms;
+    dcms.reserve(dates.size());
+    for (const auto& date : dates) {
+        dcms.push_back(get_dcm(date));
+    }
+    return dcms;
+}
+
+} // namespace astro
+} // namespace astrea
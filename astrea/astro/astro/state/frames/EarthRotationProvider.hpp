@@ -0,0 +1,234 @@
+/**
+ * @file EarthRotationProvider.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief Cached and batched ECI <-> ECEF rotations over a time grid.
+ * @version 0.1
+ * @date 2025-08-06
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <vector>
+
+#include <units/units.hpp>
+
+#include <astro/astro.fwd.hpp>
+#include <astro/state/CartesianVector.hpp>
+#include <astro/state/frames/instances/EarthCenteredEarthFixed.hpp>
+#include <astro/state/frames/instances/EarthCenteredInertial.hpp>
+#include <astro/state/frames/types/DirectionCosineMatrix.hpp>
+#include <astro/time/Date.hpp>
+
+namespace astrea {
+namespace astro {
+
+/**
+ * @brief Provides ECI <-> ECEF rotations from a precomputed time grid.
+ *
+ * The sidereal angle and DCM are computed once for every node of the grid. Rotations at the nodes reuse the cached
+ * DCMs exactly, while rotations at arbitrary dates linearly interpolate the (unwrapped) sidereal angle between the
+ * surrounding nodes. The sidereal angle advances at a nearly constant rate, so the interpolation error is many orders
+ * of magnitude below the error of the rotation model itself.
+ */
+class EarthRotationProvider {
+  public:
+    /**
+     * @brief Construct an EarthRotationProvider with evenly spaced nodes.
+     *
+     * @param start The first node of the grid.
+     * @param end The last node of the grid. The final interval is shortened to land on it exactly.
+     * @param step The spacing between nodes.
+     */
+    EarthRotationProvider(const Date& start, const Date& end, const Time& step);
+
+    /**
+     * @brief Construct an EarthRotationProvider with nodes at specific offsets from an epoch.
+     *
+     * @param epoch The epoch the offsets are measured from.
+     * @param times The strictly increasing node offsets from the epoch.
+     */
+    EarthRotationProvider(const Date& epoch, const std::vector<Time>& times);
+
+    /**
+     * @brief Destructor for EarthRotationProvider.
+     */
+    ~EarthRotationProvider() = default;
+
+    /**
+     * @brief Get the number of nodes in the grid.
+     *
+     * @return std::size_t The number of nodes.
+     */
+    std::size_t size() const { return _dcms.size(); }
+
+    /**
+     * @brief Get the date of a grid node.
+     *
+     * @param index The index of the node.
+     * @return const Date& The date of the node.
+     */
+    const Date& get_date(const std::size_t& index) const { return _dates[index]; }
+
+    /**
+     * @brief Get the dates of all grid nodes.
+     *
+     * @return const std::vector<Date>& The dates of the nodes.
+     */
+    const std::vector<Date>& get_dates() const { return _dates; }
+
+    /**
+     * @brief Get the cached ECI to ECEF DCM at a grid node.
+     *
+     * @param index The index of the node.
+     * @return const DCM<ECI, ECEF>& The DCM at the node.
+     */
+    const DCM<ECI, ECEF>& get_dcm(const std::size_t& index) const { return _dcms[index]; }
+
+    /**
+     * @brief Get the ECI to ECEF DCM at an arbitrary date.
+     *
+     * @param date The date of the rotation. Dates outside of the grid fall back to ECEF::get_dcm.
+     * @return DCM<ECI, ECEF> The DCM at the date.
+     */
+    DCM<ECI, ECEF> get_dcm(const Date& date) const;
+
+    /**
+     * @brief Get the (unwrapped) sidereal rotation angle at an arbitrary date.
+     *
+     * @param date The date of the rotation. Dates outside of the grid fall back to julian_date_to_siderial_time.
+     * @return Angle The sidereal angle at the date.
+     */
+    Angle get_rotation_angle(const Date& date) const;
+
+    /**
+     * @brief Rotate N ECI vectors into ECEF at every node of the grid.
+     *
+     * @tparam Value_T The type of the vector components.
+     * @param vectors The N vectors to rotate.
+     * @return std::vector<CartesianVector<Value_T, ECEF>> N*K rotated vectors, with the K nodes of vector n stored
+     *         contiguously starting at n*K.
+     */
+    template <typename Value_T>
+    std::vector<CartesianVector<Value_T, ECEF>> rotate_into_ecef(const std::vector<CartesianVector<Value_T, ECI>>& vectors) const
+    {
+        return rotate(vectors, _dcms);
+    }
+
+    /**
+     * @brief Rotate N ECEF vectors into ECI at every node of the grid.
+     *
+     * @tparam Value_T The type of the vector components.
+     * @param vectors The N vectors to rotate.
+     * @return std::vector<CartesianVector<Value_T, ECI>> N*K rotated vectors, with the K nodes of vector n stored
+     *         contiguously starting at n*K.
+     */
+    template <typename Value_T>
+    std::vector<CartesianVector<Value_T, ECI>> rotate_into_eci(const std::vector<CartesianVector<Value_T, ECEF>>& vectors) const
+    {
+        return rotate(vectors, transposed(_dcms));
+    }
+
+    /**
+     * @brief Rotate N ECI vectors into ECEF at K arbitrary dates.
+     *
+     * @tparam Value_T The type of the vector components.
+     * @param vectors The N vectors to rotate.
+     * @param dates The K dates to rotate at.
+     * @return std::vector<CartesianVector<Value_T, ECEF>> N*K rotated vectors, with the K dates of vector n stored
+     *         contiguously starting at n*K.
+     */
+    template <typename Value_T>
+    std::vector<CartesianVector<Value_T, ECEF>>
+        rotate_into_ecef(const std::vector<CartesianVector<Value_T, ECI>>& vectors, const std::vector<Date>& dates) const
+    {
+        return rotate(vectors, get_dcms(dates));
+    }
+
+    /**
+     * @brief Rotate N ECEF vectors into ECI at K arbitrary dates.
+     *
+     * @tparam Value_T The type of the vector components.
+     * @param vectors The N vectors to rotate.
+     * @param dates The K dates to rotate at.
+     * @return std::vector<CartesianVector<Value_T, ECI>> N*K rotated vectors, with the K dates of vector n stored
+     *         contiguously starting at n*K.
+     */
+    template <typename Value_T>
+    std::vector<CartesianVector<Value_T, ECI>>
+        rotate_into_eci(const std::vector<CartesianVector<Value_T, ECEF>>& vectors, const std::vector<Date>& dates) const
+    {
+        return rotate(vectors, transposed(get_dcms(dates)));
+    }
+
+  private:
+    Date _epoch;                       //!< Epoch the node offsets are measured from
+    std::vector<Date> _dates;          //!< Date of each node
+    std::vector<double> _times;        //!< Node offsets from the epoch, in seconds
+    std::vector<double> _angles;       //!< Unwrapped sidereal angle at each node, in radians
+    std::vector<DCM<ECI, ECEF>> _dcms; //!< ECI to ECEF DCM at each node
+    double _step;                      //!< Spacing of the first interval, used to guess the interval of a date
+
+    /**
+     * @brief Find the interval containing a time offset.
+     *
+     * @param time The offset from the epoch, in seconds. Must be within the grid.
+     * @return std::size_t The index of the node at the start of the interval.
+     */
+    std::size_t find_interval(const double& time) const;
+
+    /**
+     * @brief Get the ECI to ECEF DCM for each of a set of dates.
+     *
+     * @param dates The dates of the rotations.
+     * @return std::vector<DCM<ECI, ECEF>> The DCM at each date.
+     */
+    std::vector<DCM<ECI, ECEF>> get_dcms(const std::vector<Date>& dates) const;
+
+    /**
+     * @brief Transpose a set of DCMs.
+     *
+     * @tparam In_Frame_T The input frame of the DCMs.
+     * @tparam Out_Frame_T The output frame of the DCMs.
+     * @param dcms The DCMs to transpose.
+     * @return std::vector<DCM<Out_Frame_T, In_Frame_T>> The transposed DCMs.
+     */
+    template <typename In_Frame_T, typename Out_Frame_T>
+    static std::vector<DCM<Out_Frame_T, In_Frame_T>> transposed(const std::vector<DCM<In_Frame_T, Out_Frame_T>>& dcms)
+    {
+        std::vector<DCM<Out_Frame_T, In_Frame_T>> result;
+        result.reserve(dcms.size());
+        for (const auto& dcm : dcms) {
+            result.push_back(dcm.transpose());
+        }
+        return result;
+    }
+
+    /**
+     * @brief Apply every DCM to every vector.
+     *
+     * @tparam Value_T The type of the vector components.
+     * @tparam In_Frame_T The input frame of the vectors.
+     * @tparam Out_Frame_T The output frame of the vectors.
+     * @param vectors The N vectors to rotate.
+     * @param dcms The K DCMs to apply.
+     * @return std::vector<CartesianVector<Value_T, Out_Frame_T>> N*K rotated vectors, grouped by input vector.
+     */
+    template <typename Value_T, typename In_Frame_T, typename Out_Frame_T>
+    static std::vector<CartesianVector<Value_T, Out_Frame_T>>
+        rotate(const std::vector<CartesianVector<Value_T, In_Frame_T>>& vectors, const std::vector<DCM<In_Frame_T, Out_Frame_T>>& dcms)
+    {
+        std::vector<CartesianVector<Value_T, Out_Frame_T>> result;
+        result.reserve(vectors.size() * dcms.size());
+        for (const auto& vector : vectors) {
+            for (const auto& dcm : dcms) {
+                result.push_back(dcm * vector);
+            }
+        }
+        return result;
+    }
+};
+
+} // namespace astro
+} // namespace astrea
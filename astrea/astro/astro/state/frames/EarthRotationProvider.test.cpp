@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <numbers>
+
+#include <math/test_util.hpp>
+#include <units/units.hpp>
+
+#include <astro/state/CartesianVector.hpp>
+#include <astro/state/frames/EarthRotationProvider.hpp>
+#include <astro/state/frames/frames.hpp>
+#include <astro/time/Date.hpp>
+#include <tests/utilities/comparisons.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace mp_units;
+using mp_units::angular::unit_symbols::rad;
+using mp_units::non_si::day;
+using mp_units::si::unit_symbols::km;
+using mp_units::si::unit_symbols::min;
+using mp_units::si::unit_symbols::s;
+
+class EarthRotationProviderTest : public testing::Test {
+  public:
+    EarthRotationProviderTest() {}
+
+    void SetUp() override
+    {
+        start = Date("2025-08-06 00:00:00");
+        end   = start + 1.0 * day;
+
+        vectors = { RadiusVector<ECI>(7000.0 * km, 0.0 * km, 0.0 * km),
+                    RadiusVector<ECI>(0.0 * km, -6378.0 * km, 1000.0 * km),
+                    RadiusVector<ECI>(1234.0 * km, 5678.0 * km, -4321.0 * km) };
+    }
+
+    const Unitless REL_TOL = 1.0e-10;
+    const Unitless ABS_TOL = 1.0e-6;
+
+    Date start;
+    Date end;
+    std::vector<RadiusVector<ECI>> vectors;
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(EarthRotationProviderTest, Grid)
+{
+    const EarthRotationProvider provider(start, end, 7.0 * min);
+    ASSERT_EQ(provider.size(), 207);
+    ASSERT_EQ(provider.get_date(0), start);
+    ASSERT_EQ(provider.get_date(provider.size() - 1), end);
+}
+
+TEST_F(EarthRotationProviderTest, InvalidGrid)
+{
+    ASSERT_ANY_THROW(EarthRotationProvider(start, end, 0.0 * s));
+    ASSERT_ANY_THROW(EarthRotationProvider(start, std::vector<Time>{}));
+    ASSERT_ANY_THROW(EarthRotationProvider(start, std::vector<Time>{ 0.0 * s, 10.0 * s, 10.0 * s }));
+}
+
+TEST_F(EarthRotationProviderTest, NodesMatchDirect)
+{
+    const EarthRotationProvider provider(start, end, 60.0 * s);
+    for (std::size_t ii = 0; ii < provider.size(); ++ii) {
+        const Date& date   = provider.get_date(ii);
+        const auto direct  = ECEF::get_dcm(date);
+        const auto& cached = provider.get_dcm(ii);
+        const auto lookup  = provider.get_dcm(date);
+        for (const auto& vector : vectors) {
+            ASSERT_EQ(cached * vector, direct * vector);
+            ASSERT_EQ(lookup * vector, direct * vector);
+        }
+    }
+}
+
+TEST_F(EarthRotationProviderTest, Interpolation)
+{
+    const EarthRotationProvider provider(start, end, 10.0 * min);
+    for (Time offset = 0.0 * s; offset < 1.0 * day; offset += 37.0 * s) {
+        const Date date = start + offset;
+
+        const Angle expected = julian_date_to_siderial_time(date.jd());
+        const Angle angle    = provider.get_rotation_angle(date);
+        ASSERT_NEAR(std::remainder((angle - expected).numerical_value_in(rad), 2.0 * std::numbers::pi), 0.0, 1.0e-9);
+
+        for (const auto& vector : vectors) {
+            ASSERT_EQ_CART_VEC(provider.get_dcm(date) * vector, vector.in_frame<ECEF>(date), REL_TOL, ABS_TOL);
+        }
+    }
+}
+
+TEST_F(EarthRotationProviderTest, LargeSteps)
+{
+    const EarthRotationProvider provider(start, start + 10.0 * day, 1.0 * day);
+    const Date date = start + 4.5 * day;
+    ASSERT_EQ_CART_VEC(provider.get_dcm(date) * vectors[0], vectors[0].in_frame<ECEF>(date), REL_TOL, ABS_TOL);
+}
+
+TEST_F(EarthRotationProviderTest, OutsideGrid)
+{
+    const EarthRotationProvider provider(start, end, 10.0 * min);
+    for (const Date& date : { start - 1.0 * s, end + 1.0 * day }) {
+        ASSERT_EQ(provider.get_dcm(date) * vectors[0], ECEF::get_dcm(date) * vectors[0]);
+    }
+}
+
+TEST_F(EarthRotationProviderTest, NonUniformGrid)
+{
+    const std::vector<Time> times = { 0.0 * s, 1.0 * s, 100.0 * s, 101.0 * s, 5000.0 * s };
+    const EarthRotationProvider provider(start, times);
+    for (const Time& offset : { 0.5 * s, 50.0 * s, 100.5 * s, 4000.0 * s }) {
+        const Date date = start + offset;
+        ASSERT_EQ_CART_VEC(provider.get_dcm(date) * vectors[1], vectors[1].in_frame<ECEF>(date), REL_TOL, ABS_TOL);
+    }
+}
+
+TEST_F(EarthRotationProviderTest, BatchedRotation)
+{
+    const EarthRotationProvider provider(start, end, 30.0 * min);
+
+    const auto ecef = provider.rotate_into_ecef(vectors);
+    ASSERT_EQ(ecef.size(), vectors.size() * provider.size());
+    for (std::size_t ii = 0; ii < vectors.size(); ++ii) {
+        for (std::size_t jj = 0; jj < provider.size(); ++jj) {
+            ASSERT_EQ(ecef[ii * provider.size() + jj], vectors[ii].in_frame<ECEF>(provider.get_date(jj)));
+        }
+    }
+
+    std::vector<RadiusVector<ECEF>> fixed;
+    for (std::size_t ii = 0; ii < vectors.size(); ++ii) {
+        fixed.push_back(ecef[ii * provider.size()]);
+    }
+    const auto eci = provider.rotate_into_eci(fixed);
+    for (std::size_t ii = 0; ii < fixed.size(); ++ii) {
+        for (std::size_t jj = 0; jj < provider.size(); ++jj) {
+            ASSERT_EQ(eci[ii * provider.size() + jj], fixed[ii].in_frame<ECI>(provider.get_date(jj)));
+        }
+    }
+}
+
+TEST_F(EarthRotationProviderTest, BatchedRotationAtDates)
+{
+    const EarthRotationProvider provider(start, end, 30.0 * min);
+    const std::vector<Date> dates = { start + 1.0 * s, start + 12345.0 * s, end - 1.0 * s };
+
+    const auto ecef = provider.rotate_into_ecef(vectors, dates);
+    ASSERT_EQ(ecef.size(), vectors.size() * dates.size());
+    for (std::size_t ii = 0; ii < vectors.size(); ++ii) {
+        for (std::size_t jj = 0; jj < dates.size(); ++jj) {
+            ASSERT_EQ_CART_VEC(ecef[ii * dates.size() + jj], vectors[ii].in_frame<ECEF>(dates[jj]), REL_TOL, ABS_TOL);
+        }
+    }
+}
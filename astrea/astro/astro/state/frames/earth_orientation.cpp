@@ -0,0 +1,521 @@
+#include <astro/state/frames/earth_orientation.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <numbers>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <astro/state/frames/instances/InternationalTerrestrialReferenceFrame.hpp>
+
+namespace astrea {
+namespace astro {
+
+namespace {
+
+using Matrix = std::array<std::array<double, 3>, 3>;
+
+constexpr double TWO_PI            = 2.0 * std::numbers::pi;
+constexpr double ARCSEC_TO_RAD     = std::numbers::pi / 648000.0;
+constexpr double ARCSEC_PER_CIRCLE = 1296000.0;
+constexpr double J2000_DAY         = 2451545.0;
+constexpr double DAYS_PER_CENTURY  = 36525.0;
+
+// Julian centuries of TT since J2000
+double julian_centuries(const TwoPartJulianDate& tt) { return ((tt.day() - J2000_DAY) + tt.fraction()) / DAYS_PER_CENTURY; }
+
+// Rotations applied in place, following the SOFA sign conventions (passive rotations)
+void rotate_x(const double& angle, Matrix& r)
+{
+    const double c = std::cos(angle);
+    const double s = std::sin(angle);
+    for (std::size_t jj = 0; jj < 3; ++jj) {
+        const double r1 = c * r[1][jj] + s * r[2][jj];
+        const double r2 = -s * r[1][jj] + c * r[2][jj];
+        r[1][jj]        = r1;
+        r[2][jj]        = r2;
+    }
+}
+
+void rotate_y(const double& angle, Matrix& r)
+{
+    const double c = std::cos(angle);
+    const double s = std::sin(angle);
+    for (std::size_t jj = 0; jj < 3; ++jj) {
+        const double r0 = c * r[0][jj] - s * r[2][jj];
+        const double r2 = s * r[0][jj] + c * r[2][jj];
+        r[0][jj]        = r0;
+        r[2][jj]        = r2;
+    }
+}
+
+void rotate_z(const double& angle, Matrix& r)
+{
+    const double c = std::cos(angle);
+    const double s = std::sin(angle);
+    for (std::size_t jj = 0; jj < 3; ++jj) {
+        const double r0 = c * r[0][jj] + s * r[1][jj];
+        const double r1 = -s * r[0][jj] + c * r[1][jj];
+        r[0][jj]        = r0;
+        r[1][jj]        = r1;
+    }
+}
+
+Matrix multiply(const Matrix& a, const Matrix& b)
+{
+    Matrix result{};
+    for (std::size_t ii = 0; ii < 3; ++ii) {
+        for (std::size_t jj = 0; jj < 3; ++jj) {
+            for (std::size_t kk = 0; kk < 3; ++kk) {
+                result[ii][jj] += a[ii][kk] * b[kk][jj];
+            }
+        }
+    }
+    return result;
+}
+
+constexpr Matrix IDENTITY = { { { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 } } };
+
+// Delaunay arguments l, l', F, D, Omega in radians (IERS Conventions 2003, Eq. 5.43)
+std::array<double, 5> fundamental_arguments(const double& t)
+{
+    const auto arg = [&](const std::array<double, 5>& c) {
+        return std::fmod(c[0] + t * (c[1] + t * (c[2] + t * (c[3] + t * c[4]))), ARCSEC_PER_CIRCLE) * ARCSEC_TO_RAD;
+    };
+    return { arg({ 485868.249036, 1717915923.2178, 31.8792, 0.051635, -0.00024470 }),
+             arg({ 1287104.793048, 129596581.0481, -0.5532, 0.000136, -0.00001149 }),
+             arg({ 335779.526232, 1739527262.8478, -12.7512, -0.001037, 0.00000417 }),
+             arg({ 1072260.703692, 1602961601.2090, -6.3706, 0.006593, -0.00003169 }),
+             arg({ 450160.398036, -6962890.5431, 7.4722, 0.007702, -0.00005939 }) };
+}
+
+// Delaunay arguments followed by the mean longitudes of the planets and the general precession in longitude, in
+// radians (IERS Conventions 2003, Eqs. 5.43 and 5.44)
+std::array<double, 14> all_fundamental_arguments(const double& t)
+{
+    const auto delaunay  = fundamental_arguments(t);
+    const auto longitude = [&](const double& c0, const double& c1) { return std::fmod(c0 + c1 * t, TWO_PI); };
+    return { delaunay[0],
+             delaunay[1],
+             delaunay[2],
+             delaunay[3],
+             delaunay[4],
+             longitude(4.402608842, 2608.7903141574),
+             longitude(3.176146697, 1021.3285546211),
+             longitude(1.753470314, 628.3075849991),
+             longitude(6.203480913, 334.0612426700),
+             longitude(0.599546497, 52.9690962641),
+             longitude(0.874016757, 21.3299104960),
+             longitude(5.481293872, 7.4781598567),
+             longitude(5.311886287, 3.8133035638),
+             (0.02438175 + 0.00000538691 * t) * t };
+}
+
+// Luni-solar nutation term: multipliers of l, l', F, D, Omega, then the longitude coefficients (sin, t*sin, cos)
+// and obliquity coefficients (cos, t*cos, sin), in units of 0.1 microarcseconds
+struct NutationTerm {
+    std::array<int, 5> multipliers;
+    double psiSin, psiSinT, psiCos;
+    double epsCos, epsCosT, epsSin;
+};
+
+// Leading 77 luni-solar terms of the IAU 2000A nutation series (Mathews et al. 2002)
+constexpr std::array<NutationTerm, 77> NUTATION_TERMS = { {
+    { { 0, 0, 0, 0, 1 }, -172064161.0, -174666.0, 33386.0, 92052331.0, 9086.0, 15377.0 },
+    { { 0, 0, 2, -2, 2 }, -13170906.0, -1675.0, -13696.0, 5730336.0, -3015.0, -4587.0 },
+    { { 0, 0, 2, 0, 2 }, -2276413.0, -234.0, 2796.0, 978459.0, -485.0, 1374.0 },
+    { { 0, 0, 0, 0, 2 }, 2074554.0, 207.0, -698.0, -897492.0, 470.0, -291.0 },
+    { { 0, 1, 0, 0, 0 }, 1475877.0, -3633.0, 11817.0, 73871.0, -184.0, -1924.0 },
+    { { 0, 1, 2, -2, 2 }, -516821.0, 1226.0, -524.0, 224386.0, -677.0, -174.0 },
+    { { 1, 0, 0, 0, 0 }, 711159.0, 73.0, -872.0, -6750.0, 0.0, 358.0 },
+    { { 0, 0, 2, 0, 1 }, -387298.0, -367.0, 380.0, 200728.0, 18.0, 318.0 },
+    { { 1, 0, 2, 0, 2 }, -301461.0, -36.0, 816.0, 129025.0, -63.0, 367.0 },
+    { { 0, -1, 2, -2, 2 }, 215829.0, -494.0, 111.0, -95929.0, 299.0, 132.0 },
+    { { 0, 0, 2, -2, 1 }, 128227.0, 137.0, 181.0, -68982.0, -9.0, 39.0 },
+    { { -1, 0, 2, 0, 2 }, 123457.0, 11.0, 19.0, -53311.0, 32.0, -4.0 },
+    { { -1, 0, 0, 2, 0 }, 156994.0, 10.0, -168.0, -1235.0, 0.0, 82.0 },
+    { { 1, 0, 0, 0, 1 }, 63110.0, 63.0, 27.0, -33228.0, 0.0, -9.0 },
+    { { -1, 0, 0, 0, 1 }, -57976.0, -63.0, -189.0, 31429.0, 0.0, -75.0 },
+    { { -1, 0, 2, 2, 2 }, -59641.0, -11.0, 149.0, 25543.0, -11.0, 66.0 },
+    { { 1, 0, 2, 0, 1 }, -51613.0, -42.0, 129.0, 26366.0, 0.0, 78.0 },
+    { { -2, 0, 2, 0, 1 }, 45893.0, 50.0, 31.0, -24236.0, -10.0, 20.0 },
+    { { 0, 0, 0, 2, 0 }, 63384.0, 11.0, -150.0, -1220.0, 0.0, 29.0 },
+    { { 0, 0, 2, 2, 2 }, -38571.0, -1.0, 158.0, 16452.0, -11.0, 68.0 },
+    { { 0, -2, 2, -2, 2 }, 32481.0, 0.0, 0.0, -13870.0, 0.0, 0.0 },
+    { { -2, 0, 0, 2, 0 }, -47722.0, 0.0, -18.0, 477.0, 0.0, -25.0 },
+    { { 2, 0, 2, 0, 2 }, -31046.0, -1.0, 131.0, 13238.0, -11.0, 59.0 },
+    { { 1, 0, 2, -2, 2 }, 28593.0, 0.0, -1.0, -12338.0, 10.0, -3.0 },
+    { { -1, 0, 2, 0, 1 }, 20441.0, 21.0, 10.0, -10758.0, 0.0, -3.0 },
+    { { 2, 0, 0, 0, 0 }, 29243.0, 0.0, -74.0, -609.0, 0.0, 13.0 },
+    { { 0, 0, 2, 0, 0 }, 25887.0, 0.0, -66.0, -550.0, 0.0, 11.0 },
+    { { 0, 1, 0, 0, 1 }, -14053.0, -25.0, 79.0, 8551.0, -2.0, -45.0 },
+    { { -1, 0, 0, 2, 1 }, 15164.0, 10.0, 11.0, -8001.0, 0.0, -1.0 },
+    { { 0, 2, 2, -2, 2 }, -15794.0, 72.0, -16.0, 6850.0, -42.0, -5.0 },
+    { { 0, 0, -2, 2, 0 }, 21783.0, 0.0, 13.0, -167.0, 0.0, 13.0 },
+    { { 1, 0, 0, -2, 1 }, -12873.0, -10.0, -37.0, 6953.0, 0.0, -14.0 },
+    { { 0, -1, 0, 0, 1 }, -12654.0, 11.0, 63.0, 6415.0, 0.0, 26.0 },
+    { { -1, 0, 2, 2, 1 }, -10204.0, 0.0, 25.0, 5222.0, 0.0, 15.0 },
+    { { 0, 2, 0, 0, 0 }, 16707.0, -85.0, -10.0, 168.0, -1.0, 10.0 },
+    { { 1, 0, 2, 2, 2 }, -7691.0, 0.0, 44.0, 3268.0, 0.0, 19.0 },
+    { { -2, 0, 2, 0, 0 }, -11024.0, 0.0, -14.0, 104.0, 0.0, 2.0 },
+    { { 0, 1, 2, 0, 2 }, 7566.0, -21.0, -11.0, -3250.0, 0.0, -5.0 },
+    { { 0, 0, 2, 2, 1 }, -6637.0, -11.0, 25.0, 3353.0, 0.0, 14.0 },
+    { { 0, -1, 2, 0, 2 }, -7141.0, 21.0, 8.0, 3070.0, 0.0, 4.0 },
+    { { 0, 0, 0, 2, 1 }, -6302.0, -11.0, 2.0, 3272.0, 0.0, 4.0 },
+    { { 1, 0, 2, -2, 1 }, 5800.0, 10.0, 2.0, -3045.0, 0.0, -1.0 },
+    { { 2, 0, 2, -2, 2 }, 6443.0, 0.0, -7.0, -2768.0, 0.0, -4.0 },
+    { { -2, 0, 0, 2, 1 }, -5774.0, -11.0, -15.0, 3041.0, 0.0, -5.0 },
+    { { 2, 0, 2, 0, 1 }, -5350.0, 0.0, 21.0, 2695.0, 0.0, 12.0 },
+    { { 0, -1, 2, -2, 1 }, -4752.0, -11.0, -3.0, 2719.0, 0.0, -3.0 },
+    { { 0, 0, 0, -2, 1 }, -4940.0, -11.0, -21.0, 2720.0, 0.0, -9.0 },
+    { { -1, -1, 0, 2, 0 }, 7350.0, 0.0, -8.0, -51.0, 0.0, 4.0 },
+    { { 2, 0, 0, -2, 1 }, 4065.0, 0.0, 6.0, -2206.0, 0.0, 1.0 },
+    { { 1, 0, 0, 2, 0 }, 6579.0, 0.0, -24.0, -199.0, 0.0, 2.0 },
+    { { 0, 1, 2, -2, 1 }, 3579.0, 0.0, 5.0, -1900.0, 0.0, 1.0 },
+    { { 1, -1, 0, 0, 0 }, 4725.0, 0.0, -6.0, -41.0, 0.0, 3.0 },
+    { { -2, 0, 2, 0, 2 }, -3075.0, 0.0, -2.0, 1313.0, 0.0, -1.0 },
+    { { 3, 0, 2, 0, 2 }, -2904.0, 0.0, 15.0, 1233.0, 0.0, 7.0 },
+    { { 0, -1, 0, 2, 0 }, 4348.0, 0.0, -10.0, -81.0, 0.0, 2.0 },
+    { { 1, -1, 2, 0, 2 }, -2878.0, 0.0, 8.0, 1232.0, 0.0, 4.0 },
+    { { 0, 0, 0, 1, 0 }, -4230.0, 0.0, 5.0, -20.0, 0.0, -2.0 },
+    { { -1, -1, 2, 2, 2 }, -2819.0, 0.0, 7.0, 1207.0, 0.0, 3.0 },
+    { { -1, 0, 2, 0, 0 }, -4056.0, 0.0, 5.0, 40.0, 0.0, -2.0 },
+    { { 0, -1, 2, 2, 2 }, -2647.0, 0.0, 11.0, 1129.0, 0.0, 5.0 },
+    { { -2, 0, 0, 0, 1 }, -2294.0, 0.0, -10.0, 1266.0, 0.0, -4.0 },
+    { { 1, 1, 2, 0, 2 }, 2481.0, 0.0, -7.0, -1062.0, 0.0, -3.0 },
+    { { 2, 0, 0, 0, 1 }, 2179.0, 0.0, -2.0, -1129.0, 0.0, -2.0 },
+    { { -1, 1, 0, 1, 0 }, 3276.0, 0.0, 1.0, -9.0, 0.0, 0.0 },
+    { { 1, 1, 0, 0, 0 }, -3389.0, 0.0, 5.0, 35.0, 0.0, -2.0 },
+    { { 1, 0, 2, 0, 0 }, 3339.0, 0.0, -13.0, -107.0, 0.0, 1.0 },
+    { { -1, 0, 2, -2, 1 }, -1987.0, 0.0, -6.0, 1073.0, 0.0, -2.0 },
+    { { 1, 0, 0, 0, 2 }, -1981.0, 0.0, 0.0, 854.0, 0.0, 0.0 },
+    { { -1, 0, 0, 1, 0 }, 4026.0, 0.0, -353.0, -553.0, 0.0, -139.0 },
+    { { 0, 0, 2, 1, 2 }, 1660.0, 0.0, -5.0, -710.0, 0.0, -2.0 },
+    { { -1, 0, 2, 4, 2 }, -1521.0, 0.0, 9.0, 647.0, 0.0, 4.0 },
+    { { -1, 1, 0, 1, 1 }, 1314.0, 0.0, 0.0, -700.0, 0.0, 0.0 },
+    { { 0, -2, 2, -2, 1 }, -1283.0, 0.0, 0.0, 672.0, 0.0, 0.0 },
+    { { 1, 0, 2, 2, 1 }, -1331.0, 0.0, 8.0, 663.0, 0.0, 4.0 },
+    { { -2, 0, 2, 2, 2 }, 1383.0, 0.0, -2.0, -594.0, 0.0, -2.0 },
+    { { -1, 0, 0, 0, 2 }, 1405.0, 0.0, 4.0, -610.0, 0.0, 2.0 },
+    { { 1, 1, 2, -2, 2 }, 1290.0, 0.0, 0.0, -556.0, 0.0, 0.0 },
+} };
+
+// CIO locator series term: multipliers of l, l', F, D, Omega, then the sin and cos coefficients in microarcseconds
+struct CioLocatorTerm {
+    std::array<int, 5> multipliers;
+    double sinCoefficient, cosCoefficient;
+};
+
+// Periodic terms of s + XY/2 (IERS Conventions 2010, Table 5.2d), grouped by power of t
+constexpr std::array<CioLocatorTerm, 12> CIO_LOCATOR_TERMS_0 = { {
+    { { 0, 0, 0, 0, 1 }, -2640.73, 0.39 },
+    { { 0, 0, 0, 0, 2 }, -63.53, 0.02 },
+    { { 0, 0, 2, -2, 3 }, -11.75, -0.01 },
+    { { 0, 0, 2, -2, 1 }, -11.21, -0.01 },
+    { { 0, 0, 2, -2, 2 }, 4.57, 0.00 },
+    { { 0, 0, 2, 0, 3 }, -2.02, 0.00 },
+    { { 0, 0, 2, 0, 1 }, -1.98, 0.00 },
+    { { 0, 0, 0, 0, 3 }, 1.72, 0.00 },
+    { { 0, 1, 0, 0, 1 }, 1.41, 0.01 },
+    { { 0, 1, 0, 0, -1 }, 1.26, 0.01 },
+    { { 1, 0, 0, 0, -1 }, 0.63, 0.00 },
+    { { 1, 0, 0, 0, 1 }, 0.63, 0.00 },
+} };
+
+constexpr std::array<CioLocatorTerm, 3> CIO_LOCATOR_TERMS_1 = { {
+    { { 0, 0, 0, 0, 2 }, -0.07, 3.57 },
+    { { 0, 0, 0, 0, 1 }, 1.73, -0.03 },
+    { { 0, 0, 2, -2, 3 }, 0.00, 0.48 },
+} };
+
+constexpr std::array<CioLocatorTerm, 4> CIO_LOCATOR_TERMS_2 = { {
+    { { 0, 0, 0, 0, 1 }, 743.52, -0.17 },
+    { { 0, 0, 2, -2, 2 }, 56.91, 0.06 },
+    { { 0, 0, 2, 0, 2 }, 9.84, -0.01 },
+    { { 0, 0, 0, 0, 2 }, -8.85, 0.01 },
+} };
+
+constexpr std::array<CioLocatorTerm, 1> CIO_LOCATOR_TERMS_4 = { {
+    { { 0, 0, 0, 0, 1 }, -0.26, -0.01 },
+} };
+
+double argument(const std::array<int, 5>& multipliers, const std::array<double, 5>& fundamentals)
+{
+    double arg = 0.0;
+    for (std::size_t ii = 0; ii < 5; ++ii) {
+        arg += multipliers[ii] * fundamentals[ii];
+    }
+    return arg;
+}
+
+// Nutation in longitude and obliquity in radians (IAU 2000, adjusted for IAU 2006)
+std::array<double, 2> nutation(const double& t, const std::array<double, 5>& fundamentals)
+{
+    static constexpr double UNIT_TO_RAD = 1.0e-7 * ARCSEC_TO_RAD;
+
+    double dpsi = 0.0;
+    double deps = 0.0;
+    for (const auto& term : NUTATION_TERMS) {
+        const double arg  = argument(term.multipliers, fundamentals);
+        const double sarg = std::sin(arg);
+        const double carg = std::cos(arg);
+        dpsi += (term.psiSin + term.psiSinT * t) * sarg + term.psiCos * carg;
+        deps += (term.epsCos + term.epsCosT * t) * carg + term.epsSin * sarg;
+    }
+
+    // Fixed offsets standing in for the planetary terms (IAU 2000B)
+    dpsi = dpsi * UNIT_TO_RAD - 0.135e-3 * ARCSEC_TO_RAD;
+    deps = deps * UNIT_TO_RAD + 0.388e-3 * ARCSEC_TO_RAD;
+
+    // IAU 2006 adjustments for the J2 rate and the new precession
+    const double fj2 = -2.7774e-6 * t;
+    return { dpsi * (1.0 + 0.4697e-6 + fj2), deps * (1.0 + fj2) };
+}
+
+template <std::size_t N>
+double cio_locator_sum(const std::array<CioLocatorTerm, N>& terms, const std::array<double, 5>& fundamentals)
+{
+    double sum = 0.0;
+    for (const auto& term : terms) {
+        const double arg = argument(term.multipliers, fundamentals);
+        sum += term.sinCoefficient * std::sin(arg) + term.cosCoefficient * std::cos(arg);
+    }
+    return sum * 1.0e-6;
+}
+
+// CIO locator in radians, from the series for s + XY/2
+double cio_locator(const double& t, const std::array<double, 5>& fundamentals, const double& x, const double& y)
+{
+    const double sPlusHalfXy =
+        (0.000094 + cio_locator_sum(CIO_LOCATOR_TERMS_0, fundamentals)) +
+        t * (0.00380865 + cio_locator_sum(CIO_LOCATOR_TERMS_1, fundamentals) +
+             t * (-0.00012268 + cio_locator_sum(CIO_LOCATOR_TERMS_2, fundamentals) +
+                  t * (-0.07257411 + t * (0.00002798 + cio_locator_sum(CIO_LOCATOR_TERMS_4, fundamentals) + t * 0.00001562))));
+    return sPlusHalfXy * ARCSEC_TO_RAD - x * y / 2.0;
+}
+
+// Build a DCM from a raw matrix
+DCM<EarthCenteredInertial, InternationalTerrestrialReferenceFrame> to_dcm(const Matrix& r)
+{
+    return DCM<EarthCenteredInertial, InternationalTerrestrialReferenceFrame>{
+        detail::Matrix3{ r[0][0], r[0][1], r[0][2], r[1][0], r[1][1], r[1][2], r[2][0], r[2][1], r[2][2] }
+    };
+}
+
+} // namespace
+
+
+CelestialIntermediatePoleSeries::CelestialIntermediatePoleSeries(const std::filesystem::path& xFile, const std::filesystem::path& yFile) :
+    _xTerms(read_terms(xFile)),
+    _yTerms(read_terms(yFile))
+{
+}
+
+const std::optional<CelestialIntermediatePoleSeries>& CelestialIntermediatePoleSeries::get_instance()
+{
+    static const std::optional<CelestialIntermediatePoleSeries> series = []() -> std::optional<CelestialIntermediatePoleSeries> {
+        const char* root = std::getenv("ASTREA_ROOT");
+        if (!root) { return std::nullopt; }
+        const std::filesystem::path directory = std::filesystem::path(root) / "data" / "frames";
+        const std::filesystem::path xFile     = directory / "tab5.2a.txt";
+        const std::filesystem::path yFile     = directory / "tab5.2b.txt";
+        if (!std::filesystem::exists(xFile) || !std::filesystem::exists(yFile)) { return std::nullopt; }
+        return CelestialIntermediatePoleSeries(xFile, yFile);
+    }();
+    return series;
+}
+
+std::size_t CelestialIntermediatePoleSeries::size() const
+{
+    std::size_t nTerms = 0;
+    for (const auto& powerTerms : _xTerms) {
+        nTerms += powerTerms.size();
+    }
+    for (const auto& powerTerms : _yTerms) {
+        nTerms += powerTerms.size();
+    }
+    return nTerms;
+}
+
+CelestialIntermediatePole CelestialIntermediatePoleSeries::get_pole(const TwoPartJulianDate& tt) const
+{
+    using mp_units::angular::unit_symbols::rad;
+    static constexpr double MICROARCSEC_TO_RAD = 1.0e-6 * ARCSEC_TO_RAD;
+
+    const double t        = julian_centuries(tt);
+    const auto arguments  = all_fundamental_arguments(t);
+    const auto polynomial = [&](const std::array<double, 6>& c) {
+        return c[0] + t * (c[1] + t * (c[2] + t * (c[3] + t * (c[4] + t * c[5]))));
+    };
+
+    // Polynomial parts of X and Y, in microarcseconds, from the headers of the tables
+    const double x =
+        (polynomial({ -16617.0, 2004191898.0, -429782.9, -198618.34, 7.578, 5.9285 }) + sum_terms(_xTerms, t, arguments)) *
+        MICROARCSEC_TO_RAD;
+    const double y =
+        (polynomial({ -6951.0, -25896.0, -22407274.7, 1900.59, 1112.526, 0.1358 }) + sum_terms(_yTerms, t, arguments)) *
+        MICROARCSEC_TO_RAD;
+
+    const std::array<double, 5> fundamentals = { arguments[0], arguments[1], arguments[2], arguments[3], arguments[4] };
+    return { x * rad, y * rad, cio_locator(t, fundamentals, x, y) * rad };
+}
+
+std::vector<std::vector<CelestialIntermediatePoleSeries::Term>> CelestialIntermediatePoleSeries::read_terms(const std::filesystem::path& file)
+{
+    std::ifstream stream(file);
+    if (!stream) { throw std::runtime_error("Unable to open CIP series file: " + file.string()); }
+
+    // Terms are listed in blocks headed "j = <power of t>". Each row holds the index of the term, its sin and cos
+    // coefficients and the 14 multipliers; every other line is a description or a column header.
+    std::vector<std::vector<Term>> terms;
+    std::optional<std::size_t> power;
+    std::string line;
+    while (std::getline(stream, line)) {
+        const std::size_t start = line.find_first_not_of(' ');
+        if (start == std::string::npos) { continue; }
+        if (line[start] == 'j' && line.find('=') != std::string::npos) {
+            std::size_t newPower;
+            if (!(std::istringstream(line.substr(line.find('=') + 1)) >> newPower)) {
+                throw std::runtime_error("Malformed line in " + file.string() + ": " + line);
+            }
+            power = newPower;
+            terms.resize(std::max(terms.size(), newPower + 1));
+            continue;
+        }
+
+        std::istringstream lineStream(line);
+        std::size_t index;
+        Term term;
+        if (!(lineStream >> index >> term.sinCoefficient >> term.cosCoefficient)) { continue; }
+        for (int& multiplier : term.multipliers) {
+            if (!(lineStream >> multiplier)) { throw std::runtime_error("Malformed line in " + file.string() + ": " + line); }
+        }
+        if (!power) { throw std::runtime_error("CIP series term found before a power of t in " + file.string()); }
+        terms[*power].push_back(term);
+    }
+    if (std::all_of(terms.begin(), terms.end(), [](const auto& powerTerms) { return powerTerms.empty(); })) {
+        throw std::runtime_error("No terms found in CIP series file: " + file.string());
+    }
+    return terms;
+}
+
+double CelestialIntermediatePoleSeries::sum_terms(const std::vector<std::vector<Term>>& terms, const double& t, const std::array<double, 14>& arguments)
+{
+    double sum    = 0.0;
+    double tPower = 1.0;
+    for (const auto& powerTerms : terms) {
+        double powerSum = 0.0;
+        for (const auto& term : powerTerms) {
+            double arg = 0.0;
+            for (std::size_t ii = 0; ii < 14; ++ii) {
+                arg += term.multipliers[ii] * arguments[ii];
+            }
+            powerSum += term.sinCoefficient * std::sin(arg) + term.cosCoefficient * std::cos(arg);
+        }
+        sum += powerSum * tPower;
+        tPower *= t;
+    }
+    return sum;
+}
+
+
+CelestialIntermediatePole get_celestial_intermediate_pole(const TwoPartJulianDate& tt)
+{
+    using mp_units::angular::unit_symbols::rad;
+
+    if (const auto& series = CelestialIntermediatePoleSeries::get_instance()) { return series->get_pole(tt); }
+
+    // IAU 2000B fallback
+    const double t          = julian_centuries(tt);
+    const auto fundamentals = fundamental_arguments(t);
+    const auto [dpsi, deps] = nutation(t, fundamentals);
+    const auto polynomial   = [&](const std::array<double, 6>& c) {
+        return (c[0] + t * (c[1] + t * (c[2] + t * (c[3] + t * (c[4] + t * c[5]))))) * ARCSEC_TO_RAD;
+    };
+
+    // IAU 2006 Fukushima-Williams bias-precession angles
+    const double gamma = polynomial({ -0.052928, 10.556378, 0.4932044, -0.00031238, -0.000002788, 0.0000000260 });
+    const double phi   = polynomial({ 84381.412819, -46.811016, 0.0511268, 0.00053289, -0.000000440, -0.0000000176 });
+    const double psi   = polynomial({ -0.041775, 5038.481484, 1.5584175, -0.00018522, -0.000026452, -0.0000000148 });
+    const double eps   = polynomial({ 84381.406, -46.836769, -0.0001831, 0.00200340, -0.000000576, -0.0000000434 });
+
+    // The CIP is the third row of the bias-precession-nutation matrix
+    Matrix npb = IDENTITY;
+    rotate_z(gamma, npb);
+    rotate_x(phi, npb);
+    rotate_z(-(psi + dpsi), npb);
+    rotate_x(-(eps + deps), npb);
+    const double x = npb[2][0];
+    const double y = npb[2][1];
+
+    return { x * rad, y * rad, cio_locator(t, fundamentals, x, y) * rad };
+}
+
+Angle earth_rotation_angle(const TwoPartJulianDate& ut1)
+{
+    using mp_units::angular::unit_symbols::rad;
+
+    // The day part of a two-part date is integral, so the fraction alone carries the fraction of the day
+    const double t = (ut1.day() - J2000_DAY) + ut1.fraction();
+    double theta   = std::fmod(TWO_PI * (ut1.fraction() + 0.7790572732640 + 0.00273781191135448 * t), TWO_PI);
+    if (theta < 0.0) { theta += TWO_PI; }
+    return theta * rad;
+}
+
+Angle terrestrial_intermediate_origin_locator(const TwoPartJulianDate& tt)
+{
+    using mp_units::angular::unit_symbols::rad;
+    return -47.0e-6 * julian_centuries(tt) * ARCSEC_TO_RAD * rad;
+}
+
+DCM<EarthCenteredInertial, InternationalTerrestrialReferenceFrame> get_celestial_to_terrestrial_dcm(
+    const CelestialIntermediatePole& pole,
+    const Angle& earthRotationAngle,
+    const PolarMotion& polarMotion,
+    const Angle& tioLocator
+)
+{
+    using mp_units::angular::unit_symbols::rad;
+
+    const double x = pole.x.numerical_value_in(rad);
+    const double y = pole.y.numerical_value_in(rad);
+    const double s = pole.s.numerical_value_in(rad);
+
+    // GCRS to CIRS
+    const double r2 = x * x + y * y;
+    const double e  = (r2 > 0.0) ? std::atan2(y, x) : 0.0;
+    const double d  = std::atan(std::sqrt(r2 / (1.0 - r2)));
+    Matrix rotation = IDENTITY;
+    rotate_z(e, rotation);
+    rotate_y(d, rotation);
+    rotate_z(-(e + s), rotation);
+
+    // CIRS to TIRS
+    rotate_z(earthRotationAngle.numerical_value_in(rad), rotation);
+
+    // TIRS to ITRS
+    Matrix polar = IDENTITY;
+    rotate_z(tioLocator.numerical_value_in(rad), polar);
+    rotate_y(-polarMotion.x.numerical_value_in(rad), polar);
+    rotate_x(-polarMotion.y.numerical_value_in(rad), polar);
+
+    return to_dcm(multiply(polar, rotation));
+}
+
+DCM<EarthCenteredInertial, InternationalTerrestrialReferenceFrame> get_celestial_to_terrestrial_dcm(const Date& date)
+{
+    const TwoPartJulianDate tt = date.tt();
+    return get_celestial_to_terrestrial_dcm(
+        get_celestial_intermediate_pole(tt),
+        earth_rotation_angle(date.ut1()),
+        EarthOrientationTable::get_instance().polar_motion(date.two_part_jd()),
+        terrestrial_intermediate_origin_locator(tt)
+    );
+}
+
+} // namespace astro
+} // namespace astrea
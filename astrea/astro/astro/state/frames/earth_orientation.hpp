@@ -0,0 +1,174 @@
+/**
+ * @file earth_orientation.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief IAU 2006/2000 CIO-based transformation between the celestial (GCRS) and terrestrial (ITRS) frames.
+ * @details The transformation follows the IERS Conventions (2010), Chapter 5, and the algorithms of the IAU SOFA
+ *          library: the CIP coordinates X, Y come from the IAU 2006/2000A series (or the IAU 2000B fallback), the CIO
+ *          locator s from its series, and the Earth rotation angle and polar motion complete the rotation.
+ * @version 0.1
+ * @date 2025-08-06
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <array>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+#include <units/units.hpp>
+
+#include <astro/astro.fwd.hpp>
+#include <astro/state/frames/instances/EarthCenteredInertial.hpp>
+#include <astro/state/frames/types/DirectionCosineMatrix.hpp>
+#include <astro/time/Date.hpp>
+#include <astro/time/TimeScales.hpp>
+#include <astro/time/TwoPartJulianDate.hpp>
+
+namespace astrea {
+namespace astro {
+
+/**
+ * @brief Position of the Celestial Intermediate Pole (CIP) and Celestial Intermediate Origin (CIO) in the GCRS.
+ */
+struct CelestialIntermediatePole {
+    Angle x; //!< CIP X coordinate
+    Angle y; //!< CIP Y coordinate
+    Angle s; //!< CIO locator
+};
+
+/**
+ * @brief The full IAU 2006/2000A series for the CIP coordinates X and Y, read from the tab5.2a.txt and tab5.2b.txt
+ * files that accompany Chapter 5 of the IERS Conventions (2010).
+ *
+ * The tables hold every luni-solar and planetary term of the series, which is evaluated directly for X and Y rather
+ * than through a nutation matrix.
+ */
+class CelestialIntermediatePoleSeries {
+  public:
+    /**
+     * @brief Construct a CelestialIntermediatePoleSeries from the IERS tables.
+     *
+     * @param xFile Path to Table 5.2a, the series for X.
+     * @param yFile Path to Table 5.2b, the series for Y.
+     */
+    CelestialIntermediatePoleSeries(const std::filesystem::path& xFile, const std::filesystem::path& yFile);
+
+    /**
+     * @brief Destructor for CelestialIntermediatePoleSeries.
+     */
+    ~CelestialIntermediatePoleSeries() = default;
+
+    /**
+     * @brief Get the default series, loaded once from $ASTREA_ROOT/data/frames/tab5.2a.txt and tab5.2b.txt.
+     *
+     * @return const std::optional<CelestialIntermediatePoleSeries>& The series, or empty if the tables are not present.
+     */
+    static const std::optional<CelestialIntermediatePoleSeries>& get_instance();
+
+    /**
+     * @brief Get the number of periodic terms in the series for X and Y.
+     *
+     * @return std::size_t The number of terms.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Evaluate the series for the CIP coordinates and CIO locator.
+     *
+     * @param tt The TT date.
+     * @return CelestialIntermediatePole The CIP coordinates and CIO locator.
+     */
+    CelestialIntermediatePole get_pole(const TwoPartJulianDate& tt) const;
+
+  private:
+    /**
+     * @brief Periodic term of the series: multipliers of the 14 fundamental arguments and the sin and cos coefficients.
+     */
+    struct Term {
+        std::array<int, 14> multipliers; //!< Multipliers of l, l', F, D, Omega, the planetary longitudes and p_A
+        double sinCoefficient;           //!< Coefficient of the sine, in microarcseconds
+        double cosCoefficient;           //!< Coefficient of the cosine, in microarcseconds
+    };
+
+    std::vector<std::vector<Term>> _xTerms; //!< Periodic terms of X, grouped by power of t
+    std::vector<std::vector<Term>> _yTerms; //!< Periodic terms of Y, grouped by power of t
+
+    /**
+     * @brief Read the periodic terms of one of the IERS tables.
+     *
+     * @param file Path to the table.
+     * @return std::vector<std::vector<Term>> The terms, grouped by power of t.
+     */
+    static std::vector<std::vector<Term>> read_terms(const std::filesystem::path& file);
+
+    /**
+     * @brief Sum the periodic terms of a series.
+     *
+     * @param terms The terms, grouped by power of t.
+     * @param t Julian centuries of TT since J2000.
+     * @param arguments The 14 fundamental arguments, in radians.
+     * @return double The sum, in microarcseconds.
+     */
+    static double sum_terms(const std::vector<std::vector<Term>>& terms, const double& t, const std::array<double, 14>& arguments);
+};
+
+/**
+ * @brief Evaluate the IAU 2006 precession and IAU 2000A nutation series for the CIP coordinates and CIO locator.
+ *
+ * The IERS tables ship in data/frames, and when $ASTREA_ROOT points at them the full series is evaluated through the
+ * default CelestialIntermediatePoleSeries. Otherwise nutation falls back to IAU 2000B: the leading 77 luni-solar terms of
+ * IAU 2000A with fixed offsets standing in for the planetary terms, adjusted for IAU 2006. The fallback agrees with
+ * the full series to about 1 mas between 1995 and 2050.
+ *
+ * @param tt The TT date.
+ * @return CelestialIntermediatePole The CIP coordinates and CIO locator.
+ */
+CelestialIntermediatePole get_celestial_intermediate_pole(const TwoPartJulianDate& tt);
+
+/**
+ * @brief Get the Earth rotation angle (IAU 2000).
+ *
+ * @param ut1 The UT1 date.
+ * @return Angle The Earth rotation angle, in [0, 2*pi).
+ */
+Angle earth_rotation_angle(const TwoPartJulianDate& ut1);
+
+/**
+ * @brief Get the Terrestrial Intermediate Origin (TIO) locator s'.
+ *
+ * @param tt The TT date.
+ * @return Angle The TIO locator.
+ */
+Angle terrestrial_intermediate_origin_locator(const TwoPartJulianDate& tt);
+
+/**
+ * @brief Build the GCRS to ITRS DCM from its components.
+ *
+ * @param pole The CIP coordinates and CIO locator.
+ * @param earthRotationAngle The Earth rotation angle.
+ * @param polarMotion The coordinates of the pole in the ITRS.
+ * @param tioLocator The TIO locator s'.
+ * @return DCM<EarthCenteredInertial, InternationalTerrestrialReferenceFrame> The DCM from ECI (GCRS) to ITRF.
+ */
+DCM<EarthCenteredInertial, InternationalTerrestrialReferenceFrame> get_celestial_to_terrestrial_dcm(
+    const CelestialIntermediatePole& pole,
+    const Angle& earthRotationAngle,
+    const PolarMotion& polarMotion,
+    const Angle& tioLocator
+);
+
+/**
+ * @brief Get the GCRS to ITRS DCM at a date, evaluating the full series.
+ *
+ * UT1 and polar motion are taken from the default EarthOrientationTable.
+ *
+ * @param date The UTC date.
+ * @return DCM<EarthCenteredInertial, InternationalTerrestrialReferenceFrame> The DCM from ECI (GCRS) to ITRF.
+ */
+DCM<EarthCenteredInertial, InternationalTerrestrialReferenceFrame> get_celestial_to_terrestrial_dcm(const Date& date);
+
+} // namespace astro
+} // namespace astrea
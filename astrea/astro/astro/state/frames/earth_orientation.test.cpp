@@ -0,0 +1,261 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <numbers>
+
+#include <math/test_util.hpp>
+#include <units/units.hpp>
+
+#include <astro/state/CartesianVector.hpp>
+#include <astro/state/frames/earth_orientation.hpp>
+#include <astro/state/frames/frames.hpp>
+#include <astro/time/Date.hpp>
+#include <astro/time/TimeScales.hpp>
+#include <tests/utilities/comparisons.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace mp_units;
+using mp_units::angular::unit_symbols::rad;
+using mp_units::si::unit_symbols::km;
+
+// Reference values are from the IAU SOFA library test suite (t_sofa_c.c) and the SOFA "Tools for Earth Attitude"
+// cookbook example for 2007-04-05 12:00 UTC
+class EarthOrientationTest : public testing::Test {
+  public:
+    EarthOrientationTest() {}
+
+    void SetUp() override
+    {
+        xFile = std::filesystem::temp_directory_path() / "astrea_earth_orientation_test_x.txt";
+        yFile = std::filesystem::temp_directory_path() / "astrea_earth_orientation_test_y.txt";
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(xFile);
+        std::filesystem::remove(yFile);
+    }
+
+    // Get the columns of a DCM by rotating the unit vectors
+    template <typename In_Frame_T, typename Out_Frame_T>
+    static std::array<std::array<double, 3>, 3> to_matrix(const DCM<In_Frame_T, Out_Frame_T>& dcm)
+    {
+        std::array<std::array<double, 3>, 3> matrix;
+        for (std::size_t jj = 0; jj < 3; ++jj) {
+            CartesianVector<Unitless, In_Frame_T> unit(0.0 * one, 0.0 * one, 0.0 * one);
+            unit[jj]                                     = 1.0 * one;
+            const CartesianVector<Unitless, Out_Frame_T> column = dcm * unit;
+            for (std::size_t ii = 0; ii < 3; ++ii) {
+                matrix[ii][jj] = column[ii].numerical_value_in(one);
+            }
+        }
+        return matrix;
+    }
+
+    static void assert_matrix_near(const std::array<std::array<double, 3>, 3>& matrix, const std::array<std::array<double, 3>, 3>& expected, const double& tol)
+    {
+        for (std::size_t ii = 0; ii < 3; ++ii) {
+            for (std::size_t jj = 0; jj < 3; ++jj) {
+                ASSERT_NEAR(matrix[ii][jj], expected[ii][jj], tol) << "Element (" << ii << ", " << jj << ")";
+            }
+        }
+    }
+
+    static constexpr double ARCSEC_TO_RAD = std::numbers::pi / 648000.0;
+
+    // The cookbook matrix includes the observed celestial pole offsets, ~0.3 mas (~1.5e-9 rad), which the series do
+    // not model
+    static constexpr double SERIES_TOL      = 5.0e-9;
+    static constexpr double FULL_SERIES_TOL = 1.0e-12;
+
+    // Celestial pole offsets dX, dY used by the cookbook for 2007-04-05
+    static constexpr double COOKBOOK_DX = 0.1750e-3 * ARCSEC_TO_RAD;
+    static constexpr double COOKBOOK_DY = -0.2259e-3 * ARCSEC_TO_RAD;
+
+    std::filesystem::path xFile;
+    std::filesystem::path yFile;
+
+    const std::array<std::array<double, 3>, 3> COOKBOOK_C2T = { {
+        { +0.973104317697535, +0.230363826239128, -0.000703163482198 },
+        { -0.230363800456037, +0.973104570632801, +0.000118545366625 },
+        { +0.000711560162668, +0.000046626403995, +0.999999745754024 },
+    } };
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(EarthOrientationTest, CelestialIntermediatePole)
+{
+    // The default path evaluates the full series from the shipped IERS tables
+    const CelestialIntermediatePole pole = get_celestial_intermediate_pole(TwoPartJulianDate(2400000.5, 53736.0));
+    ASSERT_NEAR(pole.x.numerical_value_in(rad), 0.5791308486706011000e-3, FULL_SERIES_TOL);
+    ASSERT_NEAR(pole.y.numerical_value_in(rad), 0.4020579816732961219e-4, FULL_SERIES_TOL);
+    ASSERT_NEAR(pole.s.numerical_value_in(rad), -0.1220032213076463117e-7, 1.0e-11);
+}
+
+TEST_F(EarthOrientationTest, EarthRotationAngle)
+{
+    ASSERT_NEAR(earth_rotation_angle(TwoPartJulianDate(2400000.5, 54388.0)).numerical_value_in(rad), 0.4022837240028158102, 1.0e-12);
+}
+
+TEST_F(EarthOrientationTest, TerrestrialIntermediateOriginLocator)
+{
+    ASSERT_NEAR(
+        terrestrial_intermediate_origin_locator(TwoPartJulianDate(2400000.5, 52541.0)).numerical_value_in(rad), -0.6216698469981019309e-11, 1.0e-20
+    );
+}
+
+TEST_F(EarthOrientationTest, PolarMotionMatrix)
+{
+    // With no precession-nutation or Earth rotation the DCM reduces to the polar motion matrix
+    const CelestialIntermediatePole pole{ 0.0 * rad, 0.0 * rad, 0.0 * rad };
+    const PolarMotion polarMotion{ 2.55060238e-7 * rad, 1.860359247e-6 * rad };
+    const auto dcm = get_celestial_to_terrestrial_dcm(pole, 0.0 * rad, polarMotion, -0.1367174580728891460e-10 * rad);
+
+    assert_matrix_near(
+        to_matrix(dcm),
+        { { { 0.9999999999999674721, -0.1367174580728846989e-10, 0.2550602379999972345e-6 },
+            { 0.1414624947957029801e-10, 0.9999999999982695317, -0.1860359246998866389e-5 },
+            { -0.2550602379741215021e-6, 0.1860359247002414021e-5, 0.9999999999982370039 } } },
+        1.0e-12
+    );
+}
+
+TEST_F(EarthOrientationTest, CookbookExample)
+{
+    const TwoPartJulianDate tt(2400000.5, 54195.5 + 65.184 / 86400.0);
+    const TwoPartJulianDate ut1(2400000.5, 54195.5 - 0.072073685 / 86400.0);
+    const PolarMotion polarMotion{ 0.0349282 * ARCSEC_TO_RAD * rad, 0.4833163 * ARCSEC_TO_RAD * rad };
+
+    const auto dcm = get_celestial_to_terrestrial_dcm(
+        get_celestial_intermediate_pole(tt), earth_rotation_angle(ut1), polarMotion, terrestrial_intermediate_origin_locator(tt)
+    );
+    assert_matrix_near(to_matrix(dcm), COOKBOOK_C2T, SERIES_TOL);
+}
+
+TEST_F(EarthOrientationTest, CookbookExampleFromDate)
+{
+    // UT1 and polar motion come from the default table
+    const Date date("2007-04-05 12:00:00");
+    const TwoPartJulianDate tt           = date.tt();
+    const EarthOrientationParameters eop = EarthOrientationTable::get_instance().get_parameters(date.two_part_jd());
+    ASSERT_TRUE(eop.isTabulated);
+    ASSERT_NEAR((date.ut1() - date.two_part_jd()).count(), eop.ut1MinusUtc.count(), 1.0e-9);
+
+    const auto expected = get_celestial_to_terrestrial_dcm(
+        get_celestial_intermediate_pole(tt),
+        earth_rotation_angle(date.ut1()),
+        eop.polarMotion,
+        terrestrial_intermediate_origin_locator(tt)
+    );
+    assert_matrix_near(to_matrix(get_celestial_to_terrestrial_dcm(date)), to_matrix(expected), 1.0e-14);
+    assert_matrix_near(to_matrix(ITRF::get_dcm(date)), to_matrix(expected), 1.0e-14);
+
+    // The current IERS values agree with the cookbook's to ~0.02 ms in UT1-UTC and ~0.5 mas in polar motion
+    assert_matrix_near(to_matrix(get_celestial_to_terrestrial_dcm(date)), COOKBOOK_C2T, SERIES_TOL);
+}
+
+TEST_F(EarthOrientationTest, FrameRoundTrip)
+{
+    const Date date("2025-08-06 12:34:56");
+    const RadiusVector<ECI> position(7000.0 * km, -1234.0 * km, 567.0 * km);
+
+    const RadiusVector<ITRF> itrf = position.in_frame<ITRF>(date);
+    ASSERT_EQ_CART_VEC(itrf.in_frame<ECI>(date), position, 1.0e-14 * one, 1.0e-10 * one);
+    ASSERT_EQ_QUANTITY(itrf.norm(), position.norm(), 1.0e-14 * one);
+}
+
+TEST_F(EarthOrientationTest, SeriesFromFile)
+{
+    // Tables in the IERS layout, with a term on Omega and constant terms for t^0 and t^1
+    {
+        std::ofstream file(xFile);
+        file << " X = -16617. + 2004191898. t - 429782.9 t^2 - 198618.34 t^3 + 7.578 t^4 + 5.9285 t^5\n"
+             << "     i    (a_{s,j})_i      (a_{c,j})_i    l    l'   F    D   Om L_Me L_Ve  L_E L_Ma  L_J L_Sa  L_U L_Ne  p_A\n"
+             << " j = 0  Number of terms = 2\n\n"
+             << "     1       100.00       200.00    0    0    0    0    0    0    0    0    0    0    0    0    0    0\n"
+             << "     2        50.00         0.00    0    0    0    0    1    0    0    0    0    0    0    0    0    0\n";
+    }
+    {
+        std::ofstream file(yFile);
+        file << " j = 0  Number of terms = 1\n"
+             << "     1         0.00       300.00    0    0    0    0    0    0    0    0    0    0    0    0    0    0\n"
+             << " j = 1  Number of terms = 1\n"
+             << "     2         0.00        10.00    0    0    0    0    0    0    0    0    0    0    0    0    0    0\n";
+    }
+    const CelestialIntermediatePoleSeries series(xFile, yFile);
+    ASSERT_EQ(series.size(), 4);
+
+    static constexpr double MICROARCSEC_TO_RAD = 1.0e-6 * ARCSEC_TO_RAD;
+    const double omega                         = std::fmod(450160.398036, 1296000.0) * ARCSEC_TO_RAD;
+    const CelestialIntermediatePole pole       = series.get_pole(TwoPartJulianDate(2451545.0));
+    ASSERT_NEAR(pole.x.numerical_value_in(rad), (-16617.0 + 200.0 + 50.0 * std::sin(omega)) * MICROARCSEC_TO_RAD, 1.0e-15);
+    ASSERT_NEAR(pole.y.numerical_value_in(rad), (-6951.0 + 300.0) * MICROARCSEC_TO_RAD, 1.0e-15);
+
+    // One century later the t^1 term applies in full
+    const double yPolynomial = -6951.0 - 25896.0 - 22407274.7 + 1900.59 + 1112.526 + 0.1358;
+    const CelestialIntermediatePole later = series.get_pole(TwoPartJulianDate(2451545.0 + 36525.0));
+    ASSERT_NEAR(later.y.numerical_value_in(rad), (yPolynomial + 300.0 + 10.0) * MICROARCSEC_TO_RAD, 1.0e-15);
+}
+
+TEST_F(EarthOrientationTest, MalformedSeriesThrows)
+{
+    ASSERT_ANY_THROW(CelestialIntermediatePoleSeries(xFile / "missing.txt", yFile / "missing.txt"));
+    {
+        std::ofstream file(yFile);
+        file << " j = 0\n     1  0.00  300.00    0    0    0    0    0    0    0    0    0    0    0    0    0    0\n";
+    }
+    {
+        std::ofstream file(xFile);
+        file << " j = 0\n     1  100.00  200.00    0    0    0    0    0\n";
+    }
+    ASSERT_ANY_THROW(CelestialIntermediatePoleSeries(xFile, yFile));
+    {
+        std::ofstream file(xFile);
+        file << "     1  100.00  200.00    0    0    0    0    0    0    0    0    0    0    0    0    0    0\n";
+    }
+    ASSERT_ANY_THROW(CelestialIntermediatePoleSeries(xFile, yFile));
+    {
+        std::ofstream file(xFile);
+        file << " X = -16617. + 2004191898. t\n j = 0  Number of terms = 0\n";
+    }
+    ASSERT_ANY_THROW(CelestialIntermediatePoleSeries(xFile, yFile));
+}
+
+TEST_F(EarthOrientationTest, FullSeries)
+{
+    const auto& series = CelestialIntermediatePoleSeries::get_instance();
+    ASSERT_TRUE(series.has_value()) << "IERS Tables 5.2a and 5.2b are not in $ASTREA_ROOT/data/frames";
+
+    // Every term of Tables 5.2a and 5.2b
+    ASSERT_EQ(series->size(), 1600 + 1275);
+
+    // XY06 and S06
+    const CelestialIntermediatePole pole = series->get_pole(TwoPartJulianDate(2400000.5, 53736.0));
+    ASSERT_NEAR(pole.x.numerical_value_in(rad), 0.5791308486706011000e-3, FULL_SERIES_TOL);
+    ASSERT_NEAR(pole.y.numerical_value_in(rad), 0.4020579816732961219e-4, FULL_SERIES_TOL);
+    ASSERT_NEAR(pole.s.numerical_value_in(rad), -0.1220032213076463117e-7, 1.0e-11);
+
+    // The cookbook matrix includes the observed celestial pole offsets. The CIO locator series is truncated at
+    // 0.5 microarcseconds, which bounds the agreement at ~1e-11.
+    const TwoPartJulianDate tt(2400000.5, 54195.5 + 65.184 / 86400.0);
+    const TwoPartJulianDate ut1(2400000.5, 54195.5 - 0.072073685 / 86400.0);
+    const PolarMotion polarMotion{ 0.0349282 * ARCSEC_TO_RAD * rad, 0.4833163 * ARCSEC_TO_RAD * rad };
+    CelestialIntermediatePole cookbookPole = series->get_pole(tt);
+    cookbookPole.x += COOKBOOK_DX * rad;
+    cookbookPole.y += COOKBOOK_DY * rad;
+
+    const auto dcm =
+        get_celestial_to_terrestrial_dcm(cookbookPole, earth_rotation_angle(ut1), polarMotion, terrestrial_intermediate_origin_locator(tt));
+    assert_matrix_near(to_matrix(dcm), COOKBOOK_C2T, 1.0e-11);
+}
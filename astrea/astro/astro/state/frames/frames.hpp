@@ -13,6 +13,7 @@
 // static state/frames
 #include <astro/state/frames/instances/EarthCenteredEarthFixed.hpp>
 #include <astro/state/frames/instances/EarthCenteredInertial.hpp>
+#include <astro/state/frames/instances/InternationalTerrestrialReferenceFrame.hpp>
 
 // dynamic state/frames
 #include <astro/state/frames/instances/LocalHorizontalLocalVertical.hpp>
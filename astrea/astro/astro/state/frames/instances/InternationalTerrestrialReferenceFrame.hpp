@@ -0,0 +1,106 @@
+/**
+ * @file InternationalTerrestrialReferenceFrame.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief Header file for the InternationalTerrestrialReferenceFrame class in the astro namespace
+ * @version 0.1
+ * @date 2025-08-06
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <units/units.hpp>
+
+#include <astro/astro.fwd.hpp>
+#include <astro/state/CartesianVector.hpp>
+#include <astro/state/frames/earth_orientation.hpp>
+#include <astro/state/frames/instances/EarthCenteredInertial.hpp>
+#include <astro/state/frames/types/DirectionCosineMatrix.hpp>
+#include <astro/state/frames/types/RotatingFrame.hpp>
+#include <astro/time/Date.hpp>
+
+namespace astrea {
+namespace astro {
+
+/**
+ * @brief Class representing the International Terrestrial Reference Frame (ITRF).
+ *
+ * Unlike EarthCenteredEarthFixed, which only rotates by the sidereal angle, the rotation into this frame includes
+ * IAU 2006/2000 precession-nutation, the Earth rotation angle from UT1, and polar motion. EarthCenteredInertial is
+ * treated as the GCRF.
+ *
+ * @note This frame contiains the following conversions:
+ * - ITRF to ITRF
+ * - ECI to ITRF
+ * - ITRF to ECI
+ */
+class InternationalTerrestrialReferenceFrame :
+    public RotatingFrame<InternationalTerrestrialReferenceFrame, EarthCenteredInertial> {
+
+  public:
+    /**
+     * @brief Default constructor for InternationalTerrestrialReferenceFrame.
+     *
+     * Initializes the ITRF frame with a name and origin.
+     */
+    InternationalTerrestrialReferenceFrame() :
+        RotatingFrame<InternationalTerrestrialReferenceFrame, EarthCenteredInertial>("International Terrestrial Reference Frame", "Earth") {};
+
+    /**
+     * @brief Default destructor for InternationalTerrestrialReferenceFrame.
+     */
+    ~InternationalTerrestrialReferenceFrame() = default;
+
+    /**
+     * @brief Converts a CartesianVector from Earth-Centered Inertial (ECI) to ITRF coordinates.
+     *
+     * @tparam Value_T The type of the vector components.
+     * @param eciVec The CartesianVector in ECI coordinates.
+     * @param date The date for which the conversion is performed.
+     * @return CartesianVector<Value_T, InternationalTerrestrialReferenceFrame> The converted CartesianVector in ITRF coordinates.
+     */
+    template <typename Value_T>
+    static CartesianVector<Value_T, InternationalTerrestrialReferenceFrame>
+        rotate_into_this_frame(const CartesianVector<Value_T, EarthCenteredInertial>& eciVec, const Date& date)
+    {
+        return get_dcm(date) * eciVec;
+    }
+
+    /**
+     * @brief Converts a CartesianVector from ITRF to Earth-Centered Inertial (ECI) coordinates.
+     *
+     * @tparam Value_T The type of the vector components.
+     * @param itrfVec The CartesianVector in ITRF coordinates.
+     * @param date The date for which the conversion is performed.
+     * @return CartesianVector<Value_T, EarthCenteredInertial> The converted CartesianVector in ECI coordinates.
+     */
+    template <typename Value_T>
+    static CartesianVector<Value_T, EarthCenteredInertial>
+        rotate_out_of_this_frame(const CartesianVector<Value_T, InternationalTerrestrialReferenceFrame>& itrfVec, const Date& date)
+    {
+        return get_dcm(date).transpose() * itrfVec;
+    }
+
+    /**
+     * @brief Get the Direction Cosine Matrix (DCM) for the ITRF frame at a given date.
+     *
+     * This evaluates the full precession-nutation series. Use a CelestialIntermediatePoleCache when rotating many
+     * vectors over a span of time.
+     *
+     * @param date The date for which to get the DCM.
+     * @return DirectionCosineMatrix<EarthCenteredInertial, InternationalTerrestrialReferenceFrame> The DCM from ECI to ITRF.
+     */
+    static DirectionCosineMatrix<EarthCenteredInertial, InternationalTerrestrialReferenceFrame> get_dcm(const Date& date)
+    {
+        return get_celestial_to_terrestrial_dcm(date);
+    }
+};
+
+/**
+ * @brief Alias for InternationalTerrestrialReferenceFrame.
+ */
+using ITRF = InternationalTerrestrialReferenceFrame; // Alias for convenience
+
+} // namespace astro
+} // namespace astrea
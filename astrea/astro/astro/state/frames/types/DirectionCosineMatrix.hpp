@@ -11,23 +11,28 @@
 #pragma once
 
 #include <array>
+#include <cmath>
+#include <span>
+#include <vector>
 
 #include <mp-units/math.h>
 #include <mp-units/systems/angular/math.h>
 
 #include <astro/state/CartesianVector.hpp>
+#include <astro/state/frames/types/dcm_kernels.hpp>
 
 namespace astrea {
 namespace astro {
 
-// TODO: Probably should use eigen instead of arrays, might not matter for these small matrices used in
-//  rotation but worth looking into
 /**
  * @brief Class representing a direction cosine matrix (DCM) for transforming vectors between state/frames.
  *
- * This class provides methods to create DCMs for various rotations and to apply them to vectors.
+ * This class provides methods to create DCMs for various rotations and to apply them to vectors. The frames are
+ * tracked in the type while the matrix itself is stored as raw doubles, so products reduce to the same arithmetic
+ * as hand-written 3x3 code.
  *
- * @tparam Out_Frame_T The frame type to which the DCM applies.
+ * @tparam In_Frame_T The frame type from which the DCM rotates.
+ * @tparam Out_Frame_T The frame type to which the DCM rotates.
  */
 template <typename In_Frame_T, typename Out_Frame_T>
 class DirectionCosineMatrix {
@@ -44,7 +49,22 @@ class DirectionCosineMatrix {
      *
      * @param matrix An array containing the three rows of the DCM, each represented as a CartesianVector.
      */
-    DirectionCosineMatrix(const std::array<CartesianVector<Unitless, In_Frame_T>, 3>& matrix) :
+    DirectionCosineMatrix(const std::array<CartesianVector<Unitless, In_Frame_T>, 3>& matrix)
+    {
+        using mp_units::one;
+        for (std::size_t ii = 0; ii < 3; ++ii) {
+            for (std::size_t jj = 0; jj < 3; ++jj) {
+                _matrix[3 * ii + jj] = matrix[ii][jj].numerical_value_in(one);
+            }
+        }
+    }
+
+    /**
+     * @brief Constructor for DirectionCosineMatrix from a raw row-major matrix.
+     *
+     * @param matrix The row-major direction cosines.
+     */
+    explicit DirectionCosineMatrix(const detail::Matrix3& matrix) :
         _matrix(matrix)
     {
     }
@@ -53,54 +73,42 @@ class DirectionCosineMatrix {
      * @brief Creates a direction cosine matrix for a rotation around the X-axis.
      *
      * @param theta The angle of rotation around the X-axis.
-     * @return DirectionCosineMatrix<Out_Frame_T> The resulting direction cosine matrix.
+     * @return DirectionCosineMatrix<In_Frame_T, Out_Frame_T> The resulting direction cosine matrix.
      */
     static DirectionCosineMatrix<In_Frame_T, Out_Frame_T> X(const Angle& theta)
     {
-        using mp_units::one;
-        using mp_units::angular::cos;
-        using mp_units::angular::sin;
-        return DirectionCosineMatrix<In_Frame_T, Out_Frame_T>{
-            { CartesianVector<Unitless, In_Frame_T>(1.0 * one, 0.0 * one, 0.0 * one),
-              CartesianVector<Unitless, In_Frame_T>(0.0 * one, cos(theta), -sin(theta)),
-              CartesianVector<Unitless, In_Frame_T>(0.0 * one, sin(theta), cos(theta)) }
-        };
+        using mp_units::angular::unit_symbols::rad;
+        const double c = std::cos(theta.numerical_value_in(rad));
+        const double s = std::sin(theta.numerical_value_in(rad));
+        return DirectionCosineMatrix<In_Frame_T, Out_Frame_T>{ detail::Matrix3{ 1.0, 0.0, 0.0, 0.0, c, -s, 0.0, s, c } };
     }
 
     /**
      * @brief Creates a direction cosine matrix for a rotation around the Y-axis.
      *
      * @param theta The angle of rotation around the Y-axis.
-     * @return DirectionCosineMatrix<Out_Frame_T> The resulting direction cosine matrix.
+     * @return DirectionCosineMatrix<In_Frame_T, Out_Frame_T> The resulting direction cosine matrix.
      */
     static DirectionCosineMatrix<In_Frame_T, Out_Frame_T> Y(const Angle& theta)
     {
-        using mp_units::one;
-        using mp_units::angular::cos;
-        using mp_units::angular::sin;
-        return DirectionCosineMatrix<In_Frame_T, Out_Frame_T>{
-            { CartesianVector<Unitless, In_Frame_T>(cos(theta), 0.0 * one, sin(theta)),
-              CartesianVector<Unitless, In_Frame_T>(0.0 * one, 1.0 * one, 0.0 * one),
-              CartesianVector<Unitless, In_Frame_T>(-sin(theta), 0.0 * one, cos(theta)) }
-        };
+        using mp_units::angular::unit_symbols::rad;
+        const double c = std::cos(theta.numerical_value_in(rad));
+        const double s = std::sin(theta.numerical_value_in(rad));
+        return DirectionCosineMatrix<In_Frame_T, Out_Frame_T>{ detail::Matrix3{ c, 0.0, s, 0.0, 1.0, 0.0, -s, 0.0, c } };
     }
 
     /**
      * @brief Creates a direction cosine matrix for a rotation around the Z-axis.
      *
      * @param theta The angle of rotation around the Z-axis.
-     * @return DirectionCosineMatrix<Out_Frame_T> The resulting direction cosine matrix.
+     * @return DirectionCosineMatrix<In_Frame_T, Out_Frame_T> The resulting direction cosine matrix.
      */
     static DirectionCosineMatrix<In_Frame_T, Out_Frame_T> Z(const Angle& theta)
     {
-        using mp_units::one;
-        using mp_units::angular::cos;
-        using mp_units::angular::sin;
-        return DirectionCosineMatrix<In_Frame_T, Out_Frame_T>{
-            { CartesianVector<Unitless, In_Frame_T>(cos(theta), -sin(theta), 0.0 * one),
-              CartesianVector<Unitless, In_Frame_T>(sin(theta), cos(theta), 0.0 * one),
-              CartesianVector<Unitless, In_Frame_T>(0.0 * one, 0.0 * one, 1.0 * one) }
-        };
+        using mp_units::angular::unit_symbols::rad;
+        const double c = std::cos(theta.numerical_value_in(rad));
+        const double s = std::sin(theta.numerical_value_in(rad));
+        return DirectionCosineMatrix<In_Frame_T, Out_Frame_T>{ detail::Matrix3{ c, -s, 0.0, s, c, 0.0, 0.0, 0.0, 1.0 } };
     }
 
     /**
@@ -109,25 +117,26 @@ class DirectionCosineMatrix {
      * @param alpha The angle of rotation around the X-axis.
      * @param beta The angle of rotation around the Y-axis.
      * @param gamma The angle of rotation around the Z-axis.
-     * @return DirectionCosineMatrix<Out_Frame_T> The resulting direction cosine matrix.
+     * @return DirectionCosineMatrix<In_Frame_T, Out_Frame_T> The resulting direction cosine matrix.
      */
     static DirectionCosineMatrix<In_Frame_T, Out_Frame_T> XZX(const Angle& alpha, const Angle& beta, const Angle& gamma)
     {
-        using mp_units::angular::cos;
-        using mp_units::angular::sin;
-        return DirectionCosineMatrix<In_Frame_T, Out_Frame_T>{
-            { CartesianVector<Unitless, In_Frame_T>(cos(beta), -cos(gamma) * sin(beta), sin(beta) * sin(gamma)),
-              CartesianVector<Unitless, In_Frame_T>(
-                  cos(alpha) * sin(beta),
-                  cos(alpha) * cos(beta) * cos(gamma) - sin(alpha) * sin(gamma),
-                  -cos(gamma) * sin(alpha) - cos(alpha) * cos(beta) * sin(gamma)
-              ),
-              CartesianVector<Unitless, In_Frame_T>(
-                  sin(alpha) * sin(beta),
-                  cos(alpha) * sin(beta) + cos(beta) * cos(gamma) * sin(alpha),
-                  cos(alpha) * cos(gamma) - cos(beta) * sin(gamma) * sin(alpha)
-              ) }
-        };
+        using mp_units::angular::unit_symbols::rad;
+        const double ca = std::cos(alpha.numerical_value_in(rad));
+        const double sa = std::sin(alpha.numerical_value_in(rad));
+        const double cb = std::cos(beta.numerical_value_in(rad));
+        const double sb = std::sin(beta.numerical_value_in(rad));
+        const double cg = std::cos(gamma.numerical_value_in(rad));
+        const double sg = std::sin(gamma.numerical_value_in(rad));
+        return DirectionCosineMatrix<In_Frame_T, Out_Frame_T>{ detail::Matrix3{ cb,
+                                                                                -cg * sb,
+                                                                                sb * sg,
+                                                                                ca * sb,
+                                                                                ca * cb * cg - sa * sg,
+                                                                                -cg * sa - ca * cb * sg,
+                                                                                sa * sb,
+                                                                                ca * sb + cb * cg * sa,
+                                                                                ca * cg - cb * sg * sa } };
     }
 
     /**
@@ -136,7 +145,7 @@ class DirectionCosineMatrix {
      * @param x The unit vector in the X direction.
      * @param y The unit vector in the Y direction.
      * @param z The unit vector in the Z direction.
-     * @return DirectionCosineMatrix<Out_Frame_T> The resulting direction cosine matrix.
+     * @return DirectionCosineMatrix<In_Frame_T, Out_Frame_T> The resulting direction cosine matrix.
      */
     static DirectionCosineMatrix<In_Frame_T, Out_Frame_T> from_vectors(
         const CartesianVector<Unitless, In_Frame_T>& x,
@@ -144,9 +153,14 @@ class DirectionCosineMatrix {
         const CartesianVector<Unitless, In_Frame_T>& z
     )
     {
-        return DirectionCosineMatrix<In_Frame_T, Out_Frame_T>{ { CartesianVector<Unitless, In_Frame_T>(x[0], y[0], z[0]),
-                                                                 CartesianVector<Unitless, In_Frame_T>(x[1], y[1], z[1]),
-                                                                 CartesianVector<Unitless, In_Frame_T>(x[2], y[2], z[2]) } };
+        using mp_units::one;
+        detail::Matrix3 matrix;
+        for (std::size_t ii = 0; ii < 3; ++ii) {
+            matrix[3 * ii]     = x[ii].numerical_value_in(one);
+            matrix[3 * ii + 1] = y[ii].numerical_value_in(one);
+            matrix[3 * ii + 2] = z[ii].numerical_value_in(one);
+        }
+        return DirectionCosineMatrix<In_Frame_T, Out_Frame_T>{ matrix };
     }
 
     /**
@@ -154,31 +168,96 @@ class DirectionCosineMatrix {
      */
     ~DirectionCosineMatrix() = default;
 
+    /**
+     * @brief Get the raw row-major direction cosines.
+     *
+     * @return const detail::Matrix3& The direction cosines.
+     */
+    const detail::Matrix3& get_matrix() const { return _matrix; }
+
+    /**
+     * @brief Get a single direction cosine.
+     *
+     * @param row The row index.
+     * @param col The column index.
+     * @return double The direction cosine at (row, col).
+     */
+    double operator()(const std::size_t& row, const std::size_t& col) const { return _matrix[3 * row + col]; }
+
+    /**
+     * @brief Transpose the direction cosine matrix, giving the inverse rotation.
+     *
+     * @return DirectionCosineMatrix<Out_Frame_T, In_Frame_T> The transposed direction cosine matrix.
+     */
     DirectionCosineMatrix<Out_Frame_T, In_Frame_T> transpose() const
     {
-        return DirectionCosineMatrix<Out_Frame_T, In_Frame_T>{
-            { CartesianVector<Unitless, Out_Frame_T>(_matrix[0].get_x(), _matrix[1].get_x(), _matrix[2].get_x()),
-              CartesianVector<Unitless, Out_Frame_T>(_matrix[0].get_y(), _matrix[1].get_y(), _matrix[2].get_y()),
-              CartesianVector<Unitless, Out_Frame_T>(_matrix[0].get_z(), _matrix[1].get_z(), _matrix[2].get_z()) }
-        };
+        return DirectionCosineMatrix<Out_Frame_T, In_Frame_T>{ detail::transpose(_matrix) };
+    }
+
+    /**
+     * @brief Compose this direction cosine matrix with another one applied first.
+     *
+     * Composing a frame chain once and applying the result avoids a matrix-vector product per link for every vector.
+     *
+     * @tparam Prev_Frame_T The input frame of the other DCM.
+     * @param other The DCM from Prev_Frame_T to In_Frame_T.
+     * @return DirectionCosineMatrix<Prev_Frame_T, Out_Frame_T> The DCM from Prev_Frame_T to Out_Frame_T.
+     */
+    template <typename Prev_Frame_T>
+    DirectionCosineMatrix<Prev_Frame_T, Out_Frame_T> operator*(const DirectionCosineMatrix<Prev_Frame_T, In_Frame_T>& other) const
+    {
+        return DirectionCosineMatrix<Prev_Frame_T, Out_Frame_T>{ detail::multiply(_matrix, other.get_matrix()) };
     }
 
     /**
      * @brief Apply the direction cosine matrix to a CartesianVector.
      *
      * @tparam Value_T The type of the vector components.
-     * @tparam Frame_T The frame of the CartesianVector.
      * @param vec The CartesianVector to which the DCM will be applied.
      * @return CartesianVector<Value_T, Out_Frame_T> The transformed CartesianVector in the output frame.
      */
     template <typename Value_T>
     CartesianVector<Value_T, Out_Frame_T> operator*(const CartesianVector<Value_T, In_Frame_T>& vec) const
     {
-        return CartesianVector<Value_T, Out_Frame_T>(_matrix[0].dot(vec), _matrix[1].dot(vec), _matrix[2].dot(vec));
+        const auto result = detail::multiply(
+            _matrix, vec[0].numerical_value_in(Value_T::unit), vec[1].numerical_value_in(Value_T::unit), vec[2].numerical_value_in(Value_T::unit)
+        );
+        return CartesianVector<Value_T, Out_Frame_T>(result[0] * Value_T::reference, result[1] * Value_T::reference, result[2] * Value_T::reference);
+    }
+
+    /**
+     * @brief Apply the direction cosine matrix to a batch of CartesianVectors.
+     *
+     * @tparam Value_T The type of the vector components.
+     * @param vecs The CartesianVectors to which the DCM will be applied.
+     * @return std::vector<CartesianVector<Value_T, Out_Frame_T>> The transformed CartesianVectors in the output frame.
+     */
+    template <typename Value_T>
+    std::vector<CartesianVector<Value_T, Out_Frame_T>> rotate(std::span<const CartesianVector<Value_T, In_Frame_T>> vecs) const
+    {
+        std::vector<CartesianVector<Value_T, Out_Frame_T>> result;
+        result.reserve(vecs.size());
+        for (const auto& vec : vecs) {
+            result.push_back(*this * vec);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Apply the direction cosine matrix to a batch of CartesianVectors.
+     *
+     * @tparam Value_T The type of the vector components.
+     * @param vecs The CartesianVectors to which the DCM will be applied.
+     * @return std::vector<CartesianVector<Value_T, Out_Frame_T>> The transformed CartesianVectors in the output frame.
+     */
+    template <typename Value_T>
+    std::vector<CartesianVector<Value_T, Out_Frame_T>> rotate(const std::vector<CartesianVector<Value_T, In_Frame_T>>& vecs) const
+    {
+        return rotate(std::span<const CartesianVector<Value_T, In_Frame_T>>(vecs));
     }
 
   private:
-    std::array<CartesianVector<Unitless, In_Frame_T>, 3> _matrix; //!< 3x3 matrix to hold the direction cosines.
+    detail::Matrix3 _matrix = detail::IDENTITY_MATRIX; //!< Row-major 3x3 matrix to hold the direction cosines.
 };
 
 /**
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+#include <math/test_util.hpp>
+#include <units/units.hpp>
+
+#include <astro/state/CartesianVector.hpp>
+#include <astro/state/frames/frames.hpp>
+#include <astro/state/frames/types/DirectionCosineMatrix.hpp>
+#include <astro/state/frames/types/dcm_kernels.hpp>
+#include <tests/utilities/comparisons.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace mp_units;
+using mp_units::angular::unit_symbols::rad;
+using mp_units::si::unit_symbols::km;
+
+class DirectionCosineMatrixTest : public testing::Test {
+  public:
+    DirectionCosineMatrixTest() {}
+
+    void SetUp() override
+    {
+        eciToEcef = DCM<ECI, ECEF>::Z(0.7 * rad);
+        ecefToRic = DCM<ECEF, RIC>::XZX(0.3 * rad, -1.2 * rad, 2.1 * rad);
+
+        vectors = { RadiusVector<ECI>(7000.0 * km, 0.0 * km, 0.0 * km),
+                    RadiusVector<ECI>(0.0 * km, -6378.0 * km, 1000.0 * km),
+                    RadiusVector<ECI>(1234.0 * km, 5678.0 * km, -4321.0 * km) };
+    }
+
+    const Unitless REL_TOL = 1.0e-14;
+    const Unitless ABS_TOL = 1.0e-10;
+
+    DCM<ECI, ECEF> eciToEcef;
+    DCM<ECEF, RIC> ecefToRic;
+    std::vector<RadiusVector<ECI>> vectors;
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(DirectionCosineMatrixTest, DefaultIsIdentity)
+{
+    const DCM<ECI, ECEF> identity;
+    for (const auto& vector : vectors) {
+        ASSERT_EQ(identity * vector, vector.force_frame_conversion<ECEF>());
+    }
+}
+
+TEST_F(DirectionCosineMatrixTest, AxisRotations)
+{
+    const double angle = 0.4;
+    const RadiusVector<ECI> xHat(1.0 * km, 0.0 * km, 0.0 * km);
+    const RadiusVector<ECI> yHat(0.0 * km, 1.0 * km, 0.0 * km);
+
+    ASSERT_EQ_CART_VEC(
+        DCM<ECI, ECEF>::Z(angle * rad) * xHat, RadiusVector<ECEF>(std::cos(angle) * km, std::sin(angle) * km, 0.0 * km), REL_TOL, ABS_TOL
+    );
+    ASSERT_EQ_CART_VEC(
+        DCM<ECI, ECEF>::X(angle * rad) * yHat, RadiusVector<ECEF>(0.0 * km, std::cos(angle) * km, std::sin(angle) * km), REL_TOL, ABS_TOL
+    );
+    ASSERT_EQ_CART_VEC(
+        DCM<ECI, ECEF>::Y(angle * rad) * xHat, RadiusVector<ECEF>(std::cos(angle) * km, 0.0 * km, -std::sin(angle) * km), REL_TOL, ABS_TOL
+    );
+}
+
+TEST_F(DirectionCosineMatrixTest, AnglesInDegrees)
+{
+    using mp_units::angular::unit_symbols::deg;
+
+    // Angles are converted to radians whatever unit they carry
+    const RadiusVector<ECI>& vector = vectors[2];
+    ASSERT_EQ_CART_VEC(DCM<ECI, ECEF>::X(90.0 * deg) * vector, DCM<ECI, ECEF>::X(std::numbers::pi / 2.0 * rad) * vector, REL_TOL, ABS_TOL);
+    ASSERT_EQ_CART_VEC(DCM<ECI, ECEF>::Y(-30.0 * deg) * vector, DCM<ECI, ECEF>::Y(-std::numbers::pi / 6.0 * rad) * vector, REL_TOL, ABS_TOL);
+    ASSERT_EQ_CART_VEC(DCM<ECI, ECEF>::Z(180.0 * deg) * vector, DCM<ECI, ECEF>::Z(std::numbers::pi * rad) * vector, REL_TOL, ABS_TOL);
+    ASSERT_EQ_CART_VEC(
+        DCM<ECI, RIC>::XZX(60.0 * deg, 45.0 * deg, 90.0 * deg) * vector,
+        DCM<ECI, RIC>::XZX(std::numbers::pi / 3.0 * rad, std::numbers::pi / 4.0 * rad, std::numbers::pi / 2.0 * rad) * vector,
+        REL_TOL,
+        ABS_TOL
+    );
+}
+
+TEST_F(DirectionCosineMatrixTest, FromVectors)
+{
+    const CartesianVector<Unitless, ECI> x(0.0 * one, 1.0 * one, 0.0 * one);
+    const CartesianVector<Unitless, ECI> y(0.0 * one, 0.0 * one, 1.0 * one);
+    const CartesianVector<Unitless, ECI> z(1.0 * one, 0.0 * one, 0.0 * one);
+    const auto dcm = DCM<ECI, ECEF>::from_vectors(x, y, z);
+
+    ASSERT_EQ(dcm(0, 0), 0.0);
+    ASSERT_EQ(dcm(1, 0), 1.0);
+    ASSERT_EQ(dcm(0, 2), 1.0);
+    ASSERT_EQ(dcm * vectors[2], RadiusVector<ECEF>(-4321.0 * km, 1234.0 * km, 5678.0 * km));
+}
+
+TEST_F(DirectionCosineMatrixTest, TransposeIsInverse)
+{
+    const auto transpose = eciToEcef.transpose();
+    for (std::size_t ii = 0; ii < 3; ++ii) {
+        for (std::size_t jj = 0; jj < 3; ++jj) {
+            ASSERT_EQ(transpose(ii, jj), eciToEcef(jj, ii));
+        }
+    }
+    for (const auto& vector : vectors) {
+        ASSERT_EQ_CART_VEC(transpose * (eciToEcef * vector), vector, REL_TOL, ABS_TOL);
+    }
+}
+
+TEST_F(DirectionCosineMatrixTest, Composition)
+{
+    const DCM<ECI, RIC> eciToRic = ecefToRic * eciToEcef;
+    for (const auto& vector : vectors) {
+        ASSERT_EQ_CART_VEC(eciToRic * vector, ecefToRic * (eciToEcef * vector), REL_TOL, ABS_TOL);
+    }
+}
+
+TEST_F(DirectionCosineMatrixTest, BatchedRotation)
+{
+    const auto rotated = eciToEcef.rotate(vectors);
+    ASSERT_EQ(rotated.size(), vectors.size());
+    for (std::size_t ii = 0; ii < vectors.size(); ++ii) {
+        ASSERT_EQ(rotated[ii], eciToEcef * vectors[ii]);
+    }
+}
+
+TEST_F(DirectionCosineMatrixTest, RawKernelMatchesTyped)
+{
+    std::vector<double> raw;
+    for (const auto& vector : vectors) {
+        for (std::size_t ii = 0; ii < 3; ++ii) {
+            raw.push_back(vector[ii].numerical_value_in(km));
+        }
+    }
+
+    // Rotate in place
+    detail::multiply(eciToEcef.get_matrix(), raw.data(), raw.data(), vectors.size());
+    for (std::size_t ii = 0; ii < vectors.size(); ++ii) {
+        const RadiusVector<ECEF> typed = eciToEcef * vectors[ii];
+        for (std::size_t jj = 0; jj < 3; ++jj) {
+            ASSERT_EQ(raw[3 * ii + jj], typed[jj].numerical_value_in(km));
+        }
+    }
+}
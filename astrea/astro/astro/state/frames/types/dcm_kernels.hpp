@@ -0,0 +1,103 @@
+/**
+ * @file dcm_kernels.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief Raw double 3x3 matrix kernels used behind the DirectionCosineMatrix class
+ * @version 0.1
+ * @date 2025-08-06
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace astrea {
+namespace astro {
+namespace detail {
+
+/**
+ * @brief Row-major 3x3 matrix of raw doubles.
+ */
+using Matrix3 = std::array<double, 9>;
+
+/**
+ * @brief Raw double 3-vector.
+ */
+using Vector3 = std::array<double, 3>;
+
+/**
+ * @brief The 3x3 identity matrix.
+ */
+inline constexpr Matrix3 IDENTITY_MATRIX = { 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0 };
+
+/**
+ * @brief Transpose a 3x3 matrix.
+ *
+ * @param m The matrix to transpose.
+ * @return Matrix3 The transposed matrix.
+ */
+constexpr Matrix3 transpose(const Matrix3& m) { return { m[0], m[3], m[6], m[1], m[4], m[7], m[2], m[5], m[8] }; }
+
+/**
+ * @brief Multiply two 3x3 matrices.
+ *
+ * @param a The left matrix.
+ * @param b The right matrix.
+ * @return Matrix3 The product a*b.
+ */
+constexpr Matrix3 multiply(const Matrix3& a, const Matrix3& b)
+{
+    Matrix3 result{};
+    for (std::size_t ii = 0; ii < 3; ++ii) {
+        for (std::size_t jj = 0; jj < 3; ++jj) {
+            result[3 * ii + jj] = a[3 * ii] * b[jj] + a[3 * ii + 1] * b[3 + jj] + a[3 * ii + 2] * b[6 + jj];
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Multiply a 3x3 matrix by a vector.
+ *
+ * Written as plain multiply-adds so the compiler can contract them into fused multiply-adds where the target
+ * supports them.
+ *
+ * @param m The matrix.
+ * @param x The x component of the vector.
+ * @param y The y component of the vector.
+ * @param z The z component of the vector.
+ * @return Vector3 The product m*v.
+ */
+constexpr Vector3 multiply(const Matrix3& m, const double& x, const double& y, const double& z)
+{
+    return { m[0] * x + m[1] * y + m[2] * z, m[3] * x + m[4] * y + m[5] * z, m[6] * x + m[7] * y + m[8] * z };
+}
+
+/**
+ * @brief Multiply a 3x3 matrix by a batch of vectors.
+ *
+ * The vectors are stored contiguously as x, y, z triplets. The input and output may be the same buffer.
+ *
+ * @param m The matrix.
+ * @param input The 3*n input components.
+ * @param output The 3*n output components.
+ * @param n The number of vectors.
+ */
+constexpr void multiply(const Matrix3& m, const double* input, double* output, const std::size_t& n)
+{
+    for (std::size_t ii = 0; ii < n; ++ii) {
+        const double x = input[3 * ii];
+        const double y = input[3 * ii + 1];
+        const double z = input[3 * ii + 2];
+
+        output[3 * ii]     = m[0] * x + m[1] * y + m[2] * z;
+        output[3 * ii + 1] = m[3] * x + m[4] * y + m[5] * z;
+        output[3 * ii + 2] = m[6] * x + m[7] * y + m[8] * z;
+    }
+}
+
+} // namespace detail
+} // namespace astro
+} // namespace astrea
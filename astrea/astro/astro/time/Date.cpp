@@ -9,6 +9,7 @@
 #include <date/date.h> // NOTE: This is standard in std::chrono as of GNU 13.2
 #include <mp-units/math.h>
 
+#include <astro/time/epoch_parsing.hpp>
 #include <astro/utilities/conversions.hpp>
 
 using namespace mp_units;
@@ -23,27 +24,26 @@ std::ostream& operator<<(std::ostream& os, const Date& obj)
     return os;
 }
 
-// Utility operators
-Date Date::operator+(const Time& time) const
+// Constructors
+Date::Date(const std::string& epoch, const std::string& format) :
+    _julianDate([&]() {
+        const auto layout = get_iso_epoch_format(format);
+        return layout ? parse_epoch(epoch, *layout) : TwoPartJulianDate::from_sys(epoch_to_sys_time(epoch, format));
+    }())
 {
-    const auto newTime = _julianDate.time_since_epoch() + JulianDateClock::duration(time);
-    return Date(JulianDate(newTime));
 }
+
+// Utility operators
+Date Date::operator+(const Time& time) const { return Date(_julianDate + JulianDateClock::duration(time)); }
 Date& Date::operator+=(const Time& time)
 {
-    const auto newTime = _julianDate.time_since_epoch() + JulianDateClock::duration(time);
-    _julianDate        = JulianDate(newTime);
+    _julianDate += JulianDateClock::duration(time);
     return *this;
 }
-Date Date::operator-(const Time& time) const
-{
-    const auto newTime = _julianDate.time_since_epoch() - JulianDateClock::duration(time);
-    return Date(JulianDate(newTime));
-}
+Date Date::operator-(const Time& time) const { return Date(_julianDate - JulianDateClock::duration(time)); }
 Date& Date::operator-=(const Time& time)
 {
-    const auto newTime = _julianDate.time_since_epoch() - JulianDateClock::duration(time);
-    _julianDate        = JulianDate(newTime);
+    _julianDate -= JulianDateClock::duration(time);
     return *this;
 }
 
@@ -54,16 +54,16 @@ std::string Date::epoch() const
 {
     using namespace std::chrono;
 
-    const auto sysTime = round<std::chrono::milliseconds>(clock_cast<system_clock>(_julianDate));
+    const auto sysTime = round<std::chrono::milliseconds>(_julianDate.to_sys());
     std::stringstream ss;
     ss << sysTime;
     return ss.str();
 }
 
-Angle Date::gmst() const { return julian_date_to_siderial_time(_julianDate); }
+Angle Date::gmst() const { return julian_date_to_siderial_time(_julianDate.jd()); }
 
 // General conversions
-JulianDate epoch_to_julian_date(const std::string& epoch, const std::string format)
+std::chrono::sys_time<std::chrono::milliseconds> epoch_to_sys_time(const std::string& epoch, const std::string format)
 {
     using namespace std::chrono;
 
@@ -72,12 +72,41 @@ JulianDate epoch_to_julian_date(const std::string& epoch, const std::string form
     sys_time<std::chrono::milliseconds> systemTime;
     epochStream >> date::parse(format, systemTime);
 
+    return systemTime;
+}
+
+JulianDate epoch_to_julian_date(const std::string& epoch, const std::string format)
+{
+    using namespace std::chrono;
+
+    // Skip the stream based parser for the common ISO-8601/Space-Track formats
+    const auto layout = get_iso_epoch_format(format);
+    const sys_time<std::chrono::milliseconds> systemTime =
+        layout ? round<std::chrono::milliseconds>(parse_epoch(epoch, *layout).to_sys()) : epoch_to_sys_time(epoch, format);
+
     // Convert with clock cast
     return round<std::chrono::milliseconds>(clock_cast<JulianDateClock>(systemTime));
 }
 
+std::vector<Date> epochs_to_dates(const std::vector<std::string>& epochs, const std::string& format)
+{
+    std::vector<Date> dates;
+    dates.reserve(epochs.size());
+    if (const auto layout = get_iso_epoch_format(format)) {
+        for (const auto& epoch : epochs) {
+            dates.emplace_back(parse_epoch(epoch, *layout));
+        }
+    }
+    else {
+        for (const auto& epoch : epochs) {
+            dates.emplace_back(epoch, format);
+        }
+    }
+    return dates;
+}
+
 
-const Date Date::now() noexcept { return JulianDateClock::now(); }
+const Date Date::now() noexcept { return TwoPartJulianDate::from_sys(std::chrono::system_clock::now()); }
 
 
 Angle julian_date_to_siderial_time(const JulianDate& _julianDate)
@@ -14,16 +14,29 @@
 
 #include <iosfwd>
 #include <string>
+#include <vector>
 
 #include <mp-units/systems/si/chrono.h>
 
 #include <units/units.hpp>
 
 #include <astro/time/JulianDateClock.hpp>
+#include <astro/time/TimeScales.hpp>
+#include <astro/time/TwoPartJulianDate.hpp>
 
 namespace astrea {
 namespace astro {
 
+/**
+ * @brief Convert a string representation of a date to a system time point using date::parse.
+ *
+ * @param epoch The date string to convert.
+ * @param format The format of the date string, default is "%Y-%m-%d %H:%M:%S".
+ * @return std::chrono::sys_time<std::chrono::milliseconds> The system time point of the input date.
+ */
+std::chrono::sys_time<std::chrono::milliseconds>
+    epoch_to_sys_time(const std::string& epoch, const std::string format = "%Y-%m-%d %H:%M:%S");
+
 /**
  * @brief Convert a string representation of a date to a JulianDate object.
  *
@@ -42,6 +55,17 @@ JulianDate epoch_to_julian_date(const std::string& epoch, const std::string form
  */
 Angle julian_date_to_siderial_time(const JulianDate& date);
 
+class Date;
+
+/**
+ * @brief Convert a column of date strings to Date objects.
+ *
+ * @param epochs The date strings to convert.
+ * @param format The format of the date strings, default is "%Y-%m-%d %H:%M:%S".
+ * @return std::vector<Date> The Date representation of each input string, in order.
+ */
+std::vector<Date> epochs_to_dates(const std::vector<std::string>& epochs, const std::string& format = "%Y-%m-%d %H:%M:%S");
+
 /**
  * @brief Class representing a date in the astrea astro library.
  *
@@ -64,16 +88,23 @@ class Date {
     {
     }
 
+    /**
+     * @brief Construct a Date object from a two-part Julian date.
+     *
+     * @param jdate The TwoPartJulianDate to initialize the Date object.
+     */
+    Date(const TwoPartJulianDate& jdate) :
+        _julianDate(jdate)
+    {
+    }
+
     /**
      * @brief Construct a Date object from a JulianDate.
      *
      * @param epoch The JulianDate to initialize the Date object.
      * @param format The format of the date string, default is "%Y-%m-%d %H:%M:%S".
      */
-    Date(const std::string& epoch, const std::string& format = "%Y-%m-%d %H:%M:%S") :
-        _julianDate(epoch_to_julian_date(epoch, format))
-    {
-    }
+    Date(const std::string& epoch, const std::string& format = "%Y-%m-%d %H:%M:%S");
 
     /**
      * @brief Destructor for Date.
@@ -148,21 +179,28 @@ class Date {
      *
      * @return JulianDate The Julian date representation of this Date object.
      */
-    JulianDate jd() const { return _julianDate; }
+    JulianDate jd() const { return _julianDate.jd(); }
+
+    /**
+     * @brief Get the full precision, two-part Julian date representation of this Date object.
+     *
+     * @return const TwoPartJulianDate& The two-part Julian date representation of this Date object.
+     */
+    const TwoPartJulianDate& two_part_jd() const { return _julianDate; }
 
     /**
      * @brief Get the Julian date in days since the epoch.
      *
      * @return double The Julian date in days since the epoch.
      */
-    double jdn() const { return std::chrono::floor<std::chrono::days>(_julianDate).time_since_epoch().count(); }
+    double jdn() const { return _julianDate.day(); }
 
     /**
      * @brief Get the Modified Julian Date (MJD) representation of this Date object.
      *
      * @return std::chrono::duration<double, std::ratio<86400>> The Modified Julian Date representation of this Date object.
      */
-    std::chrono::duration<double, std::ratio<86400>> mjd() const { return _julianDate - MJD0; }
+    std::chrono::duration<double, std::ratio<86400>> mjd() const { return _julianDate.mjd(); }
 
     /**
      * @brief Get the Date in UTC clock format.
@@ -186,16 +224,36 @@ class Date {
     std::chrono::time_point<std::chrono::tai_clock> tai() const { return in_clock<std::chrono::tai_clock>(); }
 
     /**
-     * @brief Get the Date in TT clock format.
+     * @brief Get the Date as a two-part Julian date in Terrestrial Time.
      *
-     * @return std::chrono::time_point<std::chrono::tt_clock>
+     * @return TwoPartJulianDate The TT Julian date.
      */
-    // std::chrono::time_point<std::chrono::tai_clock> tt() const
-    // {
-    //     // TODO: Make tt clock. Find better conversion numbers
-    //     using namespace std::chrono;
-    //     return in_clock<tai_clock>().time_since_epoch() + std::chrono::milliseconds{ 32184.0 };
-    // }
+    TwoPartJulianDate tt() const { return in_time_scale(TimeScale::TT); }
+
+    /**
+     * @brief Get the Date as a two-part Julian date in Barycentric Dynamical Time.
+     *
+     * @return TwoPartJulianDate The TDB Julian date.
+     */
+    TwoPartJulianDate tdb() const { return in_time_scale(TimeScale::TDB); }
+
+    /**
+     * @brief Get the Date as a two-part Julian date in UT1.
+     *
+     * @return TwoPartJulianDate The UT1 Julian date.
+     */
+    TwoPartJulianDate ut1() const { return in_time_scale(TimeScale::UT1); }
+
+    /**
+     * @brief Get the Date as a two-part Julian date in a specified time scale.
+     *
+     * @param scale The time scale to convert to. Dates are stored in UTC.
+     * @return TwoPartJulianDate The Julian date in the requested time scale.
+     */
+    TwoPartJulianDate in_time_scale(const TimeScale& scale) const
+    {
+        return convert_time_scale(_julianDate, TimeScale::UTC, scale);
+    }
 
     /**
      * @brief Get the Date in sys clock format.
@@ -221,7 +279,7 @@ class Date {
     std::chrono::time_point<Clock_T> in_clock() const
     {
         using namespace std::chrono;
-        return round<std::chrono::milliseconds>(clock_cast<Clock_T>(_julianDate));
+        return clock_cast<Clock_T>(_julianDate.to_sys());
     }
 
     /**
@@ -232,7 +290,7 @@ class Date {
     Angle gmst() const;
 
   private:
-    JulianDate _julianDate; //!< Julian date representation of the Date object
+    TwoPartJulianDate _julianDate; //!< Two-part UTC Julian date representation of the Date object
 };
 
 } // namespace astro
@@ -39,6 +39,19 @@ TEST_F(DateTest, DefaultConstructor) { ASSERT_NO_THROW(Date()); }
 
 TEST_F(DateTest, StringConstructor) { ASSERT_NO_THROW(Date("2000-01-01 12:00:00.0")); }
 
+TEST_F(DateTest, StringConstructorFollowsFormat)
+{
+    ASSERT_EQ(Date("2000-01-01T12:00:00", "%Y-%m-%dT%H:%M:%S"), Date(J2000));
+    ASSERT_EQ(Date("2000-001 12:00:00", "%Y-%j %H:%M:%S"), Date(J2000));
+
+    // The fast ISO path accepts only the requested layout
+    for (const std::string epoch : { "2000-001 12:00:00", "2000-01-01T12:00:00", "2000-01-01 12:00:00Z", "2000-01-01" }) {
+        ASSERT_ANY_THROW(Date(epoch, "%Y-%m-%d %H:%M:%S")) << epoch;
+        ASSERT_ANY_THROW(epoch_to_julian_date(epoch, "%Y-%m-%d %H:%M:%S")) << epoch;
+        ASSERT_ANY_THROW(epochs_to_dates({ epoch }, "%Y-%m-%d %H:%M:%S")) << epoch;
+    }
+}
+
 TEST_F(DateTest, JulianDateConstructor) { ASSERT_NO_THROW(Date(J2000)); }
 
 TEST_F(DateTest, Now) { ASSERT_LE(Date::now(), Date(JulianDateClock::now())); }
@@ -111,3 +124,36 @@ TEST_F(DateTest, GMST)
 {
     ASSERT_EQ_QUANTITY(Date(J2000).gmst(), Angle(4.89496 * mp_units::angular::unit_symbols::rad), REL_TOL); // Is this right? Who knows
 }
+
+TEST_F(DateTest, MicrosecondArithmetic)
+{
+    const Date date(J2000);
+    const Time diff = (date + seconds(1.0e-6)) - date;
+    ASSERT_EQ_QUANTITY(diff, 1.0e-6 * mp_units::si::unit_symbols::s, 1.0e-9);
+}
+
+TEST_F(DateTest, LongSpanDifference)
+{
+    const Date date(J2000);
+    const Time diff = (date + days(36525.0) + seconds(1.0e-3)) - date;
+    ASSERT_NEAR(diff.numerical_value_in(mp_units::si::unit_symbols::s), 36525.0 * 86400.0 + 1.0e-3, 1.0e-6);
+}
+
+TEST_F(DateTest, SubMillisecondClock)
+{
+    const Date date(J2000);
+    ASSERT_EQ((date + seconds(2.5e-4)).sys() - date.sys(), std::chrono::microseconds(250));
+}
+
+TEST_F(DateTest, TerrestrialTime)
+{
+    const Date date(J2000);
+    ASSERT_NEAR((date.tt() - date.two_part_jd()).count(), 64.184, 1.0e-9);
+}
+
+TEST_F(DateTest, Ut1)
+{
+    // SOFA Earth attitude cookbook, UT1-UTC on 2007-04-05
+    const Date date("2007-04-05 00:00:00.0");
+    ASSERT_NEAR((date.ut1() - date.two_part_jd()).count(), -0.072073685, 1.0e-9);
+}
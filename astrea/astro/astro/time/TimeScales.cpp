@@ -0,0 +1,292 @@
+#include <astro/time/TimeScales.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <numbers>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace astrea {
+namespace astro {
+
+namespace {
+
+// Integral MJD of the UTC day containing a date
+long mjd_day(const TwoPartJulianDate& date)
+{
+    static constexpr double MJD_EPOCH_DAY = 2400000.0;
+    return static_cast<long>(date.day() - MJD_EPOCH_DAY) - (date.fraction() < 0.5 ? 1 : 0);
+}
+
+// Resolve a file in the local data directory
+std::filesystem::path get_time_data_file(const std::string& filename)
+{
+    const char* root = std::getenv("ASTREA_ROOT");
+    if (!root) { throw std::runtime_error("ASTREA_ROOT must be set to locate time scale data files."); }
+    return std::filesystem::path(root) / "data" / "time" / filename;
+}
+
+// Read the numeric, non-comment rows of a whitespace delimited data file
+std::vector<std::vector<double>> read_time_data_file(const std::filesystem::path& file, const std::size_t& nColumns)
+{
+    std::ifstream stream(file);
+    if (!stream) { throw std::runtime_error("Unable to open time scale data file: " + file.string()); }
+
+    std::vector<std::vector<double>> rows;
+    std::string line;
+    while (std::getline(stream, line)) {
+        if (line.empty() || line[0] == '#') { continue; }
+
+        std::istringstream lineStream(line);
+        std::vector<double> row(nColumns);
+        for (auto& value : row) {
+            if (!(lineStream >> value)) { throw std::runtime_error("Malformed line in " + file.string() + ": " + line); }
+        }
+        if (!rows.empty() && row[0] <= rows.back()[0]) {
+            throw std::runtime_error("Time scale data file must be sorted by increasing MJD: " + file.string());
+        }
+        rows.push_back(std::move(row));
+    }
+    if (rows.empty()) { throw std::runtime_error("No data found in time scale data file: " + file.string()); }
+    return rows;
+}
+
+// Check whether a file is in the fixed-width IERS finals format, which flags each row as IERS (I) or predicted (P)
+bool is_finals_file(const std::filesystem::path& file)
+{
+    std::ifstream stream(file);
+    std::string line;
+    while (std::getline(stream, line)) {
+        if (line.empty() || line[0] == '#') { continue; }
+        return line.size() >= 68 && (line[16] == 'I' || line[16] == 'P');
+    }
+    return false;
+}
+
+// Read the "MJD x_p y_p UT1-UTC" Bulletin A columns of an IERS finals file, stopping where the predictions end
+std::vector<std::vector<double>> read_finals_file(const std::filesystem::path& file)
+{
+    std::ifstream stream(file);
+    if (!stream) { throw std::runtime_error("Unable to open time scale data file: " + file.string()); }
+
+    // Column ranges from the IERS readme.finals2000A
+    static constexpr std::pair<std::size_t, std::size_t> MJD_COLUMNS     = { 7, 8 };
+    static constexpr std::pair<std::size_t, std::size_t> X_POLE_COLUMNS  = { 18, 9 };
+    static constexpr std::pair<std::size_t, std::size_t> Y_POLE_COLUMNS  = { 37, 9 };
+    static constexpr std::pair<std::size_t, std::size_t> UT1_UTC_COLUMNS = { 58, 10 };
+
+    std::vector<std::vector<double>> rows;
+    std::string line;
+    while (std::getline(stream, line)) {
+        const bool isPublished = line.size() >= UT1_UTC_COLUMNS.first + UT1_UTC_COLUMNS.second && line[16] != ' ' &&
+                                 line[57] != ' ';
+        if (!isPublished) { break; }
+
+        std::vector<double> row;
+        for (const auto& [start, width] : { MJD_COLUMNS, X_POLE_COLUMNS, Y_POLE_COLUMNS, UT1_UTC_COLUMNS }) {
+            try {
+                row.push_back(std::stod(line.substr(start, width)));
+            }
+            catch (const std::exception&) {
+                throw std::runtime_error("Malformed line in " + file.string() + ": " + line);
+            }
+        }
+        if (!rows.empty() && row[0] <= rows.back()[0]) {
+            throw std::runtime_error("Time scale data file must be sorted by increasing MJD: " + file.string());
+        }
+        rows.push_back(std::move(row));
+    }
+    if (rows.empty()) { throw std::runtime_error("No data found in time scale data file: " + file.string()); }
+    return rows;
+}
+
+} // namespace
+
+
+LeapSecondTable::LeapSecondTable(const std::filesystem::path& file)
+{
+    const auto rows = read_time_data_file(file, 2);
+
+    _firstMjd         = static_cast<long>(rows.front()[0]);
+    const long nDays  = static_cast<long>(rows.back()[0]) - _firstMjd + 1;
+    std::size_t iNext = 1;
+    _offsets.resize(nDays);
+    for (long ii = 0; ii < nDays; ++ii) {
+        if (iNext < rows.size() && _firstMjd + ii >= static_cast<long>(rows[iNext][0])) { ++iNext; }
+        _offsets[ii] = rows[iNext - 1][1];
+    }
+}
+
+const LeapSecondTable& LeapSecondTable::get_instance()
+{
+    static const LeapSecondTable table(get_time_data_file("leap_seconds.dat"));
+    return table;
+}
+
+seconds LeapSecondTable::tai_minus_utc(const TwoPartJulianDate& utc) const
+{
+    const long index = mjd_day(utc) - _firstMjd;
+    if (index < 0) { throw std::runtime_error("UTC dates before the start of the leap second table are not supported."); }
+    return seconds{ _offsets[std::min(static_cast<std::size_t>(index), _offsets.size() - 1)] };
+}
+
+
+EarthOrientationTable::EarthOrientationTable(const std::filesystem::path& file, const LeapSecondTable& leapSeconds) :
+    _leapSeconds(&leapSeconds)
+{
+    const auto rows = is_finals_file(file) ? read_finals_file(file) : read_time_data_file(file, 4);
+
+    // Resample UT1-TAI onto a daily grid so lookups are a single index
+    _firstMjd         = static_cast<long>(std::ceil(rows.front()[0]));
+    const long nDays  = static_cast<long>(std::floor(rows.back()[0])) - _firstMjd + 1;
+    std::size_t iNext = 0;
+    _ut1MinusTai.resize(nDays);
+    _xPole.resize(nDays);
+    _yPole.resize(nDays);
+    for (long ii = 0; ii < nDays; ++ii) {
+        const double mjd = static_cast<double>(_firstMjd + ii);
+        while (iNext + 1 < rows.size() && rows[iNext + 1][0] <= mjd) {
+            ++iNext;
+        }
+        const auto& lower    = rows[iNext];
+        const auto& upper    = rows[std::min(iNext + 1, rows.size() - 1)];
+        const double taiUtc0 = leapSeconds.tai_minus_utc(TwoPartJulianDate(lower[0] + 2400000.5)).count();
+        const double taiUtc1 = leapSeconds.tai_minus_utc(TwoPartJulianDate(upper[0] + 2400000.5)).count();
+        const double ut1Tai0 = lower[3] - taiUtc0;
+        const double ut1Tai1 = upper[3] - taiUtc1;
+
+        const double span   = upper[0] - lower[0];
+        const double weight = (span > 0.0) ? (mjd - lower[0]) / span : 0.0;
+        _ut1MinusTai[ii]    = ut1Tai0 + (ut1Tai1 - ut1Tai0) * weight;
+        _xPole[ii]          = lower[1] + (upper[1] - lower[1]) * weight;
+        _yPole[ii]          = lower[2] + (upper[2] - lower[2]) * weight;
+    }
+}
+
+const EarthOrientationTable& EarthOrientationTable::get_instance()
+{
+    static const EarthOrientationTable table([]() {
+        const std::filesystem::path finals = get_time_data_file("finals2000A.all");
+        return std::filesystem::exists(finals) ? finals : get_time_data_file("finals2000A.data");
+    }());
+    return table;
+}
+
+seconds EarthOrientationTable::ut1_minus_utc(const TwoPartJulianDate& utc) const
+{
+    return seconds{ interpolate(_ut1MinusTai, utc) } + _leapSeconds->tai_minus_utc(utc);
+}
+
+PolarMotion EarthOrientationTable::polar_motion(const TwoPartJulianDate& utc) const
+{
+    using mp_units::angular::unit_symbols::rad;
+    static constexpr double ARCSEC_TO_RAD = std::numbers::pi / 648000.0;
+    return { interpolate(_xPole, utc) * ARCSEC_TO_RAD * rad, interpolate(_yPole, utc) * ARCSEC_TO_RAD * rad };
+}
+
+EarthOrientationParameters EarthOrientationTable::get_parameters(const TwoPartJulianDate& utc) const
+{
+    return { ut1_minus_utc(utc), polar_motion(utc), contains(utc) };
+}
+
+bool EarthOrientationTable::contains(const TwoPartJulianDate& utc) const
+{
+    const double x = utc.mjd().count() - static_cast<double>(_firstMjd);
+    return x >= 0.0 && x <= static_cast<double>(_ut1MinusTai.size() - 1);
+}
+
+double EarthOrientationTable::interpolate(const std::vector<double>& grid, const TwoPartJulianDate& utc) const
+{
+    const double x = utc.mjd().count() - static_cast<double>(_firstMjd);
+    if (x <= 0.0) { return grid.front(); }
+    if (x >= static_cast<double>(grid.size() - 1)) { return grid.back(); }
+
+    const std::size_t index = static_cast<std::size_t>(x);
+    const double weight     = x - static_cast<double>(index);
+    return grid[index] + weight * (grid[index + 1] - grid[index]);
+}
+
+
+seconds tt_minus_tai() { return seconds{ 32.184 }; }
+
+seconds gps_minus_tai() { return seconds{ -19.0 }; }
+
+seconds tdb_minus_tt(const TwoPartJulianDate& tt)
+{
+    static constexpr double DEG_TO_RAD = std::numbers::pi / 180.0;
+
+    const double T = ((tt.day() - 2451545.0) + tt.fraction()) / 36525.0;
+    const double M = (357.5277233 + 35999.05034 * T) * DEG_TO_RAD;
+    return seconds{ 0.001657 * std::sin(M) + 0.00001385 * std::sin(2.0 * M) };
+}
+
+
+namespace {
+
+// Convert a date in any scale to TAI
+TwoPartJulianDate to_tai(const TwoPartJulianDate& date, const TimeScale& scale)
+{
+    const auto& leapSeconds = LeapSecondTable::get_instance();
+    switch (scale) {
+        case TimeScale::TAI: return date;
+        case TimeScale::UTC: return date + leapSeconds.tai_minus_utc(date);
+        case TimeScale::TT: return date - tt_minus_tai();
+        case TimeScale::GPS: return date - gps_minus_tai();
+        case TimeScale::TDB: {
+            // TDB-TT varies slowly enough that evaluating it at TDB instead of TT is well below its own accuracy
+            const TwoPartJulianDate tt = date - tdb_minus_tt(date);
+            return tt - tt_minus_tai();
+        }
+        case TimeScale::UT1: {
+            // Iterate once on UT1-UTC evaluated at the UT1 date to find the UTC date
+            const auto& eop             = EarthOrientationTable::get_instance();
+            const TwoPartJulianDate utc = date - eop.ut1_minus_utc(date - eop.ut1_minus_utc(date));
+            return utc + leapSeconds.tai_minus_utc(utc);
+        }
+        default: throw std::runtime_error("Unsupported time scale.");
+    }
+}
+
+// Convert a date in TAI to any scale
+TwoPartJulianDate from_tai(const TwoPartJulianDate& tai, const TimeScale& scale)
+{
+    const auto& leapSeconds = LeapSecondTable::get_instance();
+    switch (scale) {
+        case TimeScale::TAI: return tai;
+        case TimeScale::UTC: {
+            // The offsets disagree only within a leap second (or when rounding lands a hair before midnight), in
+            // which case the newer, larger offset is the one that applies
+            const seconds offset        = leapSeconds.tai_minus_utc(tai - leapSeconds.tai_minus_utc(tai));
+            const TwoPartJulianDate utc = tai - offset;
+            const seconds check         = leapSeconds.tai_minus_utc(utc);
+            return (check == offset) ? utc : tai - std::max(offset, check);
+        }
+        case TimeScale::TT: return tai + tt_minus_tai();
+        case TimeScale::GPS: return tai + gps_minus_tai();
+        case TimeScale::TDB: {
+            const TwoPartJulianDate tt = tai + tt_minus_tai();
+            return tt + tdb_minus_tt(tt);
+        }
+        case TimeScale::UT1: {
+            const TwoPartJulianDate utc = from_tai(tai, TimeScale::UTC);
+            return utc + EarthOrientationTable::get_instance().ut1_minus_utc(utc);
+        }
+        default: throw std::runtime_error("Unsupported time scale.");
+    }
+}
+
+} // namespace
+
+
+TwoPartJulianDate convert_time_scale(const TwoPartJulianDate& date, const TimeScale& from, const TimeScale& to)
+{
+    if (from == to) { return date; }
+    return from_tai(to_tai(date, from), to);
+}
+
+} // namespace astro
+} // namespace astrea
@@ -0,0 +1,213 @@
+/**
+ * @file TimeScales.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief Conversions between the UTC, TAI, TT, TDB, UT1, and GPS time scales.
+ * @details Leap seconds and UT1-UTC are read once from local data files and stored on a daily grid so that every
+ *          conversion is a constant-time table lookup.
+ * @version 0.1
+ * @date 2025-08-05
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <filesystem>
+#include <vector>
+
+#include <units/time.hpp>
+#include <units/units.hpp>
+
+#include <astro/time/TwoPartJulianDate.hpp>
+#include <astro/types/typedefs.hpp>
+
+namespace astrea {
+namespace astro {
+
+/**
+ * @brief Supported astronomical time scales.
+ */
+enum class TimeScale : EnumType {
+    UTC, //!< Coordinated Universal Time
+    TAI, //!< International Atomic Time
+    TT,  //!< Terrestrial Time
+    TDB, //!< Barycentric Dynamical Time
+    UT1, //!< Universal Time, corrected for polar motion
+    GPS  //!< GPS Time
+};
+
+/**
+ * @brief Table of TAI-UTC offsets (leap seconds), expanded onto a daily grid for constant-time lookup.
+ *
+ * The data file holds one "MJD TAI-UTC" pair per line for each UTC day on which a new offset took effect. Lines
+ * starting with '#' are ignored.
+ */
+class LeapSecondTable {
+  public:
+    /**
+     * @brief Construct a LeapSecondTable from a data file.
+     *
+     * @param file The path to the leap second file.
+     */
+    LeapSecondTable(const std::filesystem::path& file);
+
+    /**
+     * @brief Destructor for LeapSecondTable.
+     */
+    ~LeapSecondTable() = default;
+
+    /**
+     * @brief Get the default table, loaded once from $ASTREA_ROOT/data/time/leap_seconds.dat.
+     *
+     * @return const LeapSecondTable& The default leap second table.
+     */
+    static const LeapSecondTable& get_instance();
+
+    /**
+     * @brief Get TAI-UTC at a UTC date.
+     *
+     * @param utc The UTC date.
+     * @return seconds TAI-UTC. The final tabulated value is held for dates after the end of the table.
+     */
+    seconds tai_minus_utc(const TwoPartJulianDate& utc) const;
+
+  private:
+    long _firstMjd;               //!< MJD of the first tabulated day
+    std::vector<double> _offsets; //!< TAI-UTC in seconds for each day since _firstMjd
+};
+
+/**
+ * @brief Coordinates of the Celestial Intermediate Pole in the International Terrestrial Reference Frame.
+ */
+struct PolarMotion {
+    Angle x; //!< Pole coordinate along the Greenwich meridian
+    Angle y; //!< Pole coordinate along the 90 degree west meridian
+};
+
+/**
+ * @brief Earth orientation parameters at one date.
+ */
+struct EarthOrientationParameters {
+    seconds ut1MinusUtc;     //!< UT1-UTC
+    PolarMotion polarMotion; //!< Pole coordinates
+    bool isTabulated;        //!< Whether the date is covered by the table. If not, the end values were held.
+};
+
+/**
+ * @brief Table of Earth orientation parameters, resampled onto a daily grid for constant-time interpolation.
+ *
+ * The data file is either an IERS finals2000A file (finals2000A.all, .data or .daily), read from its fixed-width
+ * Bulletin A columns up to the end of the published predictions, or a list of "MJD x_p y_p UT1-UTC" lines with polar
+ * motion in arcseconds and UT1-UTC in seconds. Lines starting with '#' are ignored in the latter. UT1-UTC is stored
+ * internally as UT1-TAI, which is continuous across leap seconds and can be safely interpolated.
+ *
+ * Dates outside of the table hold the end values, which quickly degrade (UT1-UTC drifts by up to a few milliseconds per
+ * day). get_parameters() reports whether a date was covered, and contains() checks a date up front.
+ */
+class EarthOrientationTable {
+  public:
+    /**
+     * @brief Construct an EarthOrientationTable from a data file.
+     *
+     * @param file The path to the Earth orientation parameter file.
+     * @param leapSeconds The leap second table used to remove the leap second jumps from UT1-UTC.
+     */
+    EarthOrientationTable(const std::filesystem::path& file, const LeapSecondTable& leapSeconds = LeapSecondTable::get_instance());
+
+    /**
+     * @brief Destructor for EarthOrientationTable.
+     */
+    ~EarthOrientationTable() = default;
+
+    /**
+     * @brief Get the default table, loaded once from $ASTREA_ROOT/data/time/finals2000A.all if it exists, and
+     * otherwise from the daily IERS excerpt in $ASTREA_ROOT/data/time/finals2000A.data.
+     *
+     * @return const EarthOrientationTable& The default Earth orientation table.
+     */
+    static const EarthOrientationTable& get_instance();
+
+    /**
+     * @brief Get UT1-UTC at a UTC date by linear interpolation.
+     *
+     * @param utc The UTC date.
+     * @return seconds UT1-UTC. The end values are held for dates outside of the table.
+     */
+    seconds ut1_minus_utc(const TwoPartJulianDate& utc) const;
+
+    /**
+     * @brief Get the polar motion at a UTC date by linear interpolation.
+     *
+     * @param utc The UTC date.
+     * @return PolarMotion The pole coordinates. The end values are held for dates outside of the table.
+     */
+    PolarMotion polar_motion(const TwoPartJulianDate& utc) const;
+
+    /**
+     * @brief Get UT1-UTC and the polar motion at a UTC date by linear interpolation, and whether the table covers it.
+     *
+     * @param utc The UTC date.
+     * @return EarthOrientationParameters The parameters. The end values are held, and flagged as not tabulated, for
+     * dates outside of the table.
+     */
+    EarthOrientationParameters get_parameters(const TwoPartJulianDate& utc) const;
+
+    /**
+     * @brief Check whether a UTC date is covered by the table.
+     *
+     * @param utc The UTC date.
+     * @return bool True if the date is between the first and last tabulated days.
+     */
+    bool contains(const TwoPartJulianDate& utc) const;
+
+  private:
+    const LeapSecondTable* _leapSeconds; //!< Leap second table used to convert UT1-TAI back to UT1-UTC
+    long _firstMjd;                      //!< MJD of the first grid day
+    std::vector<double> _ut1MinusTai;    //!< UT1-TAI in seconds for each day since _firstMjd
+    std::vector<double> _xPole;          //!< Pole x coordinate in arcseconds for each day since _firstMjd
+    std::vector<double> _yPole;          //!< Pole y coordinate in arcseconds for each day since _firstMjd
+
+    /**
+     * @brief Linearly interpolate a daily grid at a UTC date.
+     *
+     * @param grid The daily grid to interpolate.
+     * @param utc The UTC date.
+     * @return double The interpolated value. The end values are held for dates outside of the grid.
+     */
+    double interpolate(const std::vector<double>& grid, const TwoPartJulianDate& utc) const;
+};
+
+/**
+ * @brief Get TT-TAI.
+ *
+ * @return seconds The constant TT-TAI offset of 32.184 s.
+ */
+seconds tt_minus_tai();
+
+/**
+ * @brief Get GPS-TAI.
+ *
+ * @return seconds The constant GPS-TAI offset of -19 s.
+ */
+seconds gps_minus_tai();
+
+/**
+ * @brief Get TDB-TT using the two-term periodic approximation (Vallado, Eq. 3-48).
+ *
+ * @param tt The TT date.
+ * @return seconds TDB-TT, accurate to roughly 30 microseconds.
+ */
+seconds tdb_minus_tt(const TwoPartJulianDate& tt);
+
+/**
+ * @brief Convert a date from one time scale to another.
+ *
+ * @param date The date to convert.
+ * @param from The time scale of the input date.
+ * @param to The time scale to convert into.
+ * @return TwoPartJulianDate The date in the requested time scale.
+ */
+TwoPartJulianDate convert_time_scale(const TwoPartJulianDate& date, const TimeScale& from, const TimeScale& to);
+
+} // namespace astro
+} // namespace astrea
@@ -0,0 +1,222 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <numbers>
+#include <string>
+
+#include <units/units.hpp>
+
+#include <astro/time/TimeScales.hpp>
+
+using namespace astrea;
+using namespace astro;
+
+class TimeScalesTest : public testing::Test {
+  public:
+    TimeScalesTest() {}
+
+    void SetUp() override
+    {
+        using namespace std::chrono;
+        j2000         = TwoPartJulianDate::from_sys(sys_days{ January / 1 / 2000 } + 12h);
+        leapSecond    = TwoPartJulianDate::from_sys(sys_days{ January / 1 / 2017 });
+        eopNode       = TwoPartJulianDate::from_sys(sys_days{ April / 5 / 2007 });
+        temporaryFile = std::filesystem::temp_directory_path() / "astrea_time_scales_test.dat";
+    }
+
+    void TearDown() override { std::filesystem::remove(temporaryFile); }
+
+    TwoPartJulianDate j2000;
+    TwoPartJulianDate leapSecond;
+    TwoPartJulianDate eopNode;
+    std::filesystem::path temporaryFile;
+
+    const double NANOSECOND = 1.0e-9;
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(TimeScalesTest, TaiMinusUtc)
+{
+    const auto& table = LeapSecondTable::get_instance();
+    ASSERT_EQ(table.tai_minus_utc(j2000).count(), 32.0);
+    ASSERT_EQ(table.tai_minus_utc(leapSecond - seconds(1.0)).count(), 36.0);
+    ASSERT_EQ(table.tai_minus_utc(leapSecond).count(), 37.0);
+    ASSERT_EQ(table.tai_minus_utc(leapSecond + days(10000.0)).count(), 37.0);
+    ASSERT_ANY_THROW(table.tai_minus_utc(TwoPartJulianDate(2440000.0)));
+}
+
+TEST_F(TimeScalesTest, ConstantOffsets)
+{
+    ASSERT_EQ(tt_minus_tai().count(), 32.184);
+    ASSERT_EQ(gps_minus_tai().count(), -19.0);
+}
+
+TEST_F(TimeScalesTest, TdbMinusTt)
+{
+    for (double ii = 0.0; ii < 366.0; ii += 1.0) {
+        ASSERT_LT(std::abs(tdb_minus_tt(j2000 + days(ii)).count()), 1.7e-3);
+    }
+}
+
+TEST_F(TimeScalesTest, UtcToTt)
+{
+    const TwoPartJulianDate tt = convert_time_scale(j2000, TimeScale::UTC, TimeScale::TT);
+    ASSERT_NEAR((tt - j2000).count(), 64.184, NANOSECOND);
+}
+
+TEST_F(TimeScalesTest, UtcToGps)
+{
+    // GPS-UTC was 13 s at J2000
+    const TwoPartJulianDate gps = convert_time_scale(j2000, TimeScale::UTC, TimeScale::GPS);
+    ASSERT_NEAR((gps - j2000).count(), 13.0, NANOSECOND);
+}
+
+TEST_F(TimeScalesTest, Ut1MinusUtcAtNode)
+{
+    // IERS finals2000A, 2007-04-05
+    const auto& table = EarthOrientationTable::get_instance();
+    ASSERT_NEAR(table.ut1_minus_utc(eopNode).count(), -0.0714227, NANOSECOND);
+
+    const TwoPartJulianDate ut1 = convert_time_scale(eopNode, TimeScale::UTC, TimeScale::UT1);
+    ASSERT_NEAR((ut1 - eopNode).count(), -0.0714227, NANOSECOND);
+}
+
+TEST_F(TimeScalesTest, PolarMotionAtNode)
+{
+    using mp_units::angular::unit_symbols::rad;
+
+    // IERS finals2000A, 2007-04-05
+    const double arcsecToRad = std::numbers::pi / 648000.0;
+    const PolarMotion pole   = EarthOrientationTable::get_instance().polar_motion(eopNode);
+    ASSERT_NEAR(pole.x.numerical_value_in(rad) / arcsecToRad, 0.033178, 1.0e-9);
+    ASSERT_NEAR(pole.y.numerical_value_in(rad) / arcsecToRad, 0.483095, 1.0e-9);
+}
+
+TEST_F(TimeScalesTest, DefaultTableIsDaily)
+{
+    using namespace std::chrono;
+
+    // The shipped excerpt covers every epoch used by the tests and drivers, one row per day
+    const auto& table = EarthOrientationTable::get_instance();
+    for (const auto& date : { j2000, leapSecond, eopNode, TwoPartJulianDate::from_sys(sys_days{ November / 1 / 2026 }) }) {
+        ASSERT_TRUE(table.get_parameters(date).isTabulated);
+    }
+
+    // 2025-08-06 and 2025-08-07, so the midpoint is their average
+    const TwoPartJulianDate day0 = TwoPartJulianDate::from_sys(sys_days{ August / 6 / 2025 });
+    ASSERT_NEAR(table.ut1_minus_utc(day0).count(), 0.0673619, NANOSECOND);
+    ASSERT_NEAR(table.ut1_minus_utc(day0 + hours(12.0)).count(), 0.5 * (0.0673619 + 0.0686522), NANOSECOND);
+}
+
+TEST_F(TimeScalesTest, Ut1ContinuousAcrossLeapSecond)
+{
+    const auto& table               = EarthOrientationTable::get_instance();
+    const TwoPartJulianDate newYear = TwoPartJulianDate::from_sys(std::chrono::sys_days{ std::chrono::January / 1 / 2006 });
+
+    // UT1-UTC jumps by exactly the inserted leap second
+    const double before = table.ut1_minus_utc(newYear - seconds(1.0)).count();
+    const double after  = table.ut1_minus_utc(newYear).count();
+    ASSERT_NEAR(after - before, 1.0, 1.0e-6);
+}
+
+TEST_F(TimeScalesTest, RoundTrips)
+{
+    const std::vector<TimeScale> scales = { TimeScale::UTC, TimeScale::TAI, TimeScale::TT,
+                                            TimeScale::TDB, TimeScale::UT1, TimeScale::GPS };
+    for (const auto& date : { j2000, leapSecond, eopNode, eopNode + hours(7.5) }) {
+        for (const auto& scale : scales) {
+            const TwoPartJulianDate converted = convert_time_scale(date, TimeScale::UTC, scale);
+            const TwoPartJulianDate back      = convert_time_scale(converted, scale, TimeScale::UTC);
+            ASSERT_NEAR((back - date).count(), 0.0, NANOSECOND);
+        }
+    }
+}
+
+TEST_F(TimeScalesTest, LeapSecondTableFromFile)
+{
+    {
+        std::ofstream file(temporaryFile);
+        file << "# comment\n50000 1\n50010 2\n";
+    }
+    const LeapSecondTable table(temporaryFile);
+    ASSERT_EQ(table.tai_minus_utc(TwoPartJulianDate(2450009.5)).count(), 1.0);
+    ASSERT_EQ(table.tai_minus_utc(TwoPartJulianDate(2450010.5)).count(), 2.0);
+}
+
+TEST_F(TimeScalesTest, EarthOrientationTableFromFinalsFile)
+{
+    // Rows in the fixed-width IERS finals2000A layout, ending with a row beyond the published predictions
+    const auto finalsRow = [](const std::string& mjd, const std::string& x, const std::string& y, const std::string& ut1) {
+        std::string row(185, ' ');
+        row.replace(7, 8, mjd);
+        row[16] = 'I';
+        row.replace(18, 9, x);
+        row.replace(37, 9, y);
+        row[57] = 'I';
+        row.replace(58, 10, ut1);
+        return row;
+    };
+    std::string unpublished(185, ' ');
+    unpublished.replace(7, 8, "54196.00");
+    {
+        std::ofstream file(temporaryFile);
+        file << finalsRow("53101.00", "-0.140682", " 0.333309", "-0.4399619") << "\n"
+             << finalsRow("54195.00", "0.0349282", "0.4833163", "-0.0720737") << "\n"
+             << unpublished << "\n";
+    }
+    const EarthOrientationTable table(temporaryFile);
+    ASSERT_NEAR(table.ut1_minus_utc(TwoPartJulianDate(2400000.5 + 53101.0)).count(), -0.4399619, NANOSECOND);
+    ASSERT_NEAR(table.ut1_minus_utc(eopNode).count(), -0.0720737, NANOSECOND);
+    ASSERT_TRUE(table.contains(eopNode));
+    ASSERT_FALSE(table.contains(eopNode + days(1.0)));
+
+    using mp_units::angular::unit_symbols::rad;
+    const double arcsecToRad = std::numbers::pi / 648000.0;
+    const PolarMotion pole   = table.polar_motion(eopNode);
+    ASSERT_NEAR(pole.x.numerical_value_in(rad) / arcsecToRad, 0.0349282, 1.0e-9);
+    ASSERT_NEAR(pole.y.numerical_value_in(rad) / arcsecToRad, 0.4833163, 1.0e-9);
+}
+
+TEST_F(TimeScalesTest, EarthOrientationTableReportsOutsideOfTable)
+{
+    {
+        std::ofstream file(temporaryFile);
+        file << "53101 -0.140682 0.333309 -0.4399619\n54195 0.0349282 0.4833163 -0.072073685\n";
+    }
+    const EarthOrientationTable table(temporaryFile);
+    ASSERT_FALSE(table.contains(leapSecond));
+
+    const EarthOrientationParameters inside = table.get_parameters(eopNode);
+    ASSERT_TRUE(inside.isTabulated);
+    ASSERT_NEAR(inside.ut1MinusUtc.count(), -0.072073685, NANOSECOND);
+
+    // The end values are held and flagged, and nothing is printed
+    testing::internal::CaptureStderr();
+    const EarthOrientationParameters after  = table.get_parameters(leapSecond);
+    const EarthOrientationParameters before = table.get_parameters(j2000 - days(3000.0));
+    ASSERT_TRUE(testing::internal::GetCapturedStderr().empty());
+
+    ASSERT_FALSE(after.isTabulated);
+    ASSERT_FALSE(before.isTabulated);
+    ASSERT_EQ(after.polarMotion.x, table.polar_motion(eopNode).x);
+    ASSERT_EQ(before.polarMotion.y, table.polar_motion(TwoPartJulianDate(2400000.5 + 53101.0)).y);
+}
+
+TEST_F(TimeScalesTest, UnsortedFileThrows)
+{
+    {
+        std::ofstream file(temporaryFile);
+        file << "50010 2\n50000 1\n";
+    }
+    ASSERT_ANY_THROW(LeapSecondTable{ temporaryFile });
+}
+
+TEST_F(TimeScalesTest, MissingFileThrows) { ASSERT_ANY_THROW(LeapSecondTable{ temporaryFile / "missing.dat" }); }
@@ -0,0 +1,255 @@
+/**
+ * @file TwoPartJulianDate.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief A two-part (day + fraction) Julian date representation for precise time keeping.
+ * @version 0.1
+ * @date 2025-08-05
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <chrono>
+#include <cmath>
+#include <compare>
+#include <cstdint>
+
+#include <units/time.hpp>
+
+#include <astro/time/JulianDateClock.hpp>
+
+namespace astrea {
+namespace astro {
+
+/**
+ * @brief A Julian date split into an integral day and a fraction of a day.
+ *
+ * A single double holding ~2.45e6 days resolves time to roughly 40 microseconds. Splitting the date into a whole
+ * day count and a fraction in [0, 1) keeps the full double precision for the time of day (~10 picoseconds) and
+ * allows exact differencing of the whole-day parts over long spans.
+ */
+class TwoPartJulianDate {
+  public:
+    /**
+     * @brief Construct a TwoPartJulianDate from a day and a fraction of a day.
+     *
+     * @param day The day part of the Julian date. Need not be integral.
+     * @param fraction The fractional day part of the Julian date. Need not lie in [0, 1).
+     */
+    explicit constexpr TwoPartJulianDate(const double& day = 2451545.0, const double& fraction = 0.0) :
+        _day(day),
+        _fraction(fraction)
+    {
+        normalize();
+    }
+
+    /**
+     * @brief Construct a TwoPartJulianDate from a single-part JulianDate.
+     *
+     * @param jdate The JulianDate to split.
+     */
+    constexpr TwoPartJulianDate(const JulianDate& jdate) :
+        TwoPartJulianDate(jdate.time_since_epoch().count(), 0.0)
+    {
+    }
+
+    /**
+     * @brief Construct a TwoPartJulianDate from a system time point without passing through a single double.
+     *
+     * @tparam Duration The duration type of the system time point.
+     * @param timePoint The system time point to convert.
+     * @return TwoPartJulianDate The two-part Julian date of the system time point.
+     */
+    template <class Duration>
+    static TwoPartJulianDate from_sys(const std::chrono::sys_time<Duration>& timePoint)
+    {
+        using namespace std::chrono;
+        const auto midnight  = floor<std::chrono::days>(timePoint);
+        const auto timeOfDay = std::chrono::duration<double>(timePoint - midnight).count();
+        return TwoPartJulianDate(
+            static_cast<double>(midnight.time_since_epoch().count()) + UNIX_EPOCH_DAY, 0.5 + timeOfDay / SECONDS_PER_DAY
+        );
+    }
+
+    /**
+     * @brief Convert this Julian date to a system time point with nanosecond resolution.
+     *
+     * @return std::chrono::sys_time<std::chrono::nanoseconds> The system time point.
+     */
+    std::chrono::sys_time<std::chrono::nanoseconds> to_sys() const
+    {
+        using namespace std::chrono;
+        const auto unixDays   = static_cast<int64_t>(_day - UNIX_EPOCH_DAY);
+        const auto nanosOfDay = std::llround((_fraction - 0.5) * SECONDS_PER_DAY * 1.0e9);
+        return sys_days{ std::chrono::days{ unixDays } } + std::chrono::nanoseconds{ nanosOfDay };
+    }
+
+    /**
+     * @brief Get the integral day part of the Julian date.
+     *
+     * @return const double& The day part, always integral.
+     */
+    constexpr const double& day() const { return _day; }
+
+    /**
+     * @brief Get the fractional day part of the Julian date.
+     *
+     * @return const double& The fraction of the day, always in [0, 1).
+     */
+    constexpr const double& fraction() const { return _fraction; }
+
+    /**
+     * @brief Collapse the two parts into a single-part JulianDate.
+     *
+     * @return JulianDate The (lower precision) single-part Julian date.
+     */
+    constexpr JulianDate jd() const { return JulianDate(JulianDateClock::duration{ _day + _fraction }); }
+
+    /**
+     * @brief Get the Modified Julian Date without collapsing the full Julian date first.
+     *
+     * @return JulianDateClock::duration The Modified Julian Date in days.
+     */
+    constexpr JulianDateClock::duration mjd() const
+    {
+        return JulianDateClock::duration{ (_day - MJD_EPOCH_DAY) + (_fraction - 0.5) };
+    }
+
+    /**
+     * @brief Add a duration in days to this Julian date in place.
+     *
+     * @param duration The duration to add.
+     * @return TwoPartJulianDate& A reference to this Julian date after the addition.
+     */
+    constexpr TwoPartJulianDate& operator+=(const JulianDateClock::duration& duration)
+    {
+        add_days(duration.count());
+        return *this;
+    }
+
+    /**
+     * @brief Subtract a duration in days from this Julian date in place.
+     *
+     * @param duration The duration to subtract.
+     * @return TwoPartJulianDate& A reference to this Julian date after the subtraction.
+     */
+    constexpr TwoPartJulianDate& operator-=(const JulianDateClock::duration& duration)
+    {
+        add_days(-duration.count());
+        return *this;
+    }
+
+    /**
+     * @brief Add a duration in days to this Julian date.
+     *
+     * @param duration The duration to add.
+     * @return TwoPartJulianDate The resulting Julian date.
+     */
+    constexpr TwoPartJulianDate operator+(const JulianDateClock::duration& duration) const
+    {
+        TwoPartJulianDate result = *this;
+        return result += duration;
+    }
+
+    /**
+     * @brief Subtract a duration in days from this Julian date.
+     *
+     * @param duration The duration to subtract.
+     * @return TwoPartJulianDate The resulting Julian date.
+     */
+    constexpr TwoPartJulianDate operator-(const JulianDateClock::duration& duration) const
+    {
+        TwoPartJulianDate result = *this;
+        return result -= duration;
+    }
+
+    /**
+     * @brief Difference two Julian dates, keeping the whole-day difference exact.
+     *
+     * @param other The Julian date to subtract.
+     * @return seconds The elapsed time between the two dates.
+     */
+    constexpr seconds operator-(const TwoPartJulianDate& other) const
+    {
+        return seconds{ (_day - other._day) * SECONDS_PER_DAY + (_fraction - other._fraction) * SECONDS_PER_DAY };
+    }
+
+    /**
+     * @brief Lexicographic comparison of the (normalized) day and fraction.
+     *
+     * @param other The Julian date to compare against.
+     * @return std::partial_ordering The ordering of the two dates.
+     */
+    constexpr auto operator<=>(const TwoPartJulianDate& other) const = default;
+
+    /**
+     * @brief Equality comparison of the (normalized) day and fraction.
+     *
+     * @param other The Julian date to compare against.
+     * @return bool True if both parts are equal.
+     */
+    constexpr bool operator==(const TwoPartJulianDate& other) const = default;
+
+  private:
+    static constexpr double SECONDS_PER_DAY = 86400.0;   //!< Seconds in a Julian day
+    static constexpr double UNIX_EPOCH_DAY  = 2440587.0; //!< Day part of the Julian date of 1970-01-01 00:00:00
+    static constexpr double MJD_EPOCH_DAY   = 2400000.0; //!< Day part of the Julian date of the MJD epoch
+
+    double _day;      //!< Integral day part of the Julian date
+    double _fraction; //!< Fractional day part of the Julian date, in [0, 1)
+
+    /**
+     * @brief Move any whole days out of the fraction and into the day part.
+     */
+    constexpr void normalize()
+    {
+        const double wholeDays = std::floor(_day);
+        _fraction += _day - wholeDays;
+        _day = wholeDays;
+        carry();
+    }
+
+    /**
+     * @brief Carry the whole days of an out-of-range fraction into the (already integral) day part.
+     */
+    constexpr void carry()
+    {
+        const double wholeDays = std::floor(_fraction);
+        _day += wholeDays;
+        _fraction -= wholeDays;
+        if (_fraction >= 1.0) { // -eps + 1.0 rounds up to 1.0
+            _fraction -= 1.0;
+            _day += 1.0;
+        }
+    }
+
+    /**
+     * @brief Add a number of days, avoiding floor() for the common sub-day step.
+     *
+     * @param days The number of days to add.
+     */
+    constexpr void add_days(const double& days)
+    {
+        if (days > -1.0 && days < 1.0) {
+            _fraction += days;
+            if (_fraction < 0.0) [[unlikely]] {
+                _fraction += 1.0;
+                _day -= 1.0;
+            }
+            if (_fraction >= 1.0) [[unlikely]] {
+                _fraction -= 1.0;
+                _day += 1.0;
+            }
+        }
+        else {
+            const double wholeDays = std::floor(days);
+            _day += wholeDays;
+            _fraction += days - wholeDays;
+            carry();
+        }
+    }
+};
+
+} // namespace astro
+} // namespace astrea
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include <units/units.hpp>
+
+#include <astro/time/TwoPartJulianDate.hpp>
+
+using namespace astrea;
+using namespace astro;
+
+class TwoPartJulianDateTest : public testing::Test {
+  public:
+    TwoPartJulianDateTest() {}
+
+    void SetUp() override
+    {
+        using namespace std::chrono;
+        j2000 = TwoPartJulianDate::from_sys(sys_days{ January / 1 / 2000 } + 12h);
+    }
+
+    TwoPartJulianDate j2000;
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(TwoPartJulianDateTest, DefaultConstructor) { ASSERT_EQ(TwoPartJulianDate(), TwoPartJulianDate(J2000)); }
+
+TEST_F(TwoPartJulianDateTest, Normalization)
+{
+    const TwoPartJulianDate jd(2451545.75, 1.5);
+    ASSERT_EQ(jd.day(), 2451547.0);
+    ASSERT_EQ(jd.fraction(), 0.25);
+
+    const TwoPartJulianDate negative(2451545.0, -0.25);
+    ASSERT_EQ(negative.day(), 2451544.0);
+    ASSERT_EQ(negative.fraction(), 0.75);
+}
+
+TEST_F(TwoPartJulianDateTest, FromSys)
+{
+    ASSERT_EQ(j2000.day(), 2451545.0);
+    ASSERT_EQ(j2000.fraction(), 0.0);
+    ASSERT_EQ(j2000.jd(), J2000);
+}
+
+TEST_F(TwoPartJulianDateTest, SysRoundTrip)
+{
+    using namespace std::chrono;
+    const sys_time<std::chrono::nanoseconds> time = sys_days{ August / 20 / 1992 } + 12h + 14min + 123456789ns;
+    ASSERT_EQ(TwoPartJulianDate::from_sys(time).to_sys(), time);
+}
+
+TEST_F(TwoPartJulianDateTest, Mjd) { ASSERT_EQ(j2000.mjd().count(), 51544.5); }
+
+TEST_F(TwoPartJulianDateTest, MicrosecondResolution)
+{
+    // A single double Julian date cannot resolve a microsecond step
+    ASSERT_EQ(J2000 + JulianDateClock::duration(seconds(1.0e-6)), J2000);
+
+    const TwoPartJulianDate later = j2000 + seconds(1.0e-6);
+    ASSERT_GT(later, j2000);
+    ASSERT_NEAR((later - j2000).count(), 1.0e-6, 1.0e-15);
+}
+
+TEST_F(TwoPartJulianDateTest, LongSpanDifference)
+{
+    const TwoPartJulianDate later = j2000 + days(36525.0) + seconds(1.0e-3);
+    ASSERT_NEAR((later - j2000).count(), 36525.0 * 86400.0 + 1.0e-3, 1.0e-6);
+}
+
+TEST_F(TwoPartJulianDateTest, AdditionAndSubtraction)
+{
+    TwoPartJulianDate jd = j2000;
+    jd += hours(30.0);
+    ASSERT_EQ(jd.day(), 2451546.0);
+    ASSERT_NEAR(jd.fraction(), 0.25, 1.0e-15);
+
+    jd -= hours(30.0);
+    ASSERT_EQ(jd.day(), j2000.day());
+    ASSERT_NEAR(jd.fraction(), j2000.fraction(), 1.0e-15);
+}
+
+TEST_F(TwoPartJulianDateTest, Comparison)
+{
+    ASSERT_LT(j2000, j2000 + seconds(1.0e-6));
+    ASSERT_GT(j2000 + days(1.0), j2000 + hours(23.0));
+    ASSERT_EQ(j2000 + days(1.0), TwoPartJulianDate(2451546.0, 0.0));
+}
@@ -0,0 +1,177 @@
+#include <astro/time/epoch_parsing.hpp>
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+namespace astrea {
+namespace astro {
+
+namespace {
+
+constexpr bool is_digit(const char& c) { return c >= '0' && c <= '9'; }
+
+// Read an unsigned integer of between minDigits and maxDigits digits
+constexpr bool read_digits(std::string_view str, std::size_t& pos, const std::size_t& minDigits, const std::size_t& maxDigits, int& value)
+{
+    const std::size_t start = pos;
+    value                   = 0;
+    while (pos < str.size() && pos - start < maxDigits && is_digit(str[pos])) {
+        value = value * 10 + (str[pos] - '0');
+        ++pos;
+    }
+    return pos - start >= minDigits;
+}
+
+constexpr bool read_char(std::string_view str, std::size_t& pos, const char& c)
+{
+    if (pos < str.size() && str[pos] == c) {
+        ++pos;
+        return true;
+    }
+    return false;
+}
+
+constexpr bool is_leap_year(const int& year) { return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0; }
+
+constexpr int days_in_month(const int& year, const int& month)
+{
+    constexpr std::array<int, 12> DAYS = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    return (month == 2 && is_leap_year(year)) ? 29 : DAYS[month - 1];
+}
+
+// Days since 1970-01-01 of a proleptic Gregorian date (H. Hinnant, "chrono-Compatible Low-Level Date Algorithms")
+constexpr int64_t days_from_civil(int year, const int& month, const int& day)
+{
+    year -= month <= 2;
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const int64_t yoe = year - era * 400;
+    const int64_t doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+constexpr int64_t NANOSECONDS_PER_SECOND = 1'000'000'000;
+constexpr double NANOSECONDS_PER_DAY     = 86400.0e9;
+constexpr double UNIX_EPOCH_DAY          = 2440587.0; // Day part of the Julian date of 1970-01-01 00:00:00
+
+constexpr void skip_spaces(std::string_view str, std::size_t& pos)
+{
+    while (pos < str.size() && str[pos] == ' ') {
+        ++pos;
+    }
+}
+
+// Parse any accepted layout when no format is given, and only that layout otherwise
+std::optional<TwoPartJulianDate> try_parse_epoch_impl(std::string_view epoch, const EpochFormat* format) noexcept
+{
+    std::size_t pos = 0;
+    if (!format) { skip_spaces(epoch, pos); }
+
+    // Date
+    int year, month, day;
+    if (!read_digits(epoch, pos, 4, 4, year) || !read_char(epoch, pos, '-')) { return std::nullopt; }
+
+    const std::size_t fieldStart = pos;
+    int field;
+    if (!read_digits(epoch, pos, 1, 3, field)) { return std::nullopt; }
+
+    const std::size_t fieldDigits = pos - fieldStart;
+
+    int64_t unixDays;
+    const bool hasMonth = read_char(epoch, pos, '-');
+    if (format && hasMonth == format->isDayOfYear) { return std::nullopt; }
+    if (hasMonth) { // YYYY-MM-DD
+        if (fieldDigits > 2) { return std::nullopt; }
+        month = field;
+        if (month < 1 || month > 12 || !read_digits(epoch, pos, 1, 2, day)) { return std::nullopt; }
+        if (day < 1 || day > days_in_month(year, month)) { return std::nullopt; }
+        unixDays = days_from_civil(year, month, day);
+    }
+    else { // YYYY-DDD
+        if (field < 1 || field > (is_leap_year(year) ? 366 : 365)) { return std::nullopt; }
+        unixDays = days_from_civil(year, 1, 1) + field - 1;
+    }
+
+    // Time of day
+    int hour = 0, minute = 0, second = 0;
+    int64_t nanoseconds = 0;
+    const bool hasTime =
+        format ? read_char(epoch, pos, format->separator) : (read_char(epoch, pos, 'T') || read_char(epoch, pos, ' '));
+    if (format && !hasTime) { return std::nullopt; }
+    if (hasTime) {
+        if (!format) { skip_spaces(epoch, pos); }
+        if (!read_digits(epoch, pos, 1, 2, hour) || !read_char(epoch, pos, ':') || !read_digits(epoch, pos, 1, 2, minute)) {
+            return std::nullopt;
+        }
+        if (read_char(epoch, pos, ':')) {
+            if (!read_digits(epoch, pos, 1, 2, second)) { return std::nullopt; }
+            if (read_char(epoch, pos, '.')) {
+                int64_t scale           = NANOSECONDS_PER_SECOND;
+                const std::size_t start = pos;
+                while (pos < epoch.size() && is_digit(epoch[pos])) {
+                    if (scale > 1) {
+                        scale /= 10;
+                        nanoseconds += (epoch[pos] - '0') * scale;
+                    }
+                    ++pos;
+                }
+                if (pos == start) { return std::nullopt; }
+            }
+        }
+        else if (format) {
+            return std::nullopt;
+        }
+        if (hour > 23 || minute > 59 || second > 59) { return std::nullopt; }
+    }
+    if (!format) {
+        read_char(epoch, pos, 'Z');
+        skip_spaces(epoch, pos);
+    }
+    if (pos != epoch.size()) { return std::nullopt; }
+
+    const int64_t nanosOfDay = ((hour * 60 + minute) * 60 + second) * NANOSECONDS_PER_SECOND + nanoseconds;
+    return TwoPartJulianDate(static_cast<double>(unixDays) + UNIX_EPOCH_DAY, 0.5 + static_cast<double>(nanosOfDay) / NANOSECONDS_PER_DAY);
+}
+
+} // namespace
+
+
+std::optional<TwoPartJulianDate> try_parse_epoch(std::string_view epoch) noexcept
+{
+    return try_parse_epoch_impl(epoch, nullptr);
+}
+
+std::optional<TwoPartJulianDate> try_parse_epoch(std::string_view epoch, const EpochFormat& format) noexcept
+{
+    return try_parse_epoch_impl(epoch, &format);
+}
+
+
+TwoPartJulianDate parse_epoch(std::string_view epoch)
+{
+    const auto date = try_parse_epoch(epoch);
+    if (!date) { throw std::invalid_argument("Unable to parse epoch string: " + std::string(epoch)); }
+    return *date;
+}
+
+TwoPartJulianDate parse_epoch(std::string_view epoch, const EpochFormat& format)
+{
+    const auto date = try_parse_epoch(epoch, format);
+    if (!date) { throw std::invalid_argument("Unable to parse epoch string in the requested format: " + std::string(epoch)); }
+    return *date;
+}
+
+
+std::optional<EpochFormat> get_iso_epoch_format(const std::string& format)
+{
+    if (format == "%Y-%m-%d %H:%M:%S" || format == "%F %T") { return EpochFormat{ false, ' ' }; }
+    if (format == "%Y-%m-%dT%H:%M:%S" || format == "%FT%T") { return EpochFormat{ false, 'T' }; }
+    if (format == "%Y-%j %H:%M:%S") { return EpochFormat{ true, ' ' }; }
+    return std::nullopt;
+}
+
+bool is_iso_epoch_format(const std::string& format) { return get_iso_epoch_format(format).has_value(); }
+
+} // namespace astro
+} // namespace astrea
@@ -0,0 +1,113 @@
+/**
+ * @file epoch_parsing.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief Locale- and stream-free parsing of ISO-8601 and Space-Track epoch strings.
+ * @version 0.1
+ * @date 2025-08-06
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <astro/time/TwoPartJulianDate.hpp>
+
+namespace astrea {
+namespace astro {
+
+/**
+ * @brief Layout of an ISO-8601 style epoch, for parsing strictly against one date::parse format.
+ */
+struct EpochFormat {
+    bool isDayOfYear; //!< Whether the date is "YYYY-DDD" rather than "YYYY-MM-DD"
+    char separator;   //!< Character between the date and the time of day
+};
+
+/**
+ * @brief Parse an epoch string into a two-part Julian date, returning nothing on malformed input.
+ *
+ * Accepted forms are "YYYY-MM-DD" and "YYYY-DDD" (day of year), optionally followed by 'T' or ' ' and a time of day
+ * "hh:mm", "hh:mm:ss", or "hh:mm:ss.fffffffff", and an optional trailing 'Z'. Month, day, hour, minute and second
+ * fields may be one or two digits and the day of year one to three digits, matching what date::parse accepts for
+ * the equivalent formats. Fractional seconds beyond nanoseconds are truncated.
+ *
+ * @param epoch The epoch string to parse.
+ * @return std::optional<TwoPartJulianDate> The parsed UTC Julian date, if the string was valid.
+ */
+std::optional<TwoPartJulianDate> try_parse_epoch(std::string_view epoch) noexcept;
+
+/**
+ * @brief Parse an epoch string into a two-part Julian date.
+ *
+ * @param epoch The epoch string to parse. See try_parse_epoch for the accepted forms.
+ * @return TwoPartJulianDate The parsed UTC Julian date.
+ * @throws std::invalid_argument If the string is not a valid epoch.
+ */
+TwoPartJulianDate parse_epoch(std::string_view epoch);
+
+/**
+ * @brief Parse an epoch string in exactly one layout, returning nothing on malformed input.
+ *
+ * Unlike the lenient overload, the date must be in the requested form, the time of day "hh:mm:ss" (with optional
+ * fractional seconds) must follow the requested separator, and no whitespace or trailing 'Z' is accepted. Fields may
+ * still be one or two digits, as they can be with date::parse.
+ *
+ * @param epoch The epoch string to parse.
+ * @param format The layout the epoch must follow.
+ * @return std::optional<TwoPartJulianDate> The parsed UTC Julian date, if the string was valid.
+ */
+std::optional<TwoPartJulianDate> try_parse_epoch(std::string_view epoch, const EpochFormat& format) noexcept;
+
+/**
+ * @brief Parse an epoch string in exactly one layout.
+ *
+ * @param epoch The epoch string to parse.
+ * @param format The layout the epoch must follow. See try_parse_epoch for the rules.
+ * @return TwoPartJulianDate The parsed UTC Julian date.
+ * @throws std::invalid_argument If the string is not a valid epoch in the layout.
+ */
+TwoPartJulianDate parse_epoch(std::string_view epoch, const EpochFormat& format);
+
+/**
+ * @brief Parse a column of epoch strings into two-part Julian dates.
+ *
+ * @tparam Range_T A range of string-like epochs.
+ * @param epochs The epoch strings to parse.
+ * @return std::vector<TwoPartJulianDate> The parsed UTC Julian dates, in order.
+ * @throws std::invalid_argument If any string is not a valid epoch.
+ */
+template <std::ranges::input_range Range_T>
+std::vector<TwoPartJulianDate> parse_epochs(const Range_T& epochs)
+{
+    std::vector<TwoPartJulianDate> dates;
+    if constexpr (std::ranges::sized_range<Range_T>) { dates.reserve(std::ranges::size(epochs)); }
+    for (const auto& epoch : epochs) {
+        dates.push_back(parse_epoch(std::string_view(epoch)));
+    }
+    return dates;
+}
+
+/**
+ * @brief Get the layout of a date::parse format string that the strict parse_epoch overload can handle.
+ *
+ * @param format The date::parse style format string.
+ * @return std::optional<EpochFormat> The layout, if parse_epoch can be used in place of date::parse for this format.
+ */
+std::optional<EpochFormat> get_iso_epoch_format(const std::string& format);
+
+/**
+ * @brief Check if a date::parse format string describes an epoch that parse_epoch handles identically.
+ *
+ * @param format The date::parse style format string.
+ * @return bool True if parse_epoch can be used in place of date::parse for this format.
+ */
+bool is_iso_epoch_format(const std::string& format);
+
+} // namespace astro
+} // namespace astrea
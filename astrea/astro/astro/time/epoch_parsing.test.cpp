@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+
+#include <format>
+#include <random>
+#include <sstream>
+
+#include <date/date.h>
+
+#include <units/units.hpp>
+
+#include <astro/time/epoch_parsing.hpp>
+
+using namespace astrea;
+using namespace astro;
+
+class EpochParsingTest : public testing::Test {
+  public:
+    EpochParsingTest() :
+        generator(20250806)
+    {
+    }
+
+    void SetUp() override {}
+
+    // Reference parse through date::parse, as Date did before the hand-written parser
+    std::optional<std::chrono::sys_time<std::chrono::milliseconds>> reference_parse(const std::string& epoch, const std::string& format)
+    {
+        std::istringstream epochStream{ epoch };
+        std::chrono::sys_time<std::chrono::milliseconds> systemTime;
+        epochStream >> date::parse(format, systemTime);
+        if (epochStream.fail()) { return std::nullopt; }
+        return systemTime;
+    }
+
+    // Random, valid epoch string in one of the supported layouts
+    std::pair<std::string, std::string> random_epoch()
+    {
+        using namespace std::chrono;
+        std::uniform_int_distribution<int> dayDist(-7305, 47482); // 1950 - 2100
+        std::uniform_int_distribution<int> secondDist(0, 86399);
+        std::uniform_int_distribution<int> digitsDist(0, 3);
+        std::uniform_int_distribution<int> fractionDist(0, 999);
+        std::uniform_int_distribution<int> layoutDist(0, 2);
+
+        const sys_days day = sys_days{ std::chrono::days{ dayDist(generator) } };
+        const year_month_day ymd{ day };
+        const int secondOfDay = secondDist(generator);
+        const int hour        = secondOfDay / 3600;
+        const int minute      = (secondOfDay / 60) % 60;
+        const int second      = secondOfDay % 60;
+
+        std::string fraction;
+        const int nDigits = digitsDist(generator);
+        if (nDigits > 0) {
+            fraction = "." + std::format("{:03d}", fractionDist(generator)).substr(0, static_cast<std::size_t>(nDigits));
+        }
+
+        const int y      = static_cast<int>(ymd.year());
+        const unsigned m = static_cast<unsigned>(ymd.month());
+        const unsigned d = static_cast<unsigned>(ymd.day());
+        switch (layoutDist(generator)) {
+            case 0:
+                return { std::format("{:04d}-{:02d}-{:02d} {:02d}:{:02d}:{:02d}{}", y, m, d, hour, minute, second, fraction),
+                         "%Y-%m-%d %H:%M:%S" };
+            case 1:
+                return { std::format("{:04d}-{:02d}-{:02d}T{:02d}:{:02d}:{:02d}{}", y, m, d, hour, minute, second, fraction),
+                         "%Y-%m-%dT%H:%M:%S" };
+            default: {
+                // Unpadded day-of-year layout, as built from TLE epochs
+                const int dayOfYear = (day - sys_days{ ymd.year() / January / 1 }).count() + 1;
+                return { std::format("{}-{} {}:{}:{}{}", y, dayOfYear, hour, minute, second, fraction), "%Y-%j %H:%M:%S" };
+            }
+        }
+    }
+
+    std::mt19937 generator;
+    const std::size_t N_FUZZ = 100000;
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(EpochParsingTest, J2000)
+{
+    ASSERT_EQ(parse_epoch("2000-01-01 12:00:00.0"), TwoPartJulianDate(J2000));
+    ASSERT_EQ(parse_epoch("2000-01-01T12:00:00Z"), TwoPartJulianDate(J2000));
+    ASSERT_EQ(parse_epoch("2000-001 12:00:00"), TwoPartJulianDate(J2000));
+}
+
+TEST_F(EpochParsingTest, SpaceTrackEpoch)
+{
+    using namespace std::chrono;
+    const auto expected = sys_days{ July / 30 / 2025 } + 12h + 34min + 56s + 123456us;
+    ASSERT_EQ(parse_epoch("2025-07-30T12:34:56.123456").to_sys(), expected);
+}
+
+TEST_F(EpochParsingTest, NanosecondFraction)
+{
+    using namespace std::chrono;
+    const auto expected = sys_days{ July / 30 / 2025 } + 123456789ns;
+    ASSERT_EQ(parse_epoch("2025-07-30 00:00:00.1234567891").to_sys(), expected);
+}
+
+TEST_F(EpochParsingTest, DateOnly)
+{
+    using namespace std::chrono;
+    ASSERT_EQ(parse_epoch("2024-02-29").to_sys(), sys_days{ February / 29 / 2024 });
+}
+
+TEST_F(EpochParsingTest, Malformed)
+{
+    for (const std::string epoch : { "", "2024", "24-01-01", "2024-13-01", "2024-02-30", "2023-366", "2024-01-01 24:00:00",
+                                     "2024-01-01 12:60:00", "2024-01-01 12:00:60", "2024-01-01 12:00:00.", "2024-01-01 12",
+                                     "2024-01-01 12:00:00x", "2024/01/01" }) {
+        ASSERT_FALSE(try_parse_epoch(epoch).has_value()) << epoch;
+        ASSERT_THROW(parse_epoch(epoch), std::invalid_argument) << epoch;
+    }
+}
+
+TEST_F(EpochParsingTest, Batch)
+{
+    const std::vector<std::string> epochs = { "2000-01-01 12:00:00", "2000-01-02T12:00:00", "2000-003 12:00:00" };
+    const auto dates                      = parse_epochs(epochs);
+    ASSERT_EQ(dates.size(), 3);
+    for (std::size_t ii = 0; ii < dates.size(); ++ii) {
+        ASSERT_EQ(dates[ii].day(), 2451545.0 + static_cast<double>(ii));
+    }
+    ASSERT_THROW(parse_epochs(std::vector<std::string>{ "2000-01-01", "bad" }), std::invalid_argument);
+}
+
+TEST_F(EpochParsingTest, IsoEpochFormat)
+{
+    ASSERT_TRUE(is_iso_epoch_format("%Y-%m-%d %H:%M:%S"));
+    ASSERT_TRUE(is_iso_epoch_format("%Y-%m-%dT%H:%M:%S"));
+    ASSERT_TRUE(is_iso_epoch_format("%Y-%j %H:%M:%S"));
+    ASSERT_FALSE(is_iso_epoch_format("%d/%m/%Y"));
+}
+
+TEST_F(EpochParsingTest, StrictFormat)
+{
+    const EpochFormat space     = *get_iso_epoch_format("%Y-%m-%d %H:%M:%S");
+    const EpochFormat t         = *get_iso_epoch_format("%FT%T");
+    const EpochFormat dayOfYear = *get_iso_epoch_format("%Y-%j %H:%M:%S");
+    ASSERT_FALSE(get_iso_epoch_format("%d/%m/%Y").has_value());
+
+    ASSERT_EQ(parse_epoch("2000-01-01 12:00:00", space), TwoPartJulianDate(J2000));
+    ASSERT_EQ(parse_epoch("2000-1-1 12:0:0.0", space), TwoPartJulianDate(J2000));
+    ASSERT_EQ(parse_epoch("2000-01-01T12:00:00", t), TwoPartJulianDate(J2000));
+    ASSERT_EQ(parse_epoch("2000-001 12:00:00", dayOfYear), TwoPartJulianDate(J2000));
+
+    // Every other layout the lenient parser accepts is rejected
+    for (const std::string epoch : { "2000-01-01T12:00:00", "2000-001 12:00:00", "2000-01-01", "2000-01-01 12:00",
+                                     "2000-01-01 12:00:00Z", " 2000-01-01 12:00:00", "2000-01-01 12:00:00 ",
+                                     "2000-01-01  12:00:00" }) {
+        ASSERT_TRUE(try_parse_epoch(epoch).has_value()) << epoch;
+        ASSERT_FALSE(try_parse_epoch(epoch, space).has_value()) << epoch;
+        ASSERT_THROW(parse_epoch(epoch, space), std::invalid_argument) << epoch;
+    }
+    ASSERT_FALSE(try_parse_epoch("2000-01-01 12:00:00", t).has_value());
+    ASSERT_FALSE(try_parse_epoch("2000-01-01 12:00:00", dayOfYear).has_value());
+}
+
+TEST_F(EpochParsingTest, FuzzValidAgainstDateParse)
+{
+    for (std::size_t ii = 0; ii < N_FUZZ; ++ii) {
+        const auto [epoch, format] = random_epoch();
+        const auto reference       = reference_parse(epoch, format);
+        ASSERT_TRUE(reference.has_value()) << epoch;
+        ASSERT_EQ(parse_epoch(epoch).to_sys(), *reference) << epoch;
+        ASSERT_EQ(parse_epoch(epoch, *get_iso_epoch_format(format)).to_sys(), *reference) << epoch;
+    }
+}
+
+TEST_F(EpochParsingTest, FuzzMutatedAgainstDateParse)
+{
+    static const std::string alphabet = "0123456789-:.TZ x";
+    std::uniform_int_distribution<std::size_t> charDist(0, alphabet.size() - 1);
+    std::uniform_int_distribution<int> mutationDist(0, 2);
+
+    for (std::size_t ii = 0; ii < N_FUZZ; ++ii) {
+        auto [epoch, format] = random_epoch();
+        std::uniform_int_distribution<std::size_t> posDist(0, epoch.size() - 1);
+        const std::size_t pos = posDist(generator);
+        switch (mutationDist(generator)) {
+            case 0: epoch[pos] = alphabet[charDist(generator)]; break;
+            case 1: epoch.erase(pos, 1); break;
+            default: epoch.insert(pos, 1, alphabet[charDist(generator)]); break;
+        }
+
+        // Must never crash, and must agree with date::parse whenever both accept the string. date::parse only reads
+        // as many fractional digits as the millisecond duration holds, so agreement is to the millisecond.
+        const auto date      = try_parse_epoch(epoch);
+        const auto reference = reference_parse(epoch, format);
+        if (date && reference) {
+            const auto difference = date->to_sys() - *reference;
+            ASSERT_LT(std::chrono::abs(difference), std::chrono::milliseconds(1)) << epoch;
+        }
+    }
+}
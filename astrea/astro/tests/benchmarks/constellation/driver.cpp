@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <units/units.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <astro/platforms/space/Constellation.hpp>
+#include <astro/platforms/vehicles/Spacecraft.hpp>
+#include <astro/state/State.hpp>
+#include <astro/state/StateHistory.hpp>
+#include <astro/state/orbital_data_formats/instances/GeneralPerturbations.hpp>
+#include <astro/systems/AstrodynamicsSystem.hpp>
+#include <astro/time/Date.hpp>
+#include <tests/utilities/timing.hpp>
+
+using namespace astrea;
+using namespace astro;
+
+using mp_units::si::unit_symbols::min;
+
+
+class ConstellationBenchmark : public testing::Test {
+  public:
+    ConstellationBenchmark() {}
+
+    void SetUp() override
+    {
+        // Recorded Space-Track GP records, repeated with unique ids to the size of the full catalog
+        std::ifstream fixture(std::string(std::getenv("ASTREA_ROOT")) + "/data/snapshot/gp_catalog_sample.json");
+        const nlohmann::json sample = nlohmann::json::parse(fixture);
+
+        gps.reserve(N_RECORDS);
+        for (std::size_t ii = 0; ii < N_RECORDS; ++ii) {
+            nlohmann::json record  = sample[ii % sample.size()];
+            record["NORAD_CAT_ID"] = std::to_string(ii + 1);
+            gps.emplace_back(record);
+        }
+    }
+
+    // Reads a field of /proc/self/status, in kB
+    static std::size_t read_status_kb(const std::string& field)
+    {
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line)) {
+            if (line.starts_with(field + ":")) { return std::stoul(line.substr(field.size() + 1)); }
+        }
+        return 0;
+    }
+
+    // Runs a function, reporting its time and how far it raised the peak resident set
+    template <class Function_T>
+    double measure(const std::string& label, const std::size_t& nOps, Function_T&& function)
+    {
+        std::ofstream("/proc/self/clear_refs") << "5"; // Reset the peak to the current resident set
+        const std::size_t baseline = read_status_kb("VmRSS");
+        const double time          = time_it(label, nOps, "spacecraft", function);
+        std::cout << label << " Peak Memory: " << (read_status_kb("VmHWM") - baseline) / 1.0e3 << " (MB)" << std::endl;
+        return time;
+    }
+
+    static constexpr std::size_t N_RECORDS = 30'000;
+    static constexpr std::size_t N_ITERATE = 5'000;
+    static constexpr std::size_t N_STATES  = 288;
+
+    AstrodynamicsSystem sys;
+    std::vector<GeneralPerturbations> gps;
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(ConstellationBenchmark, BuildFromCatalog)
+{
+    // Converting each record serially, then handing the Spacecraft over
+    Constellation<Spacecraft> serial;
+    const double serialTime = time_it("Serial Conversion", N_RECORDS, "spacecraft", [&]() {
+        std::vector<Spacecraft> satellites;
+        for (const auto& gp : gps) {
+            satellites.push_back(Spacecraft(gp, sys));
+        }
+        serial = Constellation<Spacecraft>(satellites);
+    });
+
+    // Bulk construction on one thread, and on every core
+    Constellation<Spacecraft> singleThread;
+    time_it("Bulk (1 Thread)", N_RECORDS, "spacecraft", [&]() {
+        singleThread = Constellation<Spacecraft>(gps, sys, 1);
+    });
+
+    Constellation<Spacecraft> parallel;
+    const double parallelTime = time_it("Bulk (All Threads)", N_RECORDS, "spacecraft", [&]() {
+        parallel = Constellation<Spacecraft>(gps, sys);
+    });
+
+    // Every path builds the same layout, in catalog order
+    ASSERT_EQ(parallel.size(), N_RECORDS);
+    ASSERT_EQ(parallel.n_shells(), 1);
+    ASSERT_EQ(parallel.n_planes(), 1);
+    ASSERT_EQ(singleThread.size(), N_RECORDS);
+    ASSERT_EQ(serial.size(), N_RECORDS);
+    const auto& expected = serial.get_shells()[0].get_planes()[0].get_all_spacecraft();
+    const auto& actual   = parallel.get_shells()[0].get_planes()[0].get_all_spacecraft();
+    for (std::size_t ii = 0; ii < N_RECORDS; ii += 997) {
+        ASSERT_EQ(actual[ii].get_id(), expected[ii].get_id());
+        ASSERT_EQ(actual[ii], expected[ii]);
+    }
+
+    ASSERT_LE(parallelTime, serialTime);
+}
+
+TEST_F(ConstellationBenchmark, IteratePropagated)
+{
+    // Stand in for a propagated constellation with a day of five-minute states per spacecraft
+    Constellation<Spacecraft> constel(std::vector<GeneralPerturbations>(gps.begin(), gps.begin() + N_ITERATE), sys);
+    constel.parallel_for_each([&](Spacecraft& sat) {
+        const State& state0 = sat.get_initial_state();
+        StateHistory history;
+        for (std::size_t ii = 0; ii < N_STATES; ++ii) {
+            const Date epoch = state0.get_epoch() + static_cast<double>(5 * ii) * min;
+            history.insert(epoch, State(state0.get_elements(), epoch, sys));
+        }
+        sat.store_state_history(history);
+    });
+    const std::size_t nExpected = N_ITERATE * N_STATES;
+
+    // Before: get_all_spacecraft() returned a copy, and dereferencing an iterator copied the spacecraft
+    std::size_t nCopyAll = 0;
+    measure("Copy All", N_ITERATE, [&]() {
+        const std::vector<Spacecraft> copies(constel.begin(), constel.end());
+        for (const auto& sat : copies) {
+            nCopyAll += sat.get_state_history().size();
+        }
+    });
+
+    std::size_t nByValue = 0;
+    const double byValueTime = measure("By Value", N_ITERATE, [&]() {
+        for (const Spacecraft sat : constel) {
+            nByValue += sat.get_state_history().size();
+        }
+    });
+
+    // After: references in place, serially and across threads
+    std::size_t nByReference = 0;
+    const double byReferenceTime = measure("By Reference", N_ITERATE, [&]() {
+        for (const Spacecraft& sat : constel.get_all_spacecraft()) {
+            nByReference += sat.get_state_history().size();
+        }
+    });
+
+    std::atomic<std::size_t> nParallel = 0;
+    measure("Parallel", N_ITERATE, [&]() {
+        std::as_const(constel).parallel_for_each([&](const Spacecraft& sat) { nParallel += sat.get_state_history().size(); });
+    });
+
+    std::size_t nPlanes = 0;
+    for (const auto& plane : std::as_const(constel).get_planes()) {
+        nPlanes += plane.size();
+    }
+
+    ASSERT_EQ(nCopyAll, nExpected);
+    ASSERT_EQ(nByValue, nExpected);
+    ASSERT_EQ(nByReference, nExpected);
+    ASSERT_EQ(nParallel, nExpected);
+    ASSERT_EQ(nPlanes, N_ITERATE);
+    ASSERT_LT(byReferenceTime * 10.0, byValueTime);
+}
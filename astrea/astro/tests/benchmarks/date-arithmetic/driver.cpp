@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include <units/units.hpp>
+
+#include <astro/time/Date.hpp>
+#include <astro/time/TimeScales.hpp>
+#include <tests/utilities/timing.hpp>
+
+using namespace astrea;
+using namespace astro;
+
+using mp_units::si::unit_symbols::s;
+
+
+class DateArithmeticBenchmark : public testing::Test {
+  public:
+    DateArithmeticBenchmark() {}
+
+    void SetUp() override {}
+
+    const std::size_t N_STEPS = 10'000'000;
+    const Time STEP           = 0.37 * s;
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(DateArithmeticBenchmark, Addition)
+{
+    // Single double Julian date, as Date was previously stored
+    JulianDate jd = J2000;
+    time_it("Single-part Addition", N_STEPS, "op", [&]() {
+        for (std::size_t ii = 0; ii < N_STEPS; ++ii) {
+            jd = JulianDate(jd.time_since_epoch() + JulianDateClock::duration(STEP));
+        }
+    });
+
+    Date date(J2000);
+    time_it("Two-part Date Addition", N_STEPS, "op", [&]() {
+        for (std::size_t ii = 0; ii < N_STEPS; ++ii) {
+            date += STEP;
+        }
+    });
+
+    // The two-part date carries no accumulated representation error
+    const Time expected = static_cast<double>(N_STEPS) * STEP;
+    std::cout << "Single-part Drift: " << (Time(jd - J2000) - expected).numerical_value_in(s) << " (s)" << std::endl;
+    std::cout << "Two-part Drift: " << ((date - Date(J2000)) - expected).numerical_value_in(s) << " (s)" << std::endl;
+}
+
+TEST_F(DateArithmeticBenchmark, Difference)
+{
+    std::vector<JulianDate> jds(N_STEPS);
+    std::vector<Date> dates(N_STEPS);
+    for (std::size_t ii = 0; ii < N_STEPS; ++ii) {
+        jds[ii]   = JulianDate(J2000.time_since_epoch() + JulianDateClock::duration(STEP * static_cast<double>(ii)));
+        dates[ii] = Date(J2000) + STEP * static_cast<double>(ii);
+    }
+
+    Time singleTotal = 0.0 * s;
+    time_it("Single-part Difference", N_STEPS, "op", [&]() {
+        for (std::size_t ii = 1; ii < N_STEPS; ++ii) {
+            singleTotal += Time(jds[ii] - jds[ii - 1]);
+        }
+    });
+
+    Time twoPartTotal = 0.0 * s;
+    time_it("Two-part Date Difference", N_STEPS, "op", [&]() {
+        for (std::size_t ii = 1; ii < N_STEPS; ++ii) {
+            twoPartTotal += dates[ii] - dates[ii - 1];
+        }
+    });
+
+    std::cout << "Checksums: " << singleTotal << ", " << twoPartTotal << std::endl;
+}
+
+TEST_F(DateArithmeticBenchmark, TimeScaleConversion)
+{
+    const Date date("2007-04-05 00:00:00.0");
+    double checksum = 0.0;
+    for (const auto& [label, scale] : { std::pair{ "UTC->TT", TimeScale::TT },
+                                        std::pair{ "UTC->TDB", TimeScale::TDB },
+                                        std::pair{ "UTC->UT1", TimeScale::UT1 } }) {
+        time_it(label, N_STEPS, "op", [&]() {
+            for (std::size_t ii = 0; ii < N_STEPS; ++ii) {
+                checksum += (date + STEP * static_cast<double>(ii)).in_time_scale(scale).fraction();
+            }
+        });
+    }
+    std::cout << "Checksum: " << checksum << std::endl;
+}
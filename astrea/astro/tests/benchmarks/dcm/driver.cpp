@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include <units/units.hpp>
+
+#include <astro/state/CartesianVector.hpp>
+#include <astro/state/frames/frames.hpp>
+#include <astro/state/frames/types/DirectionCosineMatrix.hpp>
+#include <astro/state/frames/types/dcm_kernels.hpp>
+#include <tests/utilities/timing.hpp>
+
+using namespace astrea;
+using namespace astro;
+
+using mp_units::angular::unit_symbols::rad;
+using mp_units::si::unit_symbols::km;
+
+
+class DirectionCosineMatrixBenchmark : public testing::Test {
+  public:
+    DirectionCosineMatrixBenchmark() {}
+
+    void SetUp() override
+    {
+        for (std::size_t ii = 0; ii < N_VECTORS; ++ii) {
+            const double angle = static_cast<double>(ii) * 1.0e-3;
+            vectors.emplace_back(7000.0 * std::cos(angle) * km, 7000.0 * std::sin(angle) * km, 100.0 * std::sin(3.0 * angle) * km);
+            for (const auto& component : { vectors.back().get_x(), vectors.back().get_y(), vectors.back().get_z() }) {
+                raw.push_back(component.numerical_value_in(km));
+            }
+        }
+    }
+
+    const std::size_t N_VECTORS = 1'000'000;
+
+    // ECI -> ECEF -> RIC -> sensor body, standing in for a sensor pointing chain
+    const DCM<ECI, ECEF> eciToEcef = DCM<ECI, ECEF>::Z(0.7 * rad);
+    const DCM<ECEF, RIC> ecefToRic = DCM<ECEF, RIC>::XZX(0.3 * rad, -1.2 * rad, 2.1 * rad);
+    const DCM<RIC, VNB> ricToBody  = DCM<RIC, VNB>::Y(0.25 * rad);
+
+    std::vector<RadiusVector<ECI>> vectors;
+    std::vector<double> raw;
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(DirectionCosineMatrixBenchmark, SingleRotation)
+{
+    double typedChecksum = 0.0;
+    time_it("Typed", N_VECTORS, "vector", [&]() {
+        for (const auto& vector : vectors) {
+            typedChecksum += (eciToEcef * vector).get_x().numerical_value_in(km);
+        }
+    });
+
+    double batchedChecksum = 0.0;
+    time_it("Typed Batched", N_VECTORS, "vector", [&]() {
+        for (const auto& vector : eciToEcef.rotate(vectors)) {
+            batchedChecksum += vector.get_x().numerical_value_in(km);
+        }
+    });
+
+    double kernelChecksum = 0.0;
+    time_it("Raw Kernel", N_VECTORS, "vector", [&]() {
+        std::vector<double> output(raw.size());
+        detail::multiply(eciToEcef.get_matrix(), raw.data(), output.data(), N_VECTORS);
+        for (std::size_t ii = 0; ii < N_VECTORS; ++ii) {
+            kernelChecksum += output[3 * ii];
+        }
+    });
+
+    // Hand-written doubles as the reference for what the typed path should compile down to
+    double handChecksum = 0.0;
+    time_it("Hand-Written", N_VECTORS, "vector", [&]() {
+        const double c = std::cos(0.7);
+        const double s = std::sin(0.7);
+        for (std::size_t ii = 0; ii < N_VECTORS; ++ii) {
+            handChecksum += c * raw[3 * ii] - s * raw[3 * ii + 1];
+        }
+    });
+
+    std::cout << "Checksums: " << typedChecksum << ", " << batchedChecksum << ", " << kernelChecksum << ", " << handChecksum << std::endl;
+}
+
+TEST_F(DirectionCosineMatrixBenchmark, FrameChain)
+{
+    // Apply each link of the chain to every vector
+    double sequentialChecksum = 0.0;
+    time_it("Sequential Chain", N_VECTORS, "vector", [&]() {
+        for (const auto& vector : vectors) {
+            sequentialChecksum += (ricToBody * (ecefToRic * (eciToEcef * vector))).get_x().numerical_value_in(km);
+        }
+    });
+
+    // Compose the chain once and apply a single matrix to every vector
+    double composedChecksum = 0.0;
+    time_it("Composed Chain", N_VECTORS, "vector", [&]() {
+        const DCM<ECI, VNB> eciToBody = ricToBody * ecefToRic * eciToEcef;
+        for (const auto& vector : eciToBody.rotate(vectors)) {
+            composedChecksum += vector.get_x().numerical_value_in(km);
+        }
+    });
+
+    std::cout << "Checksums: " << sequentialChecksum << ", " << composedChecksum << std::endl;
+}
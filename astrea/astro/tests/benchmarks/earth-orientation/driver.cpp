@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+
+#include <units/units.hpp>
+
+#include <astro/state/CartesianVector.hpp>
+#include <astro/state/frames/CelestialIntermediatePoleCache.hpp>
+#include <astro/state/frames/frames.hpp>
+#include <astro/time/Date.hpp>
+#include <tests/utilities/timing.hpp>
+
+using namespace astrea;
+using namespace astro;
+
+using mp_units::non_si::day;
+using mp_units::si::unit_symbols::km;
+
+
+class EarthOrientationBenchmark : public testing::Test {
+  public:
+    EarthOrientationBenchmark() {}
+
+    void SetUp() override {}
+
+    const std::size_t N_EVALUATIONS = 100'000;
+    const Time SPAN                 = 7.0 * day;
+
+    const Date epoch = Date("2025-08-06 00:00:00");
+    const RadiusVector<ECI> position{ 7000.0 * km, 100.0 * km, -300.0 * km };
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(EarthOrientationBenchmark, GcrfToItrf)
+{
+    const Time step = SPAN / static_cast<double>(N_EVALUATIONS);
+
+    // Evaluates the full precession-nutation series for every transformation
+    double seriesChecksum = 0.0;
+    time_it("Full Series", N_EVALUATIONS, "transformation", [&]() {
+        for (std::size_t ii = 0; ii < N_EVALUATIONS; ++ii) {
+            const Date date = epoch + step * (static_cast<double>(ii) + 0.5);
+            seriesChecksum += position.in_frame<ITRF>(date).get_x().numerical_value_in(km);
+        }
+    });
+
+    // Evaluates the series only at the cache nodes, including the cost of building the cache
+    double cachedChecksum = 0.0;
+    time_it("Cached", N_EVALUATIONS, "transformation", [&]() {
+        const CelestialIntermediatePoleCache cache(epoch, epoch + SPAN);
+        for (std::size_t ii = 0; ii < N_EVALUATIONS; ++ii) {
+            const Date date = epoch + step * (static_cast<double>(ii) + 0.5);
+            cachedChecksum += cache.rotate_into_itrf(position, date).get_x().numerical_value_in(km);
+        }
+    });
+
+    // The sidereal-only rotation for reference
+    double ecefChecksum = 0.0;
+    time_it("ECEF", N_EVALUATIONS, "transformation", [&]() {
+        for (std::size_t ii = 0; ii < N_EVALUATIONS; ++ii) {
+            const Date date = epoch + step * (static_cast<double>(ii) + 0.5);
+            ecefChecksum += position.in_frame<ECEF>(date).get_x().numerical_value_in(km);
+        }
+    });
+
+    std::cout << "Checksums: " << seriesChecksum << ", " << cachedChecksum << ", " << ecefChecksum << std::endl;
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include <units/units.hpp>
+
+#include <astro/state/CartesianVector.hpp>
+#include <astro/state/frames/EarthRotationProvider.hpp>
+#include <astro/state/frames/frames.hpp>
+#include <astro/time/Date.hpp>
+#include <tests/utilities/timing.hpp>
+
+using namespace astrea;
+using namespace astro;
+
+using mp_units::non_si::day;
+using mp_units::si::unit_symbols::km;
+using mp_units::si::unit_symbols::s;
+
+
+class EarthRotationBenchmark : public testing::Test {
+  public:
+    EarthRotationBenchmark() {}
+
+    void SetUp() override
+    {
+        for (std::size_t ii = 0; ii < N_GROUNDS; ++ii) {
+            const double angle = static_cast<double>(ii) * 0.1;
+            grounds.emplace_back(6378.0 * std::cos(angle) * km, 6378.0 * std::sin(angle) * km, 100.0 * ii * km);
+        }
+        for (std::size_t ii = 0; ii < N_TIMES; ++ii) {
+            times.push_back(static_cast<double>(ii) * RESOLUTION);
+        }
+    }
+
+    const std::size_t N_SATS    = 100;
+    const std::size_t N_GROUNDS = 20;
+    const std::size_t N_TIMES   = 1441;
+    const Time RESOLUTION       = 60.0 * s;
+
+    const Date epoch = Date("2025-08-06 00:00:00");
+    std::vector<RadiusVector<ECEF>> grounds;
+    std::vector<Time> times;
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(EarthRotationBenchmark, GroundStationAccess)
+{
+    // find_accesses previously rotated every ground station into ECI at every time, once for every satellite
+    double directChecksum = 0.0;
+    time_it("Direct", N_SATS * N_GROUNDS * N_TIMES, "rotation", [&]() {
+        for (std::size_t iSat = 0; iSat < N_SATS; ++iSat) {
+            for (const auto& ground : grounds) {
+                for (const auto& time : times) {
+                    directChecksum += ground.in_frame<ECI>(epoch + time).get_x().numerical_value_in(km);
+                }
+            }
+        }
+    });
+
+    // The provider rotates each ground station once per time and the result is shared by all satellites
+    double providerChecksum = 0.0;
+    time_it("Provider", N_SATS * N_GROUNDS * N_TIMES, "rotation", [&]() {
+        const EarthRotationProvider provider(epoch, times);
+        const auto positions = provider.rotate_into_eci(grounds);
+        for (std::size_t iSat = 0; iSat < N_SATS; ++iSat) {
+            for (const auto& position : positions) {
+                providerChecksum += position.get_x().numerical_value_in(km);
+            }
+        }
+    });
+
+    std::cout << "Checksums: " << directChecksum << ", " << providerChecksum << std::endl;
+}
+
+TEST_F(EarthRotationBenchmark, ForceModelRoundTrip)
+{
+    // OblatenessForce rotates the state into ECEF and the acceleration back out at arbitrary integrator times
+    const std::size_t nEvaluations = 1'000'000;
+    const Time span                = 1.0 * day;
+    const Time step                = span / static_cast<double>(nEvaluations);
+    const RadiusVector<ECI> position(7000.0 * km, 100.0 * km, -300.0 * km);
+
+    double directChecksum = 0.0;
+    time_it("Direct Round Trip", nEvaluations, "rotation", [&]() {
+        for (std::size_t ii = 0; ii < nEvaluations; ++ii) {
+            const Date date = epoch + step * (static_cast<double>(ii) + 0.5);
+            const auto dcm  = ECEF::get_dcm(date);
+            directChecksum += (dcm.transpose() * (dcm * position)).get_x().numerical_value_in(km);
+        }
+    });
+
+    double providerChecksum = 0.0;
+    time_it("Provider Round Trip", nEvaluations, "rotation", [&]() {
+        const EarthRotationProvider provider(epoch, epoch + span, 60.0 * s);
+        for (std::size_t ii = 0; ii < nEvaluations; ++ii) {
+            const Date date = epoch + step * (static_cast<double>(ii) + 0.5);
+            const auto dcm  = provider.get_dcm(date);
+            providerChecksum += (dcm.transpose() * (dcm * position)).get_x().numerical_value_in(km);
+        }
+    });
+
+    std::cout << "Checksums: " << directChecksum << ", " << providerChecksum << std::endl;
+}
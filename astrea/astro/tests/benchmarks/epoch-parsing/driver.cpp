@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <format>
+#include <string>
+#include <vector>
+
+#include <units/units.hpp>
+
+#include <astro/time/Date.hpp>
+#include <astro/time/epoch_parsing.hpp>
+#include <tests/utilities/timing.hpp>
+
+using namespace astrea;
+using namespace astro;
+
+
+class EpochParsingBenchmark : public testing::Test {
+  public:
+    EpochParsingBenchmark() {}
+
+    void SetUp() override
+    {
+        // Space-Track style GP epochs, one minute and some microseconds apart
+        epochs.reserve(N_EPOCHS);
+        for (std::size_t ii = 0; ii < N_EPOCHS; ++ii) {
+            const std::size_t minuteOfDay = ii % 1440;
+            epochs.push_back(std::format(
+                "2025-{:02d}-{:02d}T{:02d}:{:02d}:{:02d}.{:06d}", 1 + (ii / 1440) % 12, 1 + (ii / 17280) % 28,
+                minuteOfDay / 60, minuteOfDay % 60, ii % 60, ii % 1000000
+            ));
+        }
+    }
+
+    const std::size_t N_EPOCHS = 1'000'000;
+    std::vector<std::string> epochs;
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(EpochParsingBenchmark, DateParse)
+{
+    std::vector<TwoPartJulianDate> dates;
+    dates.reserve(N_EPOCHS);
+    time_it("date::parse", N_EPOCHS, "epoch", [&]() {
+        for (const auto& epoch : epochs) {
+            dates.push_back(TwoPartJulianDate::from_sys(epoch_to_sys_time(epoch, "%Y-%m-%dT%H:%M:%S")));
+        }
+    });
+    ASSERT_EQ(dates.size(), N_EPOCHS);
+}
+
+TEST_F(EpochParsingBenchmark, ParseEpoch)
+{
+    std::vector<TwoPartJulianDate> dates;
+    dates.reserve(N_EPOCHS);
+    time_it("parse_epoch", N_EPOCHS, "epoch", [&]() {
+        for (const auto& epoch : epochs) {
+            dates.push_back(parse_epoch(epoch));
+        }
+    });
+    ASSERT_EQ(dates.size(), N_EPOCHS);
+}
+
+TEST_F(EpochParsingBenchmark, ParseEpochs)
+{
+    std::vector<TwoPartJulianDate> dates;
+    time_it("parse_epochs (batch)", N_EPOCHS, "epoch", [&]() { dates = parse_epochs(epochs); });
+    ASSERT_EQ(dates.size(), N_EPOCHS);
+}
+
+TEST_F(EpochParsingBenchmark, EpochsToDates)
+{
+    std::vector<Date> dates;
+    time_it("epochs_to_dates (batch)", N_EPOCHS, "epoch", [&]() {
+        dates = epochs_to_dates(epochs, "%Y-%m-%dT%H:%M:%S");
+    });
+    ASSERT_EQ(dates.size(), N_EPOCHS);
+}
@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <iostream>
+#include <numbers>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <units/units.hpp>
+
+#include <astro/propagation/analytic/BatchLambertSolver.hpp>
+#include <astro/propagation/analytic/LambertSolver.hpp>
+#include <astro/state/CartesianVector.hpp>
+#include <astro/state/orbital_elements/instances/Cartesian.hpp>
+#include <astro/systems/AstrodynamicsSystem.hpp>
+#include <astro/time/Date.hpp>
+#include <tests/utilities/timing.hpp>
+
+using namespace astrea;
+using namespace astro;
+
+using mp_units::non_si::day;
+using mp_units::si::unit_symbols::km;
+using mp_units::si::unit_symbols::s;
+
+
+class LambertBenchmark : public testing::Test {
+  public:
+    LambertBenchmark() :
+        sys("Sun", { "Earth", "Mars" })
+    {
+    }
+
+    void SetUp() override
+    {
+        // Heliocentric transfers between the orbits of Venus and Mars
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<double> radius(1.0e8, 2.5e8);
+        std::uniform_real_distribution<double> angle(0.0, 2.0 * std::numbers::pi);
+        std::uniform_real_distribution<double> height(-5.0e6, 5.0e6);
+        std::uniform_real_distribution<double> tof(60.0, 400.0);
+        for (std::size_t ii = 0; ii < N_PROBLEMS; ++ii) {
+            const double radius0 = radius(generator);
+            const double angle0  = angle(generator);
+            const double radiusf = radius(generator);
+            const double anglef  = angle(generator);
+            r0s.emplace_back(radius0 * std::cos(angle0) * km, radius0 * std::sin(angle0) * km, height(generator) * km);
+            rfs.emplace_back(radiusf * std::cos(anglef) * km, radiusf * std::sin(anglef) * km, height(generator) * km);
+            dts.push_back(tof(generator) * day);
+        }
+    }
+
+    const std::size_t N_PROBLEMS = 100'000;
+
+    AstrodynamicsSystem sys;
+    std::vector<RadiusVector<ECI>> r0s;
+    std::vector<RadiusVector<ECI>> rfs;
+    std::vector<Time> dts;
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(LambertBenchmark, SingleRevolution)
+{
+    const GravParam mu = sys.get_center()->get_mu();
+
+    std::vector<VelocityVector<ECI>> expected(N_PROBLEMS);
+    std::vector<bool> isConverged(N_PROBLEMS, true);
+    time_it("Universal Variable", N_PROBLEMS, "solution", [&]() {
+        for (std::size_t ii = 0; ii < N_PROBLEMS; ++ii) {
+            try {
+                expected[ii] = LambertSolver::solve(r0s[ii], rfs[ii], dts[ii], mu, LambertSolver::OrbitDirection::PROGRADE).first;
+            }
+            catch (const std::runtime_error&) {
+                isConverged[ii] = false;
+            }
+        }
+    });
+
+    std::vector<std::vector<LambertSolution>> serial;
+    time_it("Izzo", N_PROBLEMS, "solution", [&]() {
+        serial = BatchLambertSolver::solve(r0s, rfs, dts, mu, LambertSolver::OrbitDirection::PROGRADE, 0, 1);
+    });
+
+    std::vector<std::vector<LambertSolution>> parallel;
+    time_it("Izzo Threaded", N_PROBLEMS, "solution", [&]() {
+        parallel = BatchLambertSolver::solve(r0s, rfs, dts, mu);
+    });
+
+    // The universal variable solver can converge to the wrong root, so Izzo is checked by propagating its solutions
+    std::size_t nConverged = 0;
+    std::size_t nAgreed    = 0;
+    for (std::size_t ii = 0; ii < N_PROBLEMS; ++ii) {
+        ASSERT_EQ(serial[ii].size(), 1);
+        ASSERT_EQ(parallel[ii].size(), 1);
+        if (isConverged[ii]) {
+            ++nConverged;
+            const VelocityVector<ECI> difference = serial[ii][0].v0 - expected[ii];
+            if (difference.norm() < 1.0e-6 * expected[ii].norm()) { ++nAgreed; }
+        }
+
+        try {
+            const Cartesian arrival = LambertSolver::solve({ r0s[ii], serial[ii][0].v0 }, dts[ii], mu);
+            ASSERT_LT((arrival.get_position() - rfs[ii]).norm(), 1.0e-6 * rfs[ii].norm());
+        }
+        catch (const std::runtime_error&) {
+            // The propagator does not converge for every transfer, so those are skipped
+        }
+    }
+    std::cout << "Universal Variable Converged: " << nConverged << " of " << N_PROBLEMS << ", Agreed: " << nAgreed << std::endl;
+}
+
+TEST_F(LambertBenchmark, MultiRevolution)
+{
+    const GravParam mu = sys.get_center()->get_mu();
+
+    std::vector<std::vector<LambertSolution>> solutions;
+    const auto solve = [&]() { solutions = BatchLambertSolver::solve(r0s, rfs, dts, mu, LambertSolver::OrbitDirection::PROGRADE, 3); };
+    solve();
+
+    std::size_t nSolutions = 0;
+    for (const auto& problem : solutions) {
+        nSolutions += problem.size();
+    }
+    time_it("Izzo Threaded, Up To 3 Revolutions", nSolutions, "solution", solve);
+}
+
+TEST_F(LambertBenchmark, Porkchop)
+{
+    // Earth to Mars across the 2026 launch window, one cell per day
+    const std::size_t nDays = 400;
+    const Date launch("2026-06-01 00:00:00");
+    std::vector<Date> departures;
+    std::vector<Date> arrivals;
+    for (std::size_t ii = 0; ii < nDays; ++ii) {
+        departures.push_back(launch + static_cast<double>(ii) * day);
+        arrivals.push_back(launch + (100.0 + ii) * day);
+    }
+
+    const CelestialBody& earth = *sys.get("Earth");
+    const CelestialBody& mars  = *sys.get("Mars");
+
+    PorkchopPlot plot;
+    time_it("Porkchop", nDays * nDays, "solution", [&]() {
+        plot = BatchLambertSolver::compute_porkchop(earth, mars, departures, arrivals, sys);
+    });
+
+    // The cheapest transfer on the grid
+    const PorkchopCell* best = nullptr;
+    for (const PorkchopCell& cell : plot.cells) {
+        if (cell.isSolved && (!best || cell.departureExcessSpeed + cell.arrivalExcessSpeed <
+                                           best->departureExcessSpeed + best->arrivalExcessSpeed)) {
+            best = &cell;
+        }
+    }
+    ASSERT_NE(best, nullptr);
+    const std::size_t index = best - plot.cells.data();
+    std::cout << "Best Transfer: depart " << plot.departures[index / nDays] << ", arrive " << plot.arrivals[index % nDays]
+              << ", departure excess " << best->departureExcessSpeed << ", arrival excess " << best->arrivalExcessSpeed << std::endl;
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <units/units.hpp>
+
+#include <astro/platforms/vehicles/Spacecraft.hpp>
+#include <astro/propagation/equations_of_motion/CowellsMethod.hpp>
+#include <astro/propagation/force_models/AtmosphericForce.hpp>
+#include <astro/propagation/force_models/ForceModel.hpp>
+#include <astro/propagation/force_models/OblatenessForce.hpp>
+#include <astro/propagation/numerical/Integrator.hpp>
+#include <astro/propagation/numerical/MonteCarloPropagator.hpp>
+#include <astro/state/orbital_elements/instances/Keplerian.hpp>
+#include <astro/systems/AstrodynamicsSystem.hpp>
+#include <astro/time/Date.hpp>
+#include <tests/utilities/timing.hpp>
+
+using namespace astrea;
+using namespace astro;
+
+using mp_units::one;
+using mp_units::si::unit_symbols::kg;
+using mp_units::si::unit_symbols::km;
+using mp_units::si::unit_symbols::m;
+using mp_units::si::unit_symbols::min;
+using mp_units::si::unit_symbols::s;
+
+
+class MonteCarloBenchmark : public testing::Test {
+  public:
+    MonteCarloBenchmark() :
+        eom(sys, forces),
+        spacecraft({ Keplerian::LEO(), epoch, sys })
+    {
+    }
+
+    void SetUp() override
+    {
+        forces.add<AtmosphericForce>();
+        forces.add<OblatenessForce>(sys, 10, 10);
+
+        // One orbit, reported every ten minutes
+        for (std::size_t ii = 0; ii <= 9; ++ii) {
+            epochs.push_back(epoch + ii * 10.0 * min);
+        }
+
+        dispersions.positionSigma                  = 100.0 * m;
+        dispersions.velocitySigma                  = 0.1 * m / s;
+        dispersions.massSigma                      = 5.0 * kg;
+        dispersions.coefficientOfDragSigma         = 0.1 * one;
+        dispersions.coefficientOfReflectivitySigma = 0.1 * one;
+    }
+
+    const std::size_t N_SAMPLES = 1'000;
+
+    AstrodynamicsSystem sys;
+    ForceModel forces;
+    CowellsMethod eom;
+    Integrator integrator;
+    Date epoch;
+    Spacecraft spacecraft;
+    std::vector<Date> epochs;
+    Dispersions dispersions;
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(MonteCarloBenchmark, DragAndOblateness)
+{
+    MonteCarloPropagator propagator(integrator, eom);
+    propagator.set_seed(42);
+
+    std::vector<MonteCarloStatistics> serial;
+    time_it("Serial", N_SAMPLES, "sample", [&]() {
+        serial = propagator.propagate(spacecraft, dispersions, epochs, N_SAMPLES, 1);
+    });
+
+    std::vector<MonteCarloStatistics> parallel;
+    time_it("Threaded", N_SAMPLES, "sample", [&]() {
+        parallel = propagator.propagate(spacecraft, dispersions, epochs, N_SAMPLES);
+    });
+
+    // Samples are seeded individually, so the thread count does not change them
+    ASSERT_EQ(serial.size(), epochs.size());
+    ASSERT_EQ(parallel.size(), epochs.size());
+    for (std::size_t ii = 0; ii < epochs.size(); ++ii) {
+        ASSERT_EQ(serial[ii].positionErrorPercentiles, parallel[ii].positionErrorPercentiles);
+    }
+
+    const MonteCarloStatistics& last = parallel.back();
+    std::cout << "Position Error After One Orbit: 50% " << last.positionErrorPercentiles[0] << ", 95% "
+              << last.positionErrorPercentiles[1] << ", 99% " << last.positionErrorPercentiles[2] << std::endl;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+namespace astrea {
+
+namespace astro {
+
+/**
+ * @brief Time a function and print its total time, time per operation, and operations per second.
+ *
+ * @param label Label printed before the times.
+ * @param nOps Number of operations the function performs.
+ * @param opName Name of a single operation, used in the printed units.
+ * @param function The function to time.
+ * @return double The total time in seconds.
+ */
+template <class Function_T>
+double time_it(const std::string& label, const std::size_t& nOps, const std::string& opName, Function_T&& function)
+{
+    using namespace std::chrono;
+    const auto start = steady_clock::now();
+    function();
+    const auto end     = steady_clock::now();
+    const double total = duration_cast<nanoseconds>(end - start).count() / 1.0e9;
+    std::cout << label << " Time: " << total << " (s), " << total / nOps * 1.0e9 << " (ns/" << opName << "), "
+              << nOps / total << " (" << opName << "/s)" << std::endl;
+    return total;
+}
+
+} // namespace astro
+} // namespace astrea
@@ -0,0 +1,482 @@
+#include <snapshot/database/CatalogArchive.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace astrea {
+namespace snapshot {
+
+using astro::GeneralPerturbations;
+
+namespace {
+
+static_assert(std::endian::native == std::endian::little, "Catalog archives are read and written as little-endian.");
+
+constexpr std::array<char, 8> MAGIC = { 'A', 'S', 'T', 'R', 'E', 'A', 'G', 'P' };
+
+enum class ColumnType : std::uint8_t {
+    FLOAT64 = 0, //!< 8 byte IEEE doubles
+    INT64   = 1, //!< 8 byte signed integers
+    STRING  = 2  //!< 4 byte offsets followed by the concatenated bytes
+};
+
+constexpr std::uint8_t NULLABLE = 0x01;
+
+// A column as described in an archive directory
+struct ColumnEntry {
+    std::string name;     //!< Field name
+    ColumnType type;      //!< Storage type
+    std::uint8_t flags;   //!< Column flags
+    std::uint64_t offset; //!< Offset of the column block from the start of the archive
+    std::uint64_t size;   //!< Size of the column block
+};
+
+template <typename T>
+struct is_optional : std::false_type {};
+
+template <typename T>
+struct is_optional<std::optional<T>> : std::true_type {};
+
+template <typename T>
+struct unwrap_optional {
+    using type = T;
+};
+
+template <typename T>
+struct unwrap_optional<std::optional<T>> {
+    using type = T;
+};
+
+template <auto Member>
+using field_t = std::remove_cvref_t<decltype(std::declval<GeneralPerturbations>().*Member)>;
+
+template <auto Member>
+using value_t = typename unwrap_optional<field_t<Member>>::type;
+
+template <typename T>
+constexpr ColumnType column_type()
+{
+    if constexpr (std::is_same_v<T, std::string>) { return ColumnType::STRING; }
+    else if constexpr (std::is_floating_point_v<T>) {
+        return ColumnType::FLOAT64;
+    }
+    else {
+        return ColumnType::INT64;
+    }
+}
+
+template <typename T>
+void append(std::string& buffer, const T& value)
+{
+    const std::size_t size = buffer.size();
+    buffer.resize(size + sizeof(T));
+    std::memcpy(buffer.data() + size, &value, sizeof(T));
+}
+
+template <typename T>
+T load(const char* data)
+{
+    T value;
+    std::memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+// Reads fixed-width values from the archive, refusing to read past the end
+class ArchiveReader {
+  public:
+    ArchiveReader(std::string_view data) :
+        _data(data)
+    {
+    }
+
+    template <typename T>
+    T read()
+    {
+        require(sizeof(T));
+        const T value = load<T>(_data.data() + _position);
+        _position += sizeof(T);
+        return value;
+    }
+
+    std::string read_string(const std::size_t& size)
+    {
+        require(size);
+        std::string value(_data.substr(_position, size));
+        _position += size;
+        return value;
+    }
+
+  private:
+    std::string_view _data;
+    std::size_t _position = 0;
+
+    void require(const std::size_t& size) const
+    {
+        if (_position + size > _data.size()) { throw std::runtime_error("Catalog archive is truncated."); }
+    }
+};
+
+std::string type_name(const ColumnType& type)
+{
+    switch (type) {
+        case (ColumnType::FLOAT64): {
+            return "float64";
+        }
+        case (ColumnType::INT64): {
+            return "int64";
+        }
+        case (ColumnType::STRING): {
+            return "string";
+        }
+    }
+    return "unknown";
+}
+
+template <auto Member>
+std::string encode_column(std::span<const GeneralPerturbations> records)
+{
+    using Field_T         = field_t<Member>;
+    using Value_T         = value_t<Member>;
+    const std::size_t n   = records.size();
+    const auto get_value = [&](const std::size_t& ii) -> const Value_T* {
+        if constexpr (is_optional<Field_T>::value) {
+            const Field_T& field = records[ii].*Member;
+            return field ? &*field : nullptr;
+        }
+        else {
+            return &(records[ii].*Member);
+        }
+    };
+
+    std::string block;
+    if constexpr (is_optional<Field_T>::value) {
+        block.assign((n + 7) / 8, '\0');
+        for (std::size_t ii = 0; ii < n; ++ii) {
+            if (get_value(ii)) { block[ii / 8] |= static_cast<char>(1 << (ii % 8)); }
+        }
+    }
+
+    if constexpr (column_type<Value_T>() == ColumnType::STRING) {
+        std::uint32_t offset = 0;
+        append(block, offset);
+        for (std::size_t ii = 0; ii < n; ++ii) {
+            const Value_T* value = get_value(ii);
+            offset += value ? static_cast<std::uint32_t>(value->size()) : 0;
+            append(block, offset);
+        }
+        block.reserve(block.size() + offset);
+        for (std::size_t ii = 0; ii < n; ++ii) {
+            if (const Value_T* value = get_value(ii)) { block += *value; }
+        }
+    }
+    else {
+        using Stored_T = std::conditional_t<column_type<Value_T>() == ColumnType::FLOAT64, double, std::int64_t>;
+        block.reserve(block.size() + n * sizeof(Stored_T));
+        for (std::size_t ii = 0; ii < n; ++ii) {
+            const Value_T* value = get_value(ii);
+            append(block, value ? static_cast<Stored_T>(*value) : Stored_T{ 0 });
+        }
+    }
+    return block;
+}
+
+template <typename Value_T>
+Value_T narrow(const std::int64_t& value, const std::string& name)
+{
+    if constexpr (std::is_floating_point_v<Value_T>) { return static_cast<Value_T>(value); }
+    else {
+        // Signed fields fit in an int64, and unsigned fields are compared as uint64 to keep their full range
+        bool inRange;
+        if constexpr (std::is_signed_v<Value_T>) {
+            inRange = value >= std::numeric_limits<Value_T>::min() && value <= std::numeric_limits<Value_T>::max();
+        }
+        else {
+            inRange = value >= 0 && static_cast<std::uint64_t>(value) <= std::numeric_limits<Value_T>::max();
+        }
+        if (!inRange) {
+            throw std::runtime_error("Catalog archive column " + name + " has a value out of range for its field.");
+        }
+        return static_cast<Value_T>(value);
+    }
+}
+
+// Reads rows [first, last) of a column. Called on row chunks so the records being filled stay in cache.
+template <auto Member>
+void decode_column(
+    const ColumnEntry& entry,
+    std::string_view block,
+    std::span<GeneralPerturbations> records,
+    const std::size_t& first,
+    const std::size_t& last
+)
+{
+    using Field_T       = field_t<Member>;
+    using Value_T       = value_t<Member>;
+    const std::size_t n = records.size();
+
+    // Check the stored type can be read into the field before touching any records
+    constexpr ColumnType fieldType = column_type<Value_T>();
+    const bool compatible =
+        entry.type == fieldType || (fieldType == ColumnType::FLOAT64 && entry.type == ColumnType::INT64);
+    if (!compatible) {
+        throw std::runtime_error(
+            "Catalog archive column " + entry.name + " is stored as " + type_name(entry.type) +
+            ", which cannot be read as " + type_name(fieldType) + "."
+        );
+    }
+
+    const bool nullable           = entry.flags & NULLABLE;
+    const std::size_t bitmapSize  = nullable ? (n + 7) / 8 : 0;
+    const std::size_t valuesSize  = entry.type == ColumnType::STRING ? (n + 1) * sizeof(std::uint32_t) : n * 8;
+    const std::size_t minimumSize = bitmapSize + valuesSize;
+    if (block.size() < minimumSize) {
+        throw std::runtime_error("Catalog archive column " + entry.name + " is truncated.");
+    }
+
+    const char* bitmap   = block.data();
+    const char* values   = block.data() + bitmapSize;
+    const auto has_value = [&](const std::size_t& ii) {
+        if (!nullable || (static_cast<unsigned char>(bitmap[ii / 8]) >> (ii % 8)) & 1u) { return true; }
+
+        // Nulls stay empty in optional fields and are an error anywhere else
+        if constexpr (!is_optional<Field_T>::value) {
+            throw std::runtime_error("Catalog archive column " + entry.name + " has nulls, but its field is required.");
+        }
+        return false;
+    };
+
+    if constexpr (fieldType == ColumnType::STRING) {
+        const char* bytes        = values + (n + 1) * sizeof(std::uint32_t);
+        const std::size_t nBytes = block.size() - minimumSize;
+        if (load<std::uint32_t>(values + n * sizeof(std::uint32_t)) != nBytes) {
+            throw std::runtime_error("Catalog archive column " + entry.name + " has inconsistent string offsets.");
+        }
+        std::uint32_t start = load<std::uint32_t>(values + first * sizeof(std::uint32_t));
+        for (std::size_t ii = first; ii < last; ++ii) {
+            const std::uint32_t end = load<std::uint32_t>(values + (ii + 1) * sizeof(std::uint32_t));
+            if (end < start || end > nBytes) {
+                throw std::runtime_error("Catalog archive column " + entry.name + " has inconsistent string offsets.");
+            }
+            if (has_value(ii)) { records[ii].*Member = std::string_view(bytes + start, end - start); }
+            start = end;
+        }
+    }
+    else if (entry.type == ColumnType::FLOAT64) {
+        for (std::size_t ii = first; ii < last; ++ii) {
+            if (has_value(ii)) { records[ii].*Member = static_cast<Value_T>(load<double>(values + ii * 8)); }
+        }
+    }
+    else {
+        for (std::size_t ii = first; ii < last; ++ii) {
+            if (has_value(ii)) { records[ii].*Member = narrow<Value_T>(load<std::int64_t>(values + ii * 8), entry.name); }
+        }
+    }
+}
+
+using Encoder = std::string (*)(std::span<const GeneralPerturbations> records);
+using Decoder = void (*)(
+    const ColumnEntry& entry,
+    std::string_view block,
+    std::span<GeneralPerturbations> records,
+    const std::size_t& first,
+    const std::size_t& last
+);
+
+struct Column {
+    const char* name; //!< Field name
+    ColumnType type;  //!< Storage type
+    bool nullable;    //!< Whether the field is optional
+    Encoder encode;   //!< Builds the column block
+    Decoder decode;   //!< Reads rows of the column block back into records
+};
+
+template <auto Member>
+constexpr Column make_column(const char* name)
+{
+    return {
+        name, column_type<value_t<Member>>(), is_optional<field_t<Member>>::value, &encode_column<Member>, &decode_column<Member>
+    };
+}
+
+// Every exported field, in the order they are written
+const std::array<Column, 40> COLUMNS = {
+    make_column<&GeneralPerturbations::APOAPSIS>("APOAPSIS"),
+    make_column<&GeneralPerturbations::ARG_OF_PERICENTER>("ARG_OF_PERICENTER"),
+    make_column<&GeneralPerturbations::BSTAR>("BSTAR"),
+    make_column<&GeneralPerturbations::CCSDS_OMM_VERS>("CCSDS_OMM_VERS"),
+    make_column<&GeneralPerturbations::CENTER_NAME>("CENTER_NAME"),
+    make_column<&GeneralPerturbations::CLASSIFICATION_TYPE>("CLASSIFICATION_TYPE"),
+    make_column<&GeneralPerturbations::COMMENT>("COMMENT"),
+    make_column<&GeneralPerturbations::COUNTRY_CODE>("COUNTRY_CODE"),
+    make_column<&GeneralPerturbations::CREATION_DATE>("CREATION_DATE"),
+    make_column<&GeneralPerturbations::DECAY_DATE>("DECAY_DATE"),
+    make_column<&GeneralPerturbations::ECCENTRICITY>("ECCENTRICITY"),
+    make_column<&GeneralPerturbations::ELEMENT_SET_NO>("ELEMENT_SET_NO"),
+    make_column<&GeneralPerturbations::EPHEMERIS_TYPE>("EPHEMERIS_TYPE"),
+    make_column<&GeneralPerturbations::EPOCH>("EPOCH"),
+    make_column<&GeneralPerturbations::FILE>("FILE"),
+    make_column<&GeneralPerturbations::GP_ID>("GP_ID"),
+    make_column<&GeneralPerturbations::INCLINATION>("INCLINATION"),
+    make_column<&GeneralPerturbations::LAUNCH_DATE>("LAUNCH_DATE"),
+    make_column<&GeneralPerturbations::MEAN_ANOMALY>("MEAN_ANOMALY"),
+    make_column<&GeneralPerturbations::MEAN_ELEMENT_THEORY>("MEAN_ELEMENT_THEORY"),
+    make_column<&GeneralPerturbations::MEAN_MOTION>("MEAN_MOTION"),
+    make_column<&GeneralPerturbations::MEAN_MOTION_DDOT>("MEAN_MOTION_DDOT"),
+    make_column<&GeneralPerturbations::MEAN_MOTION_DOT>("MEAN_MOTION_DOT"),
+    make_column<&GeneralPerturbations::NORAD_CAT_ID>("NORAD_CAT_ID"),
+    make_column<&GeneralPerturbations::OBJECT_ID>("OBJECT_ID"),
+    make_column<&GeneralPerturbations::OBJECT_NAME>("OBJECT_NAME"),
+    make_column<&GeneralPerturbations::OBJECT_TYPE>("OBJECT_TYPE"),
+    make_column<&GeneralPerturbations::ORIGINATOR>("ORIGINATOR"),
+    make_column<&GeneralPerturbations::PERIAPSIS>("PERIAPSIS"),
+    make_column<&GeneralPerturbations::PERIOD>("PERIOD"),
+    make_column<&GeneralPerturbations::RA_OF_ASC_NODE>("RA_OF_ASC_NODE"),
+    make_column<&GeneralPerturbations::RCS_SIZE>("RCS_SIZE"),
+    make_column<&GeneralPerturbations::REF_FRAME>("REF_FRAME"),
+    make_column<&GeneralPerturbations::REV_AT_EPOCH>("REV_AT_EPOCH"),
+    make_column<&GeneralPerturbations::SEMIMAJOR_AXIS>("SEMIMAJOR_AXIS"),
+    make_column<&GeneralPerturbations::SITE>("SITE"),
+    make_column<&GeneralPerturbations::TIME_SYSTEM>("TIME_SYSTEM"),
+    make_column<&GeneralPerturbations::TLE_LINE0>("TLE_LINE0"),
+    make_column<&GeneralPerturbations::TLE_LINE1>("TLE_LINE1"),
+    make_column<&GeneralPerturbations::TLE_LINE2>("TLE_LINE2"),
+};
+
+const std::string REQUIRED_COLUMN = "NORAD_CAT_ID";
+
+// Rows decoded per pass over the columns, sized so a chunk of records fits in L2
+constexpr std::size_t DECODE_CHUNK_SIZE = 256;
+
+} // namespace
+
+
+std::string serialize_catalog(std::span<const GeneralPerturbations> records)
+{
+    std::vector<std::string> blocks;
+    blocks.reserve(COLUMNS.size());
+    for (const Column& column : COLUMNS) {
+        blocks.push_back(column.encode(records));
+    }
+
+    // Header: magic, versions, record count, column count, then the column directory
+    std::size_t headerSize = MAGIC.size() + 2 * sizeof(std::uint16_t) + sizeof(std::uint64_t) + sizeof(std::uint32_t);
+    std::size_t bodySize   = 0;
+    for (std::size_t ii = 0; ii < COLUMNS.size(); ++ii) {
+        headerSize += sizeof(std::uint16_t) + std::strlen(COLUMNS[ii].name) + 2 * sizeof(std::uint8_t) + 2 * sizeof(std::uint64_t);
+        bodySize += blocks[ii].size();
+    }
+
+    std::string archive;
+    archive.reserve(headerSize + bodySize);
+    archive.append(MAGIC.data(), MAGIC.size());
+    append(archive, CATALOG_ARCHIVE_MAJOR_VERSION);
+    append(archive, CATALOG_ARCHIVE_MINOR_VERSION);
+    append(archive, static_cast<std::uint64_t>(records.size()));
+    append(archive, static_cast<std::uint32_t>(COLUMNS.size()));
+
+    std::uint64_t offset = headerSize;
+    for (std::size_t ii = 0; ii < COLUMNS.size(); ++ii) {
+        const std::uint16_t nameSize = static_cast<std::uint16_t>(std::strlen(COLUMNS[ii].name));
+        append(archive, nameSize);
+        archive.append(COLUMNS[ii].name, nameSize);
+        append(archive, static_cast<std::uint8_t>(COLUMNS[ii].type));
+        append(archive, static_cast<std::uint8_t>(COLUMNS[ii].nullable ? NULLABLE : 0));
+        append(archive, offset);
+        append(archive, static_cast<std::uint64_t>(blocks[ii].size()));
+        offset += blocks[ii].size();
+    }
+    for (const std::string& block : blocks) {
+        archive += block;
+    }
+    return archive;
+}
+
+std::vector<GeneralPerturbations> deserialize_catalog(std::string_view archive)
+{
+    ArchiveReader reader(archive);
+    if (reader.read_string(MAGIC.size()) != std::string(MAGIC.data(), MAGIC.size())) {
+        throw std::runtime_error("Not a catalog archive.");
+    }
+    const std::uint16_t major = reader.read<std::uint16_t>();
+    reader.read<std::uint16_t>(); // Minor versions only add columns
+    if (major > CATALOG_ARCHIVE_MAJOR_VERSION) {
+        throw std::runtime_error(
+            "Catalog archive version " + std::to_string(major) + " is newer than the supported version " +
+            std::to_string(CATALOG_ARCHIVE_MAJOR_VERSION) + "."
+        );
+    }
+
+    const std::uint64_t nRecords = reader.read<std::uint64_t>();
+    const std::uint32_t nColumns = reader.read<std::uint32_t>();
+    if (nRecords > archive.size() / sizeof(std::uint64_t)) {
+        throw std::runtime_error("Catalog archive is truncated."); // Too small to hold the NORAD_CAT_ID column
+    }
+
+    std::vector<ColumnEntry> entries(nColumns);
+    for (ColumnEntry& entry : entries) {
+        entry.name   = reader.read_string(reader.read<std::uint16_t>());
+        entry.type   = static_cast<ColumnType>(reader.read<std::uint8_t>());
+        entry.flags  = reader.read<std::uint8_t>();
+        entry.offset = reader.read<std::uint64_t>();
+        entry.size   = reader.read<std::uint64_t>();
+        if (entry.offset > archive.size() || entry.size > archive.size() - entry.offset) {
+            throw std::runtime_error("Catalog archive column " + entry.name + " is truncated.");
+        }
+    }
+
+    bool hasRequired = false;
+    for (const ColumnEntry& entry : entries) {
+        hasRequired |= entry.name == REQUIRED_COLUMN;
+    }
+    if (!hasRequired) { throw std::runtime_error("Catalog archive has no " + REQUIRED_COLUMN + " column."); }
+
+    // Match the archive columns to fields once, skipping columns this version does not know
+    std::vector<std::pair<const ColumnEntry*, const Column*>> matched;
+    for (const ColumnEntry& entry : entries) {
+        for (const Column& column : COLUMNS) {
+            if (entry.name == column.name) {
+                matched.emplace_back(&entry, &column);
+                break;
+            }
+        }
+    }
+
+    std::vector<GeneralPerturbations> records(nRecords);
+    for (std::size_t first = 0; first < nRecords; first += DECODE_CHUNK_SIZE) {
+        const std::size_t last = std::min<std::size_t>(first + DECODE_CHUNK_SIZE, nRecords);
+        for (const auto& [entry, column] : matched) {
+            column->decode(*entry, archive.substr(entry->offset, entry->size), records, first, last);
+        }
+    }
+    return records;
+}
+
+void export_catalog(const std::filesystem::path& path, std::span<const GeneralPerturbations> records)
+{
+    const std::string archive = serialize_catalog(records);
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(archive.data(), static_cast<std::streamsize>(archive.size()));
+    if (!file) { throw std::runtime_error("Failed to write catalog archive " + path.string() + "."); }
+}
+
+std::vector<GeneralPerturbations> import_catalog(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) { throw std::runtime_error("Failed to open catalog archive " + path.string() + "."); }
+
+    std::string archive(std::filesystem::file_size(path), '\0');
+    file.read(archive.data(), static_cast<std::streamsize>(archive.size()));
+    if (!file) { throw std::runtime_error("Failed to read catalog archive " + path.string() + "."); }
+    return deserialize_catalog(archive);
+}
+
+} // namespace snapshot
+} // namespace astrea
@@ -0,0 +1,83 @@
+/**
+ * @file CatalogArchive.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief Columnar binary export and import of General Perturbations catalogs
+ * @version 0.1
+ * @date 2025-08-03
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <astro/state/orbital_data_formats/instances/GeneralPerturbations.hpp>
+
+namespace astrea {
+namespace snapshot {
+
+/**
+ * @brief Major version of the catalog archive format. Readers refuse archives with a newer major version.
+ */
+inline constexpr std::uint16_t CATALOG_ARCHIVE_MAJOR_VERSION = 1;
+
+/**
+ * @brief Minor version of the catalog archive format. Minor versions only add columns, which older readers skip.
+ */
+inline constexpr std::uint16_t CATALOG_ARCHIVE_MINOR_VERSION = 0;
+
+/**
+ * @brief Serializes a catalog into the columnar archive format.
+ *
+ * An archive is a header followed by one block per GeneralPerturbations field. The header holds the record count
+ * and a directory naming each column with its type, whether it holds nulls, and where its block is. Each block is a
+ * validity bitmap for nullable columns followed by the values: 8 byte little-endian doubles or integers, or a table of
+ * offsets into the concatenated string bytes. Floating fields are stored as doubles and integral fields as 64 bit
+ * integers, the same precision as the snapshot database. DB_ID is local to each database and is not exported.
+ *
+ * @param records The records to serialize.
+ * @return std::string The archive bytes.
+ */
+std::string serialize_catalog(std::span<const astro::GeneralPerturbations> records);
+
+/**
+ * @brief Deserializes a catalog from the columnar archive format.
+ *
+ * Columns are matched to fields by name, so archives from other minor versions can be read:
+ *  - Columns the reader does not know are skipped.
+ *  - Fields with no column in the archive are left empty, except NORAD_CAT_ID, which must be present.
+ *  - Integer columns can be read into floating fields.
+ *
+ * @param archive The archive bytes.
+ * @return std::vector<astro::GeneralPerturbations> The records.
+ * @throws std::runtime_error If the archive is truncated or malformed, is from a newer major version, has a column
+ * whose type cannot be read into its field, or has nulls or out of range values in a field that cannot hold them.
+ */
+std::vector<astro::GeneralPerturbations> deserialize_catalog(std::string_view archive);
+
+/**
+ * @brief Writes a catalog to an archive file, for moving a snapshot between machines without copying the database.
+ *
+ * @param path The file to write.
+ * @param records The records to write, e.g. from get_all<GeneralPerturbations>() on the snapshot.
+ * @throws std::runtime_error If the file cannot be written.
+ */
+void export_catalog(const std::filesystem::path& path, std::span<const astro::GeneralPerturbations> records);
+
+/**
+ * @brief Reads a catalog from an archive file. Load it into a snapshot with SnapshotIngestor::replace or upsert.
+ *
+ * @param path The file to read.
+ * @return std::vector<astro::GeneralPerturbations> The records.
+ * @throws std::runtime_error If the file cannot be read or is not a valid archive.
+ */
+std::vector<astro::GeneralPerturbations> import_catalog(const std::filesystem::path& path);
+
+} // namespace snapshot
+} // namespace astrea
@@ -0,0 +1,207 @@
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <snapshot/database/CatalogArchive.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace snapshot;
+
+class CatalogArchiveTest : public testing::Test {
+  public:
+    CatalogArchiveTest() = default;
+
+    void SetUp() override
+    {
+        std::ifstream fixture(std::string(std::getenv("ASTREA_ROOT")) + "/data/snapshot/gp_catalog_sample.json");
+        for (const auto& record : nlohmann::json::parse(fixture)) {
+            catalog.emplace_back(record);
+        }
+
+        // A record with every optional field empty
+        GeneralPerturbations sparse;
+        sparse.NORAD_CAT_ID = 99999;
+        sparse.GP_ID        = 1;
+        catalog.push_back(sparse);
+    }
+
+    // A hand-built column, to write archives from other versions of the format
+    struct TestColumn {
+        std::string name;
+        std::uint8_t type;
+        std::uint8_t flags;
+        std::string block;
+    };
+
+    template <typename T>
+    static void append(std::string& buffer, const T& value)
+    {
+        buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    static std::string int_block(const std::vector<std::int64_t>& values)
+    {
+        std::string block;
+        for (const auto& value : values) {
+            append(block, value);
+        }
+        return block;
+    }
+
+    static std::string string_block(const std::vector<std::string>& values)
+    {
+        std::string block, bytes;
+        append(block, std::uint32_t{ 0 });
+        for (const auto& value : values) {
+            bytes += value;
+            append(block, static_cast<std::uint32_t>(bytes.size()));
+        }
+        return block + bytes;
+    }
+
+    static std::string build_archive(const std::uint16_t& major, const std::uint64_t& nRecords, const std::vector<TestColumn>& columns)
+    {
+        std::size_t headerSize = 8 + 2 + 2 + 8 + 4;
+        for (const auto& column : columns) {
+            headerSize += 2 + column.name.size() + 1 + 1 + 8 + 8;
+        }
+
+        std::string archive = "ASTREAGP";
+        append(archive, major);
+        append(archive, std::uint16_t{ 0 });
+        append(archive, nRecords);
+        append(archive, static_cast<std::uint32_t>(columns.size()));
+        std::uint64_t offset = headerSize;
+        for (const auto& column : columns) {
+            append(archive, static_cast<std::uint16_t>(column.name.size()));
+            archive += column.name;
+            append(archive, column.type);
+            append(archive, column.flags);
+            append(archive, offset);
+            append(archive, static_cast<std::uint64_t>(column.block.size()));
+            offset += column.block.size();
+        }
+        for (const auto& column : columns) {
+            archive += column.block;
+        }
+        return archive;
+    }
+
+    static constexpr std::uint8_t FLOAT64 = 0;
+    static constexpr std::uint8_t INT64   = 1;
+    static constexpr std::uint8_t STRING  = 2;
+
+    std::vector<GeneralPerturbations> catalog;
+};
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST_F(CatalogArchiveTest, RoundTrip)
+{
+    const std::vector<GeneralPerturbations> result = deserialize_catalog(serialize_catalog(catalog));
+    ASSERT_EQ(result.size(), catalog.size());
+
+    for (std::size_t ii = 0; ii < catalog.size(); ++ii) {
+        const GeneralPerturbations& expected = catalog[ii];
+        const GeneralPerturbations& actual   = result[ii];
+        ASSERT_EQ(actual.NORAD_CAT_ID, expected.NORAD_CAT_ID);
+        ASSERT_EQ(actual.GP_ID, expected.GP_ID);
+        ASSERT_EQ(actual.OBJECT_NAME, expected.OBJECT_NAME);
+        ASSERT_EQ(actual.CCSDS_OMM_VERS, expected.CCSDS_OMM_VERS);
+        ASSERT_EQ(actual.CLASSIFICATION_TYPE, expected.CLASSIFICATION_TYPE);
+        ASSERT_EQ(actual.ELEMENT_SET_NO, expected.ELEMENT_SET_NO);
+        ASSERT_EQ(actual.FILE, expected.FILE);
+        ASSERT_EQ(actual.SITE, expected.SITE);
+        ASSERT_EQ(actual.DECAY_DATE, expected.DECAY_DATE);
+        ASSERT_EQ(actual.TLE_LINE2, expected.TLE_LINE2);
+        ASSERT_EQ(actual.APOAPSIS, expected.APOAPSIS);
+
+        // Floating fields keep double precision, as in the database
+        ASSERT_EQ(actual.MEAN_MOTION.has_value(), expected.MEAN_MOTION.has_value());
+        if (expected.MEAN_MOTION) { ASSERT_EQ(static_cast<double>(*actual.MEAN_MOTION), static_cast<double>(*expected.MEAN_MOTION)); }
+    }
+
+    // Nulls survive, and are not confused with zero or empty values
+    ASSERT_FALSE(result[0].SITE.has_value());
+    ASSERT_FALSE(result.back().OBJECT_NAME.has_value());
+    ASSERT_FALSE(result.back().APOAPSIS.has_value());
+    ASSERT_FALSE(result.back().CLASSIFICATION_TYPE.has_value());
+
+    ASSERT_TRUE(deserialize_catalog(serialize_catalog({})).empty());
+}
+
+TEST_F(CatalogArchiveTest, Files)
+{
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "astrea_catalog_archive_test.gpc";
+    export_catalog(path, catalog);
+    const std::vector<GeneralPerturbations> result = import_catalog(path);
+    std::filesystem::remove(path);
+
+    ASSERT_EQ(result.size(), catalog.size());
+    ASSERT_EQ(result[1].OBJECT_NAME, "HST");
+    ASSERT_ANY_THROW(import_catalog(path));
+}
+
+TEST_F(CatalogArchiveTest, SchemaEvolution)
+{
+    // A writer with a column this reader does not know, PERIOD stored as an integer, a null name, and no other columns
+    const std::string archive = build_archive(
+        1,
+        2,
+        { { "NORAD_CAT_ID", INT64, 0, int_block({ 25544, 20580 }) },
+          { "RADAR_CROSS_SECTION", FLOAT64, 0, int_block({ 0, 0 }) },
+          { "PERIOD", INT64, 0, int_block({ 93, 95 }) },
+          { "OBJECT_NAME", STRING, 1, std::string(1, '\x01') + string_block({ "ISS (ZARYA)", "" }) } }
+    );
+
+    const std::vector<GeneralPerturbations> result = deserialize_catalog(archive);
+    ASSERT_EQ(result.size(), 2);
+    ASSERT_EQ(result[0].NORAD_CAT_ID, 25544);
+    ASSERT_EQ(result[0].PERIOD, 93.0);
+    ASSERT_EQ(result[0].OBJECT_NAME, "ISS (ZARYA)");
+    ASSERT_FALSE(result[1].OBJECT_NAME.has_value());
+
+    // Fields missing from the archive are left empty
+    ASSERT_FALSE(result[0].EPOCH.has_value());
+    ASSERT_FALSE(result[0].MEAN_MOTION.has_value());
+    ASSERT_TRUE(result[0].ORIGINATOR.empty());
+}
+
+TEST_F(CatalogArchiveTest, InvalidArchives)
+{
+    const std::string archive = serialize_catalog(catalog);
+
+    ASSERT_ANY_THROW(deserialize_catalog(archive.substr(0, archive.size() - 1)));
+    ASSERT_ANY_THROW(deserialize_catalog(archive.substr(0, 40)));
+    ASSERT_ANY_THROW(deserialize_catalog("SQLite format 3"));
+
+    // Newer major versions
+    ASSERT_ANY_THROW(deserialize_catalog(build_archive(2, 1, { { "NORAD_CAT_ID", INT64, 0, int_block({ 25544 }) } })));
+
+    // No NORAD ID
+    ASSERT_ANY_THROW(deserialize_catalog(build_archive(1, 1, { { "GP_ID", INT64, 0, int_block({ 1 }) } })));
+
+    // Types that cannot be read into their fields
+    ASSERT_ANY_THROW(deserialize_catalog(build_archive(1, 1, { { "NORAD_CAT_ID", STRING, 0, string_block({ "25544" }) } })));
+    ASSERT_ANY_THROW(deserialize_catalog(build_archive(1, 1, { { "NORAD_CAT_ID", FLOAT64, 0, int_block({ 0 }) } })));
+
+    // Out of range values and nulls in required fields
+    ASSERT_ANY_THROW(deserialize_catalog(build_archive(1, 1, { { "NORAD_CAT_ID", INT64, 0, int_block({ -1 }) } })));
+    ASSERT_ANY_THROW(deserialize_catalog(
+        build_archive(1, 1, { { "NORAD_CAT_ID", INT64, 0, int_block({ 1 }) }, { "ELEMENT_SET_NO", INT64, 0, int_block({ 100'000 }) } })
+    ));
+    ASSERT_ANY_THROW(deserialize_catalog(
+        build_archive(1, 1, { { "NORAD_CAT_ID", INT64, 1, std::string(1, '\0') + int_block({ 1 }) } })
+    ));
+}
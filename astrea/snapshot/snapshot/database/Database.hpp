@@ -11,6 +11,7 @@
 #pragma once
 
 #include <sqlite3.h>
+#include <string>
 #include <vector>
 
 #include <sqlite_orm/sqlite_orm.h>
@@ -25,6 +26,8 @@
 
 #include <astro/state/orbital_data_formats/instances/GeneralPerturbations.hpp>
 
+#include <snapshot/database/Schema.hpp>
+
 namespace astrea {
 namespace snapshot {
 
@@ -82,10 +85,13 @@ class DatabaseUtilityWrapper {
     astro::GeneralPerturbations get_sat_from_norad_id(const unsigned& id) const;
 
     /**
-     * @brief Gets a GeneralPerturbations record by its name
+     * @brief Gets GeneralPerturbations records whose name matches a LIKE pattern.
+     *
+     * Searches the trigram name index, so substring patterns such as %STARLINK% do not scan the catalog. The database
+     * must be migrated with sync_snapshot().
      *
-     * @param name The name of the GeneralPerturbations record to retrieve.
-     * @return A GeneralPerturbations object corresponding to the given name.
+     * @param name The LIKE pattern to match against the object name.
+     * @return A vector containing the GeneralPerturbations records with matching names.
      */
     std::vector<astro::GeneralPerturbations> get_sats_by_name(const std::string& name) const;
 
@@ -98,8 +104,33 @@ class DatabaseUtilityWrapper {
      */
     std::vector<astro::GeneralPerturbations> get_sats_in_range(const Distance& minPeriapsis, const Distance& maxApoapsis) const;
 
+    /**
+     * @brief Gets GeneralPerturbations records with an epoch in a specified range.
+     *
+     * @param startEpoch The earliest epoch, as an ISO 8601 string.
+     * @param endEpoch The latest epoch, as an ISO 8601 string.
+     * @return A vector containing GeneralPerturbations records with epochs in the range, inclusive.
+     */
+    std::vector<astro::GeneralPerturbations> get_sats_in_epoch_range(const std::string& startEpoch, const std::string& endEpoch) const;
+
+    /**
+     * @brief Gets GeneralPerturbations records within an orbital regime.
+     *
+     * @param minMeanMotion The minimum mean motion.
+     * @param maxMeanMotion The maximum mean motion.
+     * @param minInclination The minimum inclination.
+     * @param maxInclination The maximum inclination.
+     * @return A vector containing GeneralPerturbations records in the regime, inclusive.
+     */
+    std::vector<astro::GeneralPerturbations> get_sats_in_regime(
+        const MeanMotion& minMeanMotion,
+        const MeanMotion& maxMeanMotion,
+        const Angle& minInclination,
+        const Angle& maxInclination
+    ) const;
+
   private:
-    T _database; //!< The wrapped database instance.
+    mutable T _database; //!< The wrapped database instance. Mutable since sqlite_orm queries are non-const.
 };
 
 /**
@@ -118,18 +149,35 @@ DatabaseUtilityWrapper<typename std::decay<T>::type> make_database(T&& database)
     return DatabaseUtilityWrapper<typename std::decay<T>::type>{ std::forward<T>(database) };
 }
 
+/**
+ * @brief Gets the path to the snapshot database file.
+ *
+ * @return The path to the snapshot database, under the ASTREA_ROOT directory.
+ */
+inline std::string get_snapshot_path()
+{
+    static const std::string root = std::getenv("ASTREA_ROOT");
+    return root + "/astrea/snapshot/snapshot/database/snapshot.db";
+}
+
 /**
  * @brief Gets the snapshot database instance.
  *
- * This function creates and returns a SQLite storage instance for the snapshot database.
+ * This function creates and returns a SQLite storage instance for the snapshot database. NORAD_CAT_ID and GP_ID are
+ * indexed through their unique constraints, and the epoch and orbital regime columns through the declared indices.
+ * Call sync_snapshot() to create the schema.
  *
+ * @param path The path to the database file.
  * @return A sqlite_orm::Storage instance configured for the snapshot database.
  */
-inline auto get_snapshot()
+inline auto get_snapshot(const std::string& path = get_snapshot_path())
 {
-    static const std::string root = std::getenv("ASTREA_ROOT");
     return sqlite_orm::make_storage(
-        root + "/astrea/snapshot/snapshot/database/snapshot.db",
+        path,
+        sqlite_orm::make_index("GeneralPerturbations_epoch", &astro::GeneralPerturbations::EPOCH),
+        sqlite_orm::make_index("GeneralPerturbations_regime", &astro::GeneralPerturbations::MEAN_MOTION, &astro::GeneralPerturbations::INCLINATION),
+        sqlite_orm::make_index("GeneralPerturbations_apoapsis", &astro::GeneralPerturbations::APOAPSIS),
+        sqlite_orm::make_index("GeneralPerturbations_periapsis", &astro::GeneralPerturbations::PERIAPSIS),
         sqlite_orm::make_table(
             "GeneralPerturbations",
             sqlite_orm::make_column("DB_ID", &astro::GeneralPerturbations::DB_ID, sqlite_orm::primary_key().autoincrement()),
@@ -177,6 +225,23 @@ inline auto get_snapshot()
     );
 }
 
+/**
+ * @brief Creates or updates the schema of a snapshot database.
+ *
+ * Syncs the table and indices declared in get_snapshot(), then migrates the database to the current schema version.
+ *
+ * @tparam T The type of the database (e.g., sqlite_orm::Storage<GeneralPerturbations>).
+ * @param database The database to sync.
+ * @throws std::runtime_error If the database is from a newer schema version or a migration fails.
+ */
+template <class T>
+void sync_snapshot(T& database)
+{
+    database.sync_schema();
+    auto connection = database.get_connection();
+    migrate_schema(connection.get());
+}
+
 /**
  * @brief Creates a DatabaseUtilityWrapper for the snapshot database.
  *
@@ -34,8 +34,8 @@ GeneralPerturbations DatabaseUtilityWrapper<T>::get_sat_from_norad_id(const unsi
 template <class T>
 std::vector<GeneralPerturbations> DatabaseUtilityWrapper<T>::get_sats_by_name(const std::string& name) const
 {
-    using namespace sqlite_orm;
-    return _database.template get_all<GeneralPerturbations>(where(like(&GeneralPerturbations::OBJECT_NAME, name)));
+    auto connection = _database.get_connection();
+    return find_sats_by_name(connection.get(), name);
 }
 
 template <class T>
@@ -50,5 +50,34 @@ std::vector<GeneralPerturbations>
     ));
 }
 
+template <class T>
+std::vector<GeneralPerturbations>
+    DatabaseUtilityWrapper<T>::get_sats_in_epoch_range(const std::string& startEpoch, const std::string& endEpoch) const
+{
+    using namespace sqlite_orm;
+    return _database.template get_all<GeneralPerturbations>(
+        where(c(&GeneralPerturbations::EPOCH) >= startEpoch and c(&GeneralPerturbations::EPOCH) <= endEpoch)
+    );
+}
+
+template <class T>
+std::vector<GeneralPerturbations> DatabaseUtilityWrapper<T>::get_sats_in_regime(
+    const MeanMotion& minMeanMotion,
+    const MeanMotion& maxMeanMotion,
+    const Angle& minInclination,
+    const Angle& maxInclination
+) const
+{
+    using namespace sqlite_orm;
+    using mp_units::angular::unit_symbols::deg;
+    constexpr auto revsPerDay = mp_units::one / mp_units::non_si::day;
+    return _database.template get_all<GeneralPerturbations>(where(
+        c(&GeneralPerturbations::MEAN_MOTION) >= minMeanMotion.numerical_value_in(revsPerDay) and
+        c(&GeneralPerturbations::MEAN_MOTION) <= maxMeanMotion.numerical_value_in(revsPerDay) and
+        c(&GeneralPerturbations::INCLINATION) >= minInclination.numerical_value_in(deg) and
+        c(&GeneralPerturbations::INCLINATION) <= maxInclination.numerical_value_in(deg)
+    ));
+}
+
 } // namespace snapshot
 } // namespace astrea
\ No newline at end of file
@@ -0,0 +1,189 @@
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <snapshot/database/Database.hpp>
+#include <snapshot/database/Schema.hpp>
+#include <snapshot/database/SnapshotIngestor.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace snapshot;
+
+using mp_units::angular::unit_symbols::deg;
+using mp_units::non_si::day;
+using mp_units::si::unit_symbols::km;
+
+class DatabaseTest : public testing::Test {
+  public:
+    DatabaseTest() = default;
+
+    void SetUp() override
+    {
+        path = (std::filesystem::temp_directory_path() / "astrea_database_test.db").string();
+        remove_database();
+
+        auto storage = get_snapshot(path);
+        sync_snapshot(storage);
+
+        // A small catalog with one object in each regime
+        std::vector<GeneralPerturbations> catalog(3);
+        catalog[0].NORAD_CAT_ID = 25544;
+        catalog[0].GP_ID        = 1;
+        catalog[0].OBJECT_NAME  = "ISS (ZARYA)";
+        catalog[0].EPOCH        = "2025-07-31T21:14:52.360224";
+        catalog[0].MEAN_MOTION  = 15.50188478;
+        catalog[0].INCLINATION  = 51.6348;
+        catalog[0].APOAPSIS     = 419.639;
+        catalog[0].PERIAPSIS    = 416.877;
+
+        catalog[1].NORAD_CAT_ID = 44713;
+        catalog[1].GP_ID        = 2;
+        catalog[1].OBJECT_NAME  = "STARLINK-1007";
+        catalog[1].EPOCH        = "2025-07-30T08:00:00.000000";
+        catalog[1].MEAN_MOTION  = 15.06;
+        catalog[1].INCLINATION  = 53.05;
+        catalog[1].APOAPSIS     = 551.0;
+        catalog[1].PERIAPSIS    = 549.0;
+
+        catalog[2].NORAD_CAT_ID = 37753;
+        catalog[2].GP_ID        = 3;
+        catalog[2].OBJECT_NAME  = "GPS BIIF-2  (PRN 01)";
+        catalog[2].EPOCH        = "2025-07-31T04:52:09.861600";
+        catalog[2].MEAN_MOTION  = 2.00564157;
+        catalog[2].INCLINATION  = 56.6733;
+        catalog[2].APOAPSIS     = 20497.955;
+        catalog[2].PERIAPSIS    = 19867.166;
+
+        SnapshotIngestor(path).upsert(catalog);
+    }
+
+    void TearDown() override { remove_database(); }
+
+    void remove_database()
+    {
+        for (const std::string suffix : { "", "-wal", "-shm" }) {
+            std::filesystem::remove(path + suffix);
+        }
+    }
+
+    // Details of each step of the query plan, joined
+    static std::string explain(sqlite3* connection, const std::string& sql)
+    {
+        sqlite3_stmt* statement = nullptr;
+        EXPECT_EQ(sqlite3_prepare_v2(connection, ("EXPLAIN QUERY PLAN " + sql).c_str(), -1, &statement, nullptr), SQLITE_OK);
+
+        std::string plan;
+        while (sqlite3_step(statement) == SQLITE_ROW) {
+            plan += reinterpret_cast<const char*>(sqlite3_column_text(statement, 3));
+            plan += "\n";
+        }
+        sqlite3_finalize(statement);
+        return plan;
+    }
+
+    std::string path;
+};
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST_F(DatabaseTest, SchemaVersion)
+{
+    auto storage    = get_snapshot(path);
+    auto connection = storage.get_connection();
+    ASSERT_EQ(get_schema_version(connection.get()), SNAPSHOT_SCHEMA_VERSION);
+
+    // Syncing again is a no-op
+    ASSERT_NO_THROW(sync_snapshot(storage));
+    ASSERT_EQ(get_schema_version(connection.get()), SNAPSHOT_SCHEMA_VERSION);
+
+    // Databases from newer versions are refused
+    sqlite3_exec(connection.get(), ("PRAGMA user_version = " + std::to_string(SNAPSHOT_SCHEMA_VERSION + 1) + ";").c_str(), nullptr, nullptr, nullptr);
+    ASSERT_ANY_THROW(migrate_schema(connection.get()));
+}
+
+TEST_F(DatabaseTest, QueryPlans)
+{
+    auto storage           = get_snapshot(path);
+    auto connection        = storage.get_connection();
+    sqlite3* rawConnection = connection.get();
+
+    // Every query searches an index rather than scanning the table
+    const std::string norad = explain(rawConnection, "SELECT * FROM GeneralPerturbations WHERE NORAD_CAT_ID = ?;");
+    ASSERT_NE(norad.find("USING INDEX sqlite_autoindex_GeneralPerturbations"), std::string::npos) << norad;
+
+    const std::string name = explain(rawConnection, "SELECT rowid FROM GeneralPerturbations_name WHERE OBJECT_NAME LIKE ?;");
+    ASSERT_NE(name.find("VIRTUAL TABLE INDEX"), std::string::npos) << name;
+
+    // Name matches are filtered in SQL, then read through the primary key
+    const std::string byName = explain(
+        rawConnection,
+        "SELECT * FROM GeneralPerturbations WHERE DB_ID IN (SELECT rowid FROM GeneralPerturbations_name WHERE OBJECT_NAME LIKE ?);"
+    );
+    ASSERT_NE(byName.find("USING INTEGER PRIMARY KEY"), std::string::npos) << byName;
+    ASSERT_NE(byName.find("VIRTUAL TABLE INDEX"), std::string::npos) << byName;
+
+    const std::string epoch = explain(rawConnection, "SELECT * FROM GeneralPerturbations WHERE EPOCH >= ? AND EPOCH <= ?;");
+    ASSERT_NE(epoch.find("USING INDEX GeneralPerturbations_epoch"), std::string::npos) << epoch;
+
+    const std::string regime = explain(
+        rawConnection,
+        "SELECT * FROM GeneralPerturbations WHERE MEAN_MOTION >= ? AND MEAN_MOTION <= ? AND INCLINATION >= ? AND INCLINATION <= ?;"
+    );
+    ASSERT_NE(regime.find("USING INDEX GeneralPerturbations_regime"), std::string::npos) << regime;
+
+    const std::string range = explain(rawConnection, "SELECT * FROM GeneralPerturbations WHERE APOAPSIS <= ? AND PERIAPSIS >= ?;");
+    ASSERT_NE(range.find("USING INDEX GeneralPerturbations_"), std::string::npos) << range;
+}
+
+TEST_F(DatabaseTest, Queries)
+{
+    const auto database = make_database(get_snapshot(path));
+
+    ASSERT_EQ(database.get_sat_from_norad_id(25544).OBJECT_NAME, "ISS (ZARYA)");
+    ASSERT_ANY_THROW(database.get_sat_from_norad_id(1));
+
+    // Name patterns match substrings, ignoring case
+    ASSERT_EQ(database.get_sats_by_name("%starlink%").size(), 1);
+    ASSERT_EQ(database.get_sats_by_name("%(%").size(), 2);
+    ASSERT_EQ(database.get_sats_by_name("ISS (ZARYA)").size(), 1);
+    ASSERT_EQ(database.get_sats_by_name("%MOLNIYA%").size(), 0);
+
+    // Rows read by the name search match the ORM
+    const GeneralPerturbations byName = database.get_sats_by_name("ISS (ZARYA)")[0];
+    const GeneralPerturbations byId   = database.get_sat_from_norad_id(25544);
+    ASSERT_EQ(byName.DB_ID, byId.DB_ID);
+    ASSERT_EQ(byName.GP_ID, byId.GP_ID);
+    ASSERT_EQ(byName.CLASSIFICATION_TYPE, byId.CLASSIFICATION_TYPE);
+    ASSERT_EQ(byName.EPOCH, byId.EPOCH);
+    ASSERT_EQ(byName.MEAN_MOTION, byId.MEAN_MOTION);
+    ASSERT_EQ(byName.DECAY_DATE, byId.DECAY_DATE);
+    ASSERT_EQ(byName.TIME_SYSTEM, byId.TIME_SYSTEM);
+    ASSERT_EQ(byName.TLE_LINE1, byId.TLE_LINE1);
+
+    ASSERT_EQ(database.get_sats_in_epoch_range("2025-07-31", "2025-08-01").size(), 2);
+    ASSERT_EQ(database.get_sats_in_regime(14.0 / day, 16.0 / day, 50.0 * deg, 52.0 * deg).size(), 1);
+    ASSERT_EQ(database.get_sats_in_regime(1.0 / day, 3.0 / day, 0.0 * deg, 90.0 * deg).size(), 1);
+    ASSERT_EQ(database.get_sats_in_range(400.0 * km, 600.0 * km).size(), 2);
+}
+
+TEST_F(DatabaseTest, NameSearchFollowsIngest)
+{
+    const auto database = make_database(get_snapshot(path));
+
+    // Renames update the search table, and a full replace rebuilds it
+    GeneralPerturbations renamed = database.get_sat_from_norad_id(44713);
+    renamed.OBJECT_NAME          = "STARLINK-1007 [DEORBITING]";
+    SnapshotIngestor(path).upsert(std::vector<GeneralPerturbations>{ renamed });
+    ASSERT_EQ(database.get_sats_by_name("%DEORBITING%").size(), 1);
+
+    SnapshotIngestor(path).replace(std::vector<GeneralPerturbations>{ renamed });
+    ASSERT_EQ(database.get_sats_by_name("%DEORBITING%").size(), 1);
+    ASSERT_EQ(database.get_sats_by_name("%ISS%").size(), 0);
+}
@@ -0,0 +1,245 @@
+#include <snapshot/database/Schema.hpp>
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+
+namespace astrea {
+namespace snapshot {
+
+using astro::GeneralPerturbations;
+
+namespace {
+
+using Statement = std::unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)>;
+
+// Migration i takes the schema from version i to version i + 1
+const std::array<std::string, SNAPSHOT_SCHEMA_VERSION> MIGRATIONS = {
+    // 1: Trigram name search over an external content table, kept in sync by triggers
+    "CREATE VIRTUAL TABLE IF NOT EXISTS \"GeneralPerturbations_name\" USING fts5("
+    "    OBJECT_NAME, content = 'GeneralPerturbations', content_rowid = 'DB_ID', tokenize = 'trigram'"
+    ");"
+    "CREATE TRIGGER IF NOT EXISTS \"GeneralPerturbations_name_insert\" AFTER INSERT ON \"GeneralPerturbations\" BEGIN"
+    "    INSERT INTO \"GeneralPerturbations_name\" (rowid, OBJECT_NAME) VALUES (new.DB_ID, new.OBJECT_NAME);"
+    "END;"
+    "CREATE TRIGGER IF NOT EXISTS \"GeneralPerturbations_name_delete\" AFTER DELETE ON \"GeneralPerturbations\" BEGIN"
+    "    INSERT INTO \"GeneralPerturbations_name\" (\"GeneralPerturbations_name\", rowid, OBJECT_NAME)"
+    "        VALUES ('delete', old.DB_ID, old.OBJECT_NAME);"
+    "END;"
+    "CREATE TRIGGER IF NOT EXISTS \"GeneralPerturbations_name_update\" AFTER UPDATE OF OBJECT_NAME ON \"GeneralPerturbations\" BEGIN"
+    "    INSERT INTO \"GeneralPerturbations_name\" (\"GeneralPerturbations_name\", rowid, OBJECT_NAME)"
+    "        VALUES ('delete', old.DB_ID, old.OBJECT_NAME);"
+    "    INSERT INTO \"GeneralPerturbations_name\" (rowid, OBJECT_NAME) VALUES (new.DB_ID, new.OBJECT_NAME);"
+    "END;"
+    "INSERT INTO \"GeneralPerturbations_name\" (\"GeneralPerturbations_name\") VALUES ('rebuild');"
+};
+
+void execute(sqlite3* connection, const std::string& sql)
+{
+    char* error = nullptr;
+    if (sqlite3_exec(connection, sql.c_str(), nullptr, nullptr, &error) != SQLITE_OK) {
+        const std::string message = error ? error : sqlite3_errmsg(connection);
+        sqlite3_free(error);
+        throw std::runtime_error("Snapshot database error: " + message);
+    }
+}
+
+Statement prepare(sqlite3* connection, const std::string& sql)
+{
+    sqlite3_stmt* statement = nullptr;
+    if (sqlite3_prepare_v2(connection, sql.c_str(), -1, &statement, nullptr) != SQLITE_OK) {
+        throw std::runtime_error("Failed to prepare snapshot statement: " + std::string(sqlite3_errmsg(connection)));
+    }
+    return Statement(statement, &sqlite3_finalize);
+}
+
+// Bind values with the same storage classes sqlite_orm uses, so the ORM reads the rows back unchanged
+void bind_value(sqlite3_stmt* statement, const int& index, const std::string& value)
+{
+    sqlite3_bind_text(statement, index, value.data(), static_cast<int>(value.size()), SQLITE_STATIC);
+}
+
+template <typename T>
+void bind_value(sqlite3_stmt* statement, const int& index, const T& value)
+{
+    if constexpr (std::is_floating_point_v<T>) { sqlite3_bind_double(statement, index, static_cast<double>(value)); }
+    else {
+        sqlite3_bind_int64(statement, index, static_cast<sqlite3_int64>(value));
+    }
+}
+
+template <typename T>
+void bind_value(sqlite3_stmt* statement, const int& index, const std::optional<T>& value)
+{
+    if (value) { bind_value(statement, index, *value); }
+    else {
+        sqlite3_bind_null(statement, index);
+    }
+}
+
+// Read values back the way sqlite_orm does, with NULL as an empty optional or string
+void read_value(sqlite3_stmt* statement, const int& index, std::string& value)
+{
+    const unsigned char* text = sqlite3_column_text(statement, index);
+    value = text ? std::string(reinterpret_cast<const char*>(text), static_cast<std::size_t>(sqlite3_column_bytes(statement, index)))
+                 : std::string();
+}
+
+template <typename T>
+void read_value(sqlite3_stmt* statement, const int& index, T& value)
+{
+    if constexpr (std::is_floating_point_v<T>) { value = static_cast<T>(sqlite3_column_double(statement, index)); }
+    else {
+        value = static_cast<T>(sqlite3_column_int64(statement, index));
+    }
+}
+
+template <typename T>
+void read_value(sqlite3_stmt* statement, const int& index, std::optional<T>& value)
+{
+    if (sqlite3_column_type(statement, index) == SQLITE_NULL) { value.reset(); }
+    else {
+        read_value(statement, index, value.emplace());
+    }
+}
+
+template <auto Member>
+void bind_member(sqlite3_stmt* statement, const int& index, const GeneralPerturbations& gp)
+{
+    bind_value(statement, index, gp.*Member);
+}
+
+template <auto Member>
+void read_member(sqlite3_stmt* statement, const int& index, GeneralPerturbations& gp)
+{
+    read_value(statement, index, gp.*Member);
+}
+
+bool has_table(sqlite3* connection, const std::string& table)
+{
+    Statement statement = prepare(connection, "SELECT 1 FROM sqlite_master WHERE type = 'table' AND name = ?1;");
+    sqlite3_bind_text(statement.get(), 1, table.c_str(), -1, SQLITE_TRANSIENT);
+    return sqlite3_step(statement.get()) == SQLITE_ROW;
+}
+
+} // namespace
+
+
+const std::array<SnapshotColumn, 40>& get_snapshot_columns()
+{
+    static const std::array<SnapshotColumn, 40> columns = { {
+        { "APOAPSIS", &bind_member<&GeneralPerturbations::APOAPSIS>, &read_member<&GeneralPerturbations::APOAPSIS> },
+        { "ARG_OF_PERICENTER", &bind_member<&GeneralPerturbations::ARG_OF_PERICENTER>, &read_member<&GeneralPerturbations::ARG_OF_PERICENTER> },
+        { "BSTAR", &bind_member<&GeneralPerturbations::BSTAR>, &read_member<&GeneralPerturbations::BSTAR> },
+        { "CCSDS_OMM_VERS", &bind_member<&GeneralPerturbations::CCSDS_OMM_VERS>, &read_member<&GeneralPerturbations::CCSDS_OMM_VERS> },
+        { "CENTER_NAME", &bind_member<&GeneralPerturbations::CENTER_NAME>, &read_member<&GeneralPerturbations::CENTER_NAME> },
+        { "CLASSIFICATION_TYPE", &bind_member<&GeneralPerturbations::CLASSIFICATION_TYPE>, &read_member<&GeneralPerturbations::CLASSIFICATION_TYPE> },
+        { "COMMENT", &bind_member<&GeneralPerturbations::COMMENT>, &read_member<&GeneralPerturbations::COMMENT> },
+        { "COUNTRY_CODE", &bind_member<&GeneralPerturbations::COUNTRY_CODE>, &read_member<&GeneralPerturbations::COUNTRY_CODE> },
+        { "CREATION_DATE", &bind_member<&GeneralPerturbations::CREATION_DATE>, &read_member<&GeneralPerturbations::CREATION_DATE> },
+        { "DECAY_DATE", &bind_member<&GeneralPerturbations::DECAY_DATE>, &read_member<&GeneralPerturbations::DECAY_DATE> },
+        { "ECCENTRICITY", &bind_member<&GeneralPerturbations::ECCENTRICITY>, &read_member<&GeneralPerturbations::ECCENTRICITY> },
+        { "ELEMENT_SET_NO", &bind_member<&GeneralPerturbations::ELEMENT_SET_NO>, &read_member<&GeneralPerturbations::ELEMENT_SET_NO> },
+        { "EPHEMERIS_TYPE", &bind_member<&GeneralPerturbations::EPHEMERIS_TYPE>, &read_member<&GeneralPerturbations::EPHEMERIS_TYPE> },
+        { "EPOCH", &bind_member<&GeneralPerturbations::EPOCH>, &read_member<&GeneralPerturbations::EPOCH> },
+        { "FILE", &bind_member<&GeneralPerturbations::FILE>, &read_member<&GeneralPerturbations::FILE> },
+        { "GP_ID", &bind_member<&GeneralPerturbations::GP_ID>, &read_member<&GeneralPerturbations::GP_ID> },
+        { "INCLINATION", &bind_member<&GeneralPerturbations::INCLINATION>, &read_member<&GeneralPerturbations::INCLINATION> },
+        { "LAUNCH_DATE", &bind_member<&GeneralPerturbations::LAUNCH_DATE>, &read_member<&GeneralPerturbations::LAUNCH_DATE> },
+        { "MEAN_ANOMALY", &bind_member<&GeneralPerturbations::MEAN_ANOMALY>, &read_member<&GeneralPerturbations::MEAN_ANOMALY> },
+        { "MEAN_ELEMENT_THEORY", &bind_member<&GeneralPerturbations::MEAN_ELEMENT_THEORY>, &read_member<&GeneralPerturbations::MEAN_ELEMENT_THEORY> },
+        { "MEAN_MOTION", &bind_member<&GeneralPerturbations::MEAN_MOTION>, &read_member<&GeneralPerturbations::MEAN_MOTION> },
+        { "MEAN_MOTION_DDOT", &bind_member<&GeneralPerturbations::MEAN_MOTION_DDOT>, &read_member<&GeneralPerturbations::MEAN_MOTION_DDOT> },
+        { "MEAN_MOTION_DOT", &bind_member<&GeneralPerturbations::MEAN_MOTION_DOT>, &read_member<&GeneralPerturbations::MEAN_MOTION_DOT> },
+        { "NORAD_CAT_ID", &bind_member<&GeneralPerturbations::NORAD_CAT_ID>, &read_member<&GeneralPerturbations::NORAD_CAT_ID> },
+        { "OBJECT_ID", &bind_member<&GeneralPerturbations::OBJECT_ID>, &read_member<&GeneralPerturbations::OBJECT_ID> },
+        { "OBJECT_NAME", &bind_member<&GeneralPerturbations::OBJECT_NAME>, &read_member<&GeneralPerturbations::OBJECT_NAME> },
+        { "OBJECT_TYPE", &bind_member<&GeneralPerturbations::OBJECT_TYPE>, &read_member<&GeneralPerturbations::OBJECT_TYPE> },
+        { "ORIGINATOR", &bind_member<&GeneralPerturbations::ORIGINATOR>, &read_member<&GeneralPerturbations::ORIGINATOR> },
+        { "PERIAPSIS", &bind_member<&GeneralPerturbations::PERIAPSIS>, &read_member<&GeneralPerturbations::PERIAPSIS> },
+        { "PERIOD", &bind_member<&GeneralPerturbations::PERIOD>, &read_member<&GeneralPerturbations::PERIOD> },
+        { "RA_OF_ASC_NODE", &bind_member<&GeneralPerturbations::RA_OF_ASC_NODE>, &read_member<&GeneralPerturbations::RA_OF_ASC_NODE> },
+        { "RCS_SIZE", &bind_member<&GeneralPerturbations::RCS_SIZE>, &read_member<&GeneralPerturbations::RCS_SIZE> },
+        { "REF_FRAME", &bind_member<&GeneralPerturbations::REF_FRAME>, &read_member<&GeneralPerturbations::REF_FRAME> },
+        { "REV_AT_EPOCH", &bind_member<&GeneralPerturbations::REV_AT_EPOCH>, &read_member<&GeneralPerturbations::REV_AT_EPOCH> },
+        { "SEMIMAJOR_AXIS", &bind_member<&GeneralPerturbations::SEMIMAJOR_AXIS>, &read_member<&GeneralPerturbations::SEMIMAJOR_AXIS> },
+        { "SITE", &bind_member<&GeneralPerturbations::SITE>, &read_member<&GeneralPerturbations::SITE> },
+        { "TIME_SYSTEM", &bind_member<&GeneralPerturbations::TIME_SYSTEM>, &read_member<&GeneralPerturbations::TIME_SYSTEM> },
+        { "TLE_LINE0", &bind_member<&GeneralPerturbations::TLE_LINE0>, &read_member<&GeneralPerturbations::TLE_LINE0> },
+        { "TLE_LINE1", &bind_member<&GeneralPerturbations::TLE_LINE1>, &read_member<&GeneralPerturbations::TLE_LINE1> },
+        { "TLE_LINE2", &bind_member<&GeneralPerturbations::TLE_LINE2>, &read_member<&GeneralPerturbations::TLE_LINE2> },
+    } };
+    return columns;
+}
+
+int get_schema_version(sqlite3* connection)
+{
+    Statement statement = prepare(connection, "PRAGMA user_version;");
+    if (sqlite3_step(statement.get()) != SQLITE_ROW) {
+        throw std::runtime_error("Failed to read snapshot schema version: " + std::string(sqlite3_errmsg(connection)));
+    }
+    return sqlite3_column_int(statement.get(), 0);
+}
+
+void migrate_schema(sqlite3* connection)
+{
+    const int version = get_schema_version(connection);
+    if (version > SNAPSHOT_SCHEMA_VERSION) {
+        throw std::runtime_error(
+            "Snapshot database schema version " + std::to_string(version) + " is newer than the supported version " +
+            std::to_string(SNAPSHOT_SCHEMA_VERSION) + "."
+        );
+    }
+    if (!has_table(connection, "GeneralPerturbations")) {
+        throw std::runtime_error("Snapshot database has no GeneralPerturbations table. Call sync_schema() before migrating.");
+    }
+
+    for (int step = version; step < SNAPSHOT_SCHEMA_VERSION; ++step) {
+        try {
+            execute(connection, "BEGIN IMMEDIATE;" + MIGRATIONS[step] + "PRAGMA user_version = " + std::to_string(step + 1) + "; COMMIT;");
+        }
+        catch (...) {
+            sqlite3_exec(connection, "ROLLBACK;", nullptr, nullptr, nullptr);
+            throw;
+        }
+    }
+}
+
+void rebuild_name_search(sqlite3* connection)
+{
+    if (!has_table(connection, NAME_SEARCH_TABLE)) { return; }
+    execute(connection, "INSERT INTO \"" + NAME_SEARCH_TABLE + "\" (\"" + NAME_SEARCH_TABLE + "\") VALUES ('rebuild');");
+}
+
+std::vector<GeneralPerturbations> find_sats_by_name(sqlite3* connection, const std::string& pattern)
+{
+    // Filter on the search table in the same statement, so matching ids never leave SQLite
+    const std::array<SnapshotColumn, 40>& columns = get_snapshot_columns();
+    std::string select                            = "SELECT \"DB_ID\"";
+    for (const SnapshotColumn& column : columns) {
+        select += ", \"" + std::string(column.name) + "\"";
+    }
+    Statement statement = prepare(
+        connection,
+        select + " FROM \"GeneralPerturbations\" WHERE \"DB_ID\" IN (SELECT rowid FROM \"" + NAME_SEARCH_TABLE +
+            "\" WHERE OBJECT_NAME LIKE ?1);"
+    );
+    sqlite3_bind_text(statement.get(), 1, pattern.c_str(), -1, SQLITE_TRANSIENT);
+
+    std::vector<GeneralPerturbations> sats;
+    int result;
+    while ((result = sqlite3_step(statement.get())) == SQLITE_ROW) {
+        GeneralPerturbations& gp = sats.emplace_back();
+        gp.DB_ID                 = sqlite3_column_int(statement.get(), 0);
+        for (std::size_t ii = 0; ii < columns.size(); ++ii) {
+            columns[ii].read(statement.get(), static_cast<int>(ii + 1), gp);
+        }
+    }
+    if (result != SQLITE_DONE) { throw std::runtime_error("Failed to search object names: " + std::string(sqlite3_errmsg(connection))); }
+    return sats;
+}
+
+} // namespace snapshot
+} // namespace astrea
@@ -0,0 +1,103 @@
+/**
+ * @file Schema.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief Schema versioning and search indices for the snapshot database
+ * @version 0.1
+ * @date 2025-08-03
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include <sqlite3.h>
+
+#include <astro/state/orbital_data_formats/instances/GeneralPerturbations.hpp>
+
+namespace astrea {
+namespace snapshot {
+
+/**
+ * @brief Current version of the snapshot database schema, stored in PRAGMA user_version.
+ *
+ * Version 1 adds the trigram name search table and the triggers that keep it in sync with the GeneralPerturbations
+ * table. The B-tree indices are declared with the table in get_snapshot() and created by sync_schema.
+ */
+inline constexpr int SNAPSHOT_SCHEMA_VERSION = 1;
+
+/**
+ * @brief Name of the full-text table used for object name search.
+ */
+inline const std::string NAME_SEARCH_TABLE = "GeneralPerturbations_name";
+
+/**
+ * @brief A column of the GeneralPerturbations table, with accessors for reading and writing it through raw statements.
+ */
+struct SnapshotColumn {
+    const char* name;                                                                               //!< Column name
+    void (*bind)(sqlite3_stmt* statement, const int& index, const astro::GeneralPerturbations& gp); //!< Binds the member value
+    void (*read)(sqlite3_stmt* statement, const int& index, astro::GeneralPerturbations& gp);       //!< Reads the member value
+};
+
+/**
+ * @brief Gets every column of the GeneralPerturbations table except the autoincrement key, matching get_snapshot().
+ *
+ * Values are bound and read with the same storage classes sqlite_orm uses, so rows written or read through these
+ * columns round trip through the ORM unchanged.
+ *
+ * @return const std::array<SnapshotColumn, 40>& The columns, in declaration order.
+ */
+const std::array<SnapshotColumn, 40>& get_snapshot_columns();
+
+/**
+ * @brief Gets the schema version of a snapshot database.
+ *
+ * @param connection The database connection.
+ * @return int The schema version, or 0 for a database that has never been migrated.
+ * @throws std::runtime_error If the version cannot be read.
+ */
+int get_schema_version(sqlite3* connection);
+
+/**
+ * @brief Migrates a snapshot database to the current schema version.
+ *
+ * Each migration step runs in its own transaction along with the version bump, so an interrupted migration resumes
+ * from the last completed step. The GeneralPerturbations table must already exist.
+ *
+ * @param connection The database connection.
+ * @throws std::runtime_error If the database is from a newer schema version or a migration fails.
+ */
+void migrate_schema(sqlite3* connection);
+
+/**
+ * @brief Rebuilds the name search table from the GeneralPerturbations table.
+ *
+ * Needed after the GeneralPerturbations table is replaced outright, since the triggers only track row changes. Does
+ * nothing if the database has no name search table.
+ *
+ * @param connection The database connection.
+ * @throws std::runtime_error If the rebuild fails.
+ */
+void rebuild_name_search(sqlite3* connection);
+
+/**
+ * @brief Finds the objects whose name matches a LIKE pattern.
+ *
+ * Uses the trigram index, so substring patterns such as %STARLINK% do not scan the catalog. Patterns with fewer than
+ * three characters between wildcards fall back to a scan of the search table. Matching is case-insensitive for ASCII,
+ * the same as LIKE on the GeneralPerturbations table. The search table is filtered in the same statement that reads
+ * the matching rows.
+ *
+ * @param connection The database connection.
+ * @param pattern The LIKE pattern to match.
+ * @return std::vector<astro::GeneralPerturbations> Each matching object.
+ * @throws std::runtime_error If the query fails.
+ */
+std::vector<astro::GeneralPerturbations> find_sats_by_name(sqlite3* connection, const std::string& pattern);
+
+} // namespace snapshot
+} // namespace astrea
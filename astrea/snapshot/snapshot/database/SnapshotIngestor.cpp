@@ -0,0 +1,314 @@
+#include <snapshot/database/SnapshotIngestor.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <snapshot/database/Schema.hpp>
+#include <snapshot/http-queries/RecordParser.hpp>
+#include <snapshot/types/BoundedQueue.hpp>
+
+namespace astrea {
+namespace snapshot {
+
+using astro::GeneralPerturbations;
+
+namespace {
+
+const std::string LIVE_TABLE    = "GeneralPerturbations";
+const std::string STAGING_TABLE = "GeneralPerturbations_staging";
+
+using Statement = std::unique_ptr<sqlite3_stmt, decltype(&sqlite3_finalize)>;
+
+std::string quote(const std::string& identifier) { return "\"" + identifier + "\""; }
+
+// INSERT ... ON CONFLICT(NORAD_CAT_ID) DO UPDATE, so a record replaces any earlier record of the same object
+std::string build_upsert(const std::string& table)
+{
+    std::string columns, values, updates;
+    for (const SnapshotColumn& column : get_snapshot_columns()) {
+        const std::string name = quote(column.name);
+        columns += (columns.empty() ? "" : ", ") + name;
+        values += values.empty() ? "?" : ", ?";
+        if (name != quote("NORAD_CAT_ID")) { updates += (updates.empty() ? "" : ", ") + name + " = excluded." + name; }
+    }
+    return "INSERT INTO " + quote(table) + " (" + columns + ") VALUES (" + values + ") ON CONFLICT(" + quote("NORAD_CAT_ID") +
+           ") DO UPDATE SET " + updates + ";";
+}
+
+Statement prepare(sqlite3* connection, const std::string& sql)
+{
+    sqlite3_stmt* statement = nullptr;
+    if (sqlite3_prepare_v2(connection, sql.c_str(), -1, &statement, nullptr) != SQLITE_OK) {
+        throw std::runtime_error("Failed to prepare snapshot statement: " + std::string(sqlite3_errmsg(connection)));
+    }
+    return Statement(statement, &sqlite3_finalize);
+}
+
+// The sql column of sqlite_master for every object of a type on a table
+std::vector<std::string> get_schema(sqlite3* connection, const std::string& type, const std::string& table)
+{
+    Statement statement =
+        prepare(connection, "SELECT sql FROM sqlite_master WHERE type = ?1 AND tbl_name = ?2 AND sql IS NOT NULL;");
+    sqlite3_bind_text(statement.get(), 1, type.c_str(), -1, SQLITE_TRANSIENT);
+    sqlite3_bind_text(statement.get(), 2, table.c_str(), -1, SQLITE_TRANSIENT);
+
+    std::vector<std::string> schema;
+    while (sqlite3_step(statement.get()) == SQLITE_ROW) {
+        schema.emplace_back(reinterpret_cast<const char*>(sqlite3_column_text(statement.get(), 0)));
+    }
+    return schema;
+}
+
+// Input range over the records in a queue, ending when the producer closes it
+class QueueRange {
+  public:
+    struct Sentinel {};
+
+    class Iterator {
+      public:
+        using value_type      = GeneralPerturbations;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator(BoundedQueue<GeneralPerturbations>* queue) :
+            _queue(queue)
+        {
+            ++*this;
+        }
+
+        const GeneralPerturbations& operator*() const { return *_current; }
+
+        Iterator& operator++()
+        {
+            _current = _queue->pop();
+            return *this;
+        }
+
+        void operator++(int) { ++*this; }
+
+        bool operator==(const Sentinel&) const { return !_current.has_value(); }
+
+      private:
+        BoundedQueue<GeneralPerturbations>* _queue;
+        std::optional<GeneralPerturbations> _current;
+    };
+
+    QueueRange(BoundedQueue<GeneralPerturbations>& queue) :
+        _queue(&queue)
+    {
+    }
+
+    Iterator begin() const { return Iterator(_queue); }
+    Sentinel end() const { return {}; }
+
+  private:
+    BoundedQueue<GeneralPerturbations>* _queue;
+};
+
+// Number of records in a range, or zero if it is not known in advance
+template <class Records_T>
+std::size_t get_size(const Records_T& records)
+{
+    if constexpr (std::ranges::sized_range<const Records_T>) { return std::ranges::size(records); }
+    else {
+        return 0;
+    }
+}
+
+const auto identity = [](const GeneralPerturbations& gp) -> const GeneralPerturbations& { return gp; };
+
+} // namespace
+
+
+SnapshotIngestor::SnapshotIngestor(const std::string& path, const std::size_t& batchSize) :
+    _batchSize(batchSize)
+{
+    if (_batchSize == 0) { throw std::runtime_error("Snapshot ingest batch size must be greater than zero."); }
+    if (sqlite3_open(path.c_str(), &_connection) != SQLITE_OK) {
+        const std::string message = sqlite3_errmsg(_connection);
+        sqlite3_close(_connection);
+        throw std::runtime_error("Failed to open snapshot database " + path + ": " + message);
+    }
+
+    try {
+        // WAL lets readers keep working during a load, and NORMAL sync cannot corrupt the database in WAL mode
+        execute("PRAGMA journal_mode = WAL; PRAGMA synchronous = NORMAL; PRAGMA temp_store = MEMORY;");
+        sqlite3_busy_timeout(_connection, 5'000);
+
+        if (get_schema(_connection, "table", LIVE_TABLE).empty()) {
+            throw std::runtime_error("Snapshot database has no " + LIVE_TABLE + " table. Call sync_snapshot() before ingesting.");
+        }
+    }
+    catch (...) {
+        sqlite3_close(_connection);
+        throw;
+    }
+}
+
+SnapshotIngestor::~SnapshotIngestor() { sqlite3_close(_connection); }
+
+std::size_t SnapshotIngestor::upsert(const nlohmann::json& records, const ProgressCallback& progress)
+{
+    return write(LIVE_TABLE, records, [](const nlohmann::json& data) { return GeneralPerturbations(data); }, progress);
+}
+
+std::size_t SnapshotIngestor::upsert(std::span<const GeneralPerturbations> records, const ProgressCallback& progress)
+{
+    return write(LIVE_TABLE, records, identity, progress);
+}
+
+std::size_t SnapshotIngestor::upsert(std::istream& response, const ProgressCallback& progress, const std::size_t& queueCapacity)
+{
+    return stream(response, queueCapacity, [&](const QueueRange& records) {
+        return write(LIVE_TABLE, records, identity, progress);
+    });
+}
+
+std::size_t SnapshotIngestor::replace(const nlohmann::json& records, const ProgressCallback& progress)
+{
+    return stage_and_swap(records, [](const nlohmann::json& data) { return GeneralPerturbations(data); }, progress);
+}
+
+std::size_t SnapshotIngestor::replace(std::span<const GeneralPerturbations> records, const ProgressCallback& progress)
+{
+    return stage_and_swap(records, identity, progress);
+}
+
+std::size_t SnapshotIngestor::replace(std::istream& response, const ProgressCallback& progress, const std::size_t& queueCapacity)
+{
+    return stream(response, queueCapacity, [&](const QueueRange& records) {
+        return stage_and_swap(records, identity, progress);
+    });
+}
+
+void SnapshotIngestor::execute(const std::string& sql)
+{
+    char* error = nullptr;
+    if (sqlite3_exec(_connection, sql.c_str(), nullptr, nullptr, &error) != SQLITE_OK) {
+        const std::string message = error ? error : sqlite3_errmsg(_connection);
+        sqlite3_free(error);
+        throw std::runtime_error("Snapshot database error: " + message);
+    }
+}
+
+template <class Records_T, class Convert_T>
+std::size_t
+    SnapshotIngestor::write(const std::string& table, const Records_T& records, Convert_T&& convert, const ProgressCallback& progress)
+{
+    Statement statement                        = prepare(_connection, build_upsert(table));
+    const std::array<SnapshotColumn, 40>& columns = get_snapshot_columns();
+
+    const std::size_t nRecords = get_size(records);
+    std::size_t nWritten       = 0;
+
+    execute("BEGIN;");
+    try {
+        for (const auto& record : records) {
+            const GeneralPerturbations& gp = convert(record);
+            for (std::size_t ii = 0; ii < columns.size(); ++ii) {
+                columns[ii].bind(statement.get(), static_cast<int>(ii + 1), gp);
+            }
+            if (sqlite3_step(statement.get()) != SQLITE_DONE) {
+                throw std::runtime_error(
+                    "Failed to write NORAD_CAT_ID " + std::to_string(gp.NORAD_CAT_ID) + ": " + sqlite3_errmsg(_connection)
+                );
+            }
+            sqlite3_reset(statement.get());
+            ++nWritten;
+
+            if (nWritten % _batchSize == 0) {
+                execute("COMMIT; BEGIN;");
+                if (progress) { progress(nWritten, nRecords); }
+            }
+        }
+        execute("COMMIT;");
+    }
+    catch (...) {
+        sqlite3_exec(_connection, "ROLLBACK;", nullptr, nullptr, nullptr);
+        throw;
+    }
+
+    if (progress && nWritten % _batchSize != 0) { progress(nWritten, nRecords); }
+    return nWritten;
+}
+
+template <class Records_T, class Convert_T>
+std::size_t SnapshotIngestor::stage_and_swap(const Records_T& records, Convert_T&& convert, const ProgressCallback& progress)
+{
+    // Copy the live schema, as created by sqlite_orm, onto the staging table
+    const std::vector<std::string> tables = get_schema(_connection, "table", LIVE_TABLE);
+    std::vector<std::string> dependents   = get_schema(_connection, "index", LIVE_TABLE);
+    for (std::string& trigger : get_schema(_connection, "trigger", LIVE_TABLE)) {
+        dependents.push_back(std::move(trigger));
+    }
+    if (tables.empty()) { throw std::runtime_error("Snapshot database has no " + LIVE_TABLE + " table."); }
+
+    std::string stagingSchema      = tables.front();
+    const std::size_t namePosition = stagingSchema.find(LIVE_TABLE);
+    stagingSchema.replace(namePosition, LIVE_TABLE.size(), STAGING_TABLE);
+
+    execute("DROP TABLE IF EXISTS " + quote(STAGING_TABLE) + ";");
+    execute(stagingSchema + ";");
+
+    std::size_t nWritten = 0;
+    try {
+        nWritten = write(STAGING_TABLE, records, std::forward<Convert_T>(convert), progress);
+    }
+    catch (...) {
+        sqlite3_exec(_connection, ("DROP TABLE IF EXISTS " + quote(STAGING_TABLE) + ";").c_str(), nullptr, nullptr, nullptr);
+        throw;
+    }
+
+    // Swap atomically, then restore the indices and triggers dropped with the old table. The name search only follows
+    // row changes, so it is rebuilt from the new table.
+    std::string swap = "BEGIN IMMEDIATE; DROP TABLE " + quote(LIVE_TABLE) + "; ALTER TABLE " + quote(STAGING_TABLE) +
+                       " RENAME TO " + quote(LIVE_TABLE) + ";";
+    for (const std::string& dependent : dependents) {
+        swap += " " + dependent + ";";
+    }
+
+    try {
+        execute(swap);
+        rebuild_name_search(_connection);
+        execute("COMMIT;");
+    }
+    catch (...) {
+        sqlite3_exec(_connection, "ROLLBACK;", nullptr, nullptr, nullptr);
+        throw;
+    }
+    return nWritten;
+}
+
+template <class Write_T>
+std::size_t SnapshotIngestor::stream(std::istream& response, const std::size_t& queueCapacity, Write_T&& write_records)
+{
+    BoundedQueue<GeneralPerturbations> queue(queueCapacity);
+
+    // Parse failures reach the writer through the queue, and the writer closing the queue stops the parser
+    std::jthread parser([&]() {
+        try {
+            parse_records(response, [&](nlohmann::json&& record) { return queue.push(GeneralPerturbations(record)); });
+            queue.close();
+        }
+        catch (...) {
+            queue.close(std::current_exception());
+        }
+    });
+
+    try {
+        return write_records(QueueRange(queue));
+    }
+    catch (...) {
+        queue.close();
+        throw;
+    }
+}
+
+} // namespace snapshot
+} // namespace astrea
@@ -0,0 +1,216 @@
+/**
+ * @file SnapshotIngestor.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief Bulk catalog ingest for the snapshot database
+ * @version 0.1
+ * @date 2025-08-03
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <span>
+#include <string>
+
+#include <sqlite3.h>
+
+#include <nlohmann/json.hpp>
+
+#include <astro/state/orbital_data_formats/instances/GeneralPerturbations.hpp>
+
+namespace astrea {
+namespace snapshot {
+
+/**
+ * @brief Class for loading full General Perturbations catalogs into the snapshot database.
+ *
+ * Records are written through a single prepared statement inside batched transactions, rather than one implicit
+ * transaction per row. The connection runs in WAL mode so readers are not blocked while a catalog loads. The
+ * GeneralPerturbations table must already exist, as created by sync_snapshot().
+ */
+class SnapshotIngestor {
+  public:
+    /**
+     * @brief Callback invoked after each committed batch with the number of records written and the total, or zero
+     * if the total is not known.
+     */
+    using ProgressCallback = std::function<void(const std::size_t&, const std::size_t&)>;
+
+    /**
+     * @brief Default number of records per transaction.
+     */
+    static constexpr std::size_t DEFAULT_BATCH_SIZE = 5'000;
+
+    /**
+     * @brief Default number of parsed records waiting to be written when streaming a response.
+     */
+    static constexpr std::size_t DEFAULT_QUEUE_CAPACITY = 1'024;
+
+    /**
+     * @brief Opens a connection to the snapshot database for ingest.
+     *
+     * @param path The path to the database file.
+     * @param batchSize The number of records written per transaction.
+     * @throws std::runtime_error If the database cannot be opened, the batch size is zero, or the GeneralPerturbations
+     * table does not exist.
+     */
+    SnapshotIngestor(const std::string& path, const std::size_t& batchSize = DEFAULT_BATCH_SIZE);
+
+    /**
+     * @brief Closes the connection to the database.
+     */
+    ~SnapshotIngestor();
+
+    SnapshotIngestor(const SnapshotIngestor&)            = delete;
+    SnapshotIngestor& operator=(const SnapshotIngestor&) = delete;
+
+    /**
+     * @brief Inserts records, or updates the existing record with the same NORAD ID.
+     *
+     * Batches are committed as they fill, so a failure part way through leaves earlier batches in place.
+     *
+     * @param records A JSON array of Space-Track GP records.
+     * @param progress Optional callback invoked after each committed batch.
+     * @return std::size_t The number of records written.
+     * @throws std::runtime_error If a record cannot be written.
+     */
+    std::size_t upsert(const nlohmann::json& records, const ProgressCallback& progress = nullptr);
+
+    /**
+     * @brief Inserts records, or updates the existing record with the same NORAD ID.
+     *
+     * @param records The records to write.
+     * @param progress Optional callback invoked after each committed batch.
+     * @return std::size_t The number of records written.
+     * @throws std::runtime_error If a record cannot be written.
+     */
+    std::size_t upsert(std::span<const astro::GeneralPerturbations> records, const ProgressCallback& progress = nullptr);
+
+    /**
+     * @brief Inserts records streamed from a JSON response, or updates the existing record with the same NORAD ID.
+     *
+     * The response is parsed one record at a time on a separate thread, and parsed records are handed to the writer
+     * through a bounded queue. Memory is bounded by the queue capacity instead of growing with the response, and
+     * parsing overlaps with writing. The number of records is not known in advance, so the total passed to the
+     * progress callback is zero.
+     *
+     * @param response A stream of a JSON array of Space-Track GP records, such as a file or a download in progress.
+     * @param progress Optional callback invoked after each committed batch.
+     * @param queueCapacity The maximum number of parsed records waiting to be written.
+     * @return std::size_t The number of records written.
+     * @throws std::runtime_error If the response cannot be parsed or a record cannot be written.
+     */
+    std::size_t upsert(
+        std::istream& response,
+        const ProgressCallback& progress  = nullptr,
+        const std::size_t& queueCapacity = DEFAULT_QUEUE_CAPACITY
+    );
+
+    /**
+     * @brief Replaces the whole catalog with the given records.
+     *
+     * Records are loaded into a staging table with the same schema, which is swapped in for the live table in a
+     * single transaction once loading finishes. Readers see either the old catalog or the new one, and a failure while
+     * loading leaves the live table untouched.
+     *
+     * @param records A JSON array of Space-Track GP records.
+     * @param progress Optional callback invoked after each committed batch.
+     * @return std::size_t The number of records written.
+     * @throws std::runtime_error If a record cannot be written or the tables cannot be swapped.
+     */
+    std::size_t replace(const nlohmann::json& records, const ProgressCallback& progress = nullptr);
+
+    /**
+     * @brief Replaces the whole catalog with the given records.
+     *
+     * @param records The records to write.
+     * @param progress Optional callback invoked after each committed batch.
+     * @return std::size_t The number of records written.
+     * @throws std::runtime_error If a record cannot be written or the tables cannot be swapped.
+     */
+    std::size_t replace(std::span<const astro::GeneralPerturbations> records, const ProgressCallback& progress = nullptr);
+
+    /**
+     * @brief Replaces the whole catalog with records streamed from a JSON response.
+     *
+     * Parses and writes as upsert() does for streams. The live table is only swapped once the whole response has
+     * been read, so a failed download or parse leaves it untouched.
+     *
+     * @param response A stream of a JSON array of Space-Track GP records, such as a file or a download in progress.
+     * @param progress Optional callback invoked after each committed batch.
+     * @param queueCapacity The maximum number of parsed records waiting to be written.
+     * @return std::size_t The number of records written.
+     * @throws std::runtime_error If the response cannot be parsed, a record cannot be written, or the tables cannot be
+     * swapped.
+     */
+    std::size_t replace(
+        std::istream& response,
+        const ProgressCallback& progress  = nullptr,
+        const std::size_t& queueCapacity = DEFAULT_QUEUE_CAPACITY
+    );
+
+    /**
+     * @brief Get the number of records written per transaction.
+     *
+     * @return std::size_t The batch size.
+     */
+    std::size_t get_batch_size() const { return _batchSize; }
+
+  private:
+    sqlite3* _connection = nullptr; //!< Connection to the snapshot database
+    std::size_t _batchSize;         //!< Number of records written per transaction
+
+    /**
+     * @brief Executes one or more SQL statements that return no rows.
+     *
+     * @param sql The SQL to execute.
+     * @throws std::runtime_error If execution fails.
+     */
+    void execute(const std::string& sql);
+
+    /**
+     * @brief Writes records into a table through a prepared upsert in batched transactions.
+     *
+     * @tparam Records_T The type of the record range.
+     * @tparam Convert_T The type of the function converting a range element to a GeneralPerturbations.
+     * @param table The table to write to.
+     * @param records The records to write.
+     * @param convert Function converting a range element to a GeneralPerturbations.
+     * @param progress Optional callback invoked after each committed batch.
+     * @return std::size_t The number of records written.
+     */
+    template <class Records_T, class Convert_T>
+    std::size_t write(const std::string& table, const Records_T& records, Convert_T&& convert, const ProgressCallback& progress);
+
+    /**
+     * @brief Loads records into a staging table and swaps it in for the live table.
+     *
+     * @tparam Records_T The type of the record range.
+     * @tparam Convert_T The type of the function converting a range element to a GeneralPerturbations.
+     * @param records The records to write.
+     * @param convert Function converting a range element to a GeneralPerturbations.
+     * @param progress Optional callback invoked after each committed batch.
+     * @return std::size_t The number of records written.
+     */
+    template <class Records_T, class Convert_T>
+    std::size_t stage_and_swap(const Records_T& records, Convert_T&& convert, const ProgressCallback& progress);
+
+    /**
+     * @brief Parses a response on a separate thread, passing the records to a writer through a bounded queue.
+     *
+     * @tparam Write_T The type of the function writing a range of records.
+     * @param response The stream to parse.
+     * @param queueCapacity The maximum number of parsed records waiting to be written.
+     * @param write_records Function writing a range of records, returning the number written.
+     * @return std::size_t The number of records written.
+     */
+    template <class Write_T>
+    std::size_t stream(std::istream& response, const std::size_t& queueCapacity, Write_T&& write_records);
+};
+
+} // namespace snapshot
+} // namespace astrea
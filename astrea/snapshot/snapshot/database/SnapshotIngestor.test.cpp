@@ -0,0 +1,300 @@
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+#include <sqlite3.h>
+
+#include <snapshot/database/Database.hpp>
+#include <snapshot/database/Schema.hpp>
+#include <snapshot/database/SnapshotIngestor.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace snapshot;
+
+class SnapshotIngestorTest : public testing::Test {
+  public:
+    SnapshotIngestorTest() = default;
+
+    void SetUp() override
+    {
+        path = (std::filesystem::temp_directory_path() / "astrea_snapshot_ingestor_test.db").string();
+        remove_database();
+
+        auto storage = get_snapshot(path);
+        sync_snapshot(storage);
+
+        ASSERT_EQ(sqlite3_open(path.c_str(), &connection), SQLITE_OK);
+
+        std::ifstream fixture(std::string(std::getenv("ASTREA_ROOT")) + "/data/snapshot/gp_catalog_sample.json");
+        sample = nlohmann::json::parse(fixture).at(0);
+    }
+
+    void TearDown() override
+    {
+        sqlite3_close(connection);
+        remove_database();
+    }
+
+    void remove_database()
+    {
+        for (const std::string suffix : { "", "-wal", "-shm" }) {
+            std::filesystem::remove(path + suffix);
+        }
+    }
+
+    static GeneralPerturbations make_record(const unsigned& noradId, const unsigned& gpId, const std::string& name)
+    {
+        GeneralPerturbations gp;
+        gp.NORAD_CAT_ID = noradId;
+        gp.GP_ID        = gpId;
+        gp.OBJECT_NAME  = name;
+        gp.EPOCH        = "2025-07-31T00:00:00.000000";
+        gp.MEAN_MOTION  = 15.0;
+        gp.INCLINATION  = 53.0;
+        return gp;
+    }
+
+    // A catalog of objects with NORAD IDs and GP IDs counting up from the given values
+    static std::vector<GeneralPerturbations>
+        make_catalog(const std::size_t& size, const unsigned& firstNoradId, const unsigned& firstGpId, const std::string& prefix)
+    {
+        std::vector<GeneralPerturbations> catalog;
+        for (unsigned ii = 0; ii < size; ++ii) {
+            catalog.push_back(make_record(firstNoradId + ii, firstGpId + ii, prefix + "-" + std::to_string(ii)));
+        }
+        return catalog;
+    }
+
+    // A recorded Space-Track record, relabelled as another object
+    nlohmann::json make_json(const unsigned& noradId, const unsigned& gpId, const std::string& name) const
+    {
+        nlohmann::json record  = sample;
+        record["NORAD_CAT_ID"] = std::to_string(noradId);
+        record["GP_ID"]        = std::to_string(gpId);
+        record["OBJECT_NAME"]  = name;
+        return record;
+    }
+
+    std::string query_text(const std::string& sql) const
+    {
+        sqlite3_stmt* statement = nullptr;
+        EXPECT_EQ(sqlite3_prepare_v2(connection, sql.c_str(), -1, &statement, nullptr), SQLITE_OK) << sql;
+
+        std::string result;
+        if (sqlite3_step(statement) == SQLITE_ROW && sqlite3_column_type(statement, 0) != SQLITE_NULL) {
+            result = reinterpret_cast<const char*>(sqlite3_column_text(statement, 0));
+        }
+        sqlite3_finalize(statement);
+        return result;
+    }
+
+    long long query_int(const std::string& sql) const { return std::stoll(query_text(sql)); }
+
+    long long count_rows() const { return query_int("SELECT count(*) FROM GeneralPerturbations;"); }
+
+    // Every index and trigger declared on the live table, along with the SQL that creates it
+    std::vector<std::string> get_dependents() const
+    {
+        sqlite3_stmt* statement = nullptr;
+        EXPECT_EQ(
+            sqlite3_prepare_v2(
+                connection,
+                "SELECT type || ' ' || name || ': ' || sql FROM sqlite_master WHERE tbl_name = 'GeneralPerturbations' "
+                "AND type IN ('index', 'trigger') AND sql IS NOT NULL ORDER BY type, name;",
+                -1,
+                &statement,
+                nullptr
+            ),
+            SQLITE_OK
+        );
+
+        std::vector<std::string> dependents;
+        while (sqlite3_step(statement) == SQLITE_ROW) {
+            dependents.emplace_back(reinterpret_cast<const char*>(sqlite3_column_text(statement, 0)));
+        }
+        sqlite3_finalize(statement);
+        return dependents;
+    }
+
+    bool has_staging_table() const
+    {
+        return query_int("SELECT count(*) FROM sqlite_master WHERE name = 'GeneralPerturbations_staging';") != 0;
+    }
+
+    std::string path;
+    sqlite3* connection = nullptr;
+    nlohmann::json sample;
+};
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST_F(SnapshotIngestorTest, Constructor)
+{
+    ASSERT_NO_THROW(SnapshotIngestor ingestor(path));
+    ASSERT_EQ(SnapshotIngestor(path, 10).get_batch_size(), 10);
+    ASSERT_ANY_THROW(SnapshotIngestor ingestor(path, 0));
+
+    // Databases without the GeneralPerturbations table are refused
+    const std::string emptyPath = (std::filesystem::temp_directory_path() / "astrea_snapshot_ingestor_empty.db").string();
+    std::filesystem::remove(emptyPath);
+    ASSERT_ANY_THROW(SnapshotIngestor ingestor(emptyPath));
+    std::filesystem::remove(emptyPath);
+}
+
+TEST_F(SnapshotIngestorTest, UpsertUpdatesExistingRecord)
+{
+    SnapshotIngestor ingestor(path);
+    ASSERT_EQ(ingestor.upsert(make_catalog(3, 100, 1'000, "STARLINK")), 3);
+    const long long dbId = query_int("SELECT DB_ID FROM GeneralPerturbations WHERE NORAD_CAT_ID = 101;");
+
+    // A newer element set for an existing object, alongside a new object
+    const std::vector<GeneralPerturbations> update{ make_record(101, 2'000, "RENAMED"), make_record(200, 2'001, "ONEWEB-1") };
+    ASSERT_EQ(ingestor.upsert(update), 2);
+
+    ASSERT_EQ(count_rows(), 4);
+    ASSERT_EQ(query_int("SELECT count(*) FROM GeneralPerturbations WHERE NORAD_CAT_ID = 101;"), 1);
+    ASSERT_EQ(query_int("SELECT GP_ID FROM GeneralPerturbations WHERE NORAD_CAT_ID = 101;"), 2'000);
+    ASSERT_EQ(query_text("SELECT OBJECT_NAME FROM GeneralPerturbations WHERE NORAD_CAT_ID = 101;"), "RENAMED");
+
+    // The row is updated in place rather than deleted and reinserted
+    ASSERT_EQ(query_int("SELECT DB_ID FROM GeneralPerturbations WHERE NORAD_CAT_ID = 101;"), dbId);
+
+    // Untouched records keep their values
+    ASSERT_EQ(query_int("SELECT GP_ID FROM GeneralPerturbations WHERE NORAD_CAT_ID = 100;"), 1'000);
+
+    // The name search follows the update
+    ASSERT_EQ(find_sats_by_name(connection, "%RENAMED%").size(), 1);
+    ASSERT_TRUE(find_sats_by_name(connection, "STARLINK-1").empty());
+}
+
+TEST_F(SnapshotIngestorTest, UpsertFromJson)
+{
+    const nlohmann::json records = nlohmann::json::array({ make_json(25544, 1, "ISS (ZARYA)"), make_json(25544, 2, "ISS") });
+
+    // Later records of the same object replace earlier ones, even within a batch
+    ASSERT_EQ(SnapshotIngestor(path).upsert(records), 2);
+    ASSERT_EQ(count_rows(), 1);
+    ASSERT_EQ(query_int("SELECT GP_ID FROM GeneralPerturbations WHERE NORAD_CAT_ID = 25544;"), 2);
+    ASSERT_EQ(query_text("SELECT OBJECT_NAME FROM GeneralPerturbations WHERE NORAD_CAT_ID = 25544;"), "ISS");
+
+    // Streamed responses are upserted the same way
+    std::stringstream response(nlohmann::json::array({ make_json(25544, 3, "ISS"), make_json(48274, 4, "CSS (TIANHE)") }).dump());
+    ASSERT_EQ(SnapshotIngestor(path).upsert(response), 2);
+    ASSERT_EQ(count_rows(), 2);
+    ASSERT_EQ(query_int("SELECT GP_ID FROM GeneralPerturbations WHERE NORAD_CAT_ID = 25544;"), 3);
+}
+
+TEST_F(SnapshotIngestorTest, BatchesSpanCommitBoundary)
+{
+    SnapshotIngestor ingestor(path, 4);
+
+    std::vector<std::pair<std::size_t, std::size_t>> progress;
+    const auto record_progress = [&](const std::size_t& nWritten, const std::size_t& nRecords) {
+        progress.emplace_back(nWritten, nRecords);
+    };
+
+    // Ten records over batches of four commit twice, then commit the partial batch at the end
+    ASSERT_EQ(ingestor.upsert(make_catalog(10, 100, 1'000, "STARLINK"), record_progress), 10);
+    ASSERT_EQ(count_rows(), 10);
+    ASSERT_EQ(progress, (std::vector<std::pair<std::size_t, std::size_t>>{ { 4, 10 }, { 8, 10 }, { 10, 10 } }));
+
+    // Records that fill the last batch exactly report it once
+    progress.clear();
+    ASSERT_EQ(ingestor.upsert(make_catalog(8, 200, 2'000, "ONEWEB"), record_progress), 8);
+    ASSERT_EQ(count_rows(), 18);
+    ASSERT_EQ(progress, (std::vector<std::pair<std::size_t, std::size_t>>{ { 4, 8 }, { 8, 8 } }));
+
+    // A failure after a commit keeps the committed batch and rolls back the open one. The seventh record reuses a
+    // GP_ID, which violates its unique constraint.
+    std::vector<GeneralPerturbations> failing = make_catalog(10, 300, 3'000, "COSMOS");
+    failing[6].GP_ID                          = 1'000;
+    ASSERT_ANY_THROW(ingestor.upsert(failing));
+    ASSERT_EQ(count_rows(), 22);
+    ASSERT_EQ(query_int("SELECT count(*) FROM GeneralPerturbations WHERE NORAD_CAT_ID BETWEEN 300 AND 303;"), 4);
+    ASSERT_EQ(query_int("SELECT count(*) FROM GeneralPerturbations WHERE NORAD_CAT_ID BETWEEN 304 AND 309;"), 0);
+
+    // The connection is left usable
+    ASSERT_EQ(ingestor.upsert(make_catalog(1, 400, 4'000, "IRIDIUM")), 1);
+    ASSERT_EQ(count_rows(), 23);
+}
+
+TEST_F(SnapshotIngestorTest, ReplaceKeepsIndicesTriggersAndNameSearch)
+{
+    SnapshotIngestor ingestor(path, 4);
+    ingestor.upsert(make_catalog(10, 100, 1'000, "STARLINK"));
+
+    const std::vector<std::string> dependents = get_dependents();
+    ASSERT_FALSE(dependents.empty());
+
+    ASSERT_EQ(ingestor.replace(make_catalog(6, 200, 2'000, "ONEWEB")), 6);
+    ASSERT_EQ(count_rows(), 6);
+    ASSERT_EQ(query_int("SELECT count(*) FROM GeneralPerturbations WHERE NORAD_CAT_ID < 200;"), 0);
+    ASSERT_FALSE(has_staging_table());
+
+    // The indices and triggers are recreated on the new table exactly as they were
+    ASSERT_EQ(get_dependents(), dependents);
+    ASSERT_EQ(query_int("SELECT count(*) FROM sqlite_master WHERE name = '" + NAME_SEARCH_TABLE + "';"), 1);
+
+    // The name search is rebuilt from the new rows
+    ASSERT_TRUE(find_sats_by_name(connection, "STARLINK%").empty());
+    ASSERT_EQ(find_sats_by_name(connection, "%ONEWEB%").size(), 6);
+
+    // The recreated triggers keep the name search in step with later upserts
+    ingestor.upsert(std::vector<GeneralPerturbations>{ make_record(200, 3'000, "RENAMED") });
+    ASSERT_EQ(find_sats_by_name(connection, "%RENAMED%").size(), 1);
+    ASSERT_EQ(find_sats_by_name(connection, "%ONEWEB%").size(), 5);
+
+    // The declared indices are live on the new table
+    ASSERT_EQ(query_int("SELECT count(*) FROM pragma_index_list('GeneralPerturbations') WHERE name = 'GeneralPerturbations_epoch';"), 1);
+}
+
+TEST_F(SnapshotIngestorTest, FailedReplaceLeavesLiveTable)
+{
+    SnapshotIngestor ingestor(path, 4);
+    ingestor.upsert(make_catalog(10, 100, 1'000, "STARLINK"));
+    const std::vector<std::string> dependents = get_dependents();
+
+    // The failure comes after the staging table has committed a batch
+    std::vector<GeneralPerturbations> failing = make_catalog(10, 200, 2'000, "ONEWEB");
+    failing[6].GP_ID                          = failing[1].GP_ID;
+    ASSERT_ANY_THROW(ingestor.replace(failing));
+
+    ASSERT_EQ(count_rows(), 10);
+    ASSERT_EQ(query_int("SELECT count(*) FROM GeneralPerturbations WHERE NORAD_CAT_ID >= 200;"), 0);
+    ASSERT_EQ(query_text("SELECT OBJECT_NAME FROM GeneralPerturbations WHERE NORAD_CAT_ID = 105;"), "STARLINK-5");
+    ASSERT_FALSE(has_staging_table());
+    ASSERT_EQ(get_dependents(), dependents);
+    ASSERT_EQ(find_sats_by_name(connection, "STARLINK%").size(), 10);
+
+    // A response that breaks off part way leaves the live table untouched as well
+    nlohmann::json partial = nlohmann::json::array();
+    for (unsigned ii = 0; ii < 6; ++ii) {
+        partial.push_back(make_json(300 + ii, 3'000 + ii, "COSMOS-" + std::to_string(ii)));
+    }
+    std::string truncated = partial.dump();
+    truncated.pop_back();
+    truncated += R"(, {"NORAD_CAT_ID": "306", "GP_ID)";
+    std::stringstream response(truncated);
+    ASSERT_ANY_THROW(ingestor.replace(response));
+
+    ASSERT_EQ(count_rows(), 10);
+    ASSERT_EQ(query_int("SELECT count(*) FROM GeneralPerturbations WHERE NORAD_CAT_ID >= 300;"), 0);
+    ASSERT_FALSE(has_staging_table());
+    ASSERT_EQ(find_sats_by_name(connection, "STARLINK%").size(), 10);
+
+    // And the ingestor can still replace the catalog afterwards
+    ASSERT_EQ(ingestor.replace(make_catalog(3, 400, 4'000, "IRIDIUM")), 3);
+    ASSERT_EQ(count_rows(), 3);
+    ASSERT_EQ(get_dependents(), dependents);
+}
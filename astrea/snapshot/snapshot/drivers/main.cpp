@@ -1,17 +1,9 @@
-#include <algorithm>
-#include <fstream>
 #include <iostream>
-#include <sqlite3.h>
-#include <stdexcept>
+#include <istream>
 #include <string>
 
-#include <nlohmann/json.hpp>
-#include <sqlite_orm/sqlite_orm.h>
-
-#include <astro/state/orbital_data_formats/instances/GeneralPerturbations.hpp>
-#include <astro/time/Date.hpp>
-
 #include <snapshot/database/Database.hpp>
+#include <snapshot/database/SnapshotIngestor.hpp>
 #include <snapshot/http-queries/spacetrack/SpaceTrackClient.hpp>
 
 /**
@@ -19,60 +11,59 @@
  * credentials, retrieve all available General Perturbations (GP) data, and store it in a local SQLite database.
  *
  * @param argc Command line argument count
- * @param argv Command line argument vector, where argv[1] is the SpaceTrack username and argv[2] is the password
+ * @param argv Command line argument vector, where argv[1] is the SpaceTrack username and argv[2] is the password. Pass
+ * --replace as argv[3] to replace the stored catalog instead of updating it.
  * @return int Exit status code (0 for success)
  */
 int main(int argc, char** argv)
 {
     // Build connection and connect
     using namespace astrea;
-    using namespace astro;
     using namespace snapshot;
-    using namespace sqlite_orm;
+
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <username> <password> [--replace]" << std::endl;
+        return 1;
+    }
+    const bool replace = argc > 3 && std::string(argv[3]) == "--replace";
 
     // Build database
     auto snapshot = get_snapshot();
-    snapshot.sync_schema();
-
-    // Query SpaceTrack
-    SpaceTrackClient spaceTrack;
-    nlohmann::json spaceTrackData = spaceTrack.retrieve_all(argv[1], argv[2]);
-
-    // Store in DB
-    std::size_t barWidth = 50;
-    std::size_t iRecord  = 0;
-    std::size_t nRecords = spaceTrackData.size();
-    for (const auto& data : spaceTrackData) {
+    sync_snapshot(snapshot);
 
-        // Progress bar
-        if (iRecord % 10 == 0) {
-            std::cout << "\tProgress: [";
-            double progress = static_cast<double>(iRecord) / static_cast<double>(nRecords);
-            std::size_t pos = barWidth * progress;
-            for (std::size_t ii = 0; ii < barWidth; ++ii) {
-                if (ii < pos)
-                    std::cout << "=";
-                else if (ii == pos)
-                    std::cout << ">";
-                else
-                    std::cout << " ";
-            }
-            std::cout << "] " << int(progress * 100.0) << " %\r";
+    // Progress bar
+    const std::size_t barWidth = 50;
+    const auto showProgress    = [&](const std::size_t& iRecord, const std::size_t& nRecords) {
+        // Streamed responses have no known size
+        if (nRecords == 0) {
+            std::cout << "\tProgress: " << iRecord << " records\r";
             std::cout.flush();
+            return;
         }
 
-        // Build object
-        const GeneralPerturbations gp(data);
-
-        // Insert or update
-        auto all = snapshot.get_all<GeneralPerturbations>(where(c(&GeneralPerturbations::NORAD_CAT_ID) == gp.NORAD_CAT_ID));
-        if (all.size() == 0) { snapshot.insert(gp); }
-        else {
-            snapshot.update(gp);
+        std::cout << "\tProgress: [";
+        double progress = static_cast<double>(iRecord) / static_cast<double>(nRecords);
+        std::size_t pos = barWidth * progress;
+        for (std::size_t ii = 0; ii < barWidth; ++ii) {
+            if (ii < pos)
+                std::cout << "=";
+            else if (ii == pos)
+                std::cout << ">";
+            else
+                std::cout << " ";
         }
+        std::cout << "] " << int(progress * 100.0) << " %\r";
+        std::cout.flush();
+    };
 
-        ++iRecord;
-    }
+    // Query SpaceTrack, storing records in the DB as they are downloaded
+    SnapshotIngestor ingestor(get_snapshot_path());
+    SpaceTrackClient spaceTrack;
+    std::size_t nWritten = 0;
+    spaceTrack.retrieve_all(argv[1], argv[2], [&](std::istream& response) {
+        nWritten = replace ? ingestor.replace(response, showProgress) : ingestor.upsert(response, showProgress);
+    });
+    std::cout << std::endl << "\tStored " << nWritten << " records." << std::endl;
 
     return 0;
 }
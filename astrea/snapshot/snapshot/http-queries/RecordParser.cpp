@@ -0,0 +1,127 @@
+#include <snapshot/http-queries/RecordParser.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace astrea {
+namespace snapshot {
+
+namespace {
+
+using json = nlohmann::json;
+
+// Builds one record at a time from SAX events, handing each off when it closes
+class RecordHandler : public nlohmann::json_sax<json> {
+  public:
+    RecordHandler(const RecordCallback& onRecord) :
+        _onRecord(onRecord)
+    {
+    }
+
+    bool null() override { return add(nullptr); }
+    bool boolean(bool value) override { return add(value); }
+    bool number_integer(number_integer_t value) override { return add(value); }
+    bool number_unsigned(number_unsigned_t value) override { return add(value); }
+    bool number_float(number_float_t value, const string_t&) override { return add(value); }
+    bool string(string_t& value) override { return add(std::move(value)); }
+    bool binary(binary_t& value) override { return add(json::binary(std::move(value))); }
+
+    bool key(string_t& value) override
+    {
+        _key = std::move(value);
+        return true;
+    }
+
+    bool start_object(std::size_t) override
+    {
+        // A top-level object is an error response rather than a record
+        if (_depth == 0) { _errorResponse = true; }
+        if (_stack.empty()) {
+            if (_depth > 1) { throw std::runtime_error("Expected a JSON array of records."); }
+            _record = json::object();
+            _stack.push_back(&_record);
+        }
+        else {
+            _stack.push_back(add_child(json::object()));
+        }
+        ++_depth;
+        return true;
+    }
+
+    bool end_object() override
+    {
+        --_depth;
+        _stack.pop_back();
+        if (!_stack.empty()) { return true; }
+
+        if (_errorResponse) {
+            const std::string message = _record.contains("error") ? _record["error"].dump() : _record.dump();
+            throw std::runtime_error("Query returned an error instead of records: " + message);
+        }
+        ++_nRecords;
+        return _onRecord(std::move(_record));
+    }
+
+    bool start_array(std::size_t) override
+    {
+        if (!_stack.empty()) { _stack.push_back(add_child(json::array())); }
+        else if (_depth > 0) {
+            throw std::runtime_error("Expected a JSON array of records.");
+        }
+        ++_depth;
+        return true;
+    }
+
+    bool end_array() override
+    {
+        --_depth;
+        if (!_stack.empty()) { _stack.pop_back(); }
+        return true;
+    }
+
+    bool parse_error(std::size_t position, const std::string&, const nlohmann::detail::exception& error) override
+    {
+        throw std::runtime_error("Failed to parse records at byte " + std::to_string(position) + ": " + error.what());
+    }
+
+    std::size_t get_record_count() const { return _nRecords; }
+
+  private:
+    const RecordCallback& _onRecord; //!< Callback receiving each record
+    json _record;                    //!< Record being built
+    std::vector<json*> _stack;       //!< Open containers within the record
+    std::string _key;                //!< Key of the next value in an object
+    std::size_t _depth    = 0;       //!< Nesting depth, counting the top-level array
+    std::size_t _nRecords = 0;       //!< Number of records handed off
+    bool _errorResponse   = false;   //!< Whether the response is a single object rather than an array
+
+    bool add(json&& value)
+    {
+        if (_stack.empty()) { throw std::runtime_error("Expected a JSON array of records."); }
+        add_child(std::move(value));
+        return true;
+    }
+
+    json* add_child(json&& value)
+    {
+        json& parent = *_stack.back();
+        if (parent.is_object()) { return &(parent[_key] = std::move(value)); }
+        parent.push_back(std::move(value));
+        return &parent.back();
+    }
+};
+
+} // namespace
+
+
+std::size_t parse_records(std::istream& input, const RecordCallback& onRecord)
+{
+    RecordHandler handler(onRecord);
+    json::sax_parse(input, &handler);
+    return handler.get_record_count();
+}
+
+} // namespace snapshot
+} // namespace astrea
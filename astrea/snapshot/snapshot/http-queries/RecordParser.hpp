@@ -0,0 +1,43 @@
+/**
+ * @file RecordParser.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief Streaming parser for JSON arrays of records, such as SpaceTrack query responses
+ * @version 0.1
+ * @date 2025-08-03
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <istream>
+
+#include <nlohmann/json.hpp>
+
+namespace astrea {
+namespace snapshot {
+
+/**
+ * @brief Callback invoked with each record as it is parsed. Returning false stops parsing.
+ */
+using RecordCallback = std::function<bool(nlohmann::json&& record)>;
+
+/**
+ * @brief Parses a JSON array of objects from a stream one record at a time.
+ *
+ * The stream is read with a SAX parser and only the record being parsed is held in memory, so the memory used does
+ * not grow with the size of the response. Each object in the top-level array is handed to the callback once its
+ * closing brace is read.
+ *
+ * @param input The stream to read, e.g. a file or a download in progress.
+ * @param onRecord Callback invoked with each record. Returning false stops parsing.
+ * @return std::size_t The number of records handed to the callback.
+ * @throws std::runtime_error If the JSON is malformed, is not an array of objects, or is an error response of the form
+ * {"error": "..."}.
+ */
+std::size_t parse_records(std::istream& input, const RecordCallback& onRecord);
+
+} // namespace snapshot
+} // namespace astrea
@@ -0,0 +1,91 @@
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <snapshot/http-queries/RecordParser.hpp>
+
+using namespace astrea;
+using namespace snapshot;
+
+class RecordParserTest : public testing::Test {
+  public:
+    RecordParserTest() = default;
+
+    std::vector<nlohmann::json> parse(const std::string& text)
+    {
+        std::istringstream input(text);
+        std::vector<nlohmann::json> records;
+        parse_records(input, [&](nlohmann::json&& record) {
+            records.push_back(std::move(record));
+            return true;
+        });
+        return records;
+    }
+};
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST_F(RecordParserTest, MatchesDomParse)
+{
+    const std::string path = std::string(std::getenv("ASTREA_ROOT")) + "/data/snapshot/gp_catalog_sample.json";
+    std::ifstream fixture(path);
+    const nlohmann::json expected = nlohmann::json::parse(fixture);
+
+    std::ifstream input(path);
+    std::vector<nlohmann::json> records;
+    const std::size_t nRecords = parse_records(input, [&](nlohmann::json&& record) {
+        records.push_back(std::move(record));
+        return true;
+    });
+
+    ASSERT_EQ(nRecords, expected.size());
+    ASSERT_EQ(records.size(), expected.size());
+    for (std::size_t ii = 0; ii < records.size(); ++ii) {
+        ASSERT_EQ(records[ii], expected[ii]);
+    }
+}
+
+TEST_F(RecordParserTest, NestedValues)
+{
+    const std::vector<nlohmann::json> records = parse(R"([{"a": 1, "b": {"c": [1, 2.5, {"d": null}]}, "e": [[true]]}, {}])");
+    ASSERT_EQ(records.size(), 2);
+    ASSERT_EQ(records[0], nlohmann::json::parse(R"({"a": 1, "b": {"c": [1, 2.5, {"d": null}]}, "e": [[true]]})"));
+    ASSERT_TRUE(records[1].is_object());
+    ASSERT_TRUE(records[1].empty());
+
+    ASSERT_TRUE(parse("[]").empty());
+}
+
+TEST_F(RecordParserTest, StopEarly)
+{
+    std::istringstream input(R"([{"a": 1}, {"a": 2}, {"a": 3}])");
+    std::size_t nCalls = 0;
+    const std::size_t nRecords = parse_records(input, [&](nlohmann::json&&) { return ++nCalls < 2; });
+    ASSERT_EQ(nCalls, 2);
+    ASSERT_EQ(nRecords, 2);
+}
+
+TEST_F(RecordParserTest, InvalidResponses)
+{
+    // Space-Track reports errors as a single object
+    ASSERT_ANY_THROW(parse(R"({"error": "You've violated your query rate limit."})"));
+
+    // Not an array of objects
+    ASSERT_ANY_THROW(parse("[1, 2]"));
+    ASSERT_ANY_THROW(parse("[[{}]]"));
+    ASSERT_ANY_THROW(parse("\"records\""));
+
+    // Malformed or truncated
+    ASSERT_ANY_THROW(parse(""));
+    ASSERT_ANY_THROW(parse(R"([{"a": 1}, {"a": )"));
+    ASSERT_ANY_THROW(parse(R"([{"a": 1})"));
+}
@@ -1,18 +1,56 @@
 #include <snapshot/http-queries/spacetrack/SpaceTrackClient.hpp>
 
 #include <chrono>
+#include <exception>
 #include <iostream>
+#include <optional>
 #include <set>
 #include <stdexcept>
+#include <streambuf>
+#include <thread>
 
 #include <date/date.h> // NOTE: This is standard in std::chrono as of GNU 13.2
 #include <nlohmann/json.hpp>
 
+#include <snapshot/types/BoundedQueue.hpp>
 #include <utilities/string_util.hpp>
 
 namespace astrea {
 namespace snapshot {
 
+namespace {
+
+// Chunks of a download in flight. curl delivers at most 16 kB per chunk, so this holds about 1 MB.
+constexpr std::size_t CHUNK_QUEUE_CAPACITY = 64;
+
+// Stream buffer reading the chunks of a download in progress from a queue
+class ChunkStreamBuffer : public std::streambuf {
+  public:
+    ChunkStreamBuffer(BoundedQueue<std::string>& chunks) :
+        _chunks(chunks)
+    {
+    }
+
+  protected:
+    int_type underflow() override
+    {
+        while (gptr() == egptr()) {
+            std::optional<std::string> chunk = _chunks.pop();
+            if (!chunk) { return traits_type::eof(); }
+            _chunk = std::move(*chunk);
+            setg(_chunk.data(), _chunk.data(), _chunk.data() + _chunk.size());
+        }
+        return traits_type::to_int_type(*gptr());
+    }
+
+  private:
+    BoundedQueue<std::string>& _chunks; //!< Chunks from the download thread
+    std::string _chunk;                 //!< Chunk being read
+};
+
+} // namespace
+
+
 void SpaceTrackClient::login(const std::string& username, const std::string& password)
 {
     cpr::Payload loginParams    = { { "identity", username }, { "password", password } };
@@ -33,12 +71,66 @@ nlohmann::json SpaceTrackClient::query(
     return query_impl(username, password, queryUrl);
 }
 
+nlohmann::json SpaceTrackClient::query_paged(
+    const std::string& username,
+    const std::string& password,
+    const SpaceTrackClient::RequestClass& requestClass,
+    const std::vector<std::pair<std::string, std::string>> predicates,
+    const std::size_t& pageSize
+)
+{
+    if (pageSize == 0) { throw std::runtime_error("SpaceTrack page size must be at least one record."); }
+
+    nlohmann::json records = nlohmann::json::array();
+    for (std::size_t offset = 0;; offset += pageSize) {
+        std::vector<std::pair<std::string, std::string>> pagePredicates = predicates;
+        pagePredicates.emplace_back("limit", std::to_string(pageSize) + "," + std::to_string(offset));
+
+        const cpr::Url pageUrl = build_query_url(Controller::BASIC_SPACE_DATA, Action::QUERY, requestClass, pagePredicates);
+        nlohmann::json page    = query_impl(username, password, pageUrl);
+        const std::size_t nRecords = page.size();
+        for (auto& record : page) {
+            records.push_back(std::move(record));
+        }
+        if (nRecords < pageSize) { break; }
+    }
+    return records;
+}
+
+void SpaceTrackClient::query_stream(
+    const std::string& username,
+    const std::string& password,
+    const SpaceTrackClient::RequestClass& requestClass,
+    const std::vector<std::pair<std::string, std::string>> predicates,
+    const ResponseConsumer& consume
+)
+{
+    cpr::Url queryUrl = build_query_url(Controller::BASIC_SPACE_DATA, Action::QUERY, requestClass, predicates);
+    stream_impl(username, password, queryUrl, consume);
+}
+
 nlohmann::json SpaceTrackClient::retrieve_all(const std::string& username, const std::string& password)
 {
-    cpr::Url queryUrl = "https://www.space-track.org/"
-                        "basicspacedata/query/class/gp/object_type/payload/decay_date/null-val/epoch/%3Enow-30/orderby/"
-                        "norad_cat_id/format/json";
-    return query_impl(username, password, queryUrl);
+    return query_impl(username, password, build_retrieve_all_url());
+}
+
+void SpaceTrackClient::retrieve_all(const std::string& username, const std::string& password, const ResponseConsumer& consume)
+{
+    stream_impl(username, password, build_retrieve_all_url(), consume);
+}
+
+cpr::Url SpaceTrackClient::build_retrieve_all_url() const
+{
+    return build_query_url(
+        Controller::BASIC_SPACE_DATA,
+        Action::QUERY,
+        SpaceDataClass::GP,
+        { { "object_type", "payload" },
+          { "decay_date", "null-val" },
+          { "epoch", "%3Enow-30" },
+          { "orderby", "norad_cat_id" },
+          { "format", "json" } }
+    );
 }
 
 std::string SpaceTrackClient::controller_to_string(const Controller& controller) const
@@ -151,14 +243,12 @@ void SpaceTrackClient::check_query_history(const std::string& username) const
     // Query limits - https://www.space-track.org/documentation#api
     static const std::size_t MAX_QUERIES_PER_MINUTE = 30;
     static const std::size_t MAX_QUERIES_PER_HOUR   = 300;
-    static const std::filesystem::path QUERY_HISTORY_FILE =
-        "./astrea/snapshot/snapshot/database/spacetrack.query-history.json";
-    static const std::string TIMESTAMP_FORMAT = "%Y-%m-%d %H:%M:%S";
+    static const std::string TIMESTAMP_FORMAT       = "%Y-%m-%d %H:%M:%S";
 
     // Ingest query history
     nlohmann::json queryHistory;
-    if (std::filesystem::exists(QUERY_HISTORY_FILE)) {
-        std::ifstream queryHistroyStream(QUERY_HISTORY_FILE);
+    if (std::filesystem::exists(_queryHistoryFile)) {
+        std::ifstream queryHistroyStream(_queryHistoryFile);
         queryHistory = nlohmann::json::parse(queryHistroyStream);
     }
 
@@ -215,7 +305,7 @@ void SpaceTrackClient::check_query_history(const std::string& username) const
     queryHistory[username].push_back(outStream.str());
 
     // Save
-    std::ofstream outFileStream(QUERY_HISTORY_FILE);
+    std::ofstream outFileStream(_queryHistoryFile);
     outFileStream << std::setw(4) << queryHistory << std::endl;
 }
 
@@ -240,6 +330,16 @@ nlohmann::json SpaceTrackClient::query_impl(const std::string& username, const s
     // Query
     cpr::Response r = cpr::Get(queryUrl, _loginCookies);
 
+    // Refused queries (rate limits, expired sessions, bad predicates) come back with an error body instead of records
+    if (r.status_code != 200) {
+        std::ostringstream errorStream;
+        errorStream << "SpaceTrack query failed with status " << r.status_code << ".\n";
+        errorStream << "    Url: " << r.url << "\n";
+        errorStream << "    Text: " << r.text << "\n";
+        errorStream << "    Error: " << r.error.message << "\n";
+        throw std::runtime_error(errorStream.str());
+    }
+
     // Extract response into json
     nlohmann::json response = nlohmann::json::parse(r.text);
 
@@ -261,5 +361,59 @@ nlohmann::json SpaceTrackClient::query_impl(const std::string& username, const s
     return response;
 }
 
+void SpaceTrackClient::stream_impl(
+    const std::string& username,
+    const std::string& password,
+    cpr::Url queryUrl,
+    const ResponseConsumer& consume
+)
+{
+    // Login
+    if (!valid_cookies()) { login(username, password); }
+
+    // Make sure we're not violating the user-agreement
+    check_query_history(username);
+
+    // Download on a separate thread. The write callback blocks while the queue is full, and returns false to abort
+    // the transfer once the queue is closed.
+    BoundedQueue<std::string> chunks(CHUNK_QUEUE_CAPACITY);
+    cpr::Response r;
+    std::jthread download([&]() {
+        try {
+            r = cpr::Get(queryUrl, _loginCookies, cpr::WriteCallback([&](const std::string_view& data, intptr_t) {
+                return chunks.push(std::string(data));
+            }));
+            chunks.close();
+        }
+        catch (...) {
+            chunks.close(std::current_exception());
+        }
+    });
+
+    ChunkStreamBuffer buffer(chunks);
+    std::istream response(&buffer);
+    std::exception_ptr consumerError;
+    try {
+        consume(response);
+    }
+    catch (...) {
+        consumerError = std::current_exception();
+    }
+
+    // Stop the download if the consumer finished early, so it is not left waiting on a full queue
+    chunks.close();
+    download.join();
+
+    // A refused query or failed transfer explains a consumer failure better than the parse error it caused
+    if (r.status_code != 200) {
+        std::ostringstream errorStream;
+        errorStream << "SpaceTrack query failed with status " << r.status_code << ".\n";
+        errorStream << "    Url: " << r.url << "\n";
+        errorStream << "    Error: " << r.error.message << "\n";
+        throw std::runtime_error(errorStream.str());
+    }
+    if (consumerError) { std::rethrow_exception(consumerError); }
+}
+
 } // namespace snapshot
-} // namespace astrea
\ No newline at end of file
+} // namespace astrea
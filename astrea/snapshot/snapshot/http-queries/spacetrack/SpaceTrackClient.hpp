@@ -10,7 +10,10 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <filesystem>
+#include <functional>
+#include <istream>
 #include <variant>
 
 #include <cpr/cpr.h>
@@ -95,6 +98,11 @@ class SpaceTrackClient {
      */
     using RequestClass = std::variant<SpaceDataClass, PublicFilesClass>;
 
+    /**
+     * @brief Callback that reads a query response as it downloads.
+     */
+    using ResponseConsumer = std::function<void(std::istream& response)>;
+
     /**
      * @brief Default constructor for SpaceTrackClient.
      *
@@ -102,6 +110,20 @@ class SpaceTrackClient {
      */
     SpaceTrackClient() = default;
 
+    /**
+     * @brief Constructor for a SpaceTrackClient that talks to a server other than the live site.
+     *
+     * Used to point the client at a MockSpaceTrackServer for offline testing.
+     *
+     * @param base The base URL of the server, e.g. http://127.0.0.1:40123
+     * @param queryHistoryFile The file used to track recent queries against the rate limits.
+     */
+    SpaceTrackClient(const std::string& base, const std::filesystem::path& queryHistoryFile = DEFAULT_QUERY_HISTORY_FILE) :
+        _base(base),
+        _queryHistoryFile(queryHistoryFile)
+    {
+    }
+
     /**
      * @brief Default destructor for SpaceTrackClient.
      *
@@ -143,6 +165,51 @@ class SpaceTrackClient {
         const std::vector<std::pair<std::string, std::string>> predicates = {}
     );
 
+    /**
+     * @brief Queries the SpaceTrack API for data one page at a time.
+     *
+     * Each page is requested with a limit/<pageSize>,<offset> predicate until a short page is returned, and the pages
+     * are concatenated. Every page counts against the query limits, so large page sizes are preferred. Predicates
+     * should include an orderby so that records do not move between pages.
+     *
+     * @param username The username for the SpaceTrack account.
+     * @param password The password for the SpaceTrack account.
+     * @param requestClass The class of data to request (e.g., GP, SATCAT).
+     * @param predicates Predicates to filter the query results, not including limit.
+     * @param pageSize The maximum number of records in each page.
+     * @return A JSON array containing the records of every page.
+     * @throws std::runtime_error If the page size is zero or a page fails.
+     */
+    nlohmann::json query_paged(
+        const std::string& username,
+        const std::string& password,
+        const RequestClass& requestClass,
+        const std::vector<std::pair<std::string, std::string>> predicates,
+        const std::size_t& pageSize
+    );
+
+    /**
+     * @brief Queries the SpaceTrack API, passing the response to a consumer while it downloads.
+     *
+     * The download runs on a separate thread and hands chunks of the response to the consumer through a bounded
+     * queue, so the response is never held in memory as a whole. Pair with SnapshotIngestor::upsert or replace on a
+     * stream to parse and store records as they arrive.
+     *
+     * @param username The username for the SpaceTrack account.
+     * @param password The password for the SpaceTrack account.
+     * @param requestClass The class of data to request (e.g., GP, SATCAT).
+     * @param predicates Predicates to filter the query results.
+     * @param consume Callback reading the response stream.
+     * @throws std::runtime_error If the server refuses the query or the download fails, or whatever the consumer throws.
+     */
+    void query_stream(
+        const std::string& username,
+        const std::string& password,
+        const RequestClass& requestClass,
+        const std::vector<std::pair<std::string, std::string>> predicates,
+        const ResponseConsumer& consume
+    );
+
     /**
      * @brief Retrieves all data from the SpaceTrack API.
      *
@@ -154,8 +221,22 @@ class SpaceTrackClient {
      */
     nlohmann::json retrieve_all(const std::string& username, const std::string& password);
 
+    /**
+     * @brief Retrieves all data from the SpaceTrack API, passing the response to a consumer while it downloads.
+     *
+     * @param username The username for the SpaceTrack account.
+     * @param password The password for the SpaceTrack account.
+     * @param consume Callback reading the response stream.
+     * @throws std::runtime_error If the server refuses the query or the download fails, or whatever the consumer throws.
+     */
+    void retrieve_all(const std::string& username, const std::string& password, const ResponseConsumer& consume);
+
   private:
+    static inline const std::filesystem::path DEFAULT_QUERY_HISTORY_FILE =
+        "./astrea/snapshot/snapshot/database/spacetrack.query-history.json"; //!< Default file tracking recent queries
+
     const cpr::Url _base = "https://www.space-track.org"; //!< Base URL for the SpaceTrack API
+    const std::filesystem::path _queryHistoryFile = DEFAULT_QUERY_HISTORY_FILE; //!< File tracking recent queries
 
     // Login
     const cpr::Url _loginUrl = _base + "/ajaxauth/login"; //!< URL for the login endpoint
@@ -244,8 +325,27 @@ class SpaceTrackClient {
      * @param password The password for the SpaceTrack account.
      * @param queryUrl The URL to query.
      * @return A JSON object containing the query results.
+     * @throws std::runtime_error If the server refuses the query, for example for exceeding the rate limits.
      */
     nlohmann::json query_impl(const std::string& username, const std::string& password, cpr::Url queryUrl);
+
+    /**
+     * @brief Performs a query to the SpaceTrack API, streaming the response to a consumer.
+     *
+     * @param username The username for the SpaceTrack account.
+     * @param password The password for the SpaceTrack account.
+     * @param queryUrl The URL to query.
+     * @param consume Callback reading the response stream.
+     * @throws std::runtime_error If the server refuses the query or the download fails, or whatever the consumer throws.
+     */
+    void stream_impl(const std::string& username, const std::string& password, cpr::Url queryUrl, const ResponseConsumer& consume);
+
+    /**
+     * @brief Builds the URL retrieving every payload with a recent element set.
+     *
+     * @return A cpr::Url object for the query.
+     */
+    cpr::Url build_retrieve_all_url() const;
 };
 
 } // namespace snapshot
@@ -0,0 +1,173 @@
+#include <cstdlib>
+#include <filesystem>
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cpr/cpr.h>
+#include <nlohmann/json.hpp>
+
+#include <snapshot/http-queries/RecordParser.hpp>
+#include <snapshot/http-queries/spacetrack/SpaceTrackClient.hpp>
+#include <tests/utilities/MockSpaceTrackServer.hpp>
+
+using namespace astrea;
+using namespace snapshot;
+
+using SpaceDataClass = SpaceTrackClient::SpaceDataClass;
+
+class SpaceTrackClientTest : public testing::Test {
+  public:
+    SpaceTrackClientTest() = default;
+
+    void SetUp() override
+    {
+        fixtures     = std::filesystem::path(std::getenv("ASTREA_ROOT")) / "data/snapshot/spacetrack";
+        queryHistory = std::filesystem::temp_directory_path() / "astrea_spacetrack_test.query-history.json";
+        std::filesystem::remove(queryHistory);
+    }
+
+    void TearDown() override { std::filesystem::remove(queryHistory); }
+
+    std::filesystem::path fixtures;
+    std::filesystem::path queryHistory;
+
+    const std::string username = "user@example.com";
+    const std::string password = "password";
+};
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST_F(SpaceTrackClientTest, QueryClasses)
+{
+    MockSpaceTrackServer server(fixtures);
+    SpaceTrackClient client(server.get_base_url(), queryHistory);
+
+    const auto query = [&](const SpaceDataClass& requestClass) {
+        return client.query(
+            username, password, SpaceTrackClient::Controller::BASIC_SPACE_DATA, SpaceTrackClient::Action::QUERY, requestClass
+        );
+    };
+
+    const nlohmann::json gp = query(SpaceDataClass::GP);
+    ASSERT_EQ(gp.size(), 4);
+    ASSERT_EQ(gp[0]["OBJECT_NAME"], "ISS (ZARYA)");
+    ASSERT_EQ(query(SpaceDataClass::GP_HISTORY).size(), 8);
+    ASSERT_EQ(query(SpaceDataClass::SATCAT).size(), 4);
+    ASSERT_EQ(query(SpaceDataClass::CDM_PUBLIC).size(), 3);
+    ASSERT_EQ(query(SpaceDataClass::TIP).size(), 3);
+
+    // One login serves every query
+    ASSERT_EQ(server.get_login_count(), 1);
+    ASSERT_EQ(server.get_query_count(), 5);
+
+    // Classes without a recording are refused
+    ASSERT_ANY_THROW(query(SpaceDataClass::DECAY));
+}
+
+TEST_F(SpaceTrackClientTest, Predicates)
+{
+    MockSpaceTrackServer server(fixtures);
+    SpaceTrackClient client(server.get_base_url(), queryHistory);
+
+    const auto query = [&](const SpaceDataClass& requestClass, const std::vector<std::pair<std::string, std::string>>& predicates) {
+        return client.query(
+            username, password, SpaceTrackClient::Controller::BASIC_SPACE_DATA, SpaceTrackClient::Action::QUERY, requestClass, predicates
+        );
+    };
+
+    const nlohmann::json history = query(SpaceDataClass::GP_HISTORY, { { "norad_cat_id", "25544" } });
+    ASSERT_EQ(history.size(), 2);
+    for (const auto& record : history) {
+        ASSERT_EQ(record["NORAD_CAT_ID"], "25544");
+    }
+
+    const nlohmann::json page = query(SpaceDataClass::GP, { { "limit", "2,1" } });
+    ASSERT_EQ(page.size(), 2);
+    ASSERT_EQ(page[0]["OBJECT_NAME"], "HST");
+
+    // Operators are accepted but not applied
+    ASSERT_EQ(client.retrieve_all(username, password).size(), 4);
+}
+
+TEST_F(SpaceTrackClientTest, Paging)
+{
+    MockSpaceTrackServer server(fixtures);
+    SpaceTrackClient client(server.get_base_url(), queryHistory);
+
+    const nlohmann::json history = client.query_paged(username, password, SpaceDataClass::GP_HISTORY, {}, 3);
+    ASSERT_EQ(history.size(), 8);
+    ASSERT_EQ(server.get_query_count(), 3);
+
+    // A full last page needs one more query to find the end
+    ASSERT_EQ(client.query_paged(username, password, SpaceDataClass::GP, {}, 2).size(), 4);
+    ASSERT_EQ(server.get_query_count(), 6);
+
+    ASSERT_ANY_THROW(client.query_paged(username, password, SpaceDataClass::GP, {}, 0));
+}
+
+TEST_F(SpaceTrackClientTest, RateLimits)
+{
+    // A server stricter than the client's own limits
+    MockSpaceTrackServer::Options options;
+    options.maxQueriesPerMinute = 2;
+    MockSpaceTrackServer server(fixtures, options);
+    SpaceTrackClient client(server.get_base_url(), queryHistory);
+
+    ASSERT_NO_THROW(client.retrieve_all(username, password));
+    ASSERT_NO_THROW(client.retrieve_all(username, password));
+    ASSERT_ANY_THROW(client.retrieve_all(username, password));
+    ASSERT_EQ(server.get_throttled_count(), 1);
+}
+
+TEST_F(SpaceTrackClientTest, Login)
+{
+    MockSpaceTrackServer server(fixtures);
+
+    // Queries without a session are refused
+    const cpr::Response anonymous = cpr::Get(cpr::Url{ server.get_base_url() + "/basicspacedata/query/class/gp" });
+    ASSERT_EQ(anonymous.status_code, 401);
+
+    const cpr::Response login =
+        cpr::Post(cpr::Url{ server.get_base_url() + "/ajaxauth/login" }, cpr::Payload{ { "identity", username }, { "password", password } });
+    ASSERT_EQ(login.status_code, 200);
+    ASSERT_EQ(server.get_login_count(), 1);
+
+    const cpr::Response authenticated = cpr::Get(cpr::Url{ server.get_base_url() + "/basicspacedata/query/class/gp" }, login.cookies);
+    ASSERT_EQ(authenticated.status_code, 200);
+    ASSERT_EQ(nlohmann::json::parse(authenticated.text).size(), 4);
+}
+
+TEST_F(SpaceTrackClientTest, Streaming)
+{
+    MockSpaceTrackServer server(fixtures);
+    SpaceTrackClient client(server.get_base_url(), queryHistory);
+
+    std::vector<nlohmann::json> records;
+    client.query_stream(username, password, SpaceDataClass::GP_HISTORY, { { "norad_cat_id", "25544" } }, [&](std::istream& response) {
+        parse_records(response, [&](nlohmann::json&& record) {
+            records.push_back(std::move(record));
+            return true;
+        });
+    });
+    ASSERT_EQ(records.size(), 2);
+    ASSERT_EQ(records[0]["NORAD_CAT_ID"], "25544");
+
+    // Consumers may stop reading before the download ends
+    std::size_t nRecords = 0;
+    client.retrieve_all(username, password, [&](std::istream& response) {
+        nRecords = parse_records(response, [](nlohmann::json&&) { return false; });
+    });
+    ASSERT_EQ(nRecords, 1);
+
+    // Errors from the server and from the consumer both reach the caller
+    ASSERT_ANY_THROW(client.query_stream(username, password, SpaceDataClass::DECAY, {}, [](std::istream&) {}));
+    ASSERT_ANY_THROW(client.retrieve_all(username, password, [](std::istream&) { throw std::runtime_error("Consumer failed."); }));
+}
@@ -10,6 +10,11 @@
  */
 #pragma once
 
+#include <snapshot/database/CatalogArchive.hpp>
 #include <snapshot/database/Database.hpp>
+#include <snapshot/database/Schema.hpp>
+#include <snapshot/database/SnapshotIngestor.hpp>
+#include <snapshot/http-queries/RecordParser.hpp>
 #include <snapshot/http-queries/ethz/EthzClient.hpp>
-#include <snapshot/http-queries/spacetrack/SpaceTrackClient.hpp>
\ No newline at end of file
+#include <snapshot/http-queries/spacetrack/SpaceTrackClient.hpp>
+#include <snapshot/types/BoundedQueue.hpp>
\ No newline at end of file
@@ -0,0 +1,120 @@
+/**
+ * @file BoundedQueue.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief Blocking queue with a fixed capacity for handing work between pipeline stages
+ * @version 0.1
+ * @date 2025-08-03
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+namespace astrea {
+namespace snapshot {
+
+/**
+ * @brief Blocking single-producer, single-consumer queue with a fixed capacity.
+ *
+ * The producer blocks while the queue is full, so a fast producer cannot run ahead of a slow consumer by more than
+ * the capacity. Either side can end the exchange: the producer closes the queue when it is done, or with the
+ * exception that stopped it, and the consumer closes it to tell the producer to stop.
+ *
+ * @tparam T The type of the queued items.
+ */
+template <typename T>
+class BoundedQueue {
+  public:
+    /**
+     * @brief Constructor for BoundedQueue.
+     *
+     * @param capacity The maximum number of queued items.
+     * @throws std::runtime_error If the capacity is zero.
+     */
+    BoundedQueue(const std::size_t& capacity) :
+        _capacity(capacity)
+    {
+        if (_capacity == 0) { throw std::runtime_error("Queue capacity must be greater than zero."); }
+    }
+
+    BoundedQueue(const BoundedQueue&)            = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    /**
+     * @brief Adds an item, waiting for space if the queue is full.
+     *
+     * @param item The item to add.
+     * @return true if the item was queued, false if the queue was closed and the producer should stop.
+     */
+    bool push(T item)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _notFull.wait(lock, [&]() { return _items.size() < _capacity || _closed; });
+        if (_closed) { return false; }
+        _items.push_back(std::move(item));
+        _notEmpty.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Removes the next item, waiting for one if the queue is empty.
+     *
+     * @return std::optional<T> The next item, or nullopt once the queue is closed and drained.
+     * @throws The exception the producer closed the queue with, once the items before it are drained.
+     */
+    std::optional<T> pop()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _notEmpty.wait(lock, [&]() { return !_items.empty() || _closed; });
+        if (_items.empty()) {
+            if (_error) { std::rethrow_exception(_error); }
+            return std::nullopt;
+        }
+        T item = std::move(_items.front());
+        _items.pop_front();
+        _notFull.notify_one();
+        return item;
+    }
+
+    /**
+     * @brief Closes the queue, waking both sides. Items already queued can still be popped.
+     *
+     * @param error Optional exception rethrown to the consumer after the queued items.
+     */
+    void close(std::exception_ptr error = nullptr)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _closed = true;
+        if (error && !_error) { _error = error; }
+        _notEmpty.notify_all();
+        _notFull.notify_all();
+    }
+
+    /**
+     * @brief Get the capacity of the queue.
+     *
+     * @return std::size_t The maximum number of queued items.
+     */
+    std::size_t get_capacity() const { return _capacity; }
+
+  private:
+    const std::size_t _capacity;       //!< Maximum number of queued items
+    std::deque<T> _items;              //!< Queued items
+    bool _closed = false;              //!< Whether either side has closed the queue
+    std::exception_ptr _error;         //!< Exception that stopped the producer, if any
+    std::mutex _mutex;                 //!< Guards the queue state
+    std::condition_variable _notEmpty; //!< Signalled when an item is added or the queue closes
+    std::condition_variable _notFull;  //!< Signalled when an item is removed or the queue closes
+};
+
+} // namespace snapshot
+} // namespace astrea
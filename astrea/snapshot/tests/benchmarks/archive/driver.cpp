@@ -0,0 +1,116 @@
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <snapshot/snapshot.hpp>
+#include <tests/utilities/timing.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace snapshot;
+
+
+class ArchiveBenchmark : public testing::Test {
+  public:
+    ArchiveBenchmark() {}
+
+    void SetUp() override
+    {
+        // Recorded Space-Track GP records, repeated with unique ids to the size of the full catalog
+        std::ifstream fixture(std::string(std::getenv("ASTREA_ROOT")) + "/data/snapshot/gp_catalog_sample.json");
+        const nlohmann::json sample = nlohmann::json::parse(fixture);
+
+        nlohmann::json records = nlohmann::json::array();
+        for (std::size_t ii = 0; ii < N_RECORDS; ++ii) {
+            nlohmann::json record  = sample[ii % sample.size()];
+            record["NORAD_CAT_ID"] = std::to_string(ii + 1);
+            record["GP_ID"]        = std::to_string(GP_ID_OFFSET + ii);
+            records.push_back(record);
+            catalog.emplace_back(record);
+        }
+        json = records.dump();
+
+        path        = (std::filesystem::temp_directory_path() / "astrea_archive_benchmark.db").string();
+        archivePath = std::filesystem::temp_directory_path() / "astrea_archive_benchmark.gpc";
+        remove_files();
+        auto storage = get_snapshot(path);
+        sync_snapshot(storage);
+        SnapshotIngestor(path).upsert(catalog);
+    }
+
+    void TearDown() override { remove_files(); }
+
+    void remove_files()
+    {
+        for (const std::string suffix : { "", "-wal", "-shm" }) {
+            std::filesystem::remove(path + suffix);
+        }
+        std::filesystem::remove(archivePath);
+    }
+
+    static constexpr std::size_t N_RECORDS    = 30'000;
+    static constexpr std::size_t GP_ID_OFFSET = 100'000'000;
+
+    std::vector<GeneralPerturbations> catalog;
+    std::string json;
+    std::string path;
+    std::filesystem::path archivePath;
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(ArchiveBenchmark, LoadCatalog)
+{
+    // JSON, as downloaded from Space-Track
+    std::vector<GeneralPerturbations> fromJson;
+    time_it("JSON Parse", N_RECORDS, "record", [&]() {
+        for (const auto& record : nlohmann::json::parse(json)) {
+            fromJson.emplace_back(record);
+        }
+    });
+    std::cout << "JSON Size: " << json.size() / 1.0e6 << " (MB)" << std::endl;
+
+    // The snapshot database, through the ORM
+    std::vector<GeneralPerturbations> fromDatabase;
+    auto storage = get_snapshot(path);
+    time_it("Database Read", N_RECORDS, "record", [&]() { fromDatabase = storage.get_all<GeneralPerturbations>(); });
+
+    // The columnar archive, in memory and through a file
+    std::string archive;
+    time_it("Archive Serialize", N_RECORDS, "record", [&]() { archive = serialize_catalog(fromDatabase); });
+    std::cout << "Archive Size: " << archive.size() / 1.0e6 << " (MB)" << std::endl;
+
+    std::vector<GeneralPerturbations> fromArchive;
+    time_it("Archive Deserialize", N_RECORDS, "record", [&]() { fromArchive = deserialize_catalog(archive); });
+
+    time_it("Archive Export", N_RECORDS, "record", [&]() { export_catalog(archivePath, fromDatabase); });
+    std::vector<GeneralPerturbations> fromFile;
+    time_it("Archive Import", N_RECORDS, "record", [&]() { fromFile = import_catalog(archivePath); });
+
+    // Every path produces the same catalog
+    ASSERT_EQ(fromJson.size(), N_RECORDS);
+    ASSERT_EQ(fromDatabase.size(), N_RECORDS);
+    ASSERT_EQ(fromArchive.size(), N_RECORDS);
+    ASSERT_EQ(fromFile.size(), N_RECORDS);
+    for (std::size_t ii = 0; ii < N_RECORDS; ii += 997) {
+        ASSERT_EQ(fromArchive[ii].NORAD_CAT_ID, fromJson[ii].NORAD_CAT_ID);
+        ASSERT_EQ(fromArchive[ii].GP_ID, fromJson[ii].GP_ID);
+        ASSERT_EQ(fromArchive[ii].OBJECT_NAME, fromJson[ii].OBJECT_NAME);
+        ASSERT_EQ(fromArchive[ii].TLE_LINE1, fromJson[ii].TLE_LINE1);
+        ASSERT_EQ(fromArchive[ii].SITE, fromJson[ii].SITE);
+        ASSERT_EQ(static_cast<double>(*fromArchive[ii].MEAN_MOTION), static_cast<double>(*fromJson[ii].MEAN_MOTION));
+        ASSERT_EQ(fromFile[ii].EPOCH, fromDatabase[ii].EPOCH);
+    }
+}
@@ -0,0 +1,108 @@
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <snapshot/snapshot.hpp>
+#include <tests/utilities/timing.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace snapshot;
+
+
+class IngestBenchmark : public testing::Test {
+  public:
+    IngestBenchmark() {}
+
+    void SetUp() override
+    {
+        // Recorded Space-Track GP records, repeated with unique ids to the size of the full catalog
+        std::ifstream fixture(std::string(std::getenv("ASTREA_ROOT")) + "/data/snapshot/gp_catalog_sample.json");
+        const nlohmann::json sample = nlohmann::json::parse(fixture);
+
+        catalog = nlohmann::json::array();
+        for (std::size_t ii = 0; ii < N_RECORDS; ++ii) {
+            nlohmann::json record  = sample[ii % sample.size()];
+            record["NORAD_CAT_ID"] = std::to_string(ii + 1);
+            record["GP_ID"]        = std::to_string(GP_ID_OFFSET + ii);
+            catalog.push_back(std::move(record));
+        }
+
+        path = (std::filesystem::temp_directory_path() / "astrea_ingest_benchmark.db").string();
+        remove_database();
+        auto storage = get_snapshot(path);
+        sync_snapshot(storage);
+    }
+
+    void TearDown() override { remove_database(); }
+
+    void remove_database()
+    {
+        for (const std::string suffix : { "", "-wal", "-shm" }) {
+            std::filesystem::remove(path + suffix);
+        }
+    }
+
+    static constexpr std::size_t N_RECORDS    = 30'000;
+    static constexpr std::size_t N_ORM        = 1'000; // The per-row path is too slow to run on the whole catalog
+    static constexpr std::size_t GP_ID_OFFSET = 100'000'000;
+
+    nlohmann::json catalog;
+    std::string path;
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(IngestBenchmark, FullCatalog)
+{
+    using namespace sqlite_orm;
+
+    // The ingest this replaced: a lookup and an implicit transaction per record
+    {
+        auto storage = get_snapshot(path);
+        time_it("Per-Row ORM", N_ORM, "record", [&]() {
+            for (std::size_t ii = 0; ii < N_ORM; ++ii) {
+                const GeneralPerturbations gp(catalog[ii]);
+                auto all = storage.get_all<GeneralPerturbations>(where(c(&GeneralPerturbations::NORAD_CAT_ID) == gp.NORAD_CAT_ID));
+                if (all.size() == 0) { storage.insert(gp); }
+            }
+        });
+        ASSERT_EQ(storage.count<GeneralPerturbations>(), N_ORM);
+        storage.remove_all<GeneralPerturbations>();
+    }
+
+    SnapshotIngestor ingestor(path);
+    std::size_t nWritten = 0;
+    time_it("Upsert (Insert)", N_RECORDS, "record", [&]() { nWritten = ingestor.upsert(catalog); });
+    ASSERT_EQ(nWritten, N_RECORDS);
+
+    // A refresh where every object has a new element set
+    for (auto& record : catalog) {
+        record["GP_ID"] = std::to_string(std::stoul(record["GP_ID"].get<std::string>()) + N_RECORDS);
+    }
+    time_it("Upsert (Update)", N_RECORDS, "record", [&]() { nWritten = ingestor.upsert(catalog); });
+    ASSERT_EQ(nWritten, N_RECORDS);
+
+    time_it("Staged Replace", N_RECORDS, "record", [&]() { nWritten = ingestor.replace(catalog); });
+    ASSERT_EQ(nWritten, N_RECORDS);
+
+    // The ORM still reads the table after the swap, with one row per object holding the latest element set
+    auto storage = get_snapshot(path);
+    ASSERT_EQ(storage.count<GeneralPerturbations>(), N_RECORDS);
+
+    const auto iss = storage.get_all<GeneralPerturbations>(where(c(&GeneralPerturbations::NORAD_CAT_ID) == 1u));
+    ASSERT_EQ(iss.size(), 1);
+    ASSERT_EQ(iss[0].GP_ID, GP_ID_OFFSET + N_RECORDS);
+    ASSERT_EQ(iss[0].OBJECT_NAME, catalog[0]["OBJECT_NAME"].get<std::string>());
+    ASSERT_EQ(iss[0].CLASSIFICATION_TYPE, 'U');
+}
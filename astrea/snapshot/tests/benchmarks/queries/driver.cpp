@@ -0,0 +1,151 @@
+#include <cmath>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <snapshot/snapshot.hpp>
+#include <tests/utilities/timing.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace snapshot;
+
+using mp_units::angular::unit_symbols::deg;
+using mp_units::non_si::day;
+using mp_units::si::unit_symbols::km;
+
+
+class QueryBenchmark : public testing::Test {
+  public:
+    QueryBenchmark() {}
+
+    void SetUp() override
+    {
+        path = (std::filesystem::temp_directory_path() / "astrea_query_benchmark.db").string();
+        remove_database();
+        auto storage = get_snapshot(path);
+        sync_snapshot(storage);
+
+        // Synthetic catalog spread over LEO, MEO, and GEO, with a few large families sharing a name prefix
+        const std::vector<std::string> prefixes = { "STARLINK-", "ONEWEB-", "COSMOS 2251 DEB ", "FENGYUN 1C DEB ", "IRIDIUM " };
+        std::uniform_real_distribution<double> leoMeanMotion(11.0, 16.0);
+        std::uniform_real_distribution<double> inclination(0.0, 180.0);
+        std::uniform_real_distribution<double> eccentricity(0.0, 0.05);
+        std::uniform_int_distribution<int> dayOfMonth(1, 28);
+
+        std::vector<GeneralPerturbations> catalog(N_RECORDS);
+        for (std::size_t ii = 0; ii < N_RECORDS; ++ii) {
+            GeneralPerturbations& gp = catalog[ii];
+            gp.NORAD_CAT_ID          = static_cast<unsigned>(ii + 1);
+            gp.GP_ID                 = static_cast<unsigned>(ii + 1);
+            gp.OBJECT_NAME           = prefixes[ii % prefixes.size()] + std::to_string(ii);
+            gp.MEAN_MOTION           = ii % 20 == 0 ? 1.0027 : (ii % 10 == 0 ? 2.0056 : leoMeanMotion(generator));
+            gp.INCLINATION           = inclination(generator);
+
+            const int dom = dayOfMonth(generator);
+            gp.EPOCH      = "2025-07-" + std::string(dom < 10 ? "0" : "") + std::to_string(dom) + "T12:00:00.000000";
+
+            // Altitudes from the mean motion, in km
+            const double semimajor = 42241.1 * std::pow(*gp.MEAN_MOTION, -2.0 / 3.0);
+            const double e         = eccentricity(generator);
+            gp.APOAPSIS            = semimajor * (1.0 + e) - 6378.137;
+            gp.PERIAPSIS           = semimajor * (1.0 - e) - 6378.137;
+        }
+        SnapshotIngestor(path).upsert(catalog);
+    }
+
+    void TearDown() override { remove_database(); }
+
+    void remove_database()
+    {
+        for (const std::string suffix : { "", "-wal", "-shm" }) {
+            std::filesystem::remove(path + suffix);
+        }
+    }
+
+    // Runs each query N_QUERIES times, returning the last NORAD ID found and the number of results of each search
+    template <class Database_T, class NameSearch_T>
+    std::vector<std::size_t> run_queries(const std::string& label, Database_T& database, NameSearch_T&& search_names)
+    {
+        std::vector<std::size_t> counts(5);
+        time_it(label + " NORAD ID", N_QUERIES, "query", [&]() {
+            for (std::size_t ii = 0; ii < N_QUERIES; ++ii) {
+                counts[0] = database.get_sat_from_norad_id(static_cast<unsigned>(ii * 97 % N_RECORDS + 1)).NORAD_CAT_ID;
+            }
+        });
+        time_it(label + " Name", N_QUERIES, "query", [&]() {
+            for (std::size_t ii = 0; ii < N_QUERIES; ++ii) {
+                counts[1] = search_names("%LINK-12%").size();
+            }
+        });
+        time_it(label + " Epoch", N_QUERIES, "query", [&]() {
+            for (std::size_t ii = 0; ii < N_QUERIES; ++ii) {
+                counts[2] = database.get_sats_in_epoch_range("2025-07-14", "2025-07-15").size();
+            }
+        });
+        time_it(label + " Regime", N_QUERIES, "query", [&]() {
+            for (std::size_t ii = 0; ii < N_QUERIES; ++ii) {
+                counts[3] = database.get_sats_in_regime(1.9 / day, 2.1 / day, 50.0 * deg, 60.0 * deg).size();
+            }
+        });
+        time_it(label + " Altitude", N_QUERIES, "query", [&]() {
+            for (std::size_t ii = 0; ii < N_QUERIES; ++ii) {
+                counts[4] = database.get_sats_in_range(35000.0 * km, 36500.0 * km).size();
+            }
+        });
+        return counts;
+    }
+
+    static constexpr std::size_t N_RECORDS = 50'000;
+    static constexpr std::size_t N_QUERIES = 200;
+
+    std::string path;
+    std::mt19937 generator{ 42 };
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(QueryBenchmark, IndexedAndScanned)
+{
+    using namespace sqlite_orm;
+
+    auto database = make_database(get_snapshot(path));
+
+    const std::vector<std::size_t> withIndex = run_queries("Indexed", database, [&](const std::string& pattern) {
+        return database.get_sats_by_name(pattern);
+    });
+
+    // Drop everything but the unique constraints, and search names the way the wrapper used to
+    {
+        auto storage    = get_snapshot(path);
+        auto connection = storage.get_connection();
+        sqlite3_exec(
+            connection.get(),
+            "DROP INDEX GeneralPerturbations_epoch; DROP INDEX GeneralPerturbations_regime; DROP INDEX GeneralPerturbations_apoapsis;"
+            "DROP INDEX GeneralPerturbations_periapsis;",
+            nullptr,
+            nullptr,
+            nullptr
+        );
+    }
+    auto storage = get_snapshot(path);
+
+    const std::vector<std::size_t> noIndex = run_queries("Scanned", database, [&](const std::string& pattern) {
+        return storage.get_all<GeneralPerturbations>(where(like(&GeneralPerturbations::OBJECT_NAME, pattern)));
+    });
+
+    for (std::size_t ii = 0; ii < withIndex.size(); ++ii) {
+        std::cout << "Results " << ii << ": " << withIndex[ii] << std::endl;
+        ASSERT_EQ(withIndex[ii], noIndex[ii]);
+    }
+}
@@ -0,0 +1,122 @@
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <cpr/cpr.h>
+#include <nlohmann/json.hpp>
+
+#include <snapshot/snapshot.hpp>
+#include <tests/utilities/MockSpaceTrackServer.hpp>
+#include <tests/utilities/timing.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace snapshot;
+
+
+class SpaceTrackBenchmark : public testing::Test {
+  public:
+    SpaceTrackBenchmark() {}
+
+    void SetUp() override
+    {
+        // Recorded Space-Track GP records, repeated with unique ids to the size of the full catalog
+        fixtures = std::filesystem::path(std::getenv("ASTREA_ROOT")) / "data/snapshot/spacetrack";
+        std::ifstream fixture(fixtures / "gp.json");
+        const nlohmann::json sample = nlohmann::json::parse(fixture);
+
+        catalog = nlohmann::json::array();
+        for (std::size_t ii = 0; ii < N_RECORDS; ++ii) {
+            nlohmann::json record  = sample[ii % sample.size()];
+            record["NORAD_CAT_ID"] = std::to_string(ii + 1);
+            record["GP_ID"]        = std::to_string(GP_ID_OFFSET + ii);
+            catalog.push_back(std::move(record));
+        }
+
+        path         = (std::filesystem::temp_directory_path() / "astrea_spacetrack_benchmark.db").string();
+        queryHistory = std::filesystem::temp_directory_path() / "astrea_spacetrack_benchmark.query-history.json";
+        remove_files();
+        auto storage = get_snapshot(path);
+        sync_snapshot(storage);
+    }
+
+    void TearDown() override { remove_files(); }
+
+    void remove_files()
+    {
+        for (const std::string suffix : { "", "-wal", "-shm" }) {
+            std::filesystem::remove(path + suffix);
+        }
+        std::filesystem::remove(queryHistory);
+    }
+
+    static constexpr std::size_t N_RECORDS    = 30'000;
+    static constexpr std::size_t PAGE_SIZE    = 5'000;
+    static constexpr std::size_t GP_ID_OFFSET = 100'000'000;
+
+    const std::string username = "user@example.com";
+    const std::string password = "password";
+
+    std::filesystem::path fixtures;
+    std::filesystem::path queryHistory;
+    nlohmann::json catalog;
+    std::string path;
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(SpaceTrackBenchmark, DownloadParseInsert)
+{
+    MockSpaceTrackServer server(fixtures);
+    server.set_fixture("gp", catalog);
+
+    // Each stage on its own
+    const cpr::Url loginUrl = server.get_base_url() + "/ajaxauth/login";
+    const cpr::Url queryUrl = server.get_base_url() + "/basicspacedata/query/class/gp/orderby/norad_cat_id/format/json";
+    const cpr::Cookies cookies = cpr::Post(loginUrl, cpr::Payload{ { "identity", username }, { "password", password } }).cookies;
+
+    cpr::Response response;
+    time_it("Download", N_RECORDS, "record", [&]() { response = cpr::Get(queryUrl, cookies); });
+    ASSERT_EQ(response.status_code, 200);
+    std::cout << "Download Size: " << response.text.size() / 1.0e6 << " (MB)" << std::endl;
+
+    nlohmann::json records;
+    time_it("Parse", N_RECORDS, "record", [&]() { records = nlohmann::json::parse(response.text); });
+    ASSERT_EQ(records.size(), N_RECORDS);
+
+    SnapshotIngestor ingestor(path);
+    std::size_t nWritten = 0;
+    time_it("Insert", N_RECORDS, "record", [&]() { nWritten = ingestor.replace(records); });
+    ASSERT_EQ(nWritten, N_RECORDS);
+
+    // The whole pipeline through the client, in one query and in pages
+    SpaceTrackClient client(server.get_base_url(), queryHistory);
+    time_it("End-to-End", N_RECORDS, "record", [&]() {
+        nWritten = ingestor.replace(client.retrieve_all(username, password));
+    });
+    ASSERT_EQ(nWritten, N_RECORDS);
+
+    const std::size_t nQueries = server.get_query_count();
+    time_it("End-to-End (Paged)", N_RECORDS, "record", [&]() {
+        nWritten = ingestor.replace(
+            client.query_paged(username, password, SpaceTrackClient::SpaceDataClass::GP, { { "orderby", "norad_cat_id" } }, PAGE_SIZE)
+        );
+    });
+    ASSERT_EQ(nWritten, N_RECORDS);
+    ASSERT_EQ(server.get_query_count() - nQueries, N_RECORDS / PAGE_SIZE + 1);
+    ASSERT_EQ(server.get_throttled_count(), 0);
+
+    // The catalog arrived intact
+    const auto database = make_database(get_snapshot(path));
+    ASSERT_EQ(database.get_sat_from_norad_id(N_RECORDS).GP_ID, GP_ID_OFFSET + N_RECORDS - 1);
+}
@@ -0,0 +1,167 @@
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+#include <nlohmann/json.hpp>
+
+#include <snapshot/snapshot.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace snapshot;
+
+
+class StreamingBenchmark : public testing::Test {
+  public:
+    StreamingBenchmark() {}
+
+    void SetUp() override
+    {
+        // Recorded Space-Track GP records, repeated with unique ids to the size of the full catalog. The response is
+        // written record by record so the fixture itself is never held in memory.
+        std::ifstream fixture(std::string(std::getenv("ASTREA_ROOT")) + "/data/snapshot/gp_catalog_sample.json");
+        const nlohmann::json sample = nlohmann::json::parse(fixture);
+
+        responsePath = std::filesystem::temp_directory_path() / "astrea_streaming_benchmark.json";
+        std::ofstream response(responsePath);
+        response << "[";
+        for (std::size_t ii = 0; ii < N_RECORDS; ++ii) {
+            nlohmann::json record  = sample[ii % sample.size()];
+            record["NORAD_CAT_ID"] = std::to_string(ii + 1);
+            record["GP_ID"]        = std::to_string(GP_ID_OFFSET + ii);
+            response << (ii == 0 ? "" : ",") << record.dump();
+        }
+        response << "]";
+
+        path = (std::filesystem::temp_directory_path() / "astrea_streaming_benchmark.db").string();
+    }
+
+    void TearDown() override
+    {
+        remove_files();
+        std::filesystem::remove(responsePath);
+    }
+
+    void remove_files()
+    {
+        for (const std::string suffix : { "", "-wal", "-shm" }) {
+            std::filesystem::remove(path + suffix);
+        }
+    }
+
+    // Wall time and memory of one ingest, measured in a child process so each path starts from the same footprint
+    struct Measurement {
+        double time;          //!< Wall time (s)
+        double peakMemory;    //!< Growth of the peak resident set over the ingest (MB)
+        std::size_t nWritten; //!< Number of records written
+    };
+
+    // Reads a field of /proc/self/status, in kB
+    static std::size_t read_status_kb(const std::string& field)
+    {
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line)) {
+            if (line.starts_with(field + ":")) { return std::stoul(line.substr(field.size() + 1)); }
+        }
+        return 0;
+    }
+
+    template <class Function_T>
+    Measurement measure(const std::string& label, Function_T&& ingest)
+    {
+        // Start from an empty database, so neither path pays for dropping the other's catalog
+        remove_files();
+        auto storage = get_snapshot(path);
+        sync_snapshot(storage);
+
+        int channel[2];
+        if (pipe(channel) != 0) { throw std::runtime_error("Failed to open a pipe."); }
+
+        const pid_t child = fork();
+        if (child == 0) {
+            close(channel[0]);
+            Measurement result{};
+
+            // The peak is inherited from the parent, so reset it before starting
+            std::ofstream("/proc/self/clear_refs") << "5";
+            const std::size_t baseline = read_status_kb("VmRSS");
+
+            using namespace std::chrono;
+            const auto start = steady_clock::now();
+            try {
+                result.nWritten = ingest();
+            }
+            catch (const std::exception& error) {
+                std::cerr << label << " ingest failed: " << error.what() << std::endl;
+                _exit(1);
+            }
+            const auto end = steady_clock::now();
+
+            result.time       = duration_cast<std::chrono::nanoseconds>(end - start).count() / 1.0e9;
+            result.peakMemory = (read_status_kb("VmHWM") - baseline) / 1.0e3;
+            [[maybe_unused]] const auto nBytes = write(channel[1], &result, sizeof(result));
+            _exit(0);
+        }
+
+        close(channel[1]);
+        Measurement result{};
+        const auto nBytes = read(channel[0], &result, sizeof(result));
+        close(channel[0]);
+        waitpid(child, nullptr, 0);
+        if (nBytes != sizeof(result)) { throw std::runtime_error(label + " ingest failed."); }
+
+        std::cout << label << " Time: " << result.time << " (s), " << result.time / N_RECORDS * 1.0e9 << " (ns/record)" << std::endl;
+        std::cout << label << " Peak Memory: " << result.peakMemory << " (MB)" << std::endl;
+        return result;
+    }
+
+    static constexpr std::size_t N_RECORDS    = 100'000;
+    static constexpr std::size_t GP_ID_OFFSET = 100'000'000;
+
+    std::filesystem::path responsePath;
+    std::string path;
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(StreamingBenchmark, Ingest)
+{
+    std::cout << "Response Size: " << std::filesystem::file_size(responsePath) / 1.0e6 << " (MB)" << std::endl;
+
+    // The whole response parsed into a DOM, then written
+    const Measurement dom = measure("DOM", [&]() {
+        std::ifstream response(responsePath);
+        const nlohmann::json records = nlohmann::json::parse(response);
+        return SnapshotIngestor(path).replace(records);
+    });
+
+    // Records parsed one at a time and written as they arrive
+    const Measurement streamed = measure("Streaming", [&]() {
+        std::ifstream response(responsePath);
+        return SnapshotIngestor(path).replace(response);
+    });
+
+    ASSERT_EQ(dom.nWritten, N_RECORDS);
+    ASSERT_EQ(streamed.nWritten, N_RECORDS);
+    ASSERT_EQ(get_snapshot(path).count<GeneralPerturbations>(), N_RECORDS);
+
+    // Memory no longer grows with the response. Parsing overlaps writing given a spare core, so streaming is faster on
+    // most machines, but on a single core it can only match the DOM path.
+    ASSERT_LT(streamed.peakMemory, dom.peakMemory / 10.0);
+    ASSERT_LT(streamed.time, dom.time * 1.25);
+}
@@ -0,0 +1,358 @@
+#include <tests/utilities/MockSpaceTrackServer.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <stdexcept>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace astrea {
+namespace snapshot {
+
+namespace {
+
+// Predicates that shape the response rather than filter records
+const std::vector<std::string> CONTROL_PREDICATES = {
+    "orderby", "format", "emptyresult", "predicates", "metadata", "distinct", "favorites"
+};
+
+std::string to_lower(std::string value)
+{
+    std::transform(value.begin(), value.end(), value.begin(), [](unsigned char c) { return std::tolower(c); });
+    return value;
+}
+
+std::string to_upper(std::string value)
+{
+    std::transform(value.begin(), value.end(), value.begin(), [](unsigned char c) { return std::toupper(c); });
+    return value;
+}
+
+std::string url_decode(const std::string& value)
+{
+    std::string decoded;
+    decoded.reserve(value.size());
+    for (std::size_t ii = 0; ii < value.size(); ++ii) {
+        if (value[ii] == '%' && ii + 2 < value.size() && std::isxdigit(value[ii + 1]) && std::isxdigit(value[ii + 2])) {
+            decoded += static_cast<char>(std::stoi(value.substr(ii + 1, 2), nullptr, 16));
+            ii += 2;
+        }
+        else if (value[ii] == '+') {
+            decoded += ' ';
+        }
+        else {
+            decoded += value[ii];
+        }
+    }
+    return decoded;
+}
+
+std::vector<std::string> split(const std::string& value, const char& delimiter)
+{
+    std::vector<std::string> parts;
+    std::size_t start = 0;
+    while (start <= value.size()) {
+        const std::size_t end = std::min(value.find(delimiter, start), value.size());
+        parts.push_back(value.substr(start, end - start));
+        start = end + 1;
+    }
+    return parts;
+}
+
+// Plain values are matched exactly; anything using the query operators is passed through unfiltered
+bool is_plain_value(const std::string& value)
+{
+    static const std::vector<std::string> OPERATORS = { "<", ">", "--", "~~", "^", ",", "null-val", "now" };
+    for (const std::string& op : OPERATORS) {
+        if (to_lower(value).find(op) != std::string::npos) { return false; }
+    }
+    return true;
+}
+
+bool field_equals(const nlohmann::json& record, const std::string& field, const std::string& value)
+{
+    if (!record.contains(field) || record[field].is_null()) { return false; }
+    const nlohmann::json& entry = record[field];
+    return to_upper(entry.is_string() ? entry.get<std::string>() : entry.dump()) == to_upper(value);
+}
+
+std::string error_body(const std::string& message) { return nlohmann::json{ { "error", message } }.dump(); }
+
+std::string reason_phrase(const int& status)
+{
+    switch (status) {
+        case (200): {
+            return "OK";
+        }
+        case (400): {
+            return "Bad Request";
+        }
+        case (401): {
+            return "Unauthorized";
+        }
+        case (404): {
+            return "Not Found";
+        }
+        case (429): {
+            return "Too Many Requests";
+        }
+    }
+    return "Error";
+}
+
+void send_all(const int& connection, const std::string& data)
+{
+    std::size_t sent = 0;
+    while (sent < data.size()) {
+        const ssize_t n = ::send(connection, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (n <= 0) { return; }
+        sent += static_cast<std::size_t>(n);
+    }
+}
+
+} // namespace
+
+
+MockSpaceTrackServer::MockSpaceTrackServer(const Options& options) :
+    _options(options)
+{
+    _socket = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (_socket < 0) { throw std::runtime_error("Failed to open mock SpaceTrack server socket."); }
+
+    const int reuse = 1;
+    ::setsockopt(_socket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    // Let the kernel pick a free port so concurrent tests don't collide
+    sockaddr_in address{};
+    address.sin_family      = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port        = 0;
+    socklen_t length        = sizeof(address);
+    if (::bind(_socket, reinterpret_cast<sockaddr*>(&address), length) < 0 || ::listen(_socket, 16) < 0 ||
+        ::getsockname(_socket, reinterpret_cast<sockaddr*>(&address), &length) < 0) {
+        ::close(_socket);
+        throw std::runtime_error("Failed to bind mock SpaceTrack server to the loopback interface.");
+    }
+    _port = ntohs(address.sin_port);
+
+    _thread = std::jthread([this](std::stop_token stop) { serve(stop); });
+}
+
+MockSpaceTrackServer::MockSpaceTrackServer(const std::filesystem::path& fixtureDirectory, const Options& options) :
+    MockSpaceTrackServer(options)
+{
+    if (!std::filesystem::is_directory(fixtureDirectory)) {
+        throw std::runtime_error("SpaceTrack fixture directory " + fixtureDirectory.string() + " does not exist.");
+    }
+    for (const auto& entry : std::filesystem::directory_iterator(fixtureDirectory)) {
+        if (entry.path().extension() != ".json") { continue; }
+        std::ifstream fixtureStream(entry.path());
+        set_fixture(entry.path().stem().string(), nlohmann::json::parse(fixtureStream));
+    }
+}
+
+MockSpaceTrackServer::~MockSpaceTrackServer()
+{
+    _thread.request_stop();
+    if (_thread.joinable()) { _thread.join(); }
+    ::close(_socket);
+}
+
+void MockSpaceTrackServer::set_fixture(const std::string& requestClass, const nlohmann::json& records)
+{
+    if (!records.is_array()) {
+        throw std::runtime_error("SpaceTrack fixture for " + requestClass + " must be a JSON array.");
+    }
+
+    Fixture fixture;
+    fixture.records = records;
+    fixture.serialized.reserve(records.size());
+    for (const auto& record : records) {
+        fixture.serialized.push_back(record.dump());
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _fixtures[to_lower(requestClass)] = std::move(fixture);
+}
+
+std::string MockSpaceTrackServer::get_base_url() const { return "http://127.0.0.1:" + std::to_string(_port); }
+
+void MockSpaceTrackServer::serve(std::stop_token stop)
+{
+    // Poll with a timeout so a stop request is noticed without a connection arriving
+    pollfd listener{ _socket, POLLIN, 0 };
+    while (!stop.stop_requested()) {
+        if (::poll(&listener, 1, 50) <= 0) { continue; }
+        const int connection = ::accept(_socket, nullptr, nullptr);
+        if (connection < 0) { continue; }
+        handle(connection);
+        ::close(connection);
+    }
+}
+
+void MockSpaceTrackServer::handle(const int& connection)
+{
+    // Read the request head
+    std::string request;
+    std::size_t headEnd = std::string::npos;
+    char buffer[8192];
+    while (headEnd == std::string::npos) {
+        const ssize_t n = ::recv(connection, buffer, sizeof(buffer), 0);
+        if (n <= 0) { return; }
+        request.append(buffer, static_cast<std::size_t>(n));
+        headEnd = request.find("\r\n\r\n");
+    }
+
+    const std::vector<std::string> lines = split(request.substr(0, headEnd), '\n');
+    const std::vector<std::string> requestLine = split(lines[0].substr(0, lines[0].find('\r')), ' ');
+    if (requestLine.size() < 2) { return; }
+    const std::string& method = requestLine[0];
+    const std::string& target = requestLine[1];
+
+    std::size_t contentLength = 0;
+    std::string cookies;
+    for (std::size_t ii = 1; ii < lines.size(); ++ii) {
+        const std::string line  = lines[ii].substr(0, lines[ii].find('\r'));
+        const std::size_t colon = line.find(':');
+        if (colon == std::string::npos) { continue; }
+        const std::string name  = to_lower(line.substr(0, colon));
+        const std::string value = line.substr(std::min(line.find_first_not_of(' ', colon + 1), line.size()));
+        if (name == "content-length") { contentLength = std::stoul(value); }
+        else if (name == "cookie") {
+            cookies = value;
+        }
+    }
+
+    // Read the rest of the body
+    std::string body = request.substr(headEnd + 4);
+    while (body.size() < contentLength) {
+        const ssize_t n = ::recv(connection, buffer, sizeof(buffer), 0);
+        if (n <= 0) { return; }
+        body.append(buffer, static_cast<std::size_t>(n));
+    }
+
+    Response response;
+    if (method == "POST" && target == "/ajaxauth/login") { response = login(body); }
+    else if (method == "GET") {
+        response = query(target, cookies);
+    }
+    else {
+        response = { 404, "", error_body("Unknown endpoint " + target) };
+    }
+
+    if (_options.latency.count() > 0) { std::this_thread::sleep_for(_options.latency); }
+
+    std::string head = "HTTP/1.1 " + std::to_string(response.status) + " " + reason_phrase(response.status) + "\r\n";
+    head += "Content-Type: application/json\r\n";
+    head += "Content-Length: " + std::to_string(response.body.size()) + "\r\n";
+    head += "Connection: close\r\n";
+    head += response.headers + "\r\n";
+    send_all(connection, head);
+    send_all(connection, response.body);
+}
+
+MockSpaceTrackServer::Response MockSpaceTrackServer::login(const std::string& body)
+{
+    std::string identity, password;
+    for (const std::string& field : split(body, '&')) {
+        const std::size_t equals = field.find('=');
+        if (equals == std::string::npos) { continue; }
+        const std::string key = field.substr(0, equals);
+        if (key == "identity") { identity = url_decode(field.substr(equals + 1)); }
+        else if (key == "password") {
+            password = url_decode(field.substr(equals + 1));
+        }
+    }
+    if (identity.empty() || password.empty()) { return { 200, "", R"({"Login":"Failed"})" }; }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _session = "mock" + std::to_string(++_nLogins);
+    return { 200, "Set-Cookie: chocolatechip=" + _session + "; Path=/; Max-Age=7200; HttpOnly\r\n", "\"\"" };
+}
+
+MockSpaceTrackServer::Response MockSpaceTrackServer::query(const std::string& target, const std::string& cookies)
+{
+    ++_nQueries;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_session.empty() || cookies.find("chocolatechip=" + _session) == std::string::npos) {
+        return { 401, "", error_body("You must be logged in to complete this action") };
+    }
+
+    // Rate limits count every authenticated query, whether or not it is answered
+    const Clock::time_point now = Clock::now();
+    while (!_history.empty() && _history.front() < now - std::chrono::hours(1)) {
+        _history.pop_front();
+    }
+    const std::size_t nLastMinute = std::count_if(_history.begin(), _history.end(), [&](const auto& time) {
+        return time >= now - std::chrono::minutes(1);
+    });
+    if (nLastMinute >= _options.maxQueriesPerMinute || _history.size() >= _options.maxQueriesPerHour) {
+        ++_nThrottled;
+        return { 429, "", error_body("You've violated your query rate limit. Please refer to our Acceptable Use guidelines") };
+    }
+    _history.push_back(now);
+
+    // /basicspacedata/query/class/<class>/<predicate>/<value>/...
+    std::vector<std::string> segments = split(target.substr(1), '/');
+    if (!segments.empty() && segments.back().empty()) { segments.pop_back(); }
+    if (segments.size() < 4 || segments[0] != "basicspacedata" || segments[1] != "query" || segments[2] != "class") {
+        return { 404, "", error_body("Unsupported query " + target) };
+    }
+    if (segments.size() % 2 != 0) { return { 400, "", error_body("Predicate without a value in " + target) }; }
+
+    const auto fixture = _fixtures.find(to_lower(segments[3]));
+    if (fixture == _fixtures.end()) { return { 404, "", error_body("No fixture recorded for class " + segments[3]) }; }
+    const nlohmann::json& records = fixture->second.records;
+
+    std::vector<std::pair<std::string, std::string>> filters;
+    std::size_t limit  = records.size();
+    std::size_t offset = 0;
+    for (std::size_t ii = 4; ii < segments.size(); ii += 2) {
+        const std::string predicate = to_lower(segments[ii]);
+        const std::string value     = url_decode(segments[ii + 1]);
+        if (predicate == "limit") {
+            const std::vector<std::string> bounds = split(value, ',');
+            try {
+                limit  = std::stoul(bounds[0]);
+                offset = bounds.size() > 1 ? std::stoul(bounds[1]) : 0;
+            }
+            catch (const std::exception&) {
+                return { 400, "", error_body("Invalid limit " + value) };
+            }
+        }
+        else if (predicate == "format") {
+            if (to_lower(value) != "json") { return { 400, "", error_body("Only JSON fixtures are recorded.") }; }
+        }
+        else if (std::find(CONTROL_PREDICATES.begin(), CONTROL_PREDICATES.end(), predicate) == CONTROL_PREDICATES.end()) {
+            if (is_plain_value(value)) { filters.emplace_back(to_upper(predicate), value); }
+        }
+    }
+
+    // Filter, then page, as Space-Track does
+    Response response;
+    if (filters.empty() && !records.empty()) {
+        response.body.reserve(std::min(limit, records.size()) * (fixture->second.serialized[0].size() + 1) + 2);
+    }
+    response.body += "[";
+    std::size_t nMatched = 0;
+    std::size_t nWritten = 0;
+    for (std::size_t ii = 0; ii < records.size() && nWritten < limit; ++ii) {
+        const bool matches = std::all_of(filters.begin(), filters.end(), [&](const auto& filter) {
+            return field_equals(records[ii], filter.first, filter.second);
+        });
+        if (!matches || nMatched++ < offset) { continue; }
+        if (nWritten++ > 0) { response.body += ","; }
+        response.body += fixture->second.serialized[ii];
+    }
+    response.body += "]";
+    return response;
+}
+
+} // namespace snapshot
+} // namespace astrea
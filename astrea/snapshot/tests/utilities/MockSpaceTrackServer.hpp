@@ -0,0 +1,196 @@
+/**
+ * @file MockSpaceTrackServer.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief Local stand-in for the SpaceTrack API that replays recorded fixtures
+ * @version 0.1
+ * @date 2025-08-03
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace astrea {
+namespace snapshot {
+
+/**
+ * @brief Local HTTP server that stands in for the SpaceTrack API so clients can be tested offline.
+ *
+ * The server listens on the loopback interface and answers the login endpoint and basicspacedata queries, replaying
+ * a fixture for each request class (gp, gp_history, satcat, cdm_public, tip, ...). It emulates the parts of the API
+ * that the ingest pipeline depends on:
+ *  - Login sets a session cookie, and queries without one are refused.
+ *  - The limit predicate pages through the fixture, as in /limit/1000,2000.
+ *  - Predicates naming a record field with a plain value filter records by case-insensitive equality. Predicates
+ *    using operators (<, >, --, ~~, ^, null-val, now, lists) are accepted but not applied.
+ *  - Queries beyond the per-minute or per-hour limit are refused with HTTP 429.
+ * Fixtures are replayed in their recorded order, so orderby is ignored.
+ *
+ * Requests are served one at a time on a background thread. Linux only.
+ */
+class MockSpaceTrackServer {
+  public:
+    /**
+     * @brief Behavior of the server.
+     */
+    struct Options {
+        std::size_t maxQueriesPerMinute = 30;  //!< Queries allowed in any one minute window
+        std::size_t maxQueriesPerHour   = 300; //!< Queries allowed in any one hour window
+        std::chrono::milliseconds latency{ 0 }; //!< Delay added before each response
+    };
+
+    /**
+     * @brief Starts a server with no fixtures on an unused loopback port.
+     *
+     * @param options The behavior of the server.
+     * @throws std::runtime_error If the server socket cannot be opened.
+     */
+    MockSpaceTrackServer(const Options& options);
+
+    /**
+     * @brief Starts a server replaying every <class>.json file in a directory, such as data/snapshot/spacetrack.
+     *
+     * @param fixtureDirectory The directory of recorded responses, one JSON array per request class.
+     * @param options The behavior of the server.
+     * @throws std::runtime_error If a fixture cannot be read or the server socket cannot be opened.
+     */
+    MockSpaceTrackServer(const std::filesystem::path& fixtureDirectory, const Options& options);
+
+    /**
+     * @brief Starts a server replaying every <class>.json file in a directory with the default options.
+     *
+     * @param fixtureDirectory The directory of recorded responses, one JSON array per request class.
+     * @throws std::runtime_error If a fixture cannot be read or the server socket cannot be opened.
+     */
+    MockSpaceTrackServer(const std::filesystem::path& fixtureDirectory) :
+        MockSpaceTrackServer(fixtureDirectory, Options{})
+    {
+    }
+
+    /**
+     * @brief Stops the server and closes its socket.
+     */
+    ~MockSpaceTrackServer();
+
+    MockSpaceTrackServer(const MockSpaceTrackServer&)            = delete;
+    MockSpaceTrackServer& operator=(const MockSpaceTrackServer&) = delete;
+
+    /**
+     * @brief Sets the records replayed for a request class, replacing any existing fixture.
+     *
+     * @param requestClass The request class, as it appears in the query URL (e.g. gp, satcat).
+     * @param records A JSON array of records.
+     * @throws std::runtime_error If the records are not an array.
+     */
+    void set_fixture(const std::string& requestClass, const nlohmann::json& records);
+
+    /**
+     * @brief Get the base URL of the server, to be passed to SpaceTrackClient in place of the live site.
+     *
+     * @return std::string The base URL, e.g. http://127.0.0.1:40123
+     */
+    std::string get_base_url() const;
+
+    /**
+     * @brief Get the number of query requests received, including refused ones.
+     *
+     * @return std::size_t The number of queries.
+     */
+    std::size_t get_query_count() const { return _nQueries; }
+
+    /**
+     * @brief Get the number of queries refused for exceeding the rate limits.
+     *
+     * @return std::size_t The number of throttled queries.
+     */
+    std::size_t get_throttled_count() const { return _nThrottled; }
+
+    /**
+     * @brief Get the number of successful logins.
+     *
+     * @return std::size_t The number of logins.
+     */
+    std::size_t get_login_count() const { return _nLogins; }
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Recorded records of one request class.
+     */
+    struct Fixture {
+        nlohmann::json records;               //!< Records, used for filtering
+        std::vector<std::string> serialized; //!< Records serialized once, so responses are only concatenated
+    };
+
+    /**
+     * @brief Status, headers, and body of a response.
+     */
+    struct Response {
+        int status = 200;         //!< HTTP status code
+        std::string headers = ""; //!< Additional header lines, each ending in \r\n
+        std::string body    = ""; //!< Response body
+    };
+
+    Options _options; //!< Behavior of the server
+    int _socket = -1; //!< Listening socket
+    int _port   = 0;  //!< Port the server listens on
+
+    mutable std::mutex _mutex;                //!< Guards the fixtures
+    std::map<std::string, Fixture> _fixtures; //!< Fixture for each request class
+    std::deque<Clock::time_point> _history;   //!< Times of accepted queries in the last hour
+    std::string _session;                     //!< Value of the current session cookie
+
+    std::atomic<std::size_t> _nQueries   = 0; //!< Number of queries received
+    std::atomic<std::size_t> _nThrottled = 0; //!< Number of queries refused by the rate limits
+    std::atomic<std::size_t> _nLogins    = 0; //!< Number of successful logins
+
+    std::jthread _thread; //!< Thread accepting and serving connections
+
+    /**
+     * @brief Accepts and serves connections until a stop is requested.
+     *
+     * @param stop Token signalling the server to stop.
+     */
+    void serve(std::stop_token stop);
+
+    /**
+     * @brief Reads one request from a connection, answers it, and closes the connection.
+     *
+     * @param connection The connected socket.
+     */
+    void handle(const int& connection);
+
+    /**
+     * @brief Answers a login request.
+     *
+     * @param body The form encoded request body.
+     * @return Response The response.
+     */
+    Response login(const std::string& body);
+
+    /**
+     * @brief Answers a query request.
+     *
+     * @param target The request target, e.g. /basicspacedata/query/class/gp/limit/10
+     * @param cookies The Cookie header of the request.
+     * @return Response The response.
+     */
+    Response query(const std::string& target, const std::string& cookies);
+};
+
+} // namespace snapshot
+} // namespace astrea
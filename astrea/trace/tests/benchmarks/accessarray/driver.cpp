@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <parallel_hashmap/btree.h>
+
+#include <tests/utilities/timing.hpp>
+#include <trace/trace.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace trace;
+
+using namespace mp_units;
+using mp_units::si::unit_symbols::s;
+
+
+// The hash this replaced, kept here as the baseline
+struct XorIdPairHash {
+    std::size_t operator()(const IdPair& k) const
+    {
+        return (std::hash<std::size_t>()(k.sender)) ^ (std::hash<std::size_t>()(k.receiver));
+    }
+};
+
+
+class AccessArrayBenchmark : public testing::Test {
+  public:
+    AccessArrayBenchmark() {}
+
+    void SetUp() override
+    {
+        // Every sender and receiver pair of a dense all-to-all run, in shuffled order
+        for (std::size_t sender = 0; sender < N_PLATFORMS; ++sender) {
+            for (std::size_t receiver = 0; receiver < N_PLATFORMS; ++receiver) {
+                pairs.emplace_back(sender, receiver);
+            }
+        }
+        std::shuffle(pairs.begin(), pairs.end(), generator);
+    }
+
+    // Per-thread results of a partitioned run, with each pair in one shard and some pairs split across two
+    std::vector<AccessArray> make_shards()
+    {
+        std::vector<AccessArray> shards(N_SHARDS);
+        for (std::size_t ii = 0; ii < pairs.size(); ++ii) {
+            const IdPair& ids = pairs[ii];
+
+            shards[ii % N_SHARDS][ids.sender, ids.receiver] = access;
+            if (ii % 10 == 0) { shards[(ii + 1) % N_SHARDS][ids.sender, ids.receiver] = laterAccess; }
+        }
+        return shards;
+    }
+
+    static constexpr std::size_t N_PLATFORMS = 1'000;
+    static constexpr std::size_t N_SHARDS    = 8;
+
+    const RiseSetArray access      = RiseSetArray({ 0.0 * s, 60.0 * s });
+    const RiseSetArray laterAccess = RiseSetArray({ 120.0 * s, 180.0 * s });
+    std::vector<IdPair> pairs;
+
+    std::mt19937 generator{ 42 };
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(AccessArrayBenchmark, InsertAndLookup)
+{
+    const std::size_t nPairs = pairs.size();
+    std::size_t checksum     = 0;
+
+    phmap::btree_map<IdPair, RiseSetArray> btree;
+    time_it("B-Tree Insert", nPairs, "pair", [&]() {
+        for (const IdPair& ids : pairs) {
+            btree[ids] = access;
+        }
+    });
+    time_it("B-Tree Lookup", nPairs, "pair", [&]() {
+        for (const IdPair& ids : pairs) {
+            checksum += btree.find(ids)->second.size();
+        }
+    });
+
+    std::unordered_map<IdPair, RiseSetArray, XorIdPairHash> xorMap;
+    time_it("XOR Hash Insert", nPairs, "pair", [&]() {
+        for (const IdPair& ids : pairs) {
+            xorMap[ids] = access;
+        }
+    });
+    time_it("XOR Hash Lookup", nPairs, "pair", [&]() {
+        for (const IdPair& ids : pairs) {
+            checksum += xorMap.find(ids)->second.size();
+        }
+    });
+
+    AccessArray accesses;
+    time_it("Flat Insert", nPairs, "pair", [&]() {
+        for (const IdPair& ids : pairs) {
+            accesses[ids.sender, ids.receiver] = access;
+        }
+    });
+    time_it("Flat Lookup", nPairs, "pair", [&]() {
+        for (const IdPair& ids : pairs) {
+            checksum += accesses.at(ids.sender, ids.receiver).size();
+        }
+    });
+
+    // Number of distinct hash values for all pairs
+    std::vector<std::size_t> xorHashes, mixedHashes;
+    for (const IdPair& ids : pairs) {
+        xorHashes.push_back(XorIdPairHash()(ids));
+        mixedHashes.push_back(std::hash<IdPair>()(ids));
+    }
+    for (auto* hashes : { &xorHashes, &mixedHashes }) {
+        std::sort(hashes->begin(), hashes->end());
+        hashes->erase(std::unique(hashes->begin(), hashes->end()), hashes->end());
+    }
+    std::cout << "Distinct Hashes: " << xorHashes.size() << " (XOR), " << mixedHashes.size() << " (mixed) of " << nPairs << std::endl;
+    std::cout << "Checksum: " << checksum << std::endl;
+
+    ASSERT_EQ(accesses.size(), nPairs);
+    ASSERT_EQ(mixedHashes.size(), nPairs);
+}
+
+TEST_F(AccessArrayBenchmark, MergeShards)
+{
+    const std::size_t nPairs = pairs.size();
+
+    // Fold shards into a B-tree one pair at a time, unioning pairs seen before
+    std::vector<AccessArray> btreeShards = make_shards();
+    phmap::btree_map<IdPair, RiseSetArray> btree;
+    time_it("B-Tree Merge", nPairs, "pair", [&]() {
+        for (const auto& shard : btreeShards) {
+            for (const auto& [ids, risesets] : shard) {
+                const auto [entry, inserted] = btree.try_emplace(ids, risesets);
+                if (!inserted) { entry->second |= risesets; }
+            }
+        }
+    });
+
+    std::vector<AccessArray> unionShards = make_shards();
+    AccessArray unioned;
+    time_it("Flat Union", nPairs, "pair", [&]() {
+        for (const auto& shard : unionShards) {
+            unioned | shard;
+        }
+    });
+
+    std::vector<AccessArray> mergeShards = make_shards();
+    AccessArray merged;
+    time_it("Flat Bulk Merge", nPairs, "pair", [&]() { merged = AccessArray::merge(std::move(mergeShards)); });
+
+    // Every pair survives, and split pairs hold both accesses
+    ASSERT_EQ(btree.size(), nPairs);
+    ASSERT_EQ(unioned.size(), nPairs);
+    ASSERT_EQ(merged.size(), nPairs);
+    for (const auto& [ids, risesets] : btree) {
+        ASSERT_EQ(merged.at(ids.sender, ids.receiver), risesets);
+        ASSERT_EQ(unioned.at(ids.sender, ids.receiver), risesets);
+    }
+}
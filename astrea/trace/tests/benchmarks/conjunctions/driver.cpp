@@ -0,0 +1,165 @@
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <astro/astro.hpp>
+#include <tests/utilities/timing.hpp>
+#include <trace/trace.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace trace;
+
+using namespace mp_units;
+using mp_units::angular::unit_symbols::deg;
+using mp_units::si::unit_symbols::km;
+using mp_units::si::unit_symbols::s;
+
+
+class ConjunctionBenchmark : public testing::Test {
+  public:
+    ConjunctionBenchmark() = default;
+
+    void SetUp() override
+    {
+        // A catalog shaped like the real one: crowded LEO shells, a band of sun-synchronous orbits, navigation
+        // constellations, the GEO belt, and transfer orbits crossing all of them
+        std::uniform_real_distribution<double> unit(0.0, 1.0);
+        std::uniform_real_distribution<double> angle(0.0, 360.0);
+        catalog.reserve(N_OBJECTS);
+        for (std::size_t ii = 0; ii < N_OBJECTS; ++ii) {
+            const double draw = unit(generator);
+            double perigee, apogee, inclination;
+            if (draw < 0.35) { // Broadband LEO shells
+                perigee     = 540.0 + 20.0 * unit(generator);
+                apogee      = perigee + 2.0 * unit(generator);
+                inclination = unit(generator) < 0.7 ? 53.0 : 43.0;
+            }
+            else if (draw < 0.75) { // Sun-synchronous and debris
+                perigee     = 400.0 + 1100.0 * unit(generator);
+                apogee      = perigee + 200.0 * unit(generator);
+                inclination = 97.0 + 2.5 * unit(generator);
+            }
+            else if (draw < 0.85) { // Everything else in LEO
+                perigee     = 300.0 + 1700.0 * unit(generator);
+                apogee      = perigee + 500.0 * unit(generator);
+                inclination = 180.0 * unit(generator);
+            }
+            else if (draw < 0.90) { // Navigation
+                perigee     = 19000.0 + 4000.0 * unit(generator);
+                apogee      = perigee + 100.0 * unit(generator);
+                inclination = 55.0 + 10.0 * unit(generator);
+            }
+            else if (draw < 0.95) { // GEO belt
+                perigee     = 35750.0 + 80.0 * unit(generator);
+                apogee      = perigee + 20.0 * unit(generator);
+                inclination = 15.0 * unit(generator);
+            }
+            else { // Transfer orbits
+                perigee     = 200.0 + 400.0 * unit(generator);
+                apogee      = 20000.0 + 16000.0 * unit(generator);
+                inclination = 5.0 + 60.0 * unit(generator);
+            }
+
+            const double periapsis = RADIUS_EARTH + perigee;
+            const double apoapsis  = RADIUS_EARTH + apogee;
+            catalog.emplace_back(State(
+                Keplerian(
+                    0.5 * (periapsis + apoapsis) * km,
+                    (apoapsis - periapsis) / (apoapsis + periapsis) * one,
+                    inclination * deg,
+                    angle(generator) * deg,
+                    angle(generator) * deg,
+                    angle(generator) * deg
+                ),
+                epoch,
+                sys
+            ));
+        }
+    }
+
+    void print_counts(const ScreeningCounts& counts)
+    {
+        const auto percent = [&](const std::size_t& count) { return 100.0 * count / counts.nPairs; };
+        std::cout << "  Pairs:            " << counts.nPairs << std::endl;
+        std::cout << "  Apsis Filter:     " << counts.nApsisPairs << " (" << percent(counts.nApsisPairs) << "% of pairs)" << std::endl;
+        std::cout << "  Grid Filter:      " << counts.nGridCandidates << " pair-windows" << std::endl;
+        std::cout << "  Sweep Filter:     " << counts.nSweepCandidates << " pair-windows" << std::endl;
+        std::cout << "  Conjunctions:     " << counts.nConjunctions << std::endl;
+    }
+
+    static constexpr std::size_t N_OBJECTS   = 30'000;
+    static constexpr std::size_t N_PRIMARIES = 100;
+    static constexpr double RADIUS_EARTH     = 6378.137;
+
+    AstrodynamicsSystem sys;
+    Date epoch;
+    std::vector<Spacecraft> catalog;
+
+    std::mt19937 generator{ 42 };
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(ConjunctionBenchmark, StepSize)
+{
+    // Longer windows propagate less often but let more pairs through the grid, so the step trades the two off
+    const Date end = epoch + 6.0 * 3600.0 * s;
+    std::size_t nConjunctions = 0;
+    for (const double& step : { 10.0, 30.0, 60.0, 120.0 }) {
+        ConjunctionScreening screening;
+        time_it("Step " + std::to_string(static_cast<int>(step)) + " s", 1, "pair", [&]() {
+            screening = screen_conjunctions(catalog, epoch, end, sys, DEFAULT_SCREENING_DISTANCE, step * s);
+        });
+        print_counts(screening.counts);
+
+        // Every step finds the same approaches
+        if (nConjunctions == 0) { nConjunctions = screening.counts.nConjunctions; }
+        ASSERT_EQ(screening.counts.nConjunctions, nConjunctions);
+    }
+}
+
+TEST_F(ConjunctionBenchmark, PrimariesAgainstCatalog)
+{
+    const std::vector<Spacecraft> primaries(catalog.begin(), catalog.begin() + N_PRIMARIES);
+    const Date end = epoch + 7.0 * 86400.0 * s;
+
+    ConjunctionScreening screening;
+    time_it("Primaries vs Catalog, 7 Days", N_PRIMARIES * N_OBJECTS, "pair", [&]() {
+        screening = screen_conjunctions(primaries, catalog, epoch, end, sys);
+    });
+    print_counts(screening.counts);
+
+    ASSERT_EQ(screening.counts.nPairs, N_PRIMARIES * (N_OBJECTS - 1) - N_PRIMARIES * (N_PRIMARIES - 1) / 2);
+    ASSERT_EQ(screening.counts.nConjunctions, screening.conjunctions.size());
+}
+
+TEST_F(ConjunctionBenchmark, AllVsAll)
+{
+    const Date end = epoch + 7.0 * 86400.0 * s;
+
+    ConjunctionScreening screening;
+    time_it("All vs All, 7 Days", N_OBJECTS * (N_OBJECTS - 1) / 2, "pair", [&]() {
+        screening = screen_conjunctions(catalog, epoch, end, sys);
+    });
+    print_counts(screening.counts);
+
+    // Each stage only narrows the one before it
+    const ScreeningCounts& counts = screening.counts;
+    ASSERT_EQ(counts.nPairs, N_OBJECTS * (N_OBJECTS - 1) / 2);
+    ASSERT_LE(counts.nApsisPairs, counts.nPairs);
+    ASSERT_LE(counts.nSweepCandidates, counts.nGridCandidates);
+    ASSERT_LE(counts.nConjunctions, counts.nSweepCandidates);
+    for (const Conjunction& conjunction : screening.conjunctions) {
+        ASSERT_LE(conjunction.missDistance, DEFAULT_SCREENING_DISTANCE);
+    }
+}
@@ -0,0 +1,81 @@
+#include <iostream>
+#include <map>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <astro/astro.hpp>
+#include <tests/utilities/timing.hpp>
+#include <trace/trace.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace trace;
+
+using namespace mp_units;
+using mp_units::angular::unit_symbols::deg;
+using mp_units::si::unit_symbols::km;
+
+
+class FieldOfViewBenchmark : public testing::Test {
+  public:
+    FieldOfViewBenchmark() {}
+
+    void SetUp() override
+    {
+        // Targets spread over the whole sphere, so most fall outside the field of view
+        std::normal_distribution<double> component(0.0, 1.0);
+        targets.reserve(N_TARGETS);
+        for (std::size_t ii = 0; ii < N_TARGETS; ++ii) {
+            targets.emplace_back(component(generator) * km, component(generator) * km, component(generator) * km);
+        }
+    }
+
+    void run(const std::string& label, const FieldOfView& fov)
+    {
+        std::size_t checksum = 0;
+        time_it(label, N_TARGETS, "test", [&]() {
+            for (const auto& target : targets) {
+                checksum += fov.contains(boresight, reference, target);
+            }
+        });
+        time_it(label + " Batched", N_TARGETS, "test", [&]() {
+            for (const bool inside : fov.contains(boresight, reference, targets)) {
+                checksum += inside;
+            }
+        });
+        std::cout << "Checksum: " << checksum << std::endl;
+    }
+
+    static constexpr std::size_t N_TARGETS = 1'000'000;
+
+    const RadiusVector<ECI> boresight{ 1.0 * km, 0.0 * km, 0.0 * km };
+    const RadiusVector<ECI> reference{ 0.0 * km, 0.0 * km, 1.0 * km };
+    std::vector<RadiusVector<ECI>> targets;
+
+    std::mt19937 generator{ 42 };
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(FieldOfViewBenchmark, Containment)
+{
+    run("Circular", CircularFieldOfView(45.0 * deg));
+    run("Polygonal (8)", PolygonalFieldOfView(45.0 * deg, 8));
+    run("Polygonal (72)", PolygonalFieldOfView(45.0 * deg, 72));
+    run("Rectangular", PolygonalFieldOfView(10.0 * deg, 30.0 * deg));
+    run("Push-Broom", PolygonalFieldOfView(1.0 * deg, 45.0 * deg));
+
+    std::map<Angle, Angle> star;
+    for (int ii = 0; ii < 16; ++ii) {
+        star[ii / 16.0 * TWO_PI] = (ii % 2 == 0) ? 45.0 * deg : 15.0 * deg;
+    }
+    run("Star (16)", PolygonalFieldOfView(star));
+}
@@ -0,0 +1,56 @@
+#include <iostream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <astro/astro.hpp>
+#include <tests/utilities/timing.hpp>
+#include <trace/trace.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace trace;
+
+using namespace mp_units;
+using mp_units::angular::unit_symbols::deg;
+
+
+class GridBenchmark : public testing::Test {
+  public:
+    GridBenchmark() {}
+
+    void SetUp() override {}
+
+    AstrodynamicsSystem sys;
+    const LatLon corner1{ -90.0 * deg, -180.0 * deg };
+    const LatLon corner4{ 90.0 * deg, 180.0 * deg };
+    const std::vector<Angle> SPACINGS = { 10.0 * deg, 5.0 * deg, 2.0 * deg, 1.0 * deg };
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(GridBenchmark, PointCountAtEqualResolution)
+{
+    // Every access run scales with the number of points, so the point count is the savings
+    for (const auto& spacing : SPACINGS) {
+        const std::string label = std::to_string(spacing.numerical_value_in(deg)) + " deg";
+
+        Grid uniform, equalArea;
+        time_it("Uniform (" + label + ")", 1, "point", [&]() {
+            uniform = Grid(sys.get_center().get(), corner1, corner4, GridType::UNIFORM, spacing);
+        });
+        time_it("Equal Area (" + label + ")", 1, "point", [&]() {
+            equalArea = Grid(sys.get_center().get(), corner1, corner4, GridType::EQUAL_AREA, spacing);
+        });
+
+        const double savings = 100.0 * (1.0 - static_cast<double>(equalArea.size()) / uniform.size());
+        std::cout << "Points (" << label << "): " << uniform.size() << " (uniform), " << equalArea.size()
+                  << " (equal area), " << savings << " (% fewer)" << std::endl;
+    }
+}
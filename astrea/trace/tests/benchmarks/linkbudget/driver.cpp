@@ -0,0 +1,147 @@
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <numbers>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <astro/astro.hpp>
+#include <tests/utilities/timing.hpp>
+#include <trace/trace.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace trace;
+
+using namespace mp_units;
+using mp_units::angular::unit_symbols::deg;
+using mp_units::angular::unit_symbols::rad;
+using mp_units::si::unit_symbols::GHz;
+using mp_units::si::unit_symbols::K;
+using mp_units::si::unit_symbols::km;
+using mp_units::si::unit_symbols::m;
+using mp_units::si::unit_symbols::MHz;
+using mp_units::si::unit_symbols::s;
+using mp_units::si::unit_symbols::W;
+
+
+class LinkBudgetBenchmark : public testing::Test {
+  public:
+    LinkBudgetBenchmark() :
+        satelliteParams(&fov, 0.5 * m, 0.6 * one, 8.0 * GHz, 10.0 * W),
+        groundParams(&fov, 5.0 * m, 0.6 * one, 8.0 * GHz, 10.0 * W, RadiusVector<RIC>(1.0 * km, 0.0 * km, 0.0 * km)),
+        satellite(sc, satelliteParams),
+        ground(sc, with_noise(groundParams)),
+        occulter(*sys.get("Earth"))
+    {
+    }
+
+    static AntennaParameters with_noise(AntennaParameters params)
+    {
+        params.set_noise_bandwidth(10.0 * MHz);
+        params.set_system_noise_temperature(absolute<K>(150.0));
+        return params;
+    }
+
+    void SetUp() override
+    {
+        // A circular equatorial orbit sweeping over a ground station, from horizon to horizon and a little beyond
+        const double radius    = 7000.0;
+        const double speed     = 7.546;
+        const double halfSweep = 30.0 * std::numbers::pi / 180.0;
+        for (std::size_t ii = 0; ii < N_SAMPLES; ++ii) {
+            const double angle = -halfSweep + 2.0 * halfSweep * ii / (N_SAMPLES - 1);
+            satellitePositions.emplace_back(radius * std::cos(angle) * km, radius * std::sin(angle) * km, 0.0 * km);
+            satelliteFrames.emplace_back(
+                satellitePositions.back(),
+                VelocityVector<ECI>(-speed * std::sin(angle) * km / s, speed * std::cos(angle) * km / s, 0.0 * km / s)
+            );
+            groundPositions.emplace_back(6378.137 * km, 0.0 * km, 0.0 * km);
+            groundFrames.emplace_back(groundPositions.back(), VelocityVector<ECI>(0.0 * km / s, 0.465 * km / s, 0.0 * km / s));
+            times.push_back(static_cast<double>(ii) * s);
+        }
+    }
+
+    // Full evaluation through the scalar antenna API at every sample
+    double scalar_carrier_to_noise(const std::size_t& ii) const
+    {
+        if (occulter.is_occulting(satellitePositions[ii], groundPositions[ii])) { return -std::numeric_limits<double>::infinity(); }
+
+        const RadiusVector<ECI> lineOfSight = groundPositions[ii] - satellitePositions[ii];
+        const Distance range                = lineOfSight.norm();
+        const Angle satelliteOffset         = (-satellitePositions[ii]).offset_angle(lineOfSight);
+        const Angle groundOffset            = groundPositions[ii].offset_angle(-lineOfSight);
+        const Angle elevation               = 90.0 * deg - groundOffset;
+
+        const CNR cnr = satellite.carrier_to_noise_ratio(ground, range, satelliteOffset, ground.atmospheric_loss(elevation));
+        return 10.0 * std::log10((cnr * ground.pattern_loss(groundOffset)).numerical_value_in(one));
+    }
+
+    static constexpr std::size_t N_SAMPLES = 1'000;
+    static constexpr std::size_t N_PASSES  = 100;
+
+    Viewer sc;
+    CircularFieldOfView fov;
+    AntennaParameters satelliteParams;
+    AntennaParameters groundParams;
+    Antenna satellite;
+    Antenna ground;
+    AstrodynamicsSystem sys;
+    EllipsoidOcculter occulter;
+
+    std::vector<RadiusVector<ECI>> satellitePositions, groundPositions;
+    std::vector<SensorFrame> satelliteFrames, groundFrames;
+    TimeVector times;
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(LinkBudgetBenchmark, PassThroughput)
+{
+    const std::size_t nSamples = N_SAMPLES * N_PASSES;
+
+    std::vector<double> scalar(N_SAMPLES);
+    time_it("Scalar", nSamples, "sample", [&]() {
+        for (std::size_t pass = 0; pass < N_PASSES; ++pass) {
+            for (std::size_t ii = 0; ii < N_SAMPLES; ++ii) {
+                scalar[ii] = scalar_carrier_to_noise(ii);
+            }
+        }
+    });
+
+    LinkBudget budget;
+    time_it("Pass", nSamples, "sample", [&]() {
+        for (std::size_t pass = 0; pass < N_PASSES; ++pass) {
+            budget = find_link_budget(
+                satellite, satellitePositions, satelliteFrames, ground, groundPositions, groundFrames, times, *sys.get("Earth")
+            );
+        }
+    });
+
+    // Both agree, including where the link is blocked
+    double checksum      = 0.0;
+    std::size_t nBlocked = 0;
+    for (std::size_t ii = 0; ii < N_SAMPLES; ++ii) {
+        if (std::isinf(scalar[ii])) {
+            ASSERT_EQ(scalar[ii], budget.carrierToNoise[ii]);
+            ++nBlocked;
+            continue;
+        }
+        ASSERT_NEAR(scalar[ii], budget.carrierToNoise[ii], 1.0e-6);
+        checksum += budget.carrierToNoise[ii];
+    }
+    std::cout << "Blocked Samples: " << nBlocked << " of " << N_SAMPLES << std::endl;
+    std::cout << "Checksum: " << checksum << std::endl;
+
+    const RiseSetArray closes = find_link_margin_intervals(budget, 10.0 * one, 3.0 * one);
+    std::cout << "Link Closes: " << closes << std::endl;
+    ASSERT_GT(nBlocked, 0);
+    ASSERT_LT(nBlocked, N_SAMPLES);
+}
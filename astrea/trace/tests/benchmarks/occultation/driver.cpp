@@ -0,0 +1,115 @@
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <mp-units/math.h>
+#include <mp-units/systems/angular/math.h>
+
+#include <astro/astro.hpp>
+#include <tests/utilities/timing.hpp>
+#include <trace/trace.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace trace;
+
+using namespace mp_units;
+using mp_units::si::unit_symbols::km;
+
+
+// The spherical kernel this replaced, kept here as the baseline
+bool spherical_is_earth_occulting(const RadiusVector<ECI>& position1, const RadiusVector<ECI>& position2, const AstrodynamicsSystem& sys)
+{
+    const RadiusVector<ECI> nadir1     = -position1;
+    const Distance nadir1Mag           = nadir1.norm();
+    const RadiusVector<ECI> radius1to2 = position2 - position1;
+
+    static const Distance& radiusEarthMag = sys.get("Earth")->get_equitorial_radius() + 100.0 * km;
+    const Angle earthLimbAngle            = asin(radiusEarthMag / nadir1Mag);
+    const Angle satelliteNadirAngle       = nadir1.offset_angle(radius1to2);
+    if (satelliteNadirAngle <= earthLimbAngle) {
+        const Distance radius1to2Mag  = radius1to2.norm();
+        const Distance earthLimbRange = nadir1Mag * cos(earthLimbAngle);
+        if (radius1to2Mag > earthLimbRange) { return true; }
+    }
+    return false;
+}
+
+
+class OccultationBenchmark : public testing::Test {
+  public:
+    OccultationBenchmark() :
+        occulter(*sys.get("Earth"))
+    {
+    }
+
+    void SetUp() override
+    {
+        // LEO to MEO lines of sight in every direction
+        std::normal_distribution<double> component(0.0, 1.0);
+        std::uniform_real_distribution<double> leoRadius(6800.0, 8000.0);
+        std::uniform_real_distribution<double> meoRadius(8000.0, 30000.0);
+        for (std::size_t ii = 0; ii < N_PAIRS; ++ii) {
+            positions1.push_back(random_position(component, leoRadius(generator)));
+            positions2.push_back(random_position(component, meoRadius(generator)));
+        }
+    }
+
+    RadiusVector<ECI> random_position(std::normal_distribution<double>& component, const double& radius)
+    {
+        const double x     = component(generator);
+        const double y     = component(generator);
+        const double z     = component(generator);
+        const double scale = radius / std::sqrt(x * x + y * y + z * z);
+        return RadiusVector<ECI>(x * scale * km, y * scale * km, z * scale * km);
+    }
+
+    static constexpr std::size_t N_PAIRS = 1'000'000;
+
+    AstrodynamicsSystem sys;
+    EllipsoidOcculter occulter;
+    std::vector<RadiusVector<ECI>> positions1;
+    std::vector<RadiusVector<ECI>> positions2;
+
+    std::mt19937 generator{ 42 };
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(OccultationBenchmark, Throughput)
+{
+    std::size_t sphericalCount = 0;
+    time_it("Spherical Limb Angle", N_PAIRS, "test", [&]() {
+        for (std::size_t ii = 0; ii < N_PAIRS; ++ii) {
+            sphericalCount += spherical_is_earth_occulting(positions1[ii], positions2[ii], sys);
+        }
+    });
+
+    std::size_t scalarCount = 0;
+    time_it("Ellipsoid Scalar", N_PAIRS, "test", [&]() {
+        for (std::size_t ii = 0; ii < N_PAIRS; ++ii) {
+            scalarCount += occulter.is_occulting(positions1[ii], positions2[ii]);
+        }
+    });
+
+    std::size_t batchedCount = 0;
+    time_it("Ellipsoid Batched", N_PAIRS, "test", [&]() {
+        for (const bool occulted : occulter.is_occulting(positions1, positions2)) {
+            batchedCount += occulted;
+        }
+    });
+
+    // The models differ near the limb and the poles, so only the ellipsoid counts must match
+    std::cout << "Occulted: " << sphericalCount << " (sphere), " << scalarCount << " (ellipsoid), " << batchedCount
+              << " (batched)" << std::endl;
+    ASSERT_EQ(scalarCount, batchedCount);
+}
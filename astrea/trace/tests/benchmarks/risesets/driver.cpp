@@ -0,0 +1,101 @@
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <tests/utilities/timing.hpp>
+#include <trace/trace.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace trace;
+
+using namespace mp_units;
+using mp_units::si::unit_symbols::s;
+
+
+class RiseSetBenchmark : public testing::Test {
+  public:
+    RiseSetBenchmark() {}
+
+    void SetUp() override {}
+
+    // Fragmented access history with roughly half of the timeline covered
+    RiseSetArray random_risesets(const std::size_t& nPairs)
+    {
+        std::uniform_real_distribution<double> step(1.0, 100.0);
+
+        std::vector<Time> risesets;
+        risesets.reserve(2 * nPairs);
+        double time = 0.0;
+        for (std::size_t ii = 0; ii < 2 * nPairs; ++ii) {
+            time += step(generator);
+            risesets.push_back(time * s);
+        }
+        return RiseSetArray(std::move(risesets));
+    }
+
+    const std::vector<std::size_t> SIZES = { 10'000, 100'000, 1'000'000 };
+    const std::size_t N_SATS             = 24;
+
+    std::mt19937 generator{ 42 };
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(RiseSetBenchmark, PairwiseOperations)
+{
+    for (const auto& nPairs : SIZES) {
+        const RiseSetArray a = random_risesets(nPairs);
+        const RiseSetArray b = random_risesets(nPairs);
+        const std::string size = std::to_string(nPairs);
+
+        std::size_t checksum = 0;
+        time_it("Union (" + size + ")", 2 * nPairs, "interval", [&]() { checksum += (a | b).size(); });
+        time_it("Intersection (" + size + ")", 2 * nPairs, "interval", [&]() { checksum += (a & b).size(); });
+        time_it("Difference (" + size + ")", 2 * nPairs, "interval", [&]() { checksum += (a - b).size(); });
+
+        RiseSetArray c = a;
+        time_it("In-Place Union (" + size + ")", 2 * nPairs, "interval", [&]() {
+            c |= b;
+            checksum += c.size();
+        });
+        std::cout << "Checksum: " << checksum << std::endl;
+    }
+}
+
+TEST_F(RiseSetBenchmark, CoverageByNSatellites)
+{
+    for (const auto& nPairs : SIZES) {
+        const std::size_t nPairsPerSat = nPairs / N_SATS;
+        std::vector<RiseSetArray> accesses;
+        for (std::size_t ii = 0; ii < N_SATS; ++ii) {
+            accesses.push_back(random_risesets(nPairsPerSat));
+        }
+        const std::string size = std::to_string(nPairsPerSat * N_SATS);
+
+        // Folding pairwise touches the growing result once per satellite
+        std::size_t checksum = 0;
+        time_it("Pairwise Union (" + size + ")", nPairsPerSat * N_SATS, "interval", [&]() {
+            RiseSetArray result = accesses[0];
+            for (std::size_t ii = 1; ii < accesses.size(); ++ii) {
+                result |= accesses[ii];
+            }
+            checksum += result.size();
+        });
+        time_it("K-Way Union (" + size + ")", nPairsPerSat * N_SATS, "interval", [&]() {
+            checksum += riseset_union(accesses).size();
+        });
+        time_it("At Least 4 In View (" + size + ")", nPairsPerSat * N_SATS, "interval", [&]() {
+            checksum += riseset_coverage(accesses, 4).size();
+        });
+        std::cout << "Checksum: " << checksum << std::endl;
+    }
+}
@@ -0,0 +1,184 @@
+#include <cmath>
+#include <iostream>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <astro/astro.hpp>
+#include <tests/utilities/timing.hpp>
+#include <trace/trace.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace trace;
+
+using namespace mp_units;
+using mp_units::angular::unit_symbols::deg;
+using mp_units::si::unit_symbols::km;
+using mp_units::si::unit_symbols::min;
+using mp_units::si::unit_symbols::s;
+
+
+class SensorBenchmark : public testing::Test {
+  public:
+    SensorBenchmark() :
+        station(sys.get("Earth").get(), 38.895 * deg, -77.0366 * deg, 0.0 * km, { "Washington DC" }),
+        relay(sys.get("Earth").get(), 0.0 * deg, 0.0 * deg, 0.0 * km, { "Relay" }),
+        fov(60.0 * deg)
+    {
+    }
+
+    void SetUp() override
+    {
+        // Several anti-nadir sensors on each platform, so every sample is checked for every sensor pair
+        const RadiusVector<RIC> antiNadir{ 1.0 * km, 0.0 * km, 0.0 * km };
+        for (std::size_t ii = 0; ii < N_PAYLOADS; ++ii) {
+            station.attach_payload(SensorParameters(&fov, antiNadir));
+            relay.attach_payload(SensorParameters(&fov));
+        }
+
+        // One day at one minute resolution against a circular LEO orbit
+        const double radius = 7000.0;
+        const double rate   = std::sqrt(398600.4418 / (radius * radius * radius));
+        const double incl   = 51.6 * std::numbers::pi / 180.0;
+        for (std::size_t ii = 0; ii < N_SAMPLES; ++ii) {
+            const Time time    = static_cast<double>(ii) * min;
+            const double theta = rate * time.numerical_value_in(s);
+
+            const RadiusVector<ECI> satPosition{ radius * std::cos(theta) * km,
+                                                 radius * std::sin(theta) * std::cos(incl) * km,
+                                                 radius * std::sin(theta) * std::sin(incl) * km };
+            const VelocityVector<ECI> satVelocity{ -radius * rate * std::sin(theta) * km / s,
+                                                   radius * rate * std::cos(theta) * std::cos(incl) * km / s,
+                                                   radius * rate * std::cos(theta) * std::sin(incl) * km / s };
+            times.push_back(time);
+            satPositions.push_back(satPosition);
+            satVelocities.push_back(satVelocity);
+        }
+    }
+
+    // Access info for every sample, building each platform frame once per time
+    std::vector<AccessInfo> build_access_info()
+    {
+        std::vector<AccessInfo> accessInfo(N_SAMPLES);
+        stationFrames.resize(N_SAMPLES);
+        satFrames.resize(N_SAMPLES);
+        for (std::size_t ii = 0; ii < N_SAMPLES; ++ii) {
+            const Date date           = epoch + times[ii];
+            accessInfo[ii].time       = times[ii];
+            accessInfo[ii].position1  = station.get_inertial_position(date);
+            accessInfo[ii].position2  = satPositions[ii];
+            stationFrames[ii]         = SensorFrame(accessInfo[ii].position1, station.get_inertial_velocity(date));
+            satFrames[ii]             = SensorFrame(satPositions[ii], satVelocities[ii]);
+            accessInfo[ii].frame1     = &stationFrames[ii];
+            accessInfo[ii].frame2     = &satFrames[ii];
+            accessInfo[ii].id1        = station.get_id();
+            accessInfo[ii].id2        = relay.get_id();
+            accessInfo[ii].isOcculted = is_earth_occulting(accessInfo[ii].position1, accessInfo[ii].position2, sys);
+        }
+        return accessInfo;
+    }
+
+    static constexpr std::size_t N_SAMPLES  = 1441;
+    static constexpr std::size_t N_PAYLOADS = 4;
+    static constexpr std::size_t N_TARGETS  = 1'000'000;
+
+    AstrodynamicsSystem sys;
+    Date epoch;
+    GroundStation station;
+    GroundStation relay;
+    CircularFieldOfView fov;
+
+    TimeVector times;
+    std::vector<RadiusVector<ECI>> satPositions;
+    std::vector<VelocityVector<ECI>> satVelocities;
+    std::vector<SensorFrame> stationFrames;
+    std::vector<SensorFrame> satFrames;
+
+    std::mt19937 generator{ 42 };
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(SensorBenchmark, CircularContainment)
+{
+    // Targets spread over the whole sphere
+    std::normal_distribution<double> component(0.0, 1.0);
+    std::vector<RadiusVector<ECI>> targets;
+    targets.reserve(N_TARGETS);
+    for (std::size_t ii = 0; ii < N_TARGETS; ++ii) {
+        targets.emplace_back(component(generator) * km, component(generator) * km, component(generator) * km);
+    }
+    const RadiusVector<ECI> boresight{ 1.0 * km, 0.0 * km, 0.0 * km };
+    const Angle halfCone = 60.0 * deg;
+
+    std::size_t angleCount = 0;
+    time_it("Angle Comparison", N_TARGETS, "check", [&]() {
+        for (const auto& target : targets) {
+            angleCount += (calculate_angle_between_vectors(boresight, target) <= halfCone);
+        }
+    });
+
+    std::size_t cosineCount = 0;
+    time_it("Cosine Comparison", N_TARGETS, "check", [&]() {
+        for (const auto& target : targets) {
+            cosineCount += fov.contains(boresight, target);
+        }
+    });
+    std::cout << "Checksum: " << angleCount << " (angle), " << cosineCount << " (cosine)" << std::endl;
+}
+
+TEST_F(SensorBenchmark, SensorToSensorAccesses)
+{
+    const std::size_t nChecks = N_SAMPLES * N_PAYLOADS * N_PAYLOADS;
+    std::cout << "Samples: " << N_SAMPLES << ", Sensor Pairs: " << N_PAYLOADS * N_PAYLOADS << std::endl;
+
+    // Every check rebuilds the frame of the platform from its state
+    std::size_t perCallCount = 0;
+    time_it("Per-Call Frames", nChecks, "check", [&]() {
+        const std::vector<AccessInfo> accessInfo = build_access_info();
+        for (const auto& sensor1 : station.get_payloads()) {
+            for (const auto& sensor2 : relay.get_payloads()) {
+                for (const auto& info : accessInfo) {
+                    if (info.isOcculted) { continue; }
+                    const Date date = epoch + info.time;
+                    perCallCount += sensor1.contains(info.position2 - info.position1, date)
+                                    || sensor2.contains(info.position1 - info.position2, date);
+                }
+            }
+        }
+    });
+
+    // Frames are built once per platform per time, and shared by every sensor pair
+    std::size_t sharedCount = 0;
+    time_it("Shared Frames", nChecks, "check", [&]() {
+        const std::vector<AccessInfo> accessInfo = build_access_info();
+        for (const auto& sensor1 : station.get_payloads()) {
+            for (const auto& sensor2 : relay.get_payloads()) {
+                sharedCount += find_sensor_to_sensor_visibility(accessInfo, sensor1, sensor2, false, epoch).count();
+            }
+        }
+    });
+
+    std::size_t riseSetCount = 0;
+    time_it("Shared Frames Rise/Set", nChecks, "check", [&]() {
+        const std::vector<AccessInfo> accessInfo = build_access_info();
+        for (const auto& sensor1 : station.get_payloads()) {
+            for (const auto& sensor2 : relay.get_payloads()) {
+                riseSetCount += find_sensor_to_sensor_accesses(accessInfo, sensor1, sensor2, false, epoch).size();
+            }
+        }
+    });
+
+    // The relay frame comes from the synthetic orbit rather than its parent, so only the shared paths are comparable
+    std::cout << "Checksum: " << perCallCount << " (per-call), " << sharedCount << " (shared), " << riseSetCount
+              << " (rise/set)" << std::endl;
+}
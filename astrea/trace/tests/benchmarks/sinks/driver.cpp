@@ -0,0 +1,159 @@
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <csv-parser/csv.hpp>
+
+#include <tests/utilities/timing.hpp>
+#include <trace/trace.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace trace;
+
+using namespace mp_units;
+using mp_units::si::unit_symbols::s;
+
+
+class AccessSinkBenchmark : public testing::Test {
+  public:
+    AccessSinkBenchmark() {}
+
+    void SetUp() override
+    {
+        directory = std::filesystem::temp_directory_path() / "astrea_sink_benchmark";
+        std::filesystem::create_directories(directory);
+
+        // Satellites first, then grounds, like the constellation and ground architecture in the access driver
+        for (std::size_t ii = 0; ii < N_SATS + N_GROUNDS; ++ii) {
+            const std::string name = (ii < N_SATS ? "SAT-" : "GROUND-") + std::to_string(ii);
+            platforms.emplace_back(ii, name);
+            names.add(ii, name);
+        }
+    }
+
+    void TearDown() override { std::filesystem::remove_all(directory); }
+
+    // Accesses for a single satellite and ground pair, as the analysis would produce them
+    RiseSetArray random_risesets()
+    {
+        std::uniform_real_distribution<double> step(1.0, 600.0);
+
+        std::vector<Time> risesets;
+        risesets.reserve(2 * N_INTERVALS_PER_PAIR);
+        double time = 0.0;
+        for (std::size_t ii = 0; ii < 2 * N_INTERVALS_PER_PAIR; ++ii) {
+            time += step(generator);
+            risesets.push_back(time * s);
+        }
+        return RiseSetArray(std::move(risesets));
+    }
+
+    // Stream every pair to a sink as it is generated
+    void stream_to(AccessSink& sink)
+    {
+        for (std::size_t iSat = 0; iSat < N_SATS; ++iSat) {
+            for (std::size_t iGround = N_SATS; iGround < N_SATS + N_GROUNDS; ++iGround) {
+                sink.write(iSat, iGround, random_risesets());
+            }
+        }
+        sink.close();
+    }
+
+    static constexpr std::size_t N_SATS               = 4'000;
+    static constexpr std::size_t N_GROUNDS            = 50;
+    static constexpr std::size_t N_INTERVALS_PER_PAIR = 6;
+    static constexpr std::size_t N_INTERVALS          = N_SATS * N_GROUNDS * N_INTERVALS_PER_PAIR;
+
+    std::filesystem::path directory;
+    std::vector<std::pair<std::size_t, std::string>> platforms;
+    PlatformNameIndex names;
+
+    std::mt19937 generator{ 42 };
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(AccessSinkBenchmark, Writers)
+{
+    // Previous approach: hold every pair, then search all platforms for each pair's names
+    const std::filesystem::path legacyFile = directory / "legacy.csv";
+    std::size_t legacyHeld                 = 0;
+    time_it("Legacy CSV", N_INTERVALS, "interval", [&]() {
+        AccessArray accesses;
+        for (std::size_t iSat = 0; iSat < N_SATS; ++iSat) {
+            for (std::size_t iGround = N_SATS; iGround < N_SATS + N_GROUNDS; ++iGround) {
+                accesses[iSat, iGround] = random_risesets();
+            }
+        }
+        legacyHeld = N_INTERVALS;
+
+        std::ofstream ss(legacyFile);
+        auto writer = csv::make_csv_writer(ss);
+        writer << std::vector<std::string>({ "Sender", "Receiver", "Rise - Set Times (s)" });
+        for (const auto& [idPair, risesets] : accesses) {
+            std::string sender, receiver;
+            for (const auto& [id, name] : platforms) {
+                if (id == idPair.sender) { sender = name; }
+                if (id == idPair.receiver) { receiver = name; }
+            }
+
+            std::vector<std::string> row{ sender, receiver };
+            for (const auto& str : risesets.to_string_vector()) {
+                row.push_back(str);
+            }
+            writer << row;
+        }
+    });
+
+    generator.seed(42);
+    const std::filesystem::path csvFile = directory / "streamed.csv";
+    CsvAccessSink csvSink(csvFile, names);
+    time_it("Streaming CSV", N_INTERVALS, "interval", [&]() { stream_to(csvSink); });
+
+    generator.seed(42);
+    const std::filesystem::path binaryFile = directory / "streamed.bin";
+    BinaryAccessSink binarySink(binaryFile);
+    time_it("Streaming Binary", N_INTERVALS, "interval", [&]() { stream_to(binarySink); });
+
+    generator.seed(42);
+    const std::filesystem::path columnarFile = directory / "streamed.col";
+    ColumnarAccessSink columnarSink(columnarFile);
+    time_it("Streaming Columnar", N_INTERVALS, "interval", [&]() { stream_to(columnarSink); });
+
+    // Streaming sinks only ever hold one pair plus their write buffer
+    std::cout << "Intervals held: " << legacyHeld << " (legacy), " << N_INTERVALS_PER_PAIR << " (streaming)" << std::endl;
+    std::cout << "File size: " << std::filesystem::file_size(legacyFile) << " (legacy CSV), "
+              << std::filesystem::file_size(csvFile) << " (CSV), " << std::filesystem::file_size(binaryFile) << " (binary), "
+              << std::filesystem::file_size(columnarFile) << " (columnar) bytes" << std::endl;
+
+    // Every writer saw the same accesses
+    ASSERT_EQ(csvSink.get_interval_count(), N_INTERVALS);
+    ASSERT_EQ(binarySink.get_interval_count(), N_INTERVALS);
+    ASSERT_EQ(columnarSink.get_interval_count(), N_INTERVALS);
+
+    AccessArray binaryAccesses;
+    time_it("Binary Read", N_INTERVALS, "interval", [&]() { binaryAccesses = BinaryAccessSink::read(binaryFile); });
+    AccessArray columnarAccesses;
+    time_it("Columnar Read", N_INTERVALS, "interval", [&]() {
+        columnarAccesses = ColumnarAccessSink::read(columnarFile);
+    });
+
+    ASSERT_EQ(binaryAccesses.size(), N_SATS * N_GROUNDS);
+    ASSERT_EQ(columnarAccesses.size(), N_SATS * N_GROUNDS);
+    for (const auto& [idPair, risesets] : binaryAccesses) {
+        ASSERT_EQ(columnarAccesses.at(idPair.sender, idPair.receiver), risesets);
+    }
+}
@@ -0,0 +1,128 @@
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <astro/astro.hpp>
+#include <tests/utilities/timing.hpp>
+#include <trace/trace.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace trace;
+
+using namespace mp_units;
+using mp_units::angular::unit_symbols::deg;
+using mp_units::si::unit_symbols::min;
+using mp_units::si::unit_symbols::s;
+
+
+class VisibilityBenchmark : public testing::Test {
+  public:
+    VisibilityBenchmark() :
+        grid(sys.get("Earth").get(), { -90.0 * deg, -180.0 * deg }, { 90.0 * deg, 180.0 * deg }, GridType::UNIFORM, 5.0 * deg)
+    {
+    }
+
+    void SetUp() override
+    {
+        // One day at one minute resolution
+        for (std::size_t ii = 0; ii < N_SAMPLES; ++ii) {
+            times.push_back(static_cast<double>(ii) * min);
+        }
+
+        // Synthetic LEO passes, a handful of 5-15 minute passes per satellite per point
+        std::uniform_int_distribution<std::size_t> nPasses(2, 8);
+        std::uniform_int_distribution<std::size_t> passStart(0, N_SAMPLES - 1);
+        std::uniform_int_distribution<std::size_t> passLength(5, 15);
+        for (std::size_t iPoint = 0; iPoint < grid.size(); ++iPoint) {
+            std::vector<VisibilityBitset> pointBitsets;
+            std::vector<RiseSetArray> pointRisesets;
+            for (std::size_t iSat = 0; iSat < N_SATS; ++iSat) {
+                VisibilityBitset bitset(N_SAMPLES);
+                const std::size_t n = nPasses(generator);
+                for (std::size_t iPass = 0; iPass < n; ++iPass) {
+                    const std::size_t start = passStart(generator);
+                    const std::size_t end   = std::min(start + passLength(generator), N_SAMPLES);
+                    for (std::size_t ii = start; ii < end; ++ii) {
+                        bitset.set(ii);
+                    }
+                }
+                pointRisesets.push_back(bitset.to_risesets(times));
+                pointBitsets.push_back(std::move(bitset));
+            }
+            bitsets.push_back(std::move(pointBitsets));
+            risesets.push_back(std::move(pointRisesets));
+        }
+    }
+
+    static constexpr std::size_t N_SAMPLES = 1441;
+    static constexpr std::size_t N_SATS    = 24;
+
+    AstrodynamicsSystem sys;
+    Grid grid;
+    TimeVector times;
+    std::vector<std::vector<VisibilityBitset>> bitsets; // point-major, one per satellite
+    std::vector<std::vector<RiseSetArray>> risesets;    // the same passes as rise/set pairs
+
+    std::mt19937 generator{ 42 };
+};
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST_F(VisibilityBenchmark, NumberOfSatellitesInView)
+{
+    std::cout << "Grid Points: " << grid.size() << ", Satellites: " << N_SATS << ", Samples: " << N_SAMPLES << std::endl;
+
+    std::size_t checksum = 0;
+    time_it("Bitset Count Visible", grid.size(), "point", [&]() {
+        for (const auto& pointBitsets : bitsets) {
+            const std::vector<std::size_t> counts = count_visible(pointBitsets);
+            checksum += counts[N_SAMPLES / 2];
+        }
+    });
+    time_it("Bitset At Least 4 In View", grid.size(), "point", [&]() {
+        for (const auto& pointBitsets : bitsets) {
+            checksum += at_least_visible(pointBitsets, 4).count();
+        }
+    });
+    time_it("RiseSet At Least 4 In View", grid.size(), "point", [&]() {
+        for (const auto& pointRisesets : risesets) {
+            checksum += riseset_coverage(pointRisesets, 4).size();
+        }
+    });
+    std::cout << "Checksum: " << checksum << std::endl;
+}
+
+TEST_F(VisibilityBenchmark, PercentCoverage)
+{
+    const Time duration = times.back() - times.front();
+
+    double bitsetCoverage = 0.0;
+    time_it("Bitset Percent Coverage", grid.size(), "point", [&]() {
+        for (const auto& pointBitsets : bitsets) {
+            bitsetCoverage += static_cast<double>(at_least_visible(pointBitsets, 1).count()) / N_SAMPLES;
+        }
+    });
+
+    double risesetCoverage = 0.0;
+    time_it("RiseSet Percent Coverage", grid.size(), "point", [&]() {
+        for (const auto& pointRisesets : risesets) {
+            const RiseSetArray covered = riseset_union(pointRisesets);
+            if (covered.size() == 0) { continue; }
+            const Time accessTime = covered.access_time() * static_cast<double>(covered.size() / 2);
+            risesetCoverage += (accessTime / duration).numerical_value_in(one);
+        }
+    });
+
+    // Sampled and continuous coverage differ by the sample spacing at each pass boundary
+    std::cout << "Mean Coverage: " << 100.0 * bitsetCoverage / grid.size() << " (%, bitset), "
+              << 100.0 * risesetCoverage / grid.size() << " (%, rise/set)" << std::endl;
+}
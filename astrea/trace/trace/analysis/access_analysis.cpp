@@ -1,5 +1,10 @@
 #include <trace/trace.hpp>
 
+#include <algorithm>
+#include <optional>
+#include <span>
+#include <stdexcept>
+
 #include <mp-units/math.h>
 #include <mp-units/systems/angular/math.h>
 
@@ -7,16 +12,20 @@
 #include <astro/state/CartesianVector.hpp>
 #include <astro/state/State.hpp>
 #include <astro/state/StateHistory.hpp>
+#include <astro/state/frames/EarthRotationProvider.hpp>
 #include <astro/state/frames/frames.hpp>
 #include <astro/state/orbital_elements/instances/Cartesian.hpp>
 #include <astro/systems/AstrodynamicsSystem.hpp>
 #include <astro/time/Date.hpp>
 #include <astro/utilities/conversions.hpp>
 
+#include <trace/analysis/occultation.hpp>
 #include <trace/platforms/ground/GroundArchitecture.hpp>
+#include <trace/platforms/ground/Grid.hpp>
 #include <trace/platforms/ground/GroundStation.hpp>
 #include <trace/platforms/sensors/Sensor.hpp>
 #include <trace/platforms/vehicles/Viewer.hpp>
+#include <trace/risesets/VisibilityBitset.hpp>
 #include <trace/types/typedefs.hpp>
 
 namespace astrea {
@@ -40,94 +49,446 @@ using mp_units::si::unit_symbols::km;
 using mp_units::si::unit_symbols::s;
 
 
-struct AccessInfo {
-    Time time;                                 // Time of access
-    astro::RadiusVector<astro::ECI> position1; // Position of the first object at the time of access
-    astro::RadiusVector<astro::ECI> position2; // Position of the second object at the time of access
-    std::size_t id1;                           // ID of the first object
-    std::size_t id2;                           // ID of the second object
-    bool isOcculted;                           // Flag indicating if the access is occulted
+namespace {
+
+// Number of viewers sampled together when pairing a constellation with itself
+constexpr std::size_t VIEWER_BLOCK_SIZE = 64;
+
+// Inertial positions and sensor frames of a platform at every time, built once and shared by every pairing
+struct PlatformSamples {
+    std::vector<RadiusVector<ECI>> positions; // Inertial position at each time
+    std::vector<SensorFrame> frames;          // Sensor frame at each time, empty if the platform has no sensors
 };
 
+// Ground platforms turn rigidly with the Earth, so their position and RIC frame are constant in ECEF
+struct EarthFixedState {
+    RadiusVector<ECEF> position;                           // Earth-fixed position
+    std::optional<astro::DCM<astro::RIC, ECEF>> ricToEcef; // Earth-fixed sensor frame, empty if the platform has no sensors
+};
 
-AccessArray find_internal_accesses(ViewerConstellation& constel, const Time& resolution, const Date& epoch, const AstrodynamicsSystem& sys)
+// Common time grid for every viewer in the constellation
+TimeVector get_constellation_times(ViewerConstellation& constel, const Time& resolution)
 {
-    // Create time array
     const auto& states    = constel[0].get_state_history();
     const Date& startDate = states.first().get_epoch();
     const Date& endDate   = states.last().get_epoch();
 
-    TimeVector times = create_time_vector(0.0 * s, endDate - startDate, resolution); // TODO: Check all state histories for common time frame
+    return create_time_vector(0.0 * s, endDate - startDate, resolution); // TODO: Check all state histories for common time frame
+}
 
-    // For each sat
-    AccessArray allAccesses;
-    for (std::size_t iViewer = 0; iViewer < constel.size(); ++iViewer) {
-        Viewer& viewer1       = constel[iViewer];
-        const std::size_t id1 = viewer1.get_id();
+// Keep only the Earth-fixed state of each ground station. It is rotated into ECI one time step at a time as each
+// viewer is paired with it, so memory does not grow with the number of stations times the number of times.
+std::vector<EarthFixedState>
+    get_earth_fixed_states(const GroundArchitecture& grounds, const astro::EarthRotationProvider& earthRotation)
+{
+    std::vector<EarthFixedState> states;
+    states.reserve(grounds.size());
+    for (const auto& ground : grounds) {
+        EarthFixedState& state = states.emplace_back(ground.get_earth_fixed_position(), std::nullopt);
+        if (ground.get_payloads().empty()) { continue; }
+
+        // Build the frame at the first time and carry it into ECEF
+        const astro::DCM<ECI, ECEF>& eciToEcef = earthRotation.get_dcm(0);
+        const SensorFrame frame(eciToEcef.transpose() * state.position, ground.get_inertial_velocity(earthRotation.get_date(0)));
+        state.ricToEcef = eciToEcef * frame.ricToEci;
+    }
+    return states;
+}
 
-        // For every other sat
-        for (std::size_t jViewer = iViewer + 1; jViewer < constel.size(); ++jViewer) {
-            Viewer& viewer2       = constel[jViewer];
-            const std::size_t id2 = viewer2.get_id();
+// Rotate an Earth-fixed position into ECI at every time, reusing the storage of the previous positions
+void rotate_into_eci(
+    const RadiusVector<ECEF>& position,
+    const astro::EarthRotationProvider& earthRotation,
+    std::vector<RadiusVector<ECI>>& positions
+)
+{
+    positions.resize(earthRotation.size());
+    for (std::size_t ii = 0; ii < earthRotation.size(); ++ii) {
+        positions[ii] = earthRotation.get_dcm(ii).transpose() * position;
+    }
+}
 
-            // Satellite-level access for viewer1 -> viewer2
-            RiseSetArray satAccess = find_platform_to_platform_accesses(&viewer1, &viewer2, times, sys, epoch);
+// Rotate a ground station into ECI at every time, reusing the storage of the previous samples
+void sample_earth_fixed(const EarthFixedState& state, const astro::EarthRotationProvider& earthRotation, PlatformSamples& samples)
+{
+    rotate_into_eci(state.position, earthRotation, samples.positions);
+    samples.frames.resize(state.ricToEcef ? earthRotation.size() : 0);
+    for (std::size_t ii = 0; ii < samples.frames.size(); ++ii) {
+        samples.frames[ii].ricToEci = earthRotation.get_dcm(ii).transpose() * *state.ricToEcef;
+    }
+}
+
+// Build the frame of a platform once per time so every sensor on it can share it
+std::vector<SensorFrame>
+    get_sensor_frames(const SensorPlatform* platform, std::span<const RadiusVector<ECI>> positions, const TimeVector& times, const Date& epoch)
+{
+    std::vector<SensorFrame> frames;
+    if (platform->get_payloads().empty()) { return frames; }
+
+    frames.reserve(times.size());
+    for (std::size_t ii = 0; ii < times.size(); ++ii) {
+        frames.emplace_back(positions[ii], platform->get_inertial_velocity(epoch + times[ii]));
+    }
+    return frames;
+}
+
+// Sample a platform at every time, reusing the storage of the previous samples
+void sample_platform(const SensorPlatform* platform, const TimeVector& times, const Date& epoch, PlatformSamples& samples)
+{
+    samples.positions.clear();
+    samples.positions.reserve(times.size());
+    for (const auto& time : times) {
+        samples.positions.push_back(platform->get_inertial_position(epoch + time));
+    }
+    samples.frames = get_sensor_frames(platform, samples.positions, times, epoch);
+}
+
+// Get all access info once to avoid unnecessary calcs. The frames are not copied, so they must outlive the access info.
+std::vector<AccessInfo> get_access_info(
+    const std::size_t& id1,
+    const PlatformSamples& samples1,
+    const std::size_t& id2,
+    std::span<const RadiusVector<ECI>> positions2,
+    std::span<const SensorFrame> frames2,
+    const TimeVector& times,
+    const EllipsoidOcculter& occulter
+)
+{
+    if (positions2.size() != times.size() || samples1.positions.size() != times.size()) {
+        throw std::runtime_error("The number of precomputed positions must match the number of times.");
+    }
+
+    // Test every line of sight at once
+    const std::vector<bool> occulted = occulter.is_occulting(samples1.positions, positions2);
+
+    std::vector<AccessInfo> accessInfo(times.size());
+    for (std::size_t ii = 0; ii < times.size(); ++ii) {
+        const RadiusVector<ECI>& position1 = samples1.positions[ii];
+        const RadiusVector<ECI>& position2 = positions2[ii];
+
+        // Get sat -> ground vector at current time
+        accessInfo[ii].time       = times[ii];
+        accessInfo[ii].id1        = id1;
+        accessInfo[ii].id2        = id2;
+        accessInfo[ii].position1  = position1;
+        accessInfo[ii].position2  = position2;
+        accessInfo[ii].isOcculted = occulted[ii];
+
+        // Platforms without sensors have no frames, and are never asked for one
+        if (!samples1.frames.empty()) { accessInfo[ii].frame1 = &samples1.frames[ii]; }
+        if (!frames2.empty()) { accessInfo[ii].frame2 = &frames2[ii]; }
+    }
+    return accessInfo;
+}
+
+// Combine the accesses of every pair of sensors on two platforms, optionally storing them on the sensors
+RiseSetArray find_platform_to_platform_accesses(
+    SensorPlatform* platform1,
+    SensorPlatform* platform2,
+    const std::vector<AccessInfo>& accessInfo,
+    const bool& twoWay,
+    const Date& epoch,
+    const bool& store
+)
+{
+    RiseSetArray access;
+    for (auto& sensor1 : platform1->get_payloads()) {
+        for (auto& sensor2 : platform2->get_payloads()) {
+            RiseSetArray sensorAccess = find_sensor_to_sensor_accesses(accessInfo, sensor1, sensor2, twoWay, epoch);
 
             // Store
-            if (satAccess.size() > 0) {
-                viewer1.add_access(id2, satAccess);
-                viewer2.add_access(id1, satAccess);
-                allAccesses[id1, id2] = satAccess; // TODO: Consider id2->id1 as well
+            if (sensorAccess.size() > 0) {
+                access = (access | sensorAccess);
+                if (store) {
+                    sensor1.add_access(sensor2.get_id(), sensorAccess);
+                    sensor2.add_access(sensor1.get_id(), sensorAccess);
+                }
             }
         }
     }
+    return access;
+}
 
-    return allAccesses;
+// Gather viewers in evaluation order
+std::vector<Viewer*> get_viewers(ViewerConstellation& constel)
+{
+    std::vector<Viewer*> viewers;
+    viewers.reserve(constel.size());
+    for (Viewer& viewer : constel) {
+        viewers.push_back(&viewer);
+    }
+    return viewers;
 }
 
-AccessArray find_accesses(ViewerConstellation& constel, GroundArchitecture& grounds, const Time& resolution, const Date& epoch, const AstrodynamicsSystem& sys)
+// Visit the accesses of every pair of viewers as soon as the pair is finished
+template <class Visitor_T>
+void for_each_internal_access(
+    ViewerConstellation& constel,
+    const Time& resolution,
+    const Date& epoch,
+    const AstrodynamicsSystem& sys,
+    const bool& store,
+    Visitor_T&& visit
+)
+{
+    // Create time array
+    const TimeVector times = get_constellation_times(constel, resolution);
+    const EllipsoidOcculter occulter(*sys.get("Earth"));
+
+    // Every viewer is paired with every other. Viewers are sampled a block at a time and each block is paired with
+    // itself and every later block, so only two blocks of samples are held however large the constellation is.
+    const std::vector<Viewer*> viewers = get_viewers(constel);
+    std::vector<PlatformSamples> block1(VIEWER_BLOCK_SIZE);
+    std::vector<PlatformSamples> block2(VIEWER_BLOCK_SIZE);
+    const auto sample_block = [&](const std::size_t& first, const std::size_t& last, std::vector<PlatformSamples>& block) {
+        for (std::size_t iViewer = first; iViewer < last; ++iViewer) {
+            sample_platform(viewers[iViewer], times, epoch, block[iViewer - first]);
+        }
+    };
+
+    for (std::size_t first1 = 0; first1 < viewers.size(); first1 += VIEWER_BLOCK_SIZE) {
+        const std::size_t last1 = std::min(first1 + VIEWER_BLOCK_SIZE, viewers.size());
+        sample_block(first1, last1, block1);
+
+        for (std::size_t first2 = first1; first2 < viewers.size(); first2 += VIEWER_BLOCK_SIZE) {
+            const std::size_t last2 = std::min(first2 + VIEWER_BLOCK_SIZE, viewers.size());
+            if (first2 != first1) { sample_block(first2, last2, block2); }
+            const std::vector<PlatformSamples>& samples2 = (first2 == first1) ? block1 : block2;
+
+            // For each sat in the first block
+            for (std::size_t iViewer = first1; iViewer < last1; ++iViewer) {
+                Viewer& viewer1       = *viewers[iViewer];
+                const std::size_t id1 = viewer1.get_id();
+
+                // For every later sat in the second block
+                for (std::size_t jViewer = std::max(first2, iViewer + 1); jViewer < last2; ++jViewer) {
+                    Viewer& viewer2                = *viewers[jViewer];
+                    const std::size_t id2          = viewer2.get_id();
+                    const PlatformSamples& samples = samples2[jViewer - first2];
+
+                    // Satellite-level access for viewer1 -> viewer2
+                    const std::vector<AccessInfo> accessInfo =
+                        get_access_info(id1, block1[iViewer - first1], id2, samples.positions, samples.frames, times, occulter);
+                    RiseSetArray satAccess = find_platform_to_platform_accesses(&viewer1, &viewer2, accessInfo, false, epoch, store);
+
+                    // Store
+                    if (satAccess.size() > 0) {
+                        if (store) {
+                            viewer1.add_access(id2, satAccess);
+                            viewer2.add_access(id1, satAccess);
+                        }
+                        visit(id1, id2, std::move(satAccess)); // TODO: Consider id2->id1 as well
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Visit the accesses of every viewer and ground pair as soon as the pair is finished
+template <class Visitor_T>
+void for_each_ground_access(
+    ViewerConstellation& constel,
+    GroundArchitecture& grounds,
+    const Time& resolution,
+    const Date& epoch,
+    const AstrodynamicsSystem& sys,
+    const bool& store,
+    Visitor_T&& visit
+)
 {
     // TODO: Rework all this into a class
 
     // Create time array
-    const auto& states    = constel[0].get_state_history();
-    const Date& startDate = states.first().get_epoch();
-    const Date& endDate   = states.last().get_epoch();
+    const TimeVector times = get_constellation_times(constel, resolution);
+    const EllipsoidOcculter occulter(*sys.get("Earth"));
 
-    TimeVector times = create_time_vector(0.0 * s, endDate - startDate, resolution); // TODO: Check all state histories for common time frame
+    // Ground stations are fixed to the Earth, so they are rotated into ECI from the cached Earth rotation
+    const astro::EarthRotationProvider earthRotation(epoch, times);
+    const std::vector<EarthFixedState> groundStates = get_earth_fixed_states(grounds, earthRotation);
+    PlatformSamples samples;
+    PlatformSamples groundSamples;
 
     // For each sat
-    // AccessArray allAccesses = find_accesses(constel, resolution, sys); // Do sat-sat first?
-    AccessArray allAccesses;
     std::cout << std::endl;
     utilities::ProgressBar progressBar(constel.size(), "\tAccess");
-    for (auto& shell : constel.get_shells()) {
-        for (auto& plane : shell.get_planes()) {
-            for (Viewer& viewer : plane.get_all_spacecraft()) {
-                const std::size_t viewerId = viewer.get_id();
+    for (Viewer* viewer : get_viewers(constel)) {
+        const std::size_t viewerId = viewer->get_id();
+        sample_platform(viewer, times, epoch, samples);
 
-                // For every other sat
-                for (auto& ground : grounds) {
-                    const std::size_t groundId = ground.get_id();
+        // For every ground
+        for (std::size_t iGround = 0; iGround < grounds.size(); ++iGround) {
+            auto& ground               = grounds[iGround];
+            const std::size_t groundId = ground.get_id();
 
-                    // Satellite-level access for viewer1 -> viewer2
-                    RiseSetArray satAccess = find_platform_to_platform_accesses(&viewer, &ground, times, sys, epoch);
+            // Satellite-level access for viewer1 -> viewer2
+            sample_earth_fixed(groundStates[iGround], earthRotation, groundSamples);
+            const std::vector<AccessInfo> accessInfo =
+                get_access_info(viewerId, samples, groundId, groundSamples.positions, groundSamples.frames, times, occulter);
+            RiseSetArray satAccess = find_platform_to_platform_accesses(viewer, &ground, accessInfo, false, epoch, store);
 
-                    // Store
-                    if (satAccess.size() > 0) {
-                        viewer.add_access(groundId, satAccess);
-                        ground.add_access(viewerId, satAccess);
-                        allAccesses[viewerId, groundId] = satAccess; // TODO: Consider id2->id1 as well
-                    }
+            // Store
+            if (satAccess.size() > 0) {
+                if (store) {
+                    viewer->add_access(groundId, satAccess);
+                    ground.add_access(viewerId, satAccess);
                 }
-                progressBar();
+                visit(viewerId, groundId, std::move(satAccess)); // TODO: Consider id2->id1 as well
             }
         }
+        progressBar();
     }
+}
+
+} // namespace
+
+
+AccessArray find_internal_accesses(ViewerConstellation& constel, const Time& resolution, const Date& epoch, const AstrodynamicsSystem& sys)
+{
+    AccessArray allAccesses;
+    for_each_internal_access(constel, resolution, epoch, sys, true, [&](const std::size_t& id1, const std::size_t& id2, RiseSetArray&& access) {
+        allAccesses[id1, id2] = std::move(access);
+    });
+    return allAccesses;
+}
+
+void find_internal_accesses(
+    ViewerConstellation& constel,
+    const Time& resolution,
+    const Date& epoch,
+    const AstrodynamicsSystem& sys,
+    AccessSink& sink
+)
+{
+    for_each_internal_access(constel, resolution, epoch, sys, false, [&](const std::size_t& id1, const std::size_t& id2, RiseSetArray&& access) {
+        sink.write(id1, id2, access);
+    });
+}
 
+AccessArray find_accesses(ViewerConstellation& constel, GroundArchitecture& grounds, const Time& resolution, const Date& epoch, const AstrodynamicsSystem& sys)
+{
+    AccessArray allAccesses;
+    for_each_ground_access(constel, grounds, resolution, epoch, sys, true, [&](const std::size_t& id1, const std::size_t& id2, RiseSetArray&& access) {
+        allAccesses[id1, id2] = std::move(access);
+    });
     return allAccesses;
 }
 
+void find_accesses(
+    ViewerConstellation& constel,
+    GroundArchitecture& grounds,
+    const Time& resolution,
+    const Date& epoch,
+    const AstrodynamicsSystem& sys,
+    AccessSink& sink
+)
+{
+    for_each_ground_access(constel, grounds, resolution, epoch, sys, false, [&](const std::size_t& id1, const std::size_t& id2, RiseSetArray&& access) {
+        sink.write(id1, id2, access);
+    });
+}
+
+GroundVisibility
+    find_visibility(ViewerConstellation& constel, GroundArchitecture& grounds, const Time& resolution, const Date& epoch, const AstrodynamicsSystem& sys)
+{
+    GroundVisibility result;
+    result.times = get_constellation_times(constel, resolution);
+
+    const std::size_t nTimes = result.times.size();
+    const EllipsoidOcculter occulter(*sys.get("Earth"));
+
+    const astro::EarthRotationProvider earthRotation(epoch, result.times);
+    const std::vector<EarthFixedState> groundStates = get_earth_fixed_states(grounds, earthRotation);
+    for (const auto& ground : grounds) {
+        result.groundIds.push_back(ground.get_id());
+    }
+    PlatformSamples samples;
+    PlatformSamples groundSamples;
+
+    const std::vector<Viewer*> viewers = get_viewers(constel);
+    for (Viewer* viewer : viewers) {
+        result.viewerIds.push_back(viewer->get_id());
+    }
+
+    // Sample each viewer once, then fill its entry for every ground so results stay grouped by ground
+    result.visibility.resize(grounds.size() * viewers.size());
+    for (std::size_t iViewer = 0; iViewer < viewers.size(); ++iViewer) {
+        Viewer* viewer = viewers[iViewer];
+        sample_platform(viewer, result.times, epoch, samples);
+
+        for (std::size_t iGround = 0; iGround < grounds.size(); ++iGround) {
+            auto& ground = grounds[iGround];
+
+            sample_earth_fixed(groundStates[iGround], earthRotation, groundSamples);
+            const std::vector<AccessInfo> accessInfo = get_access_info(
+                viewer->get_id(), samples, ground.get_id(), groundSamples.positions, groundSamples.frames, result.times, occulter
+            );
+
+            // Visible if any pair of sensors can see each other
+            VisibilityBitset visibility(nTimes);
+            for (auto& sensor1 : viewer->get_payloads()) {
+                for (auto& sensor2 : ground.get_payloads()) {
+                    visibility |= find_sensor_to_sensor_visibility(accessInfo, sensor1, sensor2, false, epoch);
+                }
+            }
+            result.visibility[iGround * viewers.size() + iViewer] = std::move(visibility);
+        }
+    }
+
+    return result;
+}
+
+GroundVisibility find_visibility(ViewerConstellation& constel, const Grid& grid, const Time& resolution, const Date& epoch, const AstrodynamicsSystem& sys)
+{
+    GroundVisibility result;
+    result.times = get_constellation_times(constel, resolution);
+
+    const std::size_t nTimes = result.times.size();
+    const EllipsoidOcculter occulter(*sys.get("Earth"));
+
+    // Grid points are fixed to the Earth, so they are rotated into ECI from the cached Earth rotation
+    const astro::EarthRotationProvider earthRotation(epoch, result.times);
+    std::vector<RadiusVector<ECEF>> gridPositions;
+    gridPositions.reserve(grid.size());
+    for (std::size_t iGround = 0; iGround < grid.size(); ++iGround) {
+        gridPositions.push_back(grid[iGround].get_earth_fixed_position());
+        result.groundIds.push_back(grid[iGround].get_id());
+    }
+    PlatformSamples samples;
+    std::vector<RadiusVector<ECI>> pointPositions;
+
+    const std::vector<Viewer*> viewers = get_viewers(constel);
+    for (Viewer* viewer : viewers) {
+        result.viewerIds.push_back(viewer->get_id());
+    }
+
+    // Sample each viewer once, and share its frames across its sensors and every grid point
+    result.visibility.resize(grid.size() * viewers.size(), VisibilityBitset(nTimes));
+    for (std::size_t iViewer = 0; iViewer < viewers.size(); ++iViewer) {
+        sample_platform(viewers[iViewer], result.times, epoch, samples);
+        const auto& sensors = viewers[iViewer]->get_payloads();
+
+        for (std::size_t iGround = 0; iGround < grid.size(); ++iGround) {
+            rotate_into_eci(gridPositions[iGround], earthRotation, pointPositions);
+            const std::vector<bool> occulted = occulter.is_occulting(samples.positions, pointPositions);
+            VisibilityBitset& visibility     = result.visibility[iGround * viewers.size() + iViewer];
+            for (std::size_t iTime = 0; iTime < nTimes; ++iTime) {
+                if (occulted[iTime]) { continue; }
+
+                const RadiusVector<ECI> radius1to2 = pointPositions[iTime] - samples.positions[iTime];
+                for (const auto& sensor : sensors) {
+                    if (sensor.contains(radius1to2, samples.frames[iTime])) {
+                        visibility.set(iTime);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
 TimeVector create_time_vector(const Time& start, const Time& end, const Time& resolution)
 {
     // Fill
@@ -154,142 +515,84 @@ RiseSetArray find_platform_to_platform_accesses(
     const bool& twoWay
 )
 {
-    // Get all access info once to avoid unnecessary calcs
-    std::vector<AccessInfo> accessInfo(times.size());
-    std::size_t ii = 0;
+    std::vector<RadiusVector<ECI>> positions2;
+    positions2.reserve(times.size());
     for (const auto& time : times) {
-        // Get ECI state of ground station
-        const Date date                   = epoch + time;
-        const RadiusVector<ECI> position1 = platform1->get_inertial_position(date);
-        const RadiusVector<ECI> position2 = platform2->get_inertial_position(date);
-
-        // Get sat -> ground vector at current time
-        accessInfo[ii].time       = time;
-        accessInfo[ii].id1        = platform1->get_id();
-        accessInfo[ii].id2        = platform2->get_id();
-        accessInfo[ii].position1  = position1;
-        accessInfo[ii].position2  = position2;
-        accessInfo[ii].isOcculted = is_earth_occulting(position1, position2, sys);
-        ++ii;
+        positions2.push_back(platform2->get_inertial_position(epoch + time));
     }
-
-    // Determine access sensor by sensor
-    RiseSetArray access;
-    for (auto& sensor1 : platform1->get_payloads()) {
-        for (auto& sensor2 : platform2->get_payloads()) {
-            RiseSetArray sensorAccess = find_sensor_to_sensor_accesses(accessInfo, sensor1, sensor2, twoWay, epoch);
-
-            // Store
-            if (sensorAccess.size() > 0) {
-                access = (access | sensorAccess);
-                sensor1.add_access(sensor2.get_id(), sensorAccess);
-                sensor2.add_access(sensor1.get_id(), sensorAccess);
-            }
-        }
-    }
-
-    return access;
+    return find_platform_to_platform_accesses(platform1, platform2, positions2, times, sys, epoch, twoWay);
 }
 
-bool is_earth_occulting(const RadiusVector<ECI>& position1, const RadiusVector<ECI>& position2, const AstrodynamicsSystem& sys)
+RiseSetArray find_platform_to_platform_accesses(
+    SensorPlatform* platform1,
+    SensorPlatform* platform2,
+    std::span<const RadiusVector<ECI>> positions2,
+    const TimeVector& times,
+    const AstrodynamicsSystem& sys,
+    const Date& epoch,
+    const bool& twoWay
+)
 {
-    // NOTE: Only checking one direction. Blocking 1->2 automatically means blocking 2->1
-    // NOTE: Assumes Earth-centered
-    // NOTE: Assumes spherical Earth
-
-    // Also make RadiusVector<ECI> a class with utilities like magnitude, etc.
-    const RadiusVector<ECI> nadir1 = -position1;
-    const Distance nadir1Mag       = nadir1.norm();
-
-    // TODO: This subtraction will be duplicated many times. Look into doing elsewhere
-    const RadiusVector<ECI> radius1to2 = position2 - position1;
-
-    // Get edge angle of Earth
-    static const Distance& radiusEarthMag = sys.get("Earth")->get_equitorial_radius() + 100.0 * km; // TODO: Generalize for any body?
-    const Angle earthLimbAngle = asin(radiusEarthMag / nadir1Mag); // Assume this is good for all angles (circular Earth) - TODO: Fix
-
-    // Get angle from boresight and sat to nadir
-    const Angle satelliteNadirAngle = nadir1.offset_angle(radius1to2);
+    // Get all access info once to avoid unnecessary calcs
+    const EllipsoidOcculter occulter(*sys.get("Earth"));
+    PlatformSamples samples1;
+    sample_platform(platform1, times, epoch, samples1);
+    const std::vector<SensorFrame> frames2 = get_sensor_frames(platform2, positions2, times, epoch);
+    const std::vector<AccessInfo> accessInfo =
+        get_access_info(platform1->get_id(), samples1, platform2->get_id(), positions2, frames2, times, occulter);
 
-    // If nadir->satellite angle greater than Earth limb, Earth cannot block
-    if (satelliteNadirAngle <= earthLimbAngle) {
-        // Satellite is within Earth limb, check which is closer
-        const Distance radius1to2Mag  = radius1to2.norm();
-        const Distance earthLimbRange = nadir1Mag * cos(earthLimbAngle);
+    // Determine access sensor by sensor
+    return find_platform_to_platform_accesses(platform1, platform2, accessInfo, twoWay, epoch, true);
+}
 
-        // If outside farthest Earth limb distance - Earth must be blocking
-        if (radius1to2Mag > earthLimbRange) { return true; }
-    }
-    return false;
+bool is_earth_occulting(
+    const RadiusVector<ECI>& position1,
+    const RadiusVector<ECI>& position2,
+    const AstrodynamicsSystem& sys,
+    const Distance& grazingAltitude
+)
+{
+    // NOTE: Assumes Earth-centered, with the polar axis along ECI z
+    return EllipsoidOcculter(*sys.get("Earth"), grazingAltitude).is_occulting(position1, position2);
 }
 
 RiseSetArray
     find_sensor_to_sensor_accesses(const std::vector<AccessInfo>& accessInfo, const Sensor& sensor1, const Sensor& sensor2, const bool& twoWay, const Date& epoch)
 {
-    Time rise, set;
-    bool insideAccessInterval = false;
-    RiseSetArray access;
-    const Time start = accessInfo.front().time;
-    const Time end   = accessInfo.back().time;
+    TimeVector times;
+    times.reserve(accessInfo.size());
     for (const auto& specificAccessInfo : accessInfo) {
+        times.push_back(specificAccessInfo.time);
+    }
+
+    // Each run of visible samples is an access from its first to its last sample
+    return find_sensor_to_sensor_visibility(accessInfo, sensor1, sensor2, twoWay, epoch).to_risesets(times);
+}
+
+VisibilityBitset
+    find_sensor_to_sensor_visibility(const std::vector<AccessInfo>& accessInfo, const Sensor& sensor1, const Sensor& sensor2, const bool& twoWay, const Date& epoch)
+{
+    VisibilityBitset visibility(accessInfo.size());
+    for (std::size_t ii = 0; ii < accessInfo.size(); ++ii) {
         // Extract
-        const Time& time                   = specificAccessInfo.time;
-        const RadiusVector<ECI>& position1 = specificAccessInfo.position1; // TODO: + attachment point?
-        const RadiusVector<ECI>& position2 = specificAccessInfo.position2;
-        const bool& isOcculted             = specificAccessInfo.isOcculted;
+        const AccessInfo& info             = accessInfo[ii];
+        const RadiusVector<ECI>& position1 = info.position1; // TODO: + attachment point?
+        const RadiusVector<ECI>& position2 = info.position2;
+        if (info.isOcculted) { continue; }
 
         // TODO: This subtraction will be duplicated many times. Look into doing elsewhere
-        const RadiusVector<ECI>& radius1to2 = position2 - position1;
-        const RadiusVector<ECI>& radius2to1 = position1 - position2;
+        const RadiusVector<ECI> radius1to2 = position2 - position1;
+        const RadiusVector<ECI> radius2to1 = position1 - position2;
 
-        // Check if they can see each other
-        const Date date = epoch + time;
+        // Check if they can see each other, using the platform frames shared by every sensor pair
         bool sensorsInView;
-        if (isOcculted) { sensorsInView = false; }
-        else if (twoWay) {
-            sensorsInView = sensor1.contains(radius1to2, date) && sensor2.contains(radius2to1, date);
-        }
+        if (twoWay) { sensorsInView = sensor1.contains(radius1to2, *info.frame1) && sensor2.contains(radius2to1, *info.frame2); }
         else {
-            sensorsInView = sensor1.contains(radius1to2, date) || sensor2.contains(radius2to1, date);
-        }
-
-        // Manage bookends
-        if (time == start) {
-            insideAccessInterval = sensorsInView;
-            if (insideAccessInterval) // Consider the start time the initial rise
-            {
-                rise = start;
-            }
-            continue;
-        }
-        else if (time == end) {
-            if (insideAccessInterval && sensorsInView) { // Consider the final time the last set
-                access.append(rise, end);
-                continue;
-            }
-            // NOTE: this ignores cases where the last time is a rise time -> access analyzed for [0, T)
-        }
-
-        // Check for rise/set times
-        if (insideAccessInterval && !sensorsInView) { // previous time had access, this time does not -> last time was a set
-            insideAccessInterval = false;
-            if (rise == set) {
-                // Ignore for now - TODO: Make this an input option
-                continue;
-                // throw std::runtime_error("Rise and set found at the same time. This is likely due to a large time resolution. Please rerun analysis with a finer resolution.")
-            }
-            access.append(rise, set);
-        }
-        else if (insideAccessInterval && sensorsInView) { // previous time had access, and so does this one -> store set time and continue
-            set = time;
-        }
-        else if (!insideAccessInterval && sensorsInView) { // previous time didn't have access, this time does -> this time is a rise
-            insideAccessInterval = true;
-            rise                 = time;
-            set                  = time; // to catch cases where (set - rise) < resolution
+            sensorsInView = sensor1.contains(radius1to2, *info.frame1) || sensor2.contains(radius2to1, *info.frame2);
         }
+        visibility.set(ii, sensorsInView);
     }
-    return access;
+    return visibility;
 }
 
 } // namespace trace
@@ -10,14 +10,20 @@
  */
 #pragma once
 
+#include <span>
 #include <vector>
 
 #include <astro/astro.fwd.hpp>
 #include <units/units.hpp>
 #include <utilities/ProgressBar.hpp>
 
+#include <astro/state/CartesianVector.hpp>
+
+#include <trace/analysis/occultation.hpp>
+#include <trace/platforms/sensors/Sensor.hpp>
 #include <trace/risesets/AccessArray.hpp>
 #include <trace/risesets/RiseSetArray.hpp>
+#include <trace/risesets/VisibilityBitset.hpp>
 #include <trace/trace.fwd.hpp>
 
 namespace astrea {
@@ -34,9 +40,42 @@ using TimeVector = std::vector<Time>;
 using ViewerConstellation = astro::Constellation<Viewer>;
 
 /**
- * @brief Struct to hold access information between two objects.
+ * @brief Struct to hold access information between two objects at a single time.
+ *
+ * The frames are owned by the caller, which builds each platform frame once per time and shares it across every
+ * pairing and sensor. They are only read for objects with sensors.
+ */
+struct AccessInfo {
+    Time time;                                 //!< Time of access
+    astro::RadiusVector<astro::ECI> position1; //!< Position of the first object at the time of access
+    astro::RadiusVector<astro::ECI> position2; //!< Position of the second object at the time of access
+    const SensorFrame* frame1 = nullptr;       //!< Frame of the first object, shared by all of its sensors
+    const SensorFrame* frame2 = nullptr;       //!< Frame of the second object, shared by all of its sensors
+    std::size_t id1;                           //!< ID of the first object
+    std::size_t id2;                           //!< ID of the second object
+    bool isOcculted;                           //!< Flag indicating if the access is occulted
+};
+
+/**
+ * @brief Struct to hold the visibility between a constellation and a set of ground points on a common time grid.
  */
-struct AccessInfo;
+struct GroundVisibility {
+    TimeVector times;                         //!< Sample times, relative to the epoch
+    std::vector<std::size_t> viewerIds;       //!< Viewer IDs, in evaluation order
+    std::vector<std::size_t> groundIds;       //!< Ground IDs, in evaluation order
+    std::vector<VisibilityBitset> visibility; //!< Visibility for each ground/viewer pair, grouped by ground
+
+    /**
+     * @brief Get the visibility of every viewer from a single ground point.
+     *
+     * @param iGround The index of the ground point.
+     * @return std::span<const VisibilityBitset> The visibility of each viewer, in the order of viewerIds.
+     */
+    std::span<const VisibilityBitset> get_ground_visibility(const std::size_t& iGround) const
+    {
+        return std::span<const VisibilityBitset>(visibility).subspan(iGround * viewerIds.size(), viewerIds.size());
+    }
+};
 
 /**
  * @brief Find accesses between a constellation of viewers.
@@ -48,6 +87,28 @@ struct AccessInfo;
  */
 AccessArray find_internal_accesses(ViewerConstellation& constel, const Time& resolution, const astro::Date& epoch, const astro::AstrodynamicsSystem& sys);
 
+/**
+ * @brief Find accesses between a constellation of viewers, streaming each pair to a sink as soon as it is finished.
+ *
+ * Accesses are not kept in memory or stored on the viewers and their sensors. Viewers are sampled in fixed-size
+ * blocks, so the working set is two blocks of viewer samples and one pair of access info at a time, plus the sink's
+ * buffer. It grows with the number of times but not with the number of viewers or accesses.
+ *
+ * @param constel The constellation of viewers.
+ * @param resolution The time resolution for access calculations.
+ * @param epoch The epoch date for the analysis.
+ * @param sys The astrodynamics system used for calculations.
+ * @param sink The sink to write accesses to.
+ * @throws std::runtime_error If the sink fails to write.
+ */
+void find_internal_accesses(
+    ViewerConstellation& constel,
+    const Time& resolution,
+    const astro::Date& epoch,
+    const astro::AstrodynamicsSystem& sys,
+    AccessSink& sink
+);
+
 /**
  * @brief Find accesses between a constellation of viewers and a ground architecture.
  *
@@ -61,6 +122,69 @@ AccessArray find_internal_accesses(ViewerConstellation& constel, const Time& res
 AccessArray
     find_accesses(ViewerConstellation& constel, GroundArchitecture& grounds, const Time& resolution, const astro::Date& epoch, const astro::AstrodynamicsSystem& sys);
 
+/**
+ * @brief Find accesses between a constellation of viewers and a ground architecture, streaming each pair to a sink as
+ * soon as it is finished.
+ *
+ * Accesses are not kept in memory or stored on the platforms and their sensors. Only the samples of one viewer and
+ * one ground station and the access info of that pair are held at a time, plus the Earth-fixed state of each ground
+ * station and the sink's buffer. The working set grows with the number of times and ground stations but not with the
+ * number of viewers or accesses.
+ *
+ * @param constel The constellation of viewers.
+ * @param grounds The ground architecture containing ground stations.
+ * @param resolution The time resolution for access calculations.
+ * @param epoch The epoch date for the analysis.
+ * @param sys The astrodynamics system used for calculations.
+ * @param sink The sink to write accesses to.
+ * @throws std::runtime_error If the sink fails to write.
+ */
+void find_accesses(
+    ViewerConstellation& constel,
+    GroundArchitecture& grounds,
+    const Time& resolution,
+    const astro::Date& epoch,
+    const astro::AstrodynamicsSystem& sys,
+    AccessSink& sink
+);
+
+
+/**
+ * @brief Find the visibility between a constellation of viewers and a ground architecture on a fixed time grid.
+ *
+ * This evaluates the same geometry as find_accesses but emits packed visibility bits instead of rise/set pairs,
+ * which is much cheaper to aggregate across many ground points.
+ *
+ * @param constel The constellation of viewers.
+ * @param grounds The ground architecture containing ground stations.
+ * @param resolution The time resolution for access calculations.
+ * @param epoch The epoch date for the analysis.
+ * @param sys The astrodynamics system used for calculations.
+ * @return GroundVisibility The visibility of each viewer from each ground station.
+ */
+GroundVisibility find_visibility(
+    ViewerConstellation& constel,
+    GroundArchitecture& grounds,
+    const Time& resolution,
+    const astro::Date& epoch,
+    const astro::AstrodynamicsSystem& sys
+);
+
+/**
+ * @brief Find the visibility between a constellation of viewers and a grid of ground points on a fixed time grid.
+ *
+ * Ground points have no sensors, so a point is visible when it lies in the field of view of any viewer sensor and
+ * is not occulted by the Earth.
+ *
+ * @param constel The constellation of viewers.
+ * @param grid The grid of ground points.
+ * @param resolution The time resolution for access calculations.
+ * @param epoch The epoch date for the analysis.
+ * @param sys The astrodynamics system used for calculations.
+ * @return GroundVisibility The visibility of each viewer from each grid point.
+ */
+GroundVisibility
+    find_visibility(ViewerConstellation& constel, const Grid& grid, const Time& resolution, const astro::Date& epoch, const astro::AstrodynamicsSystem& sys);
 
 /**
  * @brief Create a time vector from a state history.
@@ -135,18 +259,23 @@ AccessArray find_accesses(
 }
 
 /**
- * @brief Check if two states are occulting each other.
+ * @brief Check if the Earth blocks the line of sight between two positions.
+ *
+ * The Earth is modeled as an ellipsoid inflated by the grazing altitude. Use EllipsoidOcculter directly to test many
+ * lines of sight at once.
  *
- * @param state1 The first state to check.
- * @param state2 The second state to check.
+ * @param position1 The inertial position of the first object.
+ * @param position2 The inertial position of the second object.
  * @param sys The astrodynamics system used for calculations.
- * @return true If the two states are occulting each other.
- * @return false If the two states are not occulting each other.
+ * @param grazingAltitude The altitude above the surface that a line of sight must clear.
+ * @return true If the Earth blocks the line of sight.
+ * @return false If the line of sight is clear.
  */
 bool is_earth_occulting(
     const astro::CartesianVector<Distance, astro::EarthCenteredInertial>& position1,
     const astro::CartesianVector<Distance, astro::EarthCenteredInertial>& position2,
-    const astro::AstrodynamicsSystem& sys
+    const astro::AstrodynamicsSystem& sys,
+    const Distance& grazingAltitude = DEFAULT_GRAZING_ALTITUDE
 );
 
 /**
@@ -169,13 +298,39 @@ RiseSetArray find_platform_to_platform_accesses(
     const bool& twoWay = false
 );
 
+/**
+ * @brief Find accesses between two sensor platforms, using precomputed positions for the second platform.
+ *
+ * @param platform1 The first sensor platform.
+ * @param platform2 The second sensor platform.
+ * @param positions2 The inertial positions of the second platform at each time.
+ * @param times The times at which to check for accesses.
+ * @param sys The astrodynamics system used for calculations.
+ * @param epoch The epoch date for the analysis.
+ * @param twoWay Flag indicating if the access should be two-way (default is false).
+ * @return RiseSetArray A collection of rise/set pairs representing the accesses.
+ */
+RiseSetArray find_platform_to_platform_accesses(
+    astro::PayloadPlatform<Sensor>* platform1,
+    astro::PayloadPlatform<Sensor>* platform2,
+    std::span<const astro::RadiusVector<astro::EarthCenteredInertial>> positions2,
+    const TimeVector& times,
+    const astro::AstrodynamicsSystem& sys,
+    const astro::Date& epoch,
+    const bool& twoWay = false
+);
+
 /**
  * @brief Find accesses between a sensor and another sensor.
  *
+ * Each sensor is evaluated in the platform frame stored in the access info, so frames are built once per platform per
+ * time rather than once per sensor pair.
+ *
  * @param accessInfo A vector of AccessInfo objects containing trace information.
  * @param sensor1 The first sensor for which to find accesses.
  * @param sensor2 The second sensor to check for accesses.
  * @param twoWay Flag indicating if the access should be two-way (default is false).
+ * @param epoch The epoch date for the analysis.
  * @return RiseSetArray A collection of rise/set pairs representing the accesses.
  */
 RiseSetArray find_sensor_to_sensor_accesses(
@@ -186,5 +341,23 @@ RiseSetArray find_sensor_to_sensor_accesses(
     const astro::Date& epoch
 );
 
+/**
+ * @brief Find the visibility between a sensor and another sensor at each sample.
+ *
+ * @param accessInfo A vector of AccessInfo objects containing trace information.
+ * @param sensor1 The first sensor for which to find visibility.
+ * @param sensor2 The second sensor to check for visibility.
+ * @param twoWay Flag indicating if the access should be two-way.
+ * @param epoch The epoch date for the analysis.
+ * @return VisibilityBitset The visibility at each sample in accessInfo.
+ */
+VisibilityBitset find_sensor_to_sensor_visibility(
+    const std::vector<AccessInfo>& accessInfo,
+    const Sensor& sensor1,
+    const Sensor& sensor2,
+    const bool& twoWay,
+    const astro::Date& epoch
+);
+
 } // namespace trace
 } // namespace astrea
\ No newline at end of file
@@ -0,0 +1,796 @@
+#include <trace/analysis/conjunction_screening.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <utilities/parallel.hpp>
+
+#include <astro/platforms/vehicles/Spacecraft.hpp>
+#include <astro/state/State.hpp>
+#include <astro/state/orbital_elements/instances/Keplerian.hpp>
+#include <astro/systems/AstrodynamicsSystem.hpp>
+#include <astro/systems/CelestialBody.hpp>
+
+namespace astrea {
+namespace trace {
+
+using mp_units::si::unit_symbols::km;
+using mp_units::si::unit_symbols::s;
+
+namespace {
+
+using Vector3 = std::array<double, 3>;
+
+constexpr double TWO_PI = 2.0 * std::numbers::pi;
+
+// Kepler's equation is solved to this many radians
+constexpr double KEPLER_TOLERANCE            = 1.0e-13;
+constexpr std::size_t MAX_KEPLER_ITERATIONS = 50;
+
+// Times of closest approach are solved to this many seconds
+constexpr double TCA_TOLERANCE = 1.0e-4;
+
+// Minima this close to the edge of a search are treated as on the edge
+constexpr double EDGE_TOLERANCE = 2.0 * TCA_TOLERANCE;
+
+// Margin on the chord bound for the J2 drift, which the two-body acceleration bound does not include
+constexpr double CHORD_BOUND_MARGIN = 1.05;
+
+// Cells are this many times the largest bounding box, so most boxes fall in one or two cells
+constexpr double CELL_SCALE = 2.0;
+
+// Mean orbit of one spacecraft in distance and time units, with the secular J2 drift folded into its rates
+struct MeanOrbit {
+    double semimajor;          //!< Semimajor axis
+    double eccentricity;       //!< Eccentricity
+    double semiminorRatio;     //!< Ratio of the semiminor to the semimajor axis
+    double cosInclination;     //!< Cosine of the inclination
+    double sinInclination;     //!< Sine of the inclination
+    double meanAnomaly0;       //!< Mean anomaly at the start of the screening
+    double meanMotion;         //!< Mean anomaly rate
+    double rightAscension0;    //!< Right ascension at the start of the screening
+    double rightAscensionRate; //!< Right ascension rate
+    double argPerigee0;        //!< Argument of perigee at the start of the screening
+    double argPerigeeRate;     //!< Argument of perigee rate
+    double perigee;            //!< Perigee radius
+    double apogee;             //!< Apogee radius
+    double chordBound;         //!< Most the path can bow from its chord over a window, per squared second
+};
+
+// Pair that could come within the screening distance in a window
+struct Candidate {
+    std::uint32_t first;  //!< Index of the first spacecraft
+    std::uint32_t second; //!< Index of the second spacecraft
+    std::uint32_t window; //!< Index of the window
+};
+
+// Closest approach between two orbits, in distance and time units
+struct Approach {
+    std::uint32_t first;  //!< Index of the first spacecraft
+    std::uint32_t second; //!< Index of the second spacecraft
+    double time;          //!< Time of closest approach since the start
+    double missDistance;  //!< Distance at closest approach
+    double relativeSpeed; //!< Relative speed at closest approach
+};
+
+MeanOrbit build_orbit(const astro::Keplerian& elements, const double& epochOffset, const double& mu, const double& j2, const double& radius)
+{
+    const double a = elements.get_semimajor().numerical_value_in(astrea::detail::distance_unit);
+    const double e = elements.get_eccentricity().numerical_value_in(astrea::detail::unitless);
+    if (a <= 0.0 || e < 0.0 || e >= 1.0) { throw std::runtime_error("Conjunction screening requires elliptical orbits."); }
+
+    const double inclination = elements.get_inclination().numerical_value_in(astrea::detail::angle_unit);
+    const double trueAnomaly = elements.get_true_anomaly().numerical_value_in(astrea::detail::angle_unit);
+
+    const double eccentricAnomaly =
+        2.0 * std::atan2(std::sqrt(1.0 - e) * std::sin(trueAnomaly / 2.0), std::sqrt(1.0 + e) * std::cos(trueAnomaly / 2.0));
+    const double meanAnomaly = eccentricAnomaly - e * std::sin(eccentricAnomaly);
+    const double raan        = elements.get_right_ascension().numerical_value_in(astrea::detail::angle_unit);
+    const double argPerigee  = elements.get_argument_of_perigee().numerical_value_in(astrea::detail::angle_unit);
+
+    // Secular rates from J2 (Vallado, 9.41)
+    const double semiminorRatio = std::sqrt(1.0 - e * e);
+    const double semiparameter  = a * (1.0 - e * e);
+    const double n0             = std::sqrt(mu / (a * a * a));
+    const double j2Scale        = 0.75 * n0 * j2 * (radius / semiparameter) * (radius / semiparameter);
+    const double cosInclination = std::cos(inclination);
+    const double cos2           = cosInclination * cosInclination;
+
+    MeanOrbit orbit;
+    orbit.semimajor          = a;
+    orbit.eccentricity       = e;
+    orbit.semiminorRatio     = semiminorRatio;
+    orbit.cosInclination     = cosInclination;
+    orbit.sinInclination     = std::sin(inclination);
+    orbit.meanMotion         = n0 + j2Scale * semiminorRatio * (3.0 * cos2 - 1.0);
+    orbit.rightAscensionRate = -2.0 * j2Scale * cosInclination;
+    orbit.argPerigeeRate     = j2Scale * (5.0 * cos2 - 1.0);
+    orbit.meanAnomaly0       = meanAnomaly - orbit.meanMotion * epochOffset;
+    orbit.rightAscension0    = raan - orbit.rightAscensionRate * epochOffset;
+    orbit.argPerigee0        = argPerigee - orbit.argPerigeeRate * epochOffset;
+    orbit.perigee            = a * (1.0 - e);
+    orbit.apogee             = a * (1.0 + e);
+
+    // Linear interpolation misses a path by at most dt^2 / 8 times its largest acceleration, which is at perigee
+    orbit.chordBound = CHORD_BOUND_MARGIN * mu / (8.0 * orbit.perigee * orbit.perigee);
+    return orbit;
+}
+
+// Wraps an angle into [-pi, pi], cheaper than std::remainder
+double wrap_angle(const double& angle) { return angle - TWO_PI * std::nearbyint(angle / TWO_PI); }
+
+// Newton's method on Kepler's equation, kept within the bracket |E - M| <= e that holds the root. Stops on the
+// residual so the sine and cosine of the root are already in hand.
+double solve_kepler(const double& meanAnomaly, const double& e, const double& guess, double& sinE, double& cosE)
+{
+    double lower            = meanAnomaly - e;
+    double upper            = meanAnomaly + e;
+    double eccentricAnomaly = std::clamp(guess, lower, upper);
+    for (std::size_t ii = 0; ii < MAX_KEPLER_ITERATIONS; ++ii) {
+        sinE                  = std::sin(eccentricAnomaly);
+        cosE                  = std::cos(eccentricAnomaly);
+        const double residual = eccentricAnomaly - e * sinE - meanAnomaly;
+        if (std::abs(residual) < KEPLER_TOLERANCE) { break; }
+        if (residual > 0.0) { upper = eccentricAnomaly; }
+        else {
+            lower = eccentricAnomaly;
+        }
+
+        eccentricAnomaly -= residual / (1.0 - e * cosE);
+        if (eccentricAnomaly <= lower || eccentricAnomaly >= upper) { eccentricAnomaly = 0.5 * (lower + upper); }
+    }
+    return eccentricAnomaly;
+}
+
+// Anomaly and orientation of an orbit at a time, which can be carried forward from one window to the next
+struct OrbitPhase {
+    double sinE;             //!< Sine of the eccentric anomaly
+    double cosE;             //!< Cosine of the eccentric anomaly
+    double sinRaan;          //!< Sine of the right ascension
+    double cosRaan;          //!< Cosine of the right ascension
+    double sinArgp;          //!< Sine of the argument of perigee
+    double cosArgp;          //!< Cosine of the argument of perigee
+    double eccentricAnomaly; //!< Eccentric anomaly
+};
+
+// Turn of the orientation of an orbit over one full window
+struct PhaseStep {
+    double sinRaan; //!< Sine of the change in right ascension
+    double cosRaan; //!< Cosine of the change in right ascension
+    double sinArgp; //!< Sine of the change in argument of perigee
+    double cosArgp; //!< Cosine of the change in argument of perigee
+};
+
+OrbitPhase get_phase(const MeanOrbit& orbit, const double& time)
+{
+    OrbitPhase phase;
+    const double meanAnomaly = wrap_angle(orbit.meanAnomaly0 + orbit.meanMotion * time);
+    phase.eccentricAnomaly   = solve_kepler(meanAnomaly, orbit.eccentricity, meanAnomaly, phase.sinE, phase.cosE);
+
+    const double rightAscension = orbit.rightAscension0 + orbit.rightAscensionRate * time;
+    const double argPerigee     = orbit.argPerigee0 + orbit.argPerigeeRate * time;
+    phase.sinRaan               = std::sin(rightAscension);
+    phase.cosRaan               = std::cos(rightAscension);
+    phase.sinArgp               = std::sin(argPerigee);
+    phase.cosArgp               = std::cos(argPerigee);
+    return phase;
+}
+
+PhaseStep get_phase_step(const MeanOrbit& orbit, const double& step)
+{
+    return { std::sin(orbit.rightAscensionRate * step),
+             std::cos(orbit.rightAscensionRate * step),
+             std::sin(orbit.argPerigeeRate * step),
+             std::cos(orbit.argPerigeeRate * step) };
+}
+
+// Carries a phase forward one full window to a time. Kepler's equation is solved from the last anomaly, and the
+// orientation is turned by a fixed rotation instead of recomputed, which leaves no trig for it at all. The rotation
+// drifts by about one rounding error per window, far inside the chord bounds.
+void advance_phase(const MeanOrbit& orbit, const double& time, const double& step, const PhaseStep& turn, OrbitPhase& phase)
+{
+    const double e           = orbit.eccentricity;
+    const double meanAnomaly = wrap_angle(orbit.meanAnomaly0 + orbit.meanMotion * time);
+    const double guess       = wrap_angle(phase.eccentricAnomaly + orbit.meanMotion * step / (1.0 - e * phase.cosE));
+    phase.eccentricAnomaly   = solve_kepler(meanAnomaly, e, guess, phase.sinE, phase.cosE);
+
+    const double sinRaan = phase.sinRaan * turn.cosRaan + phase.cosRaan * turn.sinRaan;
+    const double cosRaan = phase.cosRaan * turn.cosRaan - phase.sinRaan * turn.sinRaan;
+    const double sinArgp = phase.sinArgp * turn.cosArgp + phase.cosArgp * turn.sinArgp;
+    const double cosArgp = phase.cosArgp * turn.cosArgp - phase.sinArgp * turn.sinArgp;
+    phase.sinRaan        = sinRaan;
+    phase.cosRaan        = cosRaan;
+    phase.sinArgp        = sinArgp;
+    phase.cosArgp        = cosArgp;
+}
+
+Vector3 get_position(const MeanOrbit& orbit, const OrbitPhase& phase)
+{
+    const double x = orbit.semimajor * (phase.cosE - orbit.eccentricity);
+    const double y = orbit.semimajor * orbit.semiminorRatio * phase.sinE;
+
+    const double cosRaan = phase.cosRaan;
+    const double sinRaan = phase.sinRaan;
+    const double cosArgp = phase.cosArgp;
+    const double sinArgp = phase.sinArgp;
+    const double cosInc  = orbit.cosInclination;
+    const double sinInc  = orbit.sinInclination;
+
+    // Perifocal to inertial
+    return { x * (cosRaan * cosArgp - sinRaan * sinArgp * cosInc) - y * (cosRaan * sinArgp + sinRaan * cosArgp * cosInc),
+             x * (sinRaan * cosArgp + cosRaan * sinArgp * cosInc) - y * (sinRaan * sinArgp - cosRaan * cosArgp * cosInc),
+             x * sinArgp * sinInc + y * cosArgp * sinInc };
+}
+
+Vector3 get_position(const MeanOrbit& orbit, const double& time) { return get_position(orbit, get_phase(orbit, time)); }
+
+Vector3 get_separation(const MeanOrbit& first, const MeanOrbit& second, const double& time)
+{
+    const Vector3 position1 = get_position(first, time);
+    const Vector3 position2 = get_position(second, time);
+    return { position2[0] - position1[0], position2[1] - position1[1], position2[2] - position1[2] };
+}
+
+double squared_norm(const Vector3& vec) { return vec[0] * vec[0] + vec[1] * vec[1] + vec[2] * vec[2]; }
+
+// Brent's method for the minimum of a function on an interval (Brent, 1973, ch. 5)
+template <class Function_T>
+double minimize(Function_T&& function, double lower, double upper, const double& tolerance)
+{
+    static const double goldenRatio = 0.5 * (3.0 - std::sqrt(5.0));
+
+    double x  = lower + goldenRatio * (upper - lower);
+    double w  = x;
+    double v  = x;
+    double fx = function(x);
+    double fw = fx;
+    double fv = fx;
+    double d  = 0.0;
+    double e  = 0.0;
+    while (true) {
+        const double midpoint = 0.5 * (lower + upper);
+        const double tol1     = tolerance / 3.0 + 1.0e-12 * std::abs(x);
+        const double tol2     = 2.0 * tol1;
+        if (std::abs(x - midpoint) <= tol2 - 0.5 * (upper - lower)) { break; }
+
+        bool golden = true;
+        if (std::abs(e) > tol1) {
+            // Parabola through x, w, and v
+            double r = (x - w) * (fx - fv);
+            double q = (x - v) * (fx - fw);
+            double p = (x - v) * q - (x - w) * r;
+            q        = 2.0 * (q - r);
+            if (q > 0.0) { p = -p; }
+            q            = std::abs(q);
+            const double eLast = e;
+            e                  = d;
+            if (std::abs(p) < std::abs(0.5 * q * eLast) && p > q * (lower - x) && p < q * (upper - x)) {
+                d            = p / q;
+                const double u = x + d;
+                if (u - lower < tol2 || upper - u < tol2) { d = (x < midpoint) ? tol1 : -tol1; }
+                golden = false;
+            }
+        }
+        if (golden) {
+            e = (x < midpoint) ? upper - x : lower - x;
+            d = goldenRatio * e;
+        }
+
+        const double u  = (std::abs(d) >= tol1) ? x + d : x + (d > 0.0 ? tol1 : -tol1);
+        const double fu = function(u);
+        if (fu <= fx) {
+            if (u < x) { upper = x; }
+            else {
+                lower = x;
+            }
+            v  = w;
+            fv = fw;
+            w  = x;
+            fw = fx;
+            x  = u;
+            fx = fu;
+        }
+        else {
+            if (u < x) { lower = u; }
+            else {
+                upper = u;
+            }
+            if (fu <= fw || w == x) {
+                v  = w;
+                fv = fw;
+                w  = u;
+                fw = fu;
+            }
+            else if (fu <= fv || v == x || v == w) {
+                v  = u;
+                fv = fu;
+            }
+        }
+    }
+    return x;
+}
+
+// Packs integer cell coordinates into a key. Coordinates wrap past 2^20 cells, which only adds candidates.
+std::uint64_t pack_cell(const std::int64_t& ix, const std::int64_t& iy, const std::int64_t& iz)
+{
+    constexpr std::uint64_t mask = (std::uint64_t(1) << 21) - 1;
+    return (std::uint64_t(ix) & mask) | ((std::uint64_t(iy) & mask) << 21) | ((std::uint64_t(iz) & mask) << 42);
+}
+
+// Spatial hash from cell keys to the spacecraft whose boxes touch each cell. Cells are found by open addressing and
+// members are grouped with a counting sort, so building it costs no allocation once warm and no comparison sort.
+class SpatialHash {
+  public:
+    void clear()
+    {
+        ++_generation;
+        _cellKeys.clear();
+        _counts.clear();
+        _entries.clear();
+    }
+
+    void insert(const std::uint64_t& key, const std::uint32_t& index)
+    {
+        if (2 * (_cellKeys.size() + 1) > _slots.size()) { grow(); }
+
+        std::uint32_t& cell = find(key);
+        if (cell == NEW_CELL) {
+            cell = static_cast<std::uint32_t>(_cellKeys.size());
+            _cellKeys.push_back(key);
+            _counts.push_back(0);
+        }
+        ++_counts[cell];
+        _entries.emplace_back(cell, index);
+    }
+
+    // Calls a function with the key and members of every cell with more than one member. Members are in insertion
+    // order.
+    template <class Function_T>
+    void for_each_cell(Function_T&& function)
+    {
+        _offsets.resize(_counts.size() + 1);
+        _offsets[0] = 0;
+        for (std::size_t ii = 0; ii < _counts.size(); ++ii) {
+            _offsets[ii + 1] = _offsets[ii] + _counts[ii];
+        }
+        _members.resize(_entries.size());
+        _fill.assign(_offsets.begin(), _offsets.end() - 1);
+        for (const auto& [cell, index] : _entries) {
+            _members[_fill[cell]++] = index;
+        }
+
+        for (std::size_t ii = 0; ii < _cellKeys.size(); ++ii) {
+            if (_counts[ii] < 2) { continue; }
+            function(_cellKeys[ii], std::span<const std::uint32_t>(_members.data() + _offsets[ii], _counts[ii]));
+        }
+    }
+
+  private:
+    static constexpr std::uint32_t NEW_CELL = ~std::uint32_t(0);
+
+    // Slot of the open-addressed table, packed so each probe touches one cache line
+    struct Slot {
+        std::uint64_t key;        //!< Cell key
+        std::uint32_t cell;       //!< Cell index
+        std::uint32_t generation; //!< Generation that last wrote the slot
+    };
+
+    std::vector<Slot> _slots;                                      //!< Open-addressed table of cells
+    std::uint32_t _generation = 0;                                 //!< Current generation, so clearing is free
+    std::vector<std::uint64_t> _cellKeys;                          //!< Key of each cell
+    std::vector<std::uint32_t> _counts;                            //!< Number of members of each cell
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> _entries; //!< Cell and spacecraft of each insertion
+    std::vector<std::uint32_t> _offsets;                           //!< Start of each cell in the members
+    std::vector<std::uint32_t> _fill;                              //!< Next free member of each cell
+    std::vector<std::uint32_t> _members;                           //!< Spacecraft grouped by cell
+
+    std::uint32_t& find(const std::uint64_t& key)
+    {
+        const std::size_t mask = _slots.size() - 1;
+        std::size_t index      = (key * 0x9E3779B97F4A7C15ull) >> 20 & mask;
+        while (_slots[index].generation == _generation && _slots[index].key != key) {
+            index = (index + 1) & mask;
+        }
+
+        Slot& slot = _slots[index];
+        if (slot.generation != _generation) { slot = { key, NEW_CELL, _generation }; }
+        return slot.cell;
+    }
+
+    void grow()
+    {
+        _slots.assign(std::max<std::size_t>(1024, 2 * _slots.size()), { 0, NEW_CELL, 0 });
+        _generation = 1;
+        for (std::uint32_t ii = 0; ii < _cellKeys.size(); ++ii) {
+            find(_cellKeys[ii]) = ii;
+        }
+    }
+};
+
+// Number of pairs of a query spacecraft and another spacecraft whose radius bands overlap, not counting each query
+// with itself. Every query must also be in the sorted bands.
+std::size_t count_band_overlaps(
+    const std::vector<std::uint32_t>& queries,
+    const std::vector<double>& lowers,
+    const std::vector<double>& uppers,
+    const std::vector<double>& sortedLowers,
+    const std::vector<double>& sortedUppers
+)
+{
+    std::size_t count = 0;
+    for (const std::uint32_t& ii : queries) {
+        // Bands starting at or below this upper, less those that end before this lower
+        const std::size_t nBelow = std::upper_bound(sortedLowers.begin(), sortedLowers.end(), uppers[ii]) - sortedLowers.begin();
+        const std::size_t nEnded = std::lower_bound(sortedUppers.begin(), sortedUppers.end(), lowers[ii]) - sortedUppers.begin();
+        count += nBelow - nEnded - 1;
+    }
+    return count;
+}
+
+// Stage 1: count the pairs with at least one primary whose radius bands overlap
+std::size_t count_apsis_pairs(const std::vector<MeanOrbit>& orbits, const std::vector<bool>& isPrimary, const double& halfDistance)
+{
+    std::vector<double> lowers, uppers;
+    std::vector<std::uint32_t> all, primaries;
+    for (std::uint32_t ii = 0; ii < orbits.size(); ++ii) {
+        lowers.push_back(orbits[ii].perigee - halfDistance);
+        uppers.push_back(orbits[ii].apogee + halfDistance);
+        all.push_back(ii);
+        if (isPrimary[ii]) { primaries.push_back(ii); }
+    }
+
+    const auto sorted_bands = [&](const std::vector<std::uint32_t>& indices) {
+        std::pair<std::vector<double>, std::vector<double>> bands;
+        for (const std::uint32_t& ii : indices) {
+            bands.first.push_back(lowers[ii]);
+            bands.second.push_back(uppers[ii]);
+        }
+        std::sort(bands.first.begin(), bands.first.end());
+        std::sort(bands.second.begin(), bands.second.end());
+        return bands;
+    };
+
+    // Primary-to-primary pairs are counted from both ends
+    const auto [allLowers, allUppers]         = sorted_bands(all);
+    const auto [primaryLowers, primaryUppers] = sorted_bands(primaries);
+    return count_band_overlaps(primaries, lowers, uppers, allLowers, allUppers) -
+           count_band_overlaps(primaries, lowers, uppers, primaryLowers, primaryUppers) / 2;
+}
+
+// Stage 2: carry every spacecraft across a run of windows, keeping the pairs that pass the grid and sweep filters
+void filter_windows(
+    const std::vector<MeanOrbit>& orbits,
+    const std::vector<bool>& isPrimary,
+    const double& duration,
+    const double& distance,
+    const double& step,
+    const std::size_t& firstWindow,
+    const std::size_t& lastWindow,
+    std::vector<Candidate>& candidates,
+    ScreeningCounts& counts
+)
+{
+    const std::size_t nOrbits = orbits.size();
+    const double halfDistance = 0.5 * distance;
+
+    std::vector<OrbitPhase> phases(nOrbits);
+    std::vector<PhaseStep> turns(nOrbits);
+    std::vector<Vector3> positions0(nOrbits), positions1(nOrbits), lowers(nOrbits), uppers(nOrbits);
+    std::vector<double> bounds(nOrbits);
+    SpatialHash grid;
+
+    const double time0 = static_cast<double>(firstWindow) * step;
+    for (std::size_t ii = 0; ii < nOrbits; ++ii) {
+        phases[ii]     = get_phase(orbits[ii], time0);
+        turns[ii]      = get_phase_step(orbits[ii], step);
+        positions0[ii] = get_position(orbits[ii], phases[ii]);
+    }
+
+    for (std::size_t window = firstWindow; window < lastWindow; ++window) {
+        const double start  = static_cast<double>(window) * step;
+        const bool fullStep = start + step <= duration;
+        const double end    = fullStep ? start + step : duration;
+        const double dt     = end - start;
+
+        // Bound each path over the window by the box around its chord, padded by how far the path can bow
+        double maxExtent = 0.0;
+        for (std::size_t ii = 0; ii < nOrbits; ++ii) {
+            const MeanOrbit& orbit = orbits[ii];
+            if (fullStep) { advance_phase(orbit, end, step, turns[ii], phases[ii]); }
+            else {
+                phases[ii] = get_phase(orbit, end);
+            }
+            positions1[ii] = get_position(orbit, phases[ii]);
+
+            bounds[ii]       = orbit.chordBound * dt * dt;
+            const double pad = bounds[ii] + halfDistance;
+            for (std::size_t jj = 0; jj < 3; ++jj) {
+                lowers[ii][jj] = std::min(positions0[ii][jj], positions1[ii][jj]) - pad;
+                uppers[ii][jj] = std::max(positions0[ii][jj], positions1[ii][jj]) + pad;
+                maxExtent      = std::max(maxExtent, uppers[ii][jj] - lowers[ii][jj]);
+            }
+        }
+
+        const double cellScale = 1.0 / (CELL_SCALE * maxExtent);
+        const auto cell_of     = [&](const double& coordinate) { return static_cast<std::int64_t>(std::floor(coordinate * cellScale)); };
+
+        grid.clear();
+        for (std::uint32_t ii = 0; ii < nOrbits; ++ii) {
+            for (std::int64_t ix = cell_of(lowers[ii][0]); ix <= cell_of(uppers[ii][0]); ++ix) {
+                for (std::int64_t iy = cell_of(lowers[ii][1]); iy <= cell_of(uppers[ii][1]); ++iy) {
+                    for (std::int64_t iz = cell_of(lowers[ii][2]); iz <= cell_of(uppers[ii][2]); ++iz) {
+                        grid.insert(pack_cell(ix, iy, iz), ii);
+                    }
+                }
+            }
+        }
+
+        grid.for_each_cell([&](const std::uint64_t& key, std::span<const std::uint32_t> members) {
+            for (std::size_t aa = 0; aa < members.size(); ++aa) {
+                const std::uint32_t ii = members[aa];
+                for (std::size_t bb = aa + 1; bb < members.size(); ++bb) {
+                    const std::uint32_t jj = members[bb];
+                    if (!isPrimary[ii] && !isPrimary[jj]) { continue; }
+
+                    // Stage 1, per pair
+                    if (orbits[ii].perigee - orbits[jj].apogee > distance || orbits[jj].perigee - orbits[ii].apogee > distance) {
+                        continue;
+                    }
+
+                    // Boxes overlap, and this is the cell holding the low corner of the overlap, so each pair is kept once
+                    std::array<double, 3> overlapLower;
+                    bool overlaps = true;
+                    for (std::size_t kk = 0; kk < 3; ++kk) {
+                        overlaps &= lowers[ii][kk] <= uppers[jj][kk] && lowers[jj][kk] <= uppers[ii][kk];
+                        overlapLower[kk] = std::max(lowers[ii][kk], lowers[jj][kk]);
+                    }
+                    if (!overlaps || pack_cell(cell_of(overlapLower[0]), cell_of(overlapLower[1]), cell_of(overlapLower[2])) != key) {
+                        continue;
+                    }
+                    ++counts.nGridCandidates;
+
+                    // Closest approach of the chords, which the paths are within the bounds of
+                    Vector3 separation, drift;
+                    for (std::size_t kk = 0; kk < 3; ++kk) {
+                        separation[kk] = positions0[jj][kk] - positions0[ii][kk];
+                        drift[kk]      = positions1[jj][kk] - positions1[ii][kk] - separation[kk];
+                    }
+                    const double driftSquared = squared_norm(drift);
+                    const double closing      = -(separation[0] * drift[0] + separation[1] * drift[1] + separation[2] * drift[2]);
+                    const double fraction     = driftSquared > 0.0 ? std::clamp(closing / driftSquared, 0.0, 1.0) : 0.0;
+                    Vector3 closest;
+                    for (std::size_t kk = 0; kk < 3; ++kk) {
+                        closest[kk] = separation[kk] + fraction * drift[kk];
+                    }
+
+                    const double reach = distance + bounds[ii] + bounds[jj];
+                    if (squared_norm(closest) > reach * reach) { continue; }
+                    ++counts.nSweepCandidates;
+
+                    candidates.push_back({ ii, jj, static_cast<std::uint32_t>(window) });
+                }
+            }
+        });
+
+        std::swap(positions0, positions1);
+    }
+}
+
+// Stage 3: solve for the closest approach in a candidate window
+bool solve_approach(
+    const std::vector<MeanOrbit>& orbits,
+    const Candidate& candidate,
+    const double& duration,
+    const double& step,
+    const double& distance,
+    Approach& approach
+)
+{
+    const MeanOrbit& first  = orbits[candidate.first];
+    const MeanOrbit& second = orbits[candidate.second];
+    const auto range2       = [&](const double& time) { return squared_norm(get_separation(first, second, time)); };
+
+    // The paths are smooth and nearly straight over a window, so there is at most one minimum in it. A minimum at
+    // either end may be just past it, so widen the search into the neighboring window. Duplicates are merged later.
+    double lower = static_cast<double>(candidate.window) * step;
+    double upper = std::min(lower + step, duration);
+    double time  = minimize(range2, lower, upper, TCA_TOLERANCE);
+    if (time - lower < EDGE_TOLERANCE && lower > 0.0) {
+        lower = std::max(lower - step, 0.0);
+        time  = minimize(range2, lower, upper, TCA_TOLERANCE);
+    }
+    else if (upper - time < EDGE_TOLERANCE && upper < duration) {
+        upper = std::min(upper + step, duration);
+        time  = minimize(range2, lower, upper, TCA_TOLERANCE);
+    }
+
+    // A minimum still on an edge is only the tail of an approach, unless the edge is the end of the screening
+    if ((time - lower < EDGE_TOLERANCE && lower > 0.0) || (upper - time < EDGE_TOLERANCE && upper < duration)) { return false; }
+
+    const double missDistance = std::sqrt(range2(time));
+    if (missDistance > distance) { return false; }
+
+    // Central difference of the separation
+    const double delta  = std::min(1.0e-3, 0.5 * step);
+    const Vector3 after  = get_separation(first, second, time + delta);
+    const Vector3 before = get_separation(first, second, time - delta);
+    Vector3 relativeVelocity;
+    for (std::size_t ii = 0; ii < 3; ++ii) {
+        relativeVelocity[ii] = (after[ii] - before[ii]) / (2.0 * delta);
+    }
+
+    approach = { candidate.first, candidate.second, time, missDistance, std::sqrt(squared_norm(relativeVelocity)) };
+    return true;
+}
+
+std::pair<std::vector<Approach>, ScreeningCounts> screen_orbits(
+    const std::vector<MeanOrbit>& orbits,
+    const std::vector<bool>& isPrimary,
+    const double& duration,
+    const double& distance,
+    const double& step,
+    const std::size_t& nThreads
+)
+{
+    ScreeningCounts counts;
+    const std::size_t nOrbits    = orbits.size();
+    const std::size_t nPrimaries = std::count(isPrimary.begin(), isPrimary.end(), true);
+    if (nPrimaries == 0 || nOrbits < 2) { return { {}, counts }; }
+
+    counts.nPairs      = nPrimaries * (nOrbits - 1) - nPrimaries * (nPrimaries - 1) / 2;
+    counts.nApsisPairs = count_apsis_pairs(orbits, isPrimary, 0.5 * distance);
+
+    // Contiguous runs of windows per thread, so each thread carries its spacecraft forward
+    const std::size_t nWindows = static_cast<std::size_t>(std::ceil(duration / step));
+    const std::size_t nBlocks  = utilities::get_worker_count(nWindows, nThreads);
+    std::vector<std::vector<Candidate>> blockCandidates(nBlocks);
+    std::vector<ScreeningCounts> blockCounts(nBlocks);
+    utilities::parallel_for(nBlocks, nBlocks, [&](const std::size_t& iBlock) {
+        filter_windows(
+            orbits,
+            isPrimary,
+            duration,
+            distance,
+            step,
+            iBlock * nWindows / nBlocks,
+            (iBlock + 1) * nWindows / nBlocks,
+            blockCandidates[iBlock],
+            blockCounts[iBlock]
+        );
+    });
+
+    std::vector<Candidate> candidates;
+    for (std::size_t iBlock = 0; iBlock < nBlocks; ++iBlock) {
+        counts.nGridCandidates += blockCounts[iBlock].nGridCandidates;
+        counts.nSweepCandidates += blockCounts[iBlock].nSweepCandidates;
+        candidates.insert(candidates.end(), blockCandidates[iBlock].begin(), blockCandidates[iBlock].end());
+    }
+
+    std::vector<Approach> solved(candidates.size());
+    std::vector<char> found(candidates.size(), false);
+    utilities::parallel_for(candidates.size(), nThreads, [&](const std::size_t& ii) {
+        found[ii] = solve_approach(orbits, candidates[ii], duration, step, distance, solved[ii]);
+    });
+
+    // Merge approaches found from neighboring windows. Distinct approaches of one pair are at least a fraction of an
+    // orbit apart, far more than a window.
+    std::vector<Approach> approaches;
+    for (std::size_t ii = 0; ii < solved.size(); ++ii) {
+        if (found[ii]) { approaches.push_back(solved[ii]); }
+    }
+    std::sort(approaches.begin(), approaches.end(), [](const Approach& a, const Approach& b) {
+        return std::tie(a.first, a.second, a.time) < std::tie(b.first, b.second, b.time);
+    });
+
+    std::vector<Approach> merged;
+    for (const Approach& approach : approaches) {
+        if (!merged.empty()) {
+            Approach& last = merged.back();
+            if (last.first == approach.first && last.second == approach.second && approach.time - last.time < step) {
+                if (approach.missDistance < last.missDistance) { last = approach; }
+                continue;
+            }
+        }
+        merged.push_back(approach);
+    }
+    std::sort(merged.begin(), merged.end(), [](const Approach& a, const Approach& b) { return a.time < b.time; });
+
+    counts.nConjunctions = merged.size();
+    return { merged, counts };
+}
+
+} // namespace
+
+
+ConjunctionScreening screen_conjunctions(
+    std::span<const astro::Spacecraft> spacecraft,
+    const astro::Date& start,
+    const astro::Date& end,
+    const astro::AstrodynamicsSystem& sys,
+    const Distance& screeningDistance,
+    const Time& step,
+    const std::size_t& nThreads
+)
+{
+    return screen_conjunctions(spacecraft, {}, start, end, sys, screeningDistance, step, nThreads);
+}
+
+ConjunctionScreening screen_conjunctions(
+    std::span<const astro::Spacecraft> primaries,
+    std::span<const astro::Spacecraft> secondaries,
+    const astro::Date& start,
+    const astro::Date& end,
+    const astro::AstrodynamicsSystem& sys,
+    const Distance& screeningDistance,
+    const Time& step,
+    const std::size_t& nThreads
+)
+{
+    const double duration = (end - start).numerical_value_in(astrea::detail::time_unit);
+    const double distance = screeningDistance.numerical_value_in(astrea::detail::distance_unit);
+    const double stepSize = step.numerical_value_in(astrea::detail::time_unit);
+    if (duration <= 0.0) { throw std::runtime_error("Conjunction screening requires an end after the start."); }
+    if (distance <= 0.0 || stepSize <= 0.0) {
+        throw std::runtime_error("Conjunction screening requires a positive screening distance and step.");
+    }
+
+    const auto& center  = sys.get_center();
+    const double mu     = center->get_mu().numerical_value_in(mp_units::pow<3>(km) / mp_units::pow<2>(s));
+    const double j2     = center->get_j2().numerical_value_in(astrea::detail::unitless);
+    const double radius = center->get_equitorial_radius().numerical_value_in(astrea::detail::distance_unit);
+
+    // The catalog first, then any primaries not already in it
+    std::vector<const astro::Spacecraft*> objects;
+    std::vector<bool> isPrimary;
+    std::unordered_map<std::size_t, std::size_t> catalogIndices;
+    for (const astro::Spacecraft& sat : secondaries) {
+        catalogIndices.emplace(sat.get_id(), objects.size());
+        objects.push_back(&sat);
+        isPrimary.push_back(false);
+    }
+    for (const astro::Spacecraft& sat : primaries) {
+        const auto match = catalogIndices.find(sat.get_id());
+        if (match != catalogIndices.end()) { isPrimary[match->second] = true; }
+        else {
+            objects.push_back(&sat);
+            isPrimary.push_back(true);
+        }
+    }
+
+    std::vector<MeanOrbit> orbits(objects.size());
+    utilities::parallel_for(objects.size(), nThreads, [&](const std::size_t& ii) {
+        const astro::State& state0 = objects[ii]->get_initial_state();
+        const double epochOffset   = (state0.get_epoch() - start).numerical_value_in(astrea::detail::time_unit);
+        orbits[ii]                 = build_orbit(state0.in_element_set<astro::Keplerian>(), epochOffset, mu, j2, radius);
+    });
+
+    const auto [approaches, counts] = screen_orbits(orbits, isPrimary, duration, distance, stepSize, nThreads);
+
+    ConjunctionScreening screening;
+    screening.counts = counts;
+    screening.conjunctions.reserve(approaches.size());
+    for (const Approach& approach : approaches) {
+        // The primary is whichever end was screened, or the first given if both were
+        const bool firstIsPrimary       = isPrimary[approach.first];
+        const astro::Spacecraft& prime  = *objects[firstIsPrimary ? approach.first : approach.second];
+        const astro::Spacecraft& second = *objects[firstIsPrimary ? approach.second : approach.first];
+        screening.conjunctions.push_back({ prime.get_id(),
+                                           second.get_id(),
+                                           start + approach.time * s,
+                                           approach.missDistance * km,
+                                           approach.relativeSpeed * km / s });
+    }
+    return screening;
+}
+
+} // namespace trace
+} // namespace astrea
@@ -0,0 +1,137 @@
+/**
+ * @file conjunction_screening.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief Header file for staged close-approach screening in the astrea access library.
+ * @version 0.1
+ * @date 2025-08-06
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include <mp-units/systems/si.h>
+
+#include <units/units.hpp>
+
+#include <astro/astro.fwd.hpp>
+#include <astro/time/Date.hpp>
+
+namespace astrea {
+namespace trace {
+
+/**
+ * @brief Default miss distance below which a close approach is reported.
+ */
+inline constexpr Distance DEFAULT_SCREENING_DISTANCE = 5.0 * mp_units::si::unit_symbols::km;
+
+/**
+ * @brief Default length of the time windows searched by the grid and sweep filters.
+ */
+inline constexpr Time DEFAULT_SCREENING_STEP = 30.0 * mp_units::si::unit_symbols::s;
+
+/**
+ * @brief Struct to hold a single close approach between two spacecraft.
+ */
+struct Conjunction {
+    std::size_t primaryId;   //!< ID of the primary spacecraft
+    std::size_t secondaryId; //!< ID of the secondary spacecraft
+    astro::Date tca;         //!< Time of closest approach
+    Distance missDistance;   //!< Distance between the spacecraft at the time of closest approach
+    Velocity relativeSpeed;  //!< Relative speed of the spacecraft at the time of closest approach
+};
+
+/**
+ * @brief Struct to hold how many pairs each stage of a screening kept.
+ *
+ * The grid and sweep stages run once per time window, so they count pair-windows: a pair that stays close across
+ * several windows is counted in each of them.
+ */
+struct ScreeningCounts {
+    std::size_t nPairs           = 0; //!< Pairs screened
+    std::size_t nApsisPairs      = 0; //!< Pairs whose perigee-to-apogee radius bands overlap within the screening distance
+    std::size_t nGridCandidates  = 0; //!< Pair-windows sharing a grid cell with overlapping bounding boxes
+    std::size_t nSweepCandidates = 0; //!< Pair-windows whose linearized closest approach is within the screening distance
+    std::size_t nConjunctions    = 0; //!< Close approaches found by the time of closest approach solve
+};
+
+/**
+ * @brief Struct to hold the results of a conjunction screening.
+ */
+struct ConjunctionScreening {
+    std::vector<Conjunction> conjunctions; //!< Close approaches, ordered by time of closest approach
+    ScreeningCounts counts;                //!< Number of pairs kept by each stage
+};
+
+/**
+ * @brief Screen every pair of spacecraft for close approaches.
+ *
+ * See the primary-versus-catalog overload for the stages and the orbit model.
+ *
+ * @param spacecraft The spacecraft to screen against each other.
+ * @param start The start of the screening interval.
+ * @param end The end of the screening interval.
+ * @param sys The astrodynamics system whose central body the spacecraft orbit.
+ * @param screeningDistance The miss distance below which a close approach is reported.
+ * @param step The length of the time windows searched by the grid and sweep filters.
+ * @param nThreads The number of threads to use. Zero uses the hardware concurrency.
+ * @return ConjunctionScreening The close approaches and the number of pairs kept by each stage.
+ * @throws std::runtime_error If the interval is empty, the distance or step is not positive, or an orbit is not
+ * elliptical.
+ */
+ConjunctionScreening screen_conjunctions(
+    std::span<const astro::Spacecraft> spacecraft,
+    const astro::Date& start,
+    const astro::Date& end,
+    const astro::AstrodynamicsSystem& sys,
+    const Distance& screeningDistance = DEFAULT_SCREENING_DISTANCE,
+    const Time& step                  = DEFAULT_SCREENING_STEP,
+    const std::size_t& nThreads       = 0
+);
+
+/**
+ * @brief Screen a set of primary spacecraft against a catalog for close approaches.
+ *
+ * Screening runs in stages, each keeping only the pairs that could still come within the screening distance:
+ * 1. Pairs whose perigee-to-apogee radius bands do not overlap are dropped.
+ * 2. The interval is split into windows of the given step. In each window, every spacecraft is bounded by the box
+ * around its chord plus the most its path can bow away from that chord. Boxes are binned into a spatial hash, and pairs
+ * sharing a cell with overlapping boxes are kept. Each is then swept linearly across the window and kept if its
+ * closest approach is within the screening distance plus both bounds.
+ * 3. The time of closest approach in each remaining window is found with Brent's method, and approaches within the
+ * screening distance are reported.
+ *
+ * Windows are split across threads, and each thread carries its spacecraft from one window to the next so every
+ * position is solved once. Spacecraft are propagated from their initial states as Keplerian orbits with the secular
+ * drift from J2, so results are as accurate as that model is over the interval.
+ *
+ * A primary with the same ID as a catalog spacecraft is the same object, and is not screened against itself.
+ *
+ * @param primaries The spacecraft to screen.
+ * @param secondaries The catalog to screen the primaries against.
+ * @param start The start of the screening interval.
+ * @param end The end of the screening interval.
+ * @param sys The astrodynamics system whose central body the spacecraft orbit.
+ * @param screeningDistance The miss distance below which a close approach is reported.
+ * @param step The length of the time windows searched by the grid and sweep filters.
+ * @param nThreads The number of threads to use. Zero uses the hardware concurrency.
+ * @return ConjunctionScreening The close approaches and the number of pairs kept by each stage.
+ * @throws std::runtime_error If the interval is empty, the distance or step is not positive, or an orbit is not
+ * elliptical.
+ */
+ConjunctionScreening screen_conjunctions(
+    std::span<const astro::Spacecraft> primaries,
+    std::span<const astro::Spacecraft> secondaries,
+    const astro::Date& start,
+    const astro::Date& end,
+    const astro::AstrodynamicsSystem& sys,
+    const Distance& screeningDistance = DEFAULT_SCREENING_DISTANCE,
+    const Time& step                  = DEFAULT_SCREENING_STEP,
+    const std::size_t& nThreads       = 0
+);
+
+} // namespace trace
+} // namespace astrea
@@ -0,0 +1,208 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <astro/astro.hpp>
+
+#include <trace/trace.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace trace;
+
+using namespace mp_units;
+using mp_units::angular::unit_symbols::deg;
+using mp_units::si::unit_symbols::km;
+using mp_units::si::unit_symbols::s;
+
+class ConjunctionScreeningTest : public testing::Test {
+  public:
+    ConjunctionScreeningTest() = default;
+
+    Spacecraft make_spacecraft(const double& semimajor, const double& inclination, const double& rightAscension, const double& trueAnomaly)
+    {
+        return Spacecraft(State(
+            Keplerian(semimajor * km, 0.0 * one, inclination * deg, rightAscension * deg, 0.0 * deg, trueAnomaly * deg), epoch, sys
+        ));
+    }
+
+    static constexpr double RADIUS = 7000.0;
+
+    AstrodynamicsSystem sys;
+    Date epoch;
+};
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST_F(ConjunctionScreeningTest, InvalidInputs)
+{
+    const std::vector<Spacecraft> sats = { make_spacecraft(RADIUS, 0.0, 0.0, 0.0), make_spacecraft(RADIUS, 90.0, 0.0, 0.0) };
+
+    ASSERT_ANY_THROW(screen_conjunctions(sats, epoch, epoch, sys));
+    ASSERT_ANY_THROW(screen_conjunctions(sats, epoch + 60.0 * s, epoch, sys));
+    ASSERT_ANY_THROW(screen_conjunctions(sats, epoch, epoch + 60.0 * s, sys, 0.0 * km));
+    ASSERT_ANY_THROW(screen_conjunctions(sats, epoch, epoch + 60.0 * s, sys, DEFAULT_SCREENING_DISTANCE, 0.0 * s));
+}
+
+TEST_F(ConjunctionScreeningTest, CrossingOrbits)
+{
+    // Equatorial and polar orbits that reach the ascending node together a few minutes in
+    const std::vector<Spacecraft> sats = { make_spacecraft(RADIUS, 0.0, 0.0, -10.0), make_spacecraft(RADIUS, 90.0, 0.0, -10.0) };
+    const double meanMotion            = std::sqrt(398600.4418 / (RADIUS * RADIUS * RADIUS));
+    const double expectedTca           = 10.0 * std::numbers::pi / 180.0 / meanMotion;
+    const double speed                 = std::sqrt(398600.4418 / RADIUS);
+
+    const ConjunctionScreening screening = screen_conjunctions(sats, epoch, epoch + 600.0 * s, sys);
+    ASSERT_EQ(screening.conjunctions.size(), 1);
+
+    // J2 moves the two apart by a few kilometers before they meet
+    const Conjunction& conjunction = screening.conjunctions[0];
+    ASSERT_EQ(conjunction.primaryId, sats[0].get_id());
+    ASSERT_EQ(conjunction.secondaryId, sats[1].get_id());
+    ASSERT_NEAR((conjunction.tca - epoch).numerical_value_in(s), expectedTca, 5.0);
+    ASSERT_LT(conjunction.missDistance, DEFAULT_SCREENING_DISTANCE);
+    ASSERT_NEAR(conjunction.relativeSpeed.numerical_value_in(km / s), std::sqrt(2.0) * speed, 0.05);
+
+    // One pair, kept by every stage
+    const ScreeningCounts& counts = screening.counts;
+    ASSERT_EQ(counts.nPairs, 1);
+    ASSERT_EQ(counts.nApsisPairs, 1);
+    ASSERT_GE(counts.nGridCandidates, counts.nSweepCandidates);
+    ASSERT_GE(counts.nSweepCandidates, 1);
+    ASSERT_EQ(counts.nConjunctions, 1);
+
+    // Too short to reach the node
+    ASSERT_TRUE(screen_conjunctions(sats, epoch, epoch + 60.0 * s, sys).conjunctions.empty());
+}
+
+TEST_F(ConjunctionScreeningTest, ApsisFilter)
+{
+    // A LEO and a GEO orbit never come close, so the pair is dropped before the grid
+    const std::vector<Spacecraft> sats = { make_spacecraft(RADIUS, 0.0, 0.0, 0.0), make_spacecraft(42164.0, 0.0, 0.0, 0.0) };
+
+    const ConjunctionScreening screening = screen_conjunctions(sats, epoch, epoch + 3600.0 * s, sys);
+    ASSERT_TRUE(screening.conjunctions.empty());
+    ASSERT_EQ(screening.counts.nPairs, 1);
+    ASSERT_EQ(screening.counts.nApsisPairs, 0);
+    ASSERT_EQ(screening.counts.nGridCandidates, 0);
+}
+
+TEST_F(ConjunctionScreeningTest, PrimariesAgainstCatalog)
+{
+    const Spacecraft equatorial = make_spacecraft(RADIUS, 0.0, 0.0, -10.0);
+    const Spacecraft polar      = make_spacecraft(RADIUS, 90.0, 0.0, -10.0);
+    const Spacecraft inclined   = make_spacecraft(RADIUS, 45.0, 90.0, 0.0);
+    const std::vector<Spacecraft> primaries = { polar };
+    const std::vector<Spacecraft> catalog   = { equatorial, polar, inclined };
+
+    // The primary is also in the catalog, so it pairs with the other two only
+    const ConjunctionScreening screening = screen_conjunctions(primaries, catalog, epoch, epoch + 600.0 * s, sys);
+    ASSERT_EQ(screening.counts.nPairs, 2);
+    ASSERT_EQ(screening.conjunctions.size(), 1);
+    ASSERT_EQ(screening.conjunctions[0].primaryId, polar.get_id());
+    ASSERT_EQ(screening.conjunctions[0].secondaryId, equatorial.get_id());
+
+    // With no primaries, there is nothing to screen
+    const ConjunctionScreening none = screen_conjunctions(std::vector<Spacecraft>{}, catalog, epoch, epoch + 600.0 * s, sys);
+    ASSERT_TRUE(none.conjunctions.empty());
+    ASSERT_EQ(none.counts.nPairs, 0);
+}
+
+TEST_F(ConjunctionScreeningTest, ThreadsAgree)
+{
+    // A crowded shell, so there are close approaches to find
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> radius(RADIUS, RADIUS + 20.0);
+    std::uniform_real_distribution<double> angle(0.0, 360.0);
+    std::vector<Spacecraft> sats;
+    std::vector<std::array<double, 4>> elements;
+    for (std::size_t ii = 0; ii < 200; ++ii) {
+        elements.push_back({ radius(generator), ii % 2 ? 53.0 : 97.6, angle(generator), angle(generator) });
+        sats.push_back(make_spacecraft(elements[ii][0], elements[ii][1], elements[ii][2], elements[ii][3]));
+    }
+
+    const ConjunctionScreening serial   = screen_conjunctions(sats, epoch, epoch + 7200.0 * s, sys, 20.0 * km, 30.0 * s, 1);
+    const ConjunctionScreening parallel = screen_conjunctions(sats, epoch, epoch + 7200.0 * s, sys, 20.0 * km, 30.0 * s, 4);
+
+    ASSERT_FALSE(serial.conjunctions.empty());
+    ASSERT_EQ(serial.counts.nApsisPairs, parallel.counts.nApsisPairs);
+    ASSERT_EQ(serial.counts.nGridCandidates, parallel.counts.nGridCandidates);
+    ASSERT_EQ(serial.counts.nSweepCandidates, parallel.counts.nSweepCandidates);
+    ASSERT_EQ(serial.conjunctions.size(), parallel.conjunctions.size());
+    for (std::size_t ii = 0; ii < serial.conjunctions.size(); ++ii) {
+        ASSERT_EQ(serial.conjunctions[ii].primaryId, parallel.conjunctions[ii].primaryId);
+        ASSERT_EQ(serial.conjunctions[ii].secondaryId, parallel.conjunctions[ii].secondaryId);
+        ASSERT_LT(serial.conjunctions[ii].missDistance, 20.0 * km);
+    }
+
+    // Brute force: sample every pair each second under the same mean J2 orbits, and check that every sampled minimum
+    // under the screening distance was reported. Sampled minima are never below the true ones, so none can be missed.
+    const double mu         = sys.get_center()->get_mu().numerical_value_in(pow<3>(km) / pow<2>(s));
+    const double j2         = sys.get_center()->get_j2().numerical_value_in(one);
+    const double rEarth     = sys.get_center()->get_equitorial_radius().numerical_value_in(km);
+    const double toRad      = std::numbers::pi / 180.0;
+    const std::size_t nSats = sats.size();
+    const auto get_position = [&](const std::array<double, 4>& orbit, const double& time) {
+        const double a           = orbit[0];
+        const double meanMotion  = std::sqrt(mu / (a * a * a));
+        const double j2Scale     = 0.75 * meanMotion * j2 * (rEarth / a) * (rEarth / a);
+        const double cosInc      = std::cos(orbit[1] * toRad);
+        const double latitudeArg = orbit[3] * toRad + (meanMotion + j2Scale * (8.0 * cosInc * cosInc - 2.0)) * time;
+        const double raan        = orbit[2] * toRad - 2.0 * j2Scale * cosInc * time;
+        const double x           = a * std::cos(latitudeArg);
+        const double y           = a * std::sin(latitudeArg);
+        const double sinInc      = std::sin(orbit[1] * toRad);
+        return std::array<double, 3>{ x * std::cos(raan) - y * cosInc * std::sin(raan),
+                                      x * std::sin(raan) + y * cosInc * std::cos(raan),
+                                      y * sinInc };
+    };
+
+    const std::size_t nPairs = nSats * (nSats - 1) / 2;
+    std::vector<double> before(nPairs), current(nPairs), after(nPairs);
+    std::vector<std::array<double, 3>> positions(nSats);
+    std::size_t nChecked = 0;
+    for (std::size_t tt = 0; tt <= 7200; ++tt) {
+        for (std::size_t ii = 0; ii < nSats; ++ii) {
+            positions[ii] = get_position(elements[ii], static_cast<double>(tt));
+        }
+        for (std::size_t ii = 0, pair = 0; ii < nSats; ++ii) {
+            for (std::size_t jj = ii + 1; jj < nSats; ++jj, ++pair) {
+                const double dx = positions[jj][0] - positions[ii][0];
+                const double dy = positions[jj][1] - positions[ii][1];
+                const double dz = positions[jj][2] - positions[ii][2];
+                after[pair]     = std::sqrt(dx * dx + dy * dy + dz * dz);
+            }
+        }
+
+        if (tt >= 2) {
+            // Minimum at the middle sample, so the true minimum lies strictly inside the interval
+            const double time = static_cast<double>(tt - 1);
+            for (std::size_t ii = 0, pair = 0; ii < nSats; ++ii) {
+                for (std::size_t jj = ii + 1; jj < nSats; ++jj, ++pair) {
+                    if (current[pair] >= 20.0 || current[pair] > before[pair] || current[pair] > after[pair]) { continue; }
+
+                    const auto match = std::find_if(serial.conjunctions.begin(), serial.conjunctions.end(), [&](const Conjunction& conjunction) {
+                        const bool samePair = (conjunction.primaryId == sats[ii].get_id() && conjunction.secondaryId == sats[jj].get_id()) ||
+                                              (conjunction.primaryId == sats[jj].get_id() && conjunction.secondaryId == sats[ii].get_id());
+                        return samePair && std::abs((conjunction.tca - epoch).numerical_value_in(s) - time) <= 1.0;
+                    });
+                    ASSERT_NE(match, serial.conjunctions.end()) << "Missed approach of " << ii << " and " << jj << " at " << time << " s";
+                    ASSERT_LE(match->missDistance.numerical_value_in(km), current[pair] + 1.0e-3);
+                    ++nChecked;
+                }
+            }
+        }
+        std::swap(before, current);
+        std::swap(current, after);
+    }
+    ASSERT_GT(nChecked, 0);
+}
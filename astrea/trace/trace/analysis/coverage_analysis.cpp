@@ -0,0 +1,295 @@
+#include <trace/analysis/coverage_analysis.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include <mp-units/systems/si.h>
+
+#include <utilities/parallel.hpp>
+
+#include <trace/platforms/ground/Grid.hpp>
+#include <trace/risesets/RiseSetArray.hpp>
+#include <trace/risesets/VisibilityBitset.hpp>
+
+namespace astrea {
+namespace trace {
+
+using mp_units::si::unit_symbols::s;
+
+namespace {
+
+/**
+ * @brief Accumulates the statistics of a single point as its coverage state changes.
+ */
+class CoverageAccumulator {
+  public:
+    /**
+     * @brief Construct a CoverageAccumulator at the start of the analysis interval.
+     *
+     * @param start The start of the analysis interval, in seconds.
+     */
+    CoverageAccumulator(const double& start) :
+        _gapStart(start)
+    {
+    }
+
+    /**
+     * @brief Record a change in coverage.
+     *
+     * @param time The time of the change, in seconds.
+     * @param covered Whether the point is covered after the change.
+     */
+    void update(const double& time, const bool& covered)
+    {
+        if (covered && !_covered) { add_gap(time - _gapStart); }
+        else if (!covered && _covered) {
+            _gapStart = time;
+        }
+        _covered = covered;
+    }
+
+    /**
+     * @brief Close the analysis interval, recording any trailing gap.
+     *
+     * @param end The end of the analysis interval, in seconds.
+     */
+    void close(const double& end)
+    {
+        if (!_covered) { add_gap(end - _gapStart); }
+    }
+
+    /**
+     * @brief Returns the longest gap in coverage.
+     *
+     * @return double The longest gap, in seconds.
+     */
+    double max_gap() const { return _maxGap; }
+
+    /**
+     * @brief Returns the mean gap in coverage.
+     *
+     * @return double The mean gap, in seconds.
+     */
+    double mean_gap() const { return _nGaps ? _totalGap / static_cast<double>(_nGaps) : 0.0; }
+
+  private:
+    bool _covered      = false; //!< Whether the point is currently covered
+    double _gapStart   = 0.0;   //!< Start of the current gap, in seconds
+    double _maxGap     = 0.0;   //!< Longest gap so far, in seconds
+    double _totalGap   = 0.0;   //!< Sum of all gaps so far, in seconds
+    std::size_t _nGaps = 0;     //!< Number of gaps so far
+
+    /**
+     * @brief Record a gap in coverage, ignoring gaps with no duration.
+     *
+     * @param gap The length of the gap, in seconds.
+     */
+    void add_gap(const double& gap)
+    {
+        if (gap <= 0.0) { return; }
+        _maxGap = std::max(_maxGap, gap);
+        _totalGap += gap;
+        ++_nGaps;
+    }
+};
+
+/**
+ * @brief Resize every statistic array for a number of points.
+ *
+ * @param stats The statistics to resize.
+ * @param nPoints The number of points.
+ */
+void resize(CoverageStatistics& stats, const std::size_t& nPoints)
+{
+    stats.pointIds.resize(nPoints);
+    stats.percentCoverage.resize(nPoints);
+    stats.maxRevisit.resize(nPoints);
+    stats.meanRevisit.resize(nPoints);
+    stats.meanInView.resize(nPoints);
+    stats.weights.resize(nPoints, 1.0 / static_cast<double>(nPoints));
+}
+
+/**
+ * @brief Sweep the accesses of a single point and store its statistics.
+ *
+ * Boundaries are merged through a min-heap of cursors, so the sweep is O(n log k) for n boundaries across k viewers.
+ * Boundaries outside the analysis interval are clamped to it.
+ *
+ * @param arrays The accesses of each viewer to the point.
+ * @param start The start of the analysis interval, in seconds.
+ * @param end The end of the analysis interval, in seconds.
+ * @param minCount The minimum number of viewers in view for the point to be covered.
+ * @param stats The statistics to fill.
+ * @param index The index of the point.
+ */
+void sweep_point(
+    const std::vector<const RiseSetArray*>& arrays,
+    const double& start,
+    const double& end,
+    const std::size_t& minCount,
+    CoverageStatistics& stats,
+    const std::size_t& index
+)
+{
+    using Cursor = std::pair<double, std::size_t>;
+    std::priority_queue<Cursor, std::vector<Cursor>, std::greater<Cursor>> heap;
+    for (std::size_t ii = 0; ii < arrays.size(); ++ii) {
+        if (arrays[ii]->size() > 0) { heap.emplace((*arrays[ii])[0].numerical_value_in(s), ii); }
+    }
+
+    CoverageAccumulator accumulator(start);
+    std::vector<std::size_t> indices(arrays.size(), 0);
+    std::size_t count      = 0;
+    double lastTime        = start;
+    double coveredDuration = 0.0;
+    double viewerDuration  = 0.0;
+    while (!heap.empty() && heap.top().first < end) {
+        const double time = std::max(heap.top().first, start);
+
+        // Accumulate the state since the last boundary
+        const double dt = time - lastTime;
+        viewerDuration += static_cast<double>(count) * dt;
+        if (count >= minCount) { coveredDuration += dt; }
+        lastTime = time;
+
+        // Consume every boundary at this time before checking the count
+        const double rawTime = heap.top().first;
+        while (!heap.empty() && heap.top().first == rawTime) {
+            const std::size_t iArray = heap.top().second;
+            heap.pop();
+
+            const std::size_t iBoundary = indices[iArray]++;
+            if (iBoundary & 1) { --count; }
+            else {
+                ++count;
+            }
+
+            const RiseSetArray& array = *arrays[iArray];
+            if (iBoundary + 1 < array.size()) { heap.emplace(array[iBoundary + 1].numerical_value_in(s), iArray); }
+        }
+        accumulator.update(time, count >= minCount);
+    }
+
+    // Close out the interval
+    const double dt = end - lastTime;
+    viewerDuration += static_cast<double>(count) * dt;
+    if (count >= minCount) { coveredDuration += dt; }
+    accumulator.close(end);
+
+    const double duration        = end - start;
+    stats.percentCoverage[index] = 100.0 * coveredDuration / duration;
+    stats.meanInView[index]      = viewerDuration / duration;
+    stats.maxRevisit[index]      = accumulator.max_gap() * s;
+    stats.meanRevisit[index]     = accumulator.mean_gap() * s;
+}
+
+} // namespace
+
+
+double CoverageStatistics::weighted_mean(const std::vector<double>& values) const
+{
+    if (values.size() != weights.size()) { throw std::runtime_error("A weighted mean requires one value for each point."); }
+
+    double mean = 0.0;
+    for (std::size_t ii = 0; ii < values.size(); ++ii) {
+        mean += weights[ii] * values[ii];
+    }
+    return mean;
+}
+
+CoverageStatistics find_coverage(
+    const AccessArray& accesses,
+    const Grid& grid,
+    const Time& start,
+    const Time& end,
+    const std::size_t& minCount,
+    const std::size_t& nThreads
+)
+{
+    if (end <= start) { throw std::runtime_error("Coverage analysis requires an end time after the start time."); }
+    if (minCount == 0) { throw std::runtime_error("Coverage analysis requires a minimum count of at least one."); }
+
+    CoverageStatistics stats;
+    resize(stats, grid.size());
+
+    // Bucket the accesses by point in a single pass
+    std::unordered_map<std::size_t, std::size_t> pointIndices;
+    for (std::size_t ii = 0; ii < grid.size(); ++ii) {
+        stats.pointIds[ii] = grid[ii].get_id();
+        stats.weights[ii]  = grid.get_weight(ii).numerical_value_in(mp_units::one);
+        pointIndices.emplace(stats.pointIds[ii], ii);
+    }
+
+    std::vector<std::vector<const RiseSetArray*>> pointAccesses(grid.size());
+    for (const auto& [idPair, risesets] : accesses) {
+        auto point = pointIndices.find(idPair.receiver);
+        if (point == pointIndices.end()) { point = pointIndices.find(idPair.sender); }
+        if (point != pointIndices.end()) { pointAccesses[point->second].push_back(&risesets); }
+    }
+
+    // Every point writes only its own entries, so no synchronization is needed
+    const double startTime = start.numerical_value_in(s);
+    const double endTime   = end.numerical_value_in(s);
+    utilities::parallel_for(grid.size(), nThreads, [&](const std::size_t& ii) {
+        sweep_point(pointAccesses[ii], startTime, endTime, minCount, stats, ii);
+    });
+
+    return stats;
+}
+
+CoverageStatistics find_coverage(const GroundVisibility& visibility, const std::size_t& minCount, const std::size_t& nThreads)
+{
+    const std::size_t nSamples = visibility.times.size();
+    if (nSamples < 2) { throw std::runtime_error("Coverage analysis requires at least two samples."); }
+    if (minCount == 0) { throw std::runtime_error("Coverage analysis requires a minimum count of at least one."); }
+    for (const auto& bitset : visibility.visibility) {
+        if (bitset.size() != nSamples) {
+            throw std::runtime_error("Every VisibilityBitset must have one sample for each time.");
+        }
+    }
+
+    const std::size_t nPoints = visibility.groundIds.size();
+    CoverageStatistics stats;
+    resize(stats, nPoints);
+    stats.pointIds = visibility.groundIds;
+
+    std::vector<double> times(nSamples);
+    for (std::size_t ii = 0; ii < nSamples; ++ii) {
+        times[ii] = visibility.times[ii].numerical_value_in(s);
+    }
+
+    utilities::parallel_for(nPoints, nThreads, [&](const std::size_t& iPoint) {
+        const std::span<const VisibilityBitset> viewers = visibility.get_ground_visibility(iPoint);
+        std::vector<std::size_t> counts                 = count_visible(viewers);
+        if (counts.empty()) { counts.resize(nSamples, 0); }
+
+        CoverageAccumulator accumulator(times.front());
+        std::size_t nCovered = 0;
+        std::size_t nInView  = 0;
+        bool covered         = false;
+        for (std::size_t ii = 0; ii < nSamples; ++ii) {
+            // A gap closes at the first covered sample, and opens at the last covered sample before it
+            const bool next = (counts[ii] >= minCount);
+            accumulator.update((next || !covered) ? times[ii] : times[ii - 1], next);
+            covered = next;
+
+            nCovered += next;
+            nInView += counts[ii];
+        }
+        accumulator.close(times.back());
+
+        stats.percentCoverage[iPoint] = 100.0 * static_cast<double>(nCovered) / static_cast<double>(nSamples);
+        stats.meanInView[iPoint]      = static_cast<double>(nInView) / static_cast<double>(nSamples);
+        stats.maxRevisit[iPoint]      = accumulator.max_gap() * s;
+        stats.meanRevisit[iPoint]     = accumulator.mean_gap() * s;
+    });
+
+    return stats;
+}
+
+} // namespace trace
+} // namespace astrea
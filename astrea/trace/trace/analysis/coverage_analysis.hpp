@@ -0,0 +1,95 @@
+/**
+ * @file coverage_analysis.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief Header file for grid coverage and revisit statistics in the astrea access library.
+ * @version 0.1
+ * @date 2025-08-06
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <vector>
+
+#include <units/units.hpp>
+
+#include <trace/analysis/access_analysis.hpp>
+#include <trace/risesets/AccessArray.hpp>
+#include <trace/trace.fwd.hpp>
+
+namespace astrea {
+namespace trace {
+
+/**
+ * @brief Struct to hold coverage statistics for every point of a grid.
+ *
+ * Each statistic is stored as a flat array in grid order so results can be plotted directly as heat maps.
+ */
+struct CoverageStatistics {
+    std::vector<std::size_t> pointIds;   //!< Ground point IDs, in grid order
+    std::vector<double> percentCoverage; //!< Percent of the interval with at least the minimum number of viewers in view
+    std::vector<Time> maxRevisit;        //!< Longest gap in coverage
+    std::vector<Time> meanRevisit;       //!< Mean gap in coverage
+    std::vector<double> meanInView;      //!< Time-averaged number of viewers in view
+    std::vector<double> weights;         //!< Normalized weight of each point
+
+    /**
+     * @brief Returns the number of points.
+     *
+     * @return std::size_t The number of points.
+     */
+    std::size_t size() const { return pointIds.size(); }
+
+    /**
+     * @brief Averages a statistic over the points using their weights.
+     *
+     * With area weights this is the surface average, regardless of how densely the grid samples each region.
+     *
+     * @param values The statistic for each point, in grid order.
+     * @return double The weighted mean of the statistic.
+     * @throws std::runtime_error If there is not one value for each point.
+     */
+    double weighted_mean(const std::vector<double>& values) const;
+};
+
+/**
+ * @brief Find coverage statistics for a grid from pairwise accesses.
+ *
+ * Every access that has a grid point as its sender or receiver is swept once, in time order, to accumulate all
+ * statistics for that point. Points are split across threads. Each point is weighted by its grid weight.
+ *
+ * @param accesses The accesses between viewers and grid points.
+ * @param grid The grid of ground points.
+ * @param start The start of the analysis interval.
+ * @param end The end of the analysis interval.
+ * @param minCount The minimum number of viewers in view for a point to be covered.
+ * @param nThreads The number of threads to use. Zero uses the hardware concurrency.
+ * @return CoverageStatistics The statistics for each point of the grid.
+ * @throws std::runtime_error If the interval is empty or the minimum count is zero.
+ */
+CoverageStatistics find_coverage(
+    const AccessArray& accesses,
+    const Grid& grid,
+    const Time& start,
+    const Time& end,
+    const std::size_t& minCount = 1,
+    const std::size_t& nThreads = 0
+);
+
+/**
+ * @brief Find coverage statistics for a grid from sampled visibility.
+ *
+ * Gaps are measured between the covered samples on either side, so statistics match the continuous result to within
+ * the sample spacing.
+ *
+ * @param visibility The visibility between a constellation and the grid points.
+ * @param minCount The minimum number of viewers in view for a point to be covered.
+ * @param nThreads The number of threads to use. Zero uses the hardware concurrency.
+ * @return CoverageStatistics The statistics for each point, in the order of the ground IDs, weighted equally.
+ * @throws std::runtime_error If there are fewer than two samples or the minimum count is zero.
+ */
+CoverageStatistics find_coverage(const GroundVisibility& visibility, const std::size_t& minCount = 1, const std::size_t& nThreads = 0);
+
+} // namespace trace
+} // namespace astrea
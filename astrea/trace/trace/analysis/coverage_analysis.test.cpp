@@ -0,0 +1,139 @@
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <astro/astro.hpp>
+
+#include <trace/trace.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace trace;
+
+using namespace mp_units;
+using mp_units::angular::unit_symbols::deg;
+using mp_units::si::unit_symbols::km;
+using mp_units::si::unit_symbols::s;
+
+class CoverageAnalysisTest : public testing::Test {
+  public:
+    CoverageAnalysisTest() = default;
+
+    void SetUp() override
+    {
+        const CelestialBody* parent = sys.get("Earth").get();
+        grid = Grid({ GroundPoint(parent, 0.0 * deg, 0.0 * deg, 0.0 * km), GroundPoint(parent, 10.0 * deg, 10.0 * deg, 0.0 * km) });
+
+        // Two overlapping passes over the first point, nothing over the second
+        accesses[SAT1, grid[0].get_id()] = RiseSetArray({ 0.0 * s, 100.0 * s });
+        accesses[SAT2, grid[0].get_id()] = RiseSetArray({ 50.0 * s, 150.0 * s });
+        accesses[SAT3, SAT1]             = RiseSetArray({ 0.0 * s, 400.0 * s }); // Not a grid access
+    }
+
+    static constexpr std::size_t SAT1 = 1;
+    static constexpr std::size_t SAT2 = 2;
+    static constexpr std::size_t SAT3 = 3;
+
+    AstrodynamicsSystem sys;
+    Grid grid;
+    AccessArray accesses;
+};
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST_F(CoverageAnalysisTest, SingleFold)
+{
+    const CoverageStatistics stats = find_coverage(accesses, grid, 0.0 * s, 400.0 * s);
+    ASSERT_EQ(stats.size(), 2);
+    ASSERT_EQ(stats.pointIds[0], grid[0].get_id());
+    ASSERT_EQ(stats.pointIds[1], grid[1].get_id());
+
+    ASSERT_DOUBLE_EQ(stats.percentCoverage[0], 37.5);
+    ASSERT_DOUBLE_EQ(stats.meanInView[0], 0.5);
+    ASSERT_EQ(stats.maxRevisit[0], 250.0 * s);
+    ASSERT_EQ(stats.meanRevisit[0], 250.0 * s);
+
+    // Never covered, so the whole interval is a gap
+    ASSERT_DOUBLE_EQ(stats.percentCoverage[1], 0.0);
+    ASSERT_DOUBLE_EQ(stats.meanInView[1], 0.0);
+    ASSERT_EQ(stats.maxRevisit[1], 400.0 * s);
+    ASSERT_EQ(stats.meanRevisit[1], 400.0 * s);
+
+    // Manual grids weight every point equally
+    ASSERT_DOUBLE_EQ(stats.weighted_mean(stats.percentCoverage), 18.75);
+    ASSERT_ANY_THROW(stats.weighted_mean({ 1.0 }));
+}
+
+TEST_F(CoverageAnalysisTest, MultiFold)
+{
+    const CoverageStatistics stats = find_coverage(accesses, grid, 0.0 * s, 400.0 * s, 2);
+    ASSERT_DOUBLE_EQ(stats.percentCoverage[0], 12.5);
+    ASSERT_DOUBLE_EQ(stats.meanInView[0], 0.5);
+    ASSERT_EQ(stats.maxRevisit[0], 300.0 * s);
+    ASSERT_EQ(stats.meanRevisit[0], 175.0 * s);
+}
+
+TEST_F(CoverageAnalysisTest, ClippedInterval)
+{
+    const CoverageStatistics stats = find_coverage(accesses, grid, 75.0 * s, 125.0 * s);
+    ASSERT_DOUBLE_EQ(stats.percentCoverage[0], 100.0);
+    ASSERT_DOUBLE_EQ(stats.meanInView[0], 1.5);
+    ASSERT_EQ(stats.maxRevisit[0], 0.0 * s);
+}
+
+TEST_F(CoverageAnalysisTest, Threads)
+{
+    const CoverageStatistics serial = find_coverage(accesses, grid, 0.0 * s, 400.0 * s, 1, 1);
+    for (const std::size_t nThreads : { 0, 2, 8 }) {
+        const CoverageStatistics parallel = find_coverage(accesses, grid, 0.0 * s, 400.0 * s, 1, nThreads);
+        ASSERT_EQ(parallel.pointIds, serial.pointIds);
+        ASSERT_EQ(parallel.percentCoverage, serial.percentCoverage);
+        ASSERT_EQ(parallel.maxRevisit, serial.maxRevisit);
+        ASSERT_EQ(parallel.meanRevisit, serial.meanRevisit);
+        ASSERT_EQ(parallel.meanInView, serial.meanInView);
+    }
+}
+
+TEST_F(CoverageAnalysisTest, InvalidInputs)
+{
+    ASSERT_ANY_THROW(find_coverage(accesses, grid, 400.0 * s, 0.0 * s));
+    ASSERT_ANY_THROW(find_coverage(accesses, grid, 0.0 * s, 400.0 * s, 0));
+
+    GroundVisibility visibility;
+    visibility.times = { 0.0 * s };
+    ASSERT_ANY_THROW(find_coverage(visibility));
+}
+
+TEST_F(CoverageAnalysisTest, Visibility)
+{
+    GroundVisibility visibility;
+    for (std::size_t ii = 0; ii <= 10; ++ii) {
+        visibility.times.push_back(static_cast<double>(ii) * s);
+    }
+    visibility.viewerIds = { SAT1, SAT2 };
+    visibility.groundIds = { grid[0].get_id() };
+
+    VisibilityBitset viewer1(11);
+    VisibilityBitset viewer2(11);
+    for (std::size_t ii = 2; ii <= 4; ++ii) {
+        viewer1.set(ii);
+        viewer2.set(ii + 2);
+    }
+    visibility.visibility = { viewer1, viewer2 };
+
+    // Gaps run between the covered samples on either side
+    const CoverageStatistics stats = find_coverage(visibility);
+    ASSERT_EQ(stats.pointIds, visibility.groundIds);
+    ASSERT_DOUBLE_EQ(stats.percentCoverage[0], 100.0 * 5.0 / 11.0);
+    ASSERT_DOUBLE_EQ(stats.meanInView[0], 6.0 / 11.0);
+    ASSERT_EQ(stats.maxRevisit[0], 4.0 * s);
+    ASSERT_EQ(stats.meanRevisit[0], 3.0 * s);
+
+    const CoverageStatistics twoFold = find_coverage(visibility, 2);
+    ASSERT_DOUBLE_EQ(twoFold.percentCoverage[0], 100.0 / 11.0);
+    ASSERT_EQ(twoFold.maxRevisit[0], 6.0 * s);
+}
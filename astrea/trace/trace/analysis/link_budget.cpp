@@ -0,0 +1,188 @@
+#include <trace/analysis/link_budget.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+
+#include <mp-units/systems/angular.h>
+#include <mp-units/systems/si.h>
+
+#include <astro/state/CartesianVector.hpp>
+#include <astro/state/frames/frames.hpp>
+#include <astro/systems/AstrodynamicsSystem.hpp>
+#include <astro/systems/CelestialBody.hpp>
+#include <astro/time/Date.hpp>
+
+#include <trace/analysis/occultation.hpp>
+#include <trace/platforms/sensors/Antenna.hpp>
+#include <trace/risesets/VisibilityBitset.hpp>
+
+namespace astrea {
+
+using astro::AstrodynamicsSystem;
+using astro::Date;
+using astro::ECI;
+using astro::RadiusVector;
+
+namespace trace {
+
+using mp_units::one;
+using mp_units::angular::unit_symbols::rad;
+
+namespace {
+
+struct Vector3 {
+    double x, y, z;
+};
+
+Vector3 to_vector(const RadiusVector<ECI>& vector)
+{
+    return { vector.get_x().numerical_value_in(astrea::detail::distance_unit),
+             vector.get_y().numerical_value_in(astrea::detail::distance_unit),
+             vector.get_z().numerical_value_in(astrea::detail::distance_unit) };
+}
+
+double dot(const Vector3& a, const Vector3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+// Angle between two directions, where b has a known squared length
+Angle offset_angle(const Vector3& a, const Vector3& b, const double& bSquared)
+{
+    const double cosAngle = dot(a, b) / std::sqrt(dot(a, a) * bSquared);
+    return std::acos(std::clamp(cosAngle, -1.0, 1.0)) * rad;
+}
+
+} // namespace
+
+
+LinkBudget find_link_budget(
+    const Antenna& transmitter,
+    std::span<const RadiusVector<ECI>> transmitterPositions,
+    std::span<const SensorFrame> transmitterFrames,
+    const Antenna& receiver,
+    std::span<const RadiusVector<ECI>> receiverPositions,
+    std::span<const SensorFrame> receiverFrames,
+    const TimeVector& times,
+    const astro::CelestialBody& body,
+    const AtmosphericLossTable& atmosphere
+)
+{
+    const std::size_t nTimes = times.size();
+    if (transmitterPositions.size() != nTimes || transmitterFrames.size() != nTimes || receiverPositions.size() != nTimes ||
+        receiverFrames.size() != nTimes) {
+        throw std::runtime_error("Link budgets require a position and frame for each antenna at every time.");
+    }
+
+    LinkBudget budget;
+    budget.times = times;
+    budget.carrierToNoise.resize(nTimes);
+
+    // Gain, power, losses, and noise are fixed over the pass, so evaluate them once on boresight at a reference range
+    const double referenceRange = 1.0;
+    const CNR referenceCnr      = transmitter.carrier_to_noise_ratio(receiver, referenceRange * astrea::detail::distance_unit, 0.0 * rad);
+    const double fixedCnr       = referenceCnr.numerical_value_in(one) * referenceRange * referenceRange;
+
+    const EllipsoidOcculter occulter(body);
+    const std::vector<bool> occulted = occulter.is_occulting(transmitterPositions, receiverPositions);
+
+    // Endpoints inside the grazing layer are treated as ground terminals
+    const double atmosphereRadius =
+        (body.get_equitorial_radius() + occulter.get_grazing_altitude()).numerical_value_in(astrea::detail::distance_unit);
+    const double atmosphereRadiusSquared = atmosphereRadius * atmosphereRadius;
+    std::optional<double> zenithAttenuation;
+
+    const RadiusVector<astro::RIC> transmitterBoresight = transmitter.get_antenna_parameters().get_boresight();
+    const RadiusVector<astro::RIC> receiverBoresight    = receiver.get_antenna_parameters().get_boresight();
+
+    for (std::size_t ii = 0; ii < nTimes; ++ii) {
+        if (occulted[ii]) {
+            budget.carrierToNoise[ii] = -std::numeric_limits<double>::infinity();
+            continue;
+        }
+
+        const Vector3 transmitterPosition = to_vector(transmitterPositions[ii]);
+        const Vector3 receiverPosition    = to_vector(receiverPositions[ii]);
+        const Vector3 lineOfSight         = { receiverPosition.x - transmitterPosition.x,
+                                              receiverPosition.y - transmitterPosition.y,
+                                              receiverPosition.z - transmitterPosition.z };
+        const Vector3 reverseLineOfSight  = { -lineOfSight.x, -lineOfSight.y, -lineOfSight.z };
+        const double rangeSquared         = dot(lineOfSight, lineOfSight);
+
+        // Pointing losses at both ends
+        const Vector3 transmitterBoresightEci = to_vector(transmitterFrames[ii].ricToEci * transmitterBoresight);
+        const Vector3 receiverBoresightEci    = to_vector(receiverFrames[ii].ricToEci * receiverBoresight);
+        const Angle transmitterOffset         = offset_angle(transmitterBoresightEci, lineOfSight, rangeSquared);
+        const Angle receiverOffset            = offset_angle(receiverBoresightEci, reverseLineOfSight, rangeSquared);
+
+        double cnr = fixedCnr / rangeSquared;
+        cnr *= transmitter.pattern_loss(transmitterOffset).numerical_value_in(one);
+        cnr *= receiver.pattern_loss(receiverOffset).numerical_value_in(one);
+
+        // Atmospheric loss, from the elevation of the line of sight at the ground end
+        const double transmitterRadiusSquared = dot(transmitterPosition, transmitterPosition);
+        const double receiverRadiusSquared    = dot(receiverPosition, receiverPosition);
+        const bool transmitterIsLower         = transmitterRadiusSquared <= receiverRadiusSquared;
+        const double lowerRadiusSquared       = transmitterIsLower ? transmitterRadiusSquared : receiverRadiusSquared;
+        if (lowerRadiusSquared < atmosphereRadiusSquared) {
+            if (!zenithAttenuation) {
+                const Frequency frequency = transmitter.get_antenna_parameters().get_frequency();
+                zenithAttenuation         = atmosphere.get_zenith_attenuation(frequency).numerical_value_in(one);
+            }
+
+            const Vector3& ground     = transmitterIsLower ? transmitterPosition : receiverPosition;
+            const Vector3& upward     = transmitterIsLower ? lineOfSight : reverseLineOfSight;
+            const double sinElevation = std::max(
+                dot(ground, upward) / std::sqrt(lowerRadiusSquared * rangeSquared), atmosphere.get_minimum_sin_elevation()
+            );
+            cnr *= std::pow(10.0, -*zenithAttenuation / (10.0 * sinElevation));
+        }
+
+        budget.carrierToNoise[ii] = 10.0 * std::log10(cnr);
+    }
+
+    return budget;
+}
+
+LinkBudget find_link_budget(
+    const Antenna& transmitter,
+    const Antenna& receiver,
+    const TimeVector& times,
+    const Date& epoch,
+    const AstrodynamicsSystem& sys,
+    const AtmosphericLossTable& atmosphere
+)
+{
+    std::vector<RadiusVector<ECI>> transmitterPositions, receiverPositions;
+    std::vector<SensorFrame> transmitterFrames, receiverFrames;
+    transmitterPositions.reserve(times.size());
+    receiverPositions.reserve(times.size());
+    transmitterFrames.reserve(times.size());
+    receiverFrames.reserve(times.size());
+
+    for (const auto& time : times) {
+        const Date date = epoch + time;
+        transmitterPositions.push_back(transmitter.get_parent()->get_inertial_position(date));
+        transmitterFrames.emplace_back(transmitterPositions.back(), transmitter.get_parent()->get_inertial_velocity(date));
+        receiverPositions.push_back(receiver.get_parent()->get_inertial_position(date));
+        receiverFrames.emplace_back(receiverPositions.back(), receiver.get_parent()->get_inertial_velocity(date));
+    }
+
+    return find_link_budget(
+        transmitter, transmitterPositions, transmitterFrames, receiver, receiverPositions, receiverFrames, times, *sys.get("Earth"), atmosphere
+    );
+}
+
+RiseSetArray find_link_margin_intervals(const LinkBudget& budget, const Unitless& requiredCarrierToNoise, const Unitless& margin)
+{
+    const double threshold = (requiredCarrierToNoise + margin).numerical_value_in(one);
+
+    VisibilityBitset closes(budget.times.size());
+    for (std::size_t ii = 0; ii < budget.carrierToNoise.size(); ++ii) {
+        if (budget.carrierToNoise[ii] >= threshold) { closes.set(ii); }
+    }
+    return closes.to_risesets(budget.times);
+}
+
+} // namespace trace
+} // namespace astrea
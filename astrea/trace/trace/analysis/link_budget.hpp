@@ -0,0 +1,107 @@
+/**
+ * @file link_budget.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief Header file for link budget evaluation in the astrea access library.
+ * @version 0.1
+ * @date 2025-08-06
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include <astro/astro.fwd.hpp>
+#include <units/units.hpp>
+
+#include <astro/state/CartesianVector.hpp>
+
+#include <trace/analysis/access_analysis.hpp>
+#include <trace/platforms/sensors/AtmosphericLossTable.hpp>
+#include <trace/platforms/sensors/Sensor.hpp>
+#include <trace/risesets/RiseSetArray.hpp>
+#include <trace/trace.fwd.hpp>
+
+namespace astrea {
+namespace trace {
+
+/**
+ * @brief Struct to hold the carrier-to-noise ratio of a link at each time of a pass.
+ */
+struct LinkBudget {
+    TimeVector times;                   //!< Times since the epoch
+    std::vector<double> carrierToNoise; //!< Carrier-to-noise ratio at each time in dB, or -infinity if the link is blocked
+};
+
+/**
+ * @brief Find the carrier-to-noise ratio of a link at every time of a pass.
+ *
+ * Terms that do not change over the pass are evaluated once, and range, pointing, and atmospheric losses are then
+ * applied at each time. Both antenna patterns are applied, using the angle between each boresight and the line of
+ * sight. Endpoints below the occultation grazing altitude are treated as ground terminals, and the atmospheric loss is
+ * taken from the elevation of the line of sight at that end.
+ *
+ * @param transmitter The transmitting antenna.
+ * @param transmitterPositions The inertial position of the transmitter platform at each time.
+ * @param transmitterFrames The sensor frame of the transmitter platform at each time.
+ * @param receiver The receiving antenna.
+ * @param receiverPositions The inertial position of the receiver platform at each time.
+ * @param receiverFrames The sensor frame of the receiver platform at each time.
+ * @param times The times since the epoch.
+ * @param body The body that occults the link and holds the atmosphere.
+ * @param atmosphere The atmospheric loss table.
+ * @return LinkBudget The carrier-to-noise ratio at each time.
+ * @throws std::runtime_error If the number of samples does not match the number of times, or the receiver noise is not
+ * positive.
+ */
+LinkBudget find_link_budget(
+    const Antenna& transmitter,
+    std::span<const astro::CartesianVector<Distance, astro::EarthCenteredInertial>> transmitterPositions,
+    std::span<const SensorFrame> transmitterFrames,
+    const Antenna& receiver,
+    std::span<const astro::CartesianVector<Distance, astro::EarthCenteredInertial>> receiverPositions,
+    std::span<const SensorFrame> receiverFrames,
+    const TimeVector& times,
+    const astro::CelestialBody& body,
+    const AtmosphericLossTable& atmosphere = AtmosphericLossTable::standard()
+);
+
+/**
+ * @brief Find the carrier-to-noise ratio of a link at every time of a pass, sampling both antenna platforms.
+ *
+ * @param transmitter The transmitting antenna.
+ * @param receiver The receiving antenna.
+ * @param times The times since the epoch.
+ * @param epoch The epoch date for the analysis.
+ * @param sys The astrodynamics system used for calculations.
+ * @param atmosphere The atmospheric loss table.
+ * @return LinkBudget The carrier-to-noise ratio at each time.
+ * @throws std::runtime_error If the receiver noise is not positive.
+ */
+LinkBudget find_link_budget(
+    const Antenna& transmitter,
+    const Antenna& receiver,
+    const TimeVector& times,
+    const astro::Date& epoch,
+    const astro::AstrodynamicsSystem& sys,
+    const AtmosphericLossTable& atmosphere = AtmosphericLossTable::standard()
+);
+
+/**
+ * @brief Find the intervals where a link closes with a required margin.
+ *
+ * @param budget The link budget over a pass.
+ * @param requiredCarrierToNoise The carrier-to-noise ratio the link needs, in dB.
+ * @param margin The margin required above the needed carrier-to-noise ratio, in dB.
+ * @return RiseSetArray The intervals where the link closes with margin.
+ */
+RiseSetArray find_link_margin_intervals(
+    const LinkBudget& budget,
+    const Unitless& requiredCarrierToNoise,
+    const Unitless& margin = 0.0 * mp_units::one
+);
+
+} // namespace trace
+} // namespace astrea
@@ -0,0 +1,122 @@
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <astro/astro.hpp>
+
+#include <trace/trace.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace trace;
+
+using namespace mp_units;
+using mp_units::one;
+using mp_units::angular::unit_symbols::rad;
+using mp_units::si::unit_symbols::GHz;
+using mp_units::si::unit_symbols::K;
+using mp_units::si::unit_symbols::km;
+using mp_units::si::unit_symbols::m;
+using mp_units::si::unit_symbols::MHz;
+using mp_units::si::unit_symbols::s;
+using mp_units::si::unit_symbols::W;
+
+class LinkBudgetTest : public testing::Test {
+  public:
+    LinkBudgetTest() :
+        satelliteParams(&fov, 0.1 * m, 0.6 * one, 2.0 * GHz, 10.0 * W),
+        groundParams(&fov, 0.1 * m, 0.6 * one, 2.0 * GHz, 10.0 * W, RadiusVector<RIC>(1.0 * km, 0.0 * km, 0.0 * km)),
+        satellite(sc, satelliteParams),
+        ground(sc, with_noise(groundParams))
+    {
+    }
+
+    static AntennaParameters with_noise(AntennaParameters params)
+    {
+        params.set_noise_bandwidth(1.0 * MHz);
+        params.set_system_noise_temperature(absolute<K>(290.0));
+        return params;
+    }
+
+    static constexpr double EARTH_RADIUS = 6378.137;
+
+    // A satellite at 3 positions over a ground station on the equator: overhead, low in the sky, and behind the Earth
+    const std::vector<RadiusVector<ECI>> satellitePositions = { RadiusVector<ECI>(7000.0 * km, 0.0 * km, 0.0 * km),
+                                                                RadiusVector<ECI>(7000.0 * km, 1000.0 * km, 0.0 * km),
+                                                                RadiusVector<ECI>(-7000.0 * km, 0.0 * km, 0.0 * km) };
+    const std::vector<RadiusVector<ECI>> groundPositions    = { RadiusVector<ECI>(EARTH_RADIUS * km, 0.0 * km, 0.0 * km),
+                                                                RadiusVector<ECI>(EARTH_RADIUS * km, 0.0 * km, 0.0 * km),
+                                                                RadiusVector<ECI>(EARTH_RADIUS * km, 0.0 * km, 0.0 * km) };
+    const TimeVector times                                  = { 0.0 * s, 60.0 * s, 120.0 * s };
+
+    Viewer sc;
+    CircularFieldOfView fov;
+    AntennaParameters satelliteParams;
+    AntennaParameters groundParams;
+    Antenna satellite;
+    Antenna ground;
+    AstrodynamicsSystem sys;
+};
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST_F(LinkBudgetTest, MatchesScalarEvaluation)
+{
+    std::vector<SensorFrame> satelliteFrames, groundFrames;
+    for (std::size_t ii = 0; ii < times.size(); ++ii) {
+        satelliteFrames.emplace_back(satellitePositions[ii], VelocityVector<ECI>(0.0 * km / s, 7.5 * km / s, 0.0 * km / s));
+        groundFrames.emplace_back(groundPositions[ii], VelocityVector<ECI>(0.0 * km / s, 0.465 * km / s, 0.0 * km / s));
+    }
+
+    const LinkBudget budget =
+        find_link_budget(satellite, satellitePositions, satelliteFrames, ground, groundPositions, groundFrames, times, *sys.get("Earth"));
+    ASSERT_EQ(budget.times, times);
+    ASSERT_EQ(budget.carrierToNoise.size(), times.size());
+
+    // Overhead, both antennas on boresight
+    const double overheadRange = 7000.0 - EARTH_RADIUS;
+    const Gain zenithLoss      = ground.atmospheric_loss(90.0 * mp_units::angular::unit_symbols::deg);
+    const CNR overhead         = satellite.carrier_to_noise_ratio(ground, overheadRange * km, 0.0 * rad, zenithLoss);
+    ASSERT_NEAR(budget.carrierToNoise[0], 10.0 * std::log10(overhead.numerical_value_in(one)), 1.0e-9);
+
+    // Low in the sky, off boresight at both ends
+    const double dx             = 7000.0 - EARTH_RADIUS;
+    const double dy             = 1000.0;
+    const double slantRange     = std::hypot(dx, dy);
+    const double elevation      = std::atan2(dx, dy);
+    const double satelliteAngle = std::acos((7000.0 * dx + 1000.0 * dy) / (std::hypot(7000.0, 1000.0) * slantRange));
+    const double groundAngle    = std::numbers::pi / 2.0 - elevation;
+
+    const Gain slantLoss  = ground.atmospheric_loss(elevation * rad);
+    const CNR slant       = satellite.carrier_to_noise_ratio(ground, slantRange * km, satelliteAngle * rad, slantLoss);
+    const Gain groundLoss = ground.pattern_loss(groundAngle * rad);
+    ASSERT_NEAR(budget.carrierToNoise[1], 10.0 * std::log10((slant * groundLoss).numerical_value_in(one)), 1.0e-9);
+    ASSERT_LT(budget.carrierToNoise[1], budget.carrierToNoise[0]);
+
+    // Behind the Earth
+    ASSERT_EQ(budget.carrierToNoise[2], -std::numeric_limits<double>::infinity());
+
+    // Sizes must match
+    ASSERT_ANY_THROW(find_link_budget(
+        satellite, satellitePositions, satelliteFrames, ground, std::span(groundPositions).first(2), groundFrames, times, *sys.get("Earth")
+    ));
+}
+
+TEST_F(LinkBudgetTest, MarginIntervals)
+{
+    LinkBudget budget;
+    budget.times          = { 0.0 * s, 10.0 * s, 20.0 * s, 30.0 * s, 40.0 * s, 50.0 * s, 60.0 * s };
+    budget.carrierToNoise = { 2.0, 12.0, 15.0, 11.0, 8.0, 14.0, -std::numeric_limits<double>::infinity() };
+
+    ASSERT_EQ(find_link_margin_intervals(budget, 10.0 * one), RiseSetArray({ 10.0 * s, 30.0 * s }));
+    ASSERT_EQ(find_link_margin_intervals(budget, 10.0 * one, 1.5 * one), RiseSetArray({ 10.0 * s, 20.0 * s }));
+    ASSERT_EQ(find_link_margin_intervals(budget, 0.0 * one), RiseSetArray({ 0.0 * s, 50.0 * s }));
+    ASSERT_EQ(find_link_margin_intervals(budget, 20.0 * one), RiseSetArray());
+}
@@ -0,0 +1,129 @@
+#include <trace/analysis/occultation.hpp>
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+#include <astro/state/CartesianVector.hpp>
+#include <astro/state/frames/frames.hpp>
+#include <astro/systems/CelestialBody.hpp>
+
+namespace astrea {
+
+using astro::ECI;
+using astro::RadiusVector;
+
+namespace trace {
+
+using mp_units::si::unit_symbols::km;
+
+namespace {
+
+// Number of lines of sight converted and tested together
+constexpr std::size_t BLOCK_SIZE = 256;
+
+// Segment against sphere, after scaling z. The closest approach to the center is at t = -p1.d / d.d, so comparing
+// against the endpoints and the radius is done with both sides multiplied by d.d to avoid dividing.
+inline bool is_segment_occulted(
+    const double& x1,
+    const double& y1,
+    const double& z1,
+    const double& x2,
+    const double& y2,
+    const double& z2,
+    const double& radiusSquared
+)
+{
+    const double dx = x2 - x1;
+    const double dy = y2 - y1;
+    const double dz = z2 - z1;
+
+    const double dd = dx * dx + dy * dy + dz * dz;
+    const double pd = -(x1 * dx + y1 * dy + z1 * dz);
+    const double pp = x1 * x1 + y1 * y1 + z1 * z1;
+
+    // Non-short-circuiting so the test stays branch-free
+    return (pd > 0.0) & (pd < dd) & (pp * dd - pd * pd < radiusSquared * dd);
+}
+
+} // namespace
+
+
+EllipsoidOcculter::EllipsoidOcculter(const astro::CelestialBody& body, const Distance& grazingAltitude) :
+    EllipsoidOcculter(body.get_equitorial_radius(), body.get_polar_radius(), grazingAltitude)
+{
+}
+
+EllipsoidOcculter::EllipsoidOcculter(const Distance& equatorialRadius, const Distance& polarRadius, const Distance& grazingAltitude) :
+    _grazingAltitude(grazingAltitude)
+{
+    if (equatorialRadius <= 0.0 * km || polarRadius <= 0.0 * km) {
+        throw std::runtime_error("Occulting bodies must have positive equatorial and polar radii.");
+    }
+    if (polarRadius + grazingAltitude <= 0.0 * km) {
+        throw std::runtime_error("The grazing altitude must be above the center of the occulting body.");
+    }
+
+    const double radius = (equatorialRadius + grazingAltitude).numerical_value_in(astrea::detail::distance_unit);
+    _radiusSquared      = radius * radius;
+    _zScale             = radius / (polarRadius + grazingAltitude).numerical_value_in(astrea::detail::distance_unit);
+}
+
+EllipsoidOcculter EllipsoidOcculter::wgs84(const Distance& grazingAltitude)
+{
+    return EllipsoidOcculter(6378.137 * km, 6356.752314245 * km, grazingAltitude);
+}
+
+bool EllipsoidOcculter::is_occulting(const RadiusVector<ECI>& position1, const RadiusVector<ECI>& position2) const
+{
+    return is_segment_occulted(
+        position1.get_x().numerical_value_in(astrea::detail::distance_unit),
+        position1.get_y().numerical_value_in(astrea::detail::distance_unit),
+        position1.get_z().numerical_value_in(astrea::detail::distance_unit) * _zScale,
+        position2.get_x().numerical_value_in(astrea::detail::distance_unit),
+        position2.get_y().numerical_value_in(astrea::detail::distance_unit),
+        position2.get_z().numerical_value_in(astrea::detail::distance_unit) * _zScale,
+        _radiusSquared
+    );
+}
+
+std::vector<bool> EllipsoidOcculter::is_occulting(std::span<const RadiusVector<ECI>> positions1, std::span<const RadiusVector<ECI>> positions2) const
+{
+    if (positions1.size() != positions2.size()) {
+        throw std::runtime_error("Occultation requires the same number of positions for each end of the line of sight.");
+    }
+
+    std::array<double, BLOCK_SIZE> x1, y1, z1, x2, y2, z2;
+    std::array<bool, BLOCK_SIZE> blocked;
+
+    std::vector<bool> occulted(positions1.size());
+    for (std::size_t begin = 0; begin < positions1.size(); begin += BLOCK_SIZE) {
+        const std::size_t n = std::min(BLOCK_SIZE, positions1.size() - begin);
+
+        // Gather into contiguous coordinates, scaling z onto the sphere
+        for (std::size_t ii = 0; ii < n; ++ii) {
+            const RadiusVector<ECI>& position1 = positions1[begin + ii];
+            const RadiusVector<ECI>& position2 = positions2[begin + ii];
+
+            x1[ii] = position1.get_x().numerical_value_in(astrea::detail::distance_unit);
+            y1[ii] = position1.get_y().numerical_value_in(astrea::detail::distance_unit);
+            z1[ii] = position1.get_z().numerical_value_in(astrea::detail::distance_unit) * _zScale;
+            x2[ii] = position2.get_x().numerical_value_in(astrea::detail::distance_unit);
+            y2[ii] = position2.get_y().numerical_value_in(astrea::detail::distance_unit);
+            z2[ii] = position2.get_z().numerical_value_in(astrea::detail::distance_unit) * _zScale;
+        }
+
+        // Branch-free over contiguous arrays, so this loop vectorizes
+        for (std::size_t ii = 0; ii < n; ++ii) {
+            blocked[ii] = is_segment_occulted(x1[ii], y1[ii], z1[ii], x2[ii], y2[ii], z2[ii], _radiusSquared);
+        }
+
+        for (std::size_t ii = 0; ii < n; ++ii) {
+            occulted[begin + ii] = blocked[ii];
+        }
+    }
+    return occulted;
+}
+
+} // namespace trace
+} // namespace astrea
@@ -0,0 +1,116 @@
+/**
+ * @file occultation.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief Header file for ellipsoidal line-of-sight occultation in the astrea access library.
+ * @version 0.1
+ * @date 2025-08-06
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include <mp-units/systems/si.h>
+
+#include <units/units.hpp>
+
+#include <astro/astro.fwd.hpp>
+
+namespace astrea {
+namespace trace {
+
+/**
+ * @brief Default altitude above the surface that a line of sight must clear.
+ */
+inline constexpr Distance DEFAULT_GRAZING_ALTITUDE = 100.0 * mp_units::si::unit_symbols::km;
+
+/**
+ * @brief Class for testing whether an oblate body blocks the line of sight between two points.
+ *
+ * The body is an ellipsoid of revolution about the inertial z-axis, inflated by a grazing altitude. Scaling z by the
+ * ratio of the equatorial to polar radius turns the ellipsoid into a sphere, so each test is a closest-approach check
+ * of a line segment against a sphere. The check needs no square roots, trig, or divisions.
+ *
+ * A line of sight is only blocked if its closest approach to the center lies strictly between the endpoints. An
+ * endpoint below the grazing altitude, such as a ground station, can still see anything above its local horizon.
+ */
+class EllipsoidOcculter {
+  public:
+    /**
+     * @brief Constructs an EllipsoidOcculter from the radii of a body.
+     *
+     * @param body The occulting body.
+     * @param grazingAltitude The altitude above the surface that a line of sight must clear.
+     * @throws std::runtime_error If the radii are not positive, or the grazing altitude is below the center.
+     */
+    EllipsoidOcculter(const astro::CelestialBody& body, const Distance& grazingAltitude = DEFAULT_GRAZING_ALTITUDE);
+
+    /**
+     * @brief Constructs an EllipsoidOcculter from equatorial and polar radii.
+     *
+     * @param equatorialRadius The equatorial radius of the body.
+     * @param polarRadius The polar radius of the body.
+     * @param grazingAltitude The altitude above the surface that a line of sight must clear.
+     * @throws std::runtime_error If the radii are not positive, or the grazing altitude is below the center.
+     */
+    EllipsoidOcculter(const Distance& equatorialRadius, const Distance& polarRadius, const Distance& grazingAltitude = DEFAULT_GRAZING_ALTITUDE);
+
+    /**
+     * @brief Default destructor for EllipsoidOcculter.
+     */
+    ~EllipsoidOcculter() = default;
+
+    /**
+     * @brief Constructs an EllipsoidOcculter for the WGS-84 Earth ellipsoid.
+     *
+     * @param grazingAltitude The altitude above the surface that a line of sight must clear.
+     * @return EllipsoidOcculter The WGS-84 occulter.
+     */
+    static EllipsoidOcculter wgs84(const Distance& grazingAltitude = DEFAULT_GRAZING_ALTITUDE);
+
+    /**
+     * @brief Get the grazing altitude.
+     *
+     * @return const Distance& The altitude above the surface that a line of sight must clear.
+     */
+    const Distance& get_grazing_altitude() const { return _grazingAltitude; }
+
+    /**
+     * @brief Check if the body blocks the line of sight between two points.
+     *
+     * @param position1 The inertial position of the first point.
+     * @param position2 The inertial position of the second point.
+     * @return true If the line of sight is blocked.
+     * @return false If the line of sight is clear.
+     */
+    bool is_occulting(
+        const astro::CartesianVector<Distance, astro::EarthCenteredInertial>& position1,
+        const astro::CartesianVector<Distance, astro::EarthCenteredInertial>& position2
+    ) const;
+
+    /**
+     * @brief Check if the body blocks the line of sight between each pair of points.
+     *
+     * Positions are processed in fixed-size blocks of contiguous coordinates so the compiler can vectorize the test.
+     *
+     * @param positions1 The inertial positions of the first points.
+     * @param positions2 The inertial positions of the second points.
+     * @return std::vector<bool> Whether each line of sight is blocked.
+     * @throws std::runtime_error If the number of positions does not match.
+     */
+    std::vector<bool> is_occulting(
+        std::span<const astro::CartesianVector<Distance, astro::EarthCenteredInertial>> positions1,
+        std::span<const astro::CartesianVector<Distance, astro::EarthCenteredInertial>> positions2
+    ) const;
+
+  private:
+    Distance _grazingAltitude; //!< Altitude above the surface that a line of sight must clear
+    double _radiusSquared;     //!< Squared inflated equatorial radius, in distance units
+    double _zScale;            //!< Scale on z that turns the inflated ellipsoid into a sphere
+};
+
+} // namespace trace
+} // namespace astrea
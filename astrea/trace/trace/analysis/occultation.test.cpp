@@ -0,0 +1,143 @@
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <astro/astro.hpp>
+
+#include <trace/trace.hpp>
+
+using namespace astrea;
+using namespace astro;
+using namespace trace;
+
+using namespace mp_units;
+using mp_units::si::unit_symbols::km;
+
+class OccultationTest : public testing::Test {
+  public:
+    OccultationTest() = default;
+
+    static constexpr double EQUATORIAL_RADIUS = 6378.137;
+    static constexpr double POLAR_RADIUS      = 6356.752314245;
+
+    // Ellipsoid and a sphere through its equator, both 100 km up
+    const EllipsoidOcculter ellipsoid = EllipsoidOcculter::wgs84(100.0 * km);
+    const EllipsoidOcculter sphere    = EllipsoidOcculter(EQUATORIAL_RADIUS * km, EQUATORIAL_RADIUS * km, 100.0 * km);
+};
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST_F(OccultationTest, Constructor)
+{
+    AstrodynamicsSystem sys;
+    ASSERT_NO_THROW(EllipsoidOcculter(*sys.get("Earth")));
+    ASSERT_EQ(EllipsoidOcculter(*sys.get("Earth")).get_grazing_altitude(), DEFAULT_GRAZING_ALTITUDE);
+    ASSERT_EQ(ellipsoid.get_grazing_altitude(), 100.0 * km);
+
+    ASSERT_ANY_THROW(EllipsoidOcculter(0.0 * km, POLAR_RADIUS * km));
+    ASSERT_ANY_THROW(EllipsoidOcculter(EQUATORIAL_RADIUS * km, -1.0 * km));
+    ASSERT_ANY_THROW(EllipsoidOcculter(EQUATORIAL_RADIUS * km, POLAR_RADIUS * km, -POLAR_RADIUS * km));
+}
+
+TEST_F(OccultationTest, ClearAndBlocked)
+{
+    const RadiusVector<ECI> leo(7000.0 * km, 0.0 * km, 0.0 * km);
+    const RadiusVector<ECI> geo(42164.0 * km, 0.0 * km, 0.0 * km);
+    const RadiusVector<ECI> farSide(-42164.0 * km, 0.0 * km, 0.0 * km);
+
+    ASSERT_FALSE(ellipsoid.is_occulting(leo, geo));
+    ASSERT_TRUE(ellipsoid.is_occulting(leo, farSide));
+    ASSERT_TRUE(ellipsoid.is_occulting(farSide, leo)); // Blocking is symmetric
+    ASSERT_FALSE(ellipsoid.is_occulting(leo, leo));    // No line of sight to block
+}
+
+TEST_F(OccultationTest, PolarGrazing)
+{
+    // A chord over the pole 110 km above the polar surface, but below the equatorial radius plus 100 km
+    const double height = POLAR_RADIUS + 110.0;
+    const RadiusVector<ECI> start(-5000.0 * km, 0.0 * km, height * km);
+    const RadiusVector<ECI> end(5000.0 * km, 0.0 * km, height * km);
+    ASSERT_FALSE(ellipsoid.is_occulting(start, end));
+    ASSERT_TRUE(sphere.is_occulting(start, end));
+
+    // Both block a chord through the grazing layer over the equator
+    const double width = EQUATORIAL_RADIUS + 90.0;
+    const RadiusVector<ECI> equatorStart(width * km, -5000.0 * km, 0.0 * km);
+    const RadiusVector<ECI> equatorEnd(width * km, 5000.0 * km, 0.0 * km);
+    ASSERT_TRUE(ellipsoid.is_occulting(equatorStart, equatorEnd));
+    ASSERT_TRUE(sphere.is_occulting(equatorStart, equatorEnd));
+}
+
+TEST_F(OccultationTest, GrazingAltitude)
+{
+    // A chord 50 km above the equator only clears a grazing altitude below 50 km
+    const double width = EQUATORIAL_RADIUS + 50.0;
+    const RadiusVector<ECI> start(width * km, -3000.0 * km, 0.0 * km);
+    const RadiusVector<ECI> end(width * km, 3000.0 * km, 0.0 * km);
+    ASSERT_TRUE(ellipsoid.is_occulting(start, end));
+    ASSERT_FALSE(EllipsoidOcculter::wgs84(0.0 * km).is_occulting(start, end));
+}
+
+TEST_F(OccultationTest, GroundStations)
+{
+    // A station on the polar surface is inside the grazing sphere, but still sees above its horizon
+    const RadiusVector<ECI> pole(0.0 * km, 0.0 * km, POLAR_RADIUS * km);
+    const RadiusVector<ECI> overhead(0.0 * km, 0.0 * km, 7000.0 * km);
+    const RadiusVector<ECI> aboveHorizon(3000.0 * km, 0.0 * km, (POLAR_RADIUS + 200.0) * km);
+    const RadiusVector<ECI> belowHorizon(3000.0 * km, 0.0 * km, (POLAR_RADIUS - 800.0) * km);
+    ASSERT_FALSE(ellipsoid.is_occulting(pole, overhead));
+    ASSERT_FALSE(ellipsoid.is_occulting(pole, aboveHorizon));
+    ASSERT_TRUE(ellipsoid.is_occulting(pole, belowHorizon));
+
+    // With no grazing altitude a chord 15 km above the pole clears the ellipsoid, but not a sphere through the equator
+    const RadiusVector<ECI> start(-3000.0 * km, 0.0 * km, (POLAR_RADIUS + 15.0) * km);
+    const RadiusVector<ECI> end(3000.0 * km, 0.0 * km, (POLAR_RADIUS + 15.0) * km);
+    ASSERT_FALSE(EllipsoidOcculter::wgs84(0.0 * km).is_occulting(start, end));
+    ASSERT_TRUE(EllipsoidOcculter(EQUATORIAL_RADIUS * km, EQUATORIAL_RADIUS * km, 0.0 * km).is_occulting(start, end));
+}
+
+TEST_F(OccultationTest, Batched)
+{
+    // Enough samples to span several blocks with a partial last block
+    std::mt19937 generator(42);
+    std::normal_distribution<double> component(0.0, 1.0);
+    std::uniform_real_distribution<double> radius(6000.0, 45000.0);
+
+    std::vector<RadiusVector<ECI>> positions1;
+    std::vector<RadiusVector<ECI>> positions2;
+    for (std::size_t ii = 0; ii < 1000; ++ii) {
+        for (auto* positions : { &positions1, &positions2 }) {
+            const double x     = component(generator);
+            const double y     = component(generator);
+            const double z     = component(generator);
+            const double scale = radius(generator) / std::sqrt(x * x + y * y + z * z);
+            positions->emplace_back(x * scale * km, y * scale * km, z * scale * km);
+        }
+    }
+
+    const std::vector<bool> occulted = ellipsoid.is_occulting(positions1, positions2);
+    ASSERT_EQ(occulted.size(), positions1.size());
+    for (std::size_t ii = 0; ii < positions1.size(); ++ii) {
+        ASSERT_EQ(occulted[ii], ellipsoid.is_occulting(positions1[ii], positions2[ii]));
+    }
+
+    ASSERT_TRUE(ellipsoid.is_occulting(std::span<const RadiusVector<ECI>>(), std::span<const RadiusVector<ECI>>()).empty());
+    positions2.pop_back();
+    ASSERT_ANY_THROW(ellipsoid.is_occulting(positions1, positions2));
+}
+
+TEST_F(OccultationTest, IsEarthOcculting)
+{
+    AstrodynamicsSystem sys;
+    const RadiusVector<ECI> leo(7000.0 * km, 0.0 * km, 0.0 * km);
+    const RadiusVector<ECI> farSide(-7000.0 * km, 0.0 * km, 0.0 * km);
+    const RadiusVector<ECI> geo(42164.0 * km, 0.0 * km, 0.0 * km);
+    ASSERT_TRUE(is_earth_occulting(leo, farSide, sys));
+    ASSERT_FALSE(is_earth_occulting(leo, geo, sys));
+}
@@ -8,7 +8,6 @@
 
 #include <sqlite3.h>
 
-#include <csv-parser/csv.hpp>
 #include <nlohmann/json.hpp>
 #include <sqlite_orm/sqlite_orm.h>
 
@@ -68,19 +67,11 @@ int access_test()
     SensorParameters geoCone(&fovGeo);
     SensorParameters leoCone(&fovLeo);
 
-    // for (auto& viewer : allSats | std::views::join) { // TODO: Figure out how this works
-    //     viewer.attach_payload(simpleCone);
-    // }
-
     geo.attach_payload(geoCone);
-    for (auto& shell : allSats.get_shells()) {
-        for (auto& plane : shell.get_planes()) {
-            for (auto& sat : plane.get_all_spacecraft()) {
-                // const State& state = sat.get_state();
-                // sat.update_state(State(state.get_elements(), epoch, sys)); // Force inital epoch to match cause it's SLOW right now
-                sat.attach_payload(leoCone);
-            }
-        }
+    for (auto& sat : allSats) {
+        // const State& state = sat.get_state();
+        // sat.update_state(State(state.get_elements(), epoch, sys)); // Force inital epoch to match cause it's SLOW right now
+        sat.attach_payload(leoCone);
     }
     allSats.add_spacecraft(geo);
 
@@ -119,53 +110,30 @@ int access_test()
 
     std::cout << std::endl << std::endl << "Propagation Time: " << diff.count() / 1e9 << " (s)" << std::endl;
 
+    // Stream accesses to file as each pair finishes
+    const std::string root        = std::getenv("ASTREA_ROOT");
+    std::filesystem::path base    = root + "/astrea/trace/";
+    std::filesystem::path outfile = base / "trace/drivers/results/revisit.csv";
+    std::filesystem::create_directories(outfile.parent_path());
+
+    PlatformNameIndex names;
+    names.add_all(allSats);
+    names.add_all(grounds);
+    CsvAccessSink sink(outfile, names);
+
     start = std::chrono::steady_clock::now();
 
     // Find access
     Time accessResolution = minutes(1.0);
-    // const auto accesses   = find_accesses(allSats, accessResolution, epoch, sys);
-    const auto accesses = find_accesses(allSats, grounds, accessResolution, epoch, sys);
+    // find_internal_accesses(allSats, accessResolution, epoch, sys, sink);
+    find_accesses(allSats, grounds, accessResolution, epoch, sys, sink);
+    sink.close();
 
     end  = std::chrono::steady_clock::now();
     diff = std::chrono::duration_cast<nanoseconds>(end - start);
 
     std::cout << std::endl << std::endl << "Access Analysis Time: " << diff.count() / 1.0e9 << " (s)" << std::endl;
 
-    // Save
-    const std::string root        = std::getenv("ASTREA_ROOT");
-    std::filesystem::path base    = root + "/astrea/trace/";
-    std::filesystem::path outfile = base / "trace/drivers/results/revisit.csv";
-    std::filesystem::create_directories(outfile.parent_path());
-    std::ofstream ss(outfile);
-    auto writer = csv::make_csv_writer(ss);
-
-    writer << std::vector<std::string>({ "Sender", "Receiver", "Rise - Set Times (s)" });
-    for (const auto& [idPair, risesets] : accesses) {
-        if (risesets.size() > 0) {
-
-            // Gross
-            std::string sender, receiver;
-            for (const auto& shell : allSats.get_shells()) {
-                for (const auto& plane : shell.get_planes()) {
-                    for (const auto& viewer : plane.get_all_spacecraft()) {
-                        if (viewer.get_id() == idPair.sender) { sender = viewer.get_name(); }
-                        if (viewer.get_id() == idPair.receiver) { receiver = viewer.get_name(); }
-                    }
-                }
-            }
-            for (const auto& ground : grounds) {
-                if (ground.get_id() == idPair.sender) { sender = ground.get_name(); }
-                if (ground.get_id() == idPair.receiver) { receiver = ground.get_name(); }
-            }
-
-            std::vector<std::string> row{ sender, receiver };
-            for (const auto& str : risesets.to_string_vector()) {
-                row.push_back(str);
-            }
-            writer << row;
-        }
-    }
-
     // Call plotter
     std::filesystem::path plotFile = base / "pytrace/plots.py";
     const std::string cmd          = "python3 " + plotFile.string();
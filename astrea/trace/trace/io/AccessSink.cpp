@@ -0,0 +1,322 @@
+#include <trace/io/AccessSink.hpp>
+
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+
+#include <mp-units/systems/si.h>
+
+namespace astrea {
+namespace trace {
+
+using mp_units::si::unit_symbols::s;
+
+namespace {
+
+// File tags, so readers can reject files written by something else
+constexpr std::array<char, 8> BINARY_TAG   = { 'A', 'S', 'T', 'R', 'A', 'C', 'B', '1' };
+constexpr std::array<char, 8> COLUMNAR_TAG = { 'A', 'S', 'T', 'R', 'A', 'C', 'C', '1' };
+
+std::ofstream open_output(const std::filesystem::path& file)
+{
+    std::ofstream stream(file, std::ios::binary | std::ios::trunc);
+    if (!stream) { throw std::runtime_error("Unable to open " + file.string() + " for writing."); }
+    return stream;
+}
+
+std::ifstream open_input(const std::filesystem::path& file, const std::array<char, 8>& tag)
+{
+    std::ifstream stream(file, std::ios::binary);
+    if (!stream) { throw std::runtime_error("Unable to open " + file.string() + " for reading."); }
+
+    std::array<char, 8> fileTag;
+    stream.read(fileTag.data(), fileTag.size());
+    if (!stream || fileTag != tag) { throw std::runtime_error(file.string() + " is not an access file of the expected format."); }
+    return stream;
+}
+
+void write_bytes(std::ofstream& stream, const char* data, const std::size_t& size)
+{
+    stream.write(data, static_cast<std::streamsize>(size));
+    if (!stream) { throw std::runtime_error("Failed to write accesses."); }
+}
+
+template <class T>
+void append_value(std::vector<char>& buffer, const T& value)
+{
+    const std::size_t offset = buffer.size();
+    buffer.resize(offset + sizeof(T));
+    std::memcpy(buffer.data() + offset, &value, sizeof(T));
+}
+
+template <class T>
+void write_column(std::ofstream& stream, const std::vector<T>& column)
+{
+    write_bytes(stream, reinterpret_cast<const char*>(column.data()), column.size() * sizeof(T));
+}
+
+template <class T>
+T read_value(std::ifstream& stream)
+{
+    T value;
+    stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+    if (!stream) { throw std::runtime_error("Unexpected end of access file."); }
+    return value;
+}
+
+template <class T>
+std::vector<T> read_column(std::ifstream& stream, const std::size_t& size)
+{
+    std::vector<T> column(size);
+    stream.read(reinterpret_cast<char*>(column.data()), static_cast<std::streamsize>(size * sizeof(T)));
+    if (!stream) { throw std::runtime_error("Unexpected end of access file."); }
+    return column;
+}
+
+// Quote fields the same way the csv-parser writer does
+void append_csv_field(std::string& buffer, const std::string& field)
+{
+    if (field.find_first_of(",\"\r\n") == std::string::npos) {
+        buffer += field;
+        return;
+    }
+    buffer += '"';
+    for (const char c : field) {
+        if (c == '"') { buffer += '"'; }
+        buffer += c;
+    }
+    buffer += '"';
+}
+
+// Same format as RiseSetArray::to_string_vector, without a stream per value
+void append_csv_time(std::string& buffer, const Time& time)
+{
+    std::array<char, 32> chars;
+    const auto [end, error] =
+        std::to_chars(chars.data(), chars.data() + chars.size(), time.force_numerical_value_in(s), std::chars_format::fixed, 1);
+    if (error != std::errc()) { throw std::runtime_error("Failed to format access time."); }
+    buffer.append(chars.data(), end);
+}
+
+} // namespace
+
+
+void AccessSink::write(const std::size_t& senderId, const std::size_t& receiverId, const RiseSetArray& risesets)
+{
+    if (_isClosed) { throw std::runtime_error("Cannot write accesses to a closed sink."); }
+    if (risesets.size() == 0) { return; }
+
+    write_pair(senderId, receiverId, risesets);
+    ++_nPairs;
+    _nIntervals += risesets.size() / 2;
+}
+
+void AccessSink::write(const AccessArray& accesses)
+{
+    for (const auto& [idPair, risesets] : accesses) {
+        write(idPair.sender, idPair.receiver, risesets);
+    }
+}
+
+void AccessSink::close()
+{
+    if (_isClosed) { return; }
+    _isClosed = true;
+    finish();
+}
+
+void AccessSink::close_quietly() noexcept
+{
+    try {
+        close();
+    }
+    catch (...) {
+        // Destructors cannot report errors, so callers that care should close explicitly
+    }
+}
+
+
+CsvAccessSink::CsvAccessSink(const std::filesystem::path& file, const PlatformNameIndex& names, const std::size_t& bufferSize) :
+    _stream(open_output(file)),
+    _names(names),
+    _bufferSize(bufferSize)
+{
+    _buffer.reserve(_bufferSize);
+    _buffer += "Sender,Receiver,Rise - Set Times (s)\n";
+}
+
+void CsvAccessSink::write_pair(const std::size_t& senderId, const std::size_t& receiverId, const RiseSetArray& risesets)
+{
+    append_csv_field(_buffer, _names.get_name(senderId));
+    _buffer += ',';
+    append_csv_field(_buffer, _names.get_name(receiverId));
+    for (const Time& time : risesets) {
+        _buffer += ',';
+        append_csv_time(_buffer, time);
+    }
+    _buffer += '\n';
+
+    if (_buffer.size() >= _bufferSize) {
+        write_bytes(_stream, _buffer.data(), _buffer.size());
+        _buffer.clear();
+    }
+}
+
+void CsvAccessSink::finish()
+{
+    write_bytes(_stream, _buffer.data(), _buffer.size());
+    _buffer.clear();
+    _stream.close();
+}
+
+
+BinaryAccessSink::BinaryAccessSink(const std::filesystem::path& file, const std::size_t& bufferSize) :
+    _stream(open_output(file)),
+    _bufferSize(bufferSize)
+{
+    _buffer.reserve(_bufferSize);
+    _buffer.insert(_buffer.end(), BINARY_TAG.begin(), BINARY_TAG.end());
+}
+
+void BinaryAccessSink::write_pair(const std::size_t& senderId, const std::size_t& receiverId, const RiseSetArray& risesets)
+{
+    append_value<std::uint64_t>(_buffer, senderId);
+    append_value<std::uint64_t>(_buffer, receiverId);
+    append_value<std::uint64_t>(_buffer, risesets.size());
+    for (const Time& time : risesets) {
+        append_value<double>(_buffer, time.force_numerical_value_in(s));
+    }
+
+    if (_buffer.size() >= _bufferSize) {
+        write_bytes(_stream, _buffer.data(), _buffer.size());
+        _buffer.clear();
+    }
+}
+
+void BinaryAccessSink::finish()
+{
+    write_bytes(_stream, _buffer.data(), _buffer.size());
+    _buffer.clear();
+    _stream.close();
+}
+
+AccessArray BinaryAccessSink::read(const std::filesystem::path& file)
+{
+    std::ifstream stream = open_input(file, BINARY_TAG);
+
+    AccessArray accesses;
+    while (stream.peek() != std::ifstream::traits_type::eof()) {
+        const std::uint64_t senderId   = read_value<std::uint64_t>(stream);
+        const std::uint64_t receiverId = read_value<std::uint64_t>(stream);
+        const std::uint64_t nTimes     = read_value<std::uint64_t>(stream);
+
+        std::vector<Time> times;
+        times.reserve(nTimes);
+        for (const double& time : read_column<double>(stream, nTimes)) {
+            times.push_back(time * s);
+        }
+        accesses[senderId, receiverId] = RiseSetArray(std::move(times));
+    }
+    return accesses;
+}
+
+
+ColumnarAccessSink::ColumnarAccessSink(const std::filesystem::path& file, const std::size_t& rowGroupSize) :
+    _rowGroupSize(rowGroupSize)
+{
+    if (_rowGroupSize == 0) { throw std::runtime_error("Row groups must hold at least one interval."); }
+
+    _stream = open_output(file);
+    write_bytes(_stream, COLUMNAR_TAG.data(), COLUMNAR_TAG.size());
+
+    _senders.reserve(_rowGroupSize);
+    _receivers.reserve(_rowGroupSize);
+    _rises.reserve(_rowGroupSize);
+    _sets.reserve(_rowGroupSize);
+}
+
+void ColumnarAccessSink::write_pair(const std::size_t& senderId, const std::size_t& receiverId, const RiseSetArray& risesets)
+{
+    for (std::size_t ii = 0; ii < risesets.size(); ii += 2) {
+        _senders.push_back(senderId);
+        _receivers.push_back(receiverId);
+        _rises.push_back(risesets[ii].force_numerical_value_in(s));
+        _sets.push_back(risesets[ii + 1].force_numerical_value_in(s));
+
+        if (_senders.size() == _rowGroupSize) { write_row_group(); }
+    }
+}
+
+void ColumnarAccessSink::write_row_group()
+{
+    if (_senders.empty()) { return; }
+
+    _rowGroups.push_back(static_cast<std::uint64_t>(_stream.tellp()));
+
+    const std::uint64_t nRows = _senders.size();
+    write_bytes(_stream, reinterpret_cast<const char*>(&nRows), sizeof(nRows));
+    write_column(_stream, _senders);
+    write_column(_stream, _receivers);
+    write_column(_stream, _rises);
+    write_column(_stream, _sets);
+
+    _senders.clear();
+    _receivers.clear();
+    _rises.clear();
+    _sets.clear();
+}
+
+void ColumnarAccessSink::finish()
+{
+    write_row_group();
+
+    // Footer: group offsets, then the group count and tag so readers can find it from the end of the file
+    const std::uint64_t nGroups = _rowGroups.size();
+    write_column(_stream, _rowGroups);
+    write_bytes(_stream, reinterpret_cast<const char*>(&nGroups), sizeof(nGroups));
+    write_bytes(_stream, COLUMNAR_TAG.data(), COLUMNAR_TAG.size());
+    _stream.close();
+}
+
+AccessArray ColumnarAccessSink::read(const std::filesystem::path& file)
+{
+    std::ifstream stream = open_input(file, COLUMNAR_TAG);
+
+    // Read the footer from the end of the file
+    const std::streamoff trailerSize = sizeof(std::uint64_t) + COLUMNAR_TAG.size();
+    stream.seekg(0, std::ios::end);
+    const std::streamoff fileSize = stream.tellg();
+    if (fileSize < static_cast<std::streamoff>(COLUMNAR_TAG.size()) + trailerSize) {
+        throw std::runtime_error(file.string() + " is missing its footer.");
+    }
+    stream.seekg(fileSize - trailerSize);
+    const std::uint64_t nGroups = read_value<std::uint64_t>(stream);
+    if (read_value<std::array<char, 8>>(stream) != COLUMNAR_TAG) { throw std::runtime_error(file.string() + " is missing its footer."); }
+
+    const std::streamoff footerSize = static_cast<std::streamoff>(nGroups * sizeof(std::uint64_t));
+    if (fileSize - trailerSize - footerSize < static_cast<std::streamoff>(COLUMNAR_TAG.size())) {
+        throw std::runtime_error(file.string() + " has a corrupt footer.");
+    }
+    stream.seekg(fileSize - trailerSize - footerSize);
+    const std::vector<std::uint64_t> rowGroups = read_column<std::uint64_t>(stream, nGroups);
+
+    // Rows of a pair are contiguous, since every pair is written at once
+    AccessArray accesses;
+    for (const std::uint64_t& offset : rowGroups) {
+        stream.seekg(static_cast<std::streamoff>(offset));
+        const std::uint64_t nRows                  = read_value<std::uint64_t>(stream);
+        const std::vector<std::uint64_t> senders   = read_column<std::uint64_t>(stream, nRows);
+        const std::vector<std::uint64_t> receivers = read_column<std::uint64_t>(stream, nRows);
+        const std::vector<double> rises            = read_column<double>(stream, nRows);
+        const std::vector<double> sets             = read_column<double>(stream, nRows);
+
+        for (std::size_t ii = 0; ii < nRows; ++ii) {
+            accesses[senders[ii], receivers[ii]].append(rises[ii] * s, sets[ii] * s);
+        }
+    }
+    return accesses;
+}
+
+} // namespace trace
+} // namespace astrea
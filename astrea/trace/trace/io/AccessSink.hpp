@@ -0,0 +1,245 @@
+/**
+ * @file AccessSink.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief Streaming writers for access results.
+ * @version 0.1
+ * @date 2025-08-06
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <trace/io/PlatformNameIndex.hpp>
+#include <trace/risesets/AccessArray.hpp>
+#include <trace/risesets/RiseSetArray.hpp>
+
+namespace astrea {
+namespace trace {
+
+/**
+ * @brief Base class for streaming access writers.
+ *
+ * Access analyses hand each pair to a sink as soon as it is finished, so results never need to be held in memory all
+ * at once. Each sink holds at most a fixed-size buffer before writing it out, plus any per-file index it writes when
+ * it is closed.
+ */
+class AccessSink {
+  public:
+    /**
+     * @brief Default constructor for AccessSink.
+     */
+    AccessSink() = default;
+
+    /**
+     * @brief Virtual destructor for AccessSink.
+     */
+    virtual ~AccessSink() = default;
+
+    /**
+     * @brief Write the accesses of a single pair.
+     *
+     * @param senderId The ID of the sender.
+     * @param receiverId The ID of the receiver.
+     * @param risesets The accesses between the pair.
+     * @throws std::runtime_error If the sink is closed or the write fails.
+     */
+    void write(const std::size_t& senderId, const std::size_t& receiverId, const RiseSetArray& risesets);
+
+    /**
+     * @brief Write every pair of an AccessArray.
+     *
+     * @param accesses The accesses to write.
+     * @throws std::runtime_error If the sink is closed or the write fails.
+     */
+    void write(const AccessArray& accesses);
+
+    /**
+     * @brief Write out any buffered data and finish the output. Further writes throw.
+     *
+     * @throws std::runtime_error If the write fails.
+     */
+    void close();
+
+    /**
+     * @brief Check if the sink has been closed.
+     *
+     * @return true If the sink is closed.
+     * @return false Otherwise.
+     */
+    bool is_closed() const { return _isClosed; }
+
+    /**
+     * @brief Get the number of pairs written.
+     *
+     * @return std::size_t The number of pairs written.
+     */
+    std::size_t get_pair_count() const { return _nPairs; }
+
+    /**
+     * @brief Get the number of rise/set intervals written.
+     *
+     * @return std::size_t The number of intervals written.
+     */
+    std::size_t get_interval_count() const { return _nIntervals; }
+
+  protected:
+    /**
+     * @brief Write the accesses of a single, non-empty pair.
+     *
+     * @param senderId The ID of the sender.
+     * @param receiverId The ID of the receiver.
+     * @param risesets The accesses between the pair.
+     */
+    virtual void write_pair(const std::size_t& senderId, const std::size_t& receiverId, const RiseSetArray& risesets) = 0;
+
+    /**
+     * @brief Write out any buffered data and any trailing metadata.
+     */
+    virtual void finish() = 0;
+
+    /**
+     * @brief Close the sink from a derived destructor, ignoring any errors.
+     */
+    void close_quietly() noexcept;
+
+  private:
+    bool _isClosed          = false; //!< Whether the sink has been closed
+    std::size_t _nPairs     = 0;     //!< Number of pairs written
+    std::size_t _nIntervals = 0;     //!< Number of rise/set intervals written
+};
+
+/**
+ * @brief Streams accesses to CSV, one row per pair of platform names followed by their rise/set times in seconds.
+ *
+ * This matches the format read by the pytrace plotting scripts.
+ */
+class CsvAccessSink : public AccessSink {
+  public:
+    /**
+     * @brief Constructs a CsvAccessSink and writes the header row.
+     *
+     * @param file The file to write.
+     * @param names The names of every platform that will be written.
+     * @param bufferSize The number of bytes to buffer before writing.
+     * @throws std::runtime_error If the file cannot be opened.
+     */
+    CsvAccessSink(const std::filesystem::path& file, const PlatformNameIndex& names, const std::size_t& bufferSize = 1 << 20);
+
+    /**
+     * @brief Destructor for CsvAccessSink. Closes the sink if it is still open.
+     */
+    ~CsvAccessSink() { close_quietly(); }
+
+  protected:
+    void write_pair(const std::size_t& senderId, const std::size_t& receiverId, const RiseSetArray& risesets) override;
+    void finish() override;
+
+  private:
+    std::ofstream _stream;           //!< Output file
+    const PlatformNameIndex& _names; //!< Platform names by ID
+    std::size_t _bufferSize;         //!< Number of bytes to buffer before writing
+    std::string _buffer;             //!< Formatted rows not yet written
+};
+
+/**
+ * @brief Streams accesses to a compact binary file, one record per pair.
+ *
+ * The file starts with an 8-byte tag. Each record then holds the sender ID, the receiver ID, and the number of
+ * times as 64-bit unsigned integers, followed by the rise/set times in seconds as doubles. Values use the host byte
+ * order.
+ */
+class BinaryAccessSink : public AccessSink {
+  public:
+    /**
+     * @brief Constructs a BinaryAccessSink and writes the file tag.
+     *
+     * @param file The file to write.
+     * @param bufferSize The number of bytes to buffer before writing.
+     * @throws std::runtime_error If the file cannot be opened.
+     */
+    BinaryAccessSink(const std::filesystem::path& file, const std::size_t& bufferSize = 1 << 20);
+
+    /**
+     * @brief Destructor for BinaryAccessSink. Closes the sink if it is still open.
+     */
+    ~BinaryAccessSink() { close_quietly(); }
+
+    /**
+     * @brief Read every pair from a file written by a BinaryAccessSink.
+     *
+     * @param file The file to read.
+     * @return AccessArray The accesses in the file.
+     * @throws std::runtime_error If the file cannot be read or is not an access file.
+     */
+    static AccessArray read(const std::filesystem::path& file);
+
+  protected:
+    void write_pair(const std::size_t& senderId, const std::size_t& receiverId, const RiseSetArray& risesets) override;
+    void finish() override;
+
+  private:
+    std::ofstream _stream;     //!< Output file
+    std::size_t _bufferSize;   //!< Number of bytes to buffer before writing
+    std::vector<char> _buffer; //!< Encoded records not yet written
+};
+
+/**
+ * @brief Streams accesses to a columnar binary file, one row per rise/set interval.
+ *
+ * Rows are buffered into row groups. Each group is written as its row count followed by contiguous sender, receiver,
+ * rise and set columns. A footer lists the offset of every group so readers can load groups independently. The
+ * offsets are kept until the sink is closed, which is one integer per row group. Values use the host byte order.
+ */
+class ColumnarAccessSink : public AccessSink {
+  public:
+    /**
+     * @brief Constructs a ColumnarAccessSink and writes the file tag.
+     *
+     * @param file The file to write.
+     * @param rowGroupSize The number of intervals in each row group.
+     * @throws std::runtime_error If the file cannot be opened or the row group size is zero.
+     */
+    ColumnarAccessSink(const std::filesystem::path& file, const std::size_t& rowGroupSize = 1 << 16);
+
+    /**
+     * @brief Destructor for ColumnarAccessSink. Closes the sink if it is still open.
+     */
+    ~ColumnarAccessSink() { close_quietly(); }
+
+    /**
+     * @brief Read every pair from a file written by a ColumnarAccessSink.
+     *
+     * @param file The file to read.
+     * @return AccessArray The accesses in the file.
+     * @throws std::runtime_error If the file cannot be read or is not an access file.
+     */
+    static AccessArray read(const std::filesystem::path& file);
+
+  protected:
+    void write_pair(const std::size_t& senderId, const std::size_t& receiverId, const RiseSetArray& risesets) override;
+    void finish() override;
+
+  private:
+    std::ofstream _stream;                 //!< Output file
+    std::size_t _rowGroupSize;             //!< Number of intervals in each row group
+    std::vector<std::uint64_t> _senders;   //!< Sender column of the current row group
+    std::vector<std::uint64_t> _receivers; //!< Receiver column of the current row group
+    std::vector<double> _rises;            //!< Rise column of the current row group, in seconds
+    std::vector<double> _sets;             //!< Set column of the current row group, in seconds
+    std::vector<std::uint64_t> _rowGroups; //!< File offset of every row group written so far
+
+    /**
+     * @brief Write the current row group and clear the columns.
+     */
+    void write_row_group();
+};
+
+} // namespace trace
+} // namespace astrea
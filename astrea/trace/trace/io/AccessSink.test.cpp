@@ -0,0 +1,150 @@
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <astro/astro.hpp>
+
+#include <trace/trace.hpp>
+
+using namespace astrea;
+using namespace trace;
+
+using mp_units::si::unit_symbols::s;
+
+class AccessSinkTest : public testing::Test {
+  public:
+    AccessSinkTest() = default;
+
+    void SetUp() override
+    {
+        directory = std::filesystem::temp_directory_path() / "astrea_access_sink_test";
+        std::filesystem::create_directories(directory);
+
+        // Enough intervals to span several buffers and row groups
+        for (std::size_t iSender = 0; iSender < 20; ++iSender) {
+            for (std::size_t iReceiver = 0; iReceiver < 3; ++iReceiver) {
+                RiseSetArray& risesets = accesses[iSender, 100 + iReceiver];
+                for (std::size_t ii = 0; ii < 7; ++ii) {
+                    const double rise = 100.0 * ii + iSender + 0.25 * iReceiver;
+                    risesets.append(rise * s, (rise + 30.5) * s);
+                }
+            }
+        }
+
+        names.add(1, "Sat, \"One\"");
+        names.add(2, "Washington DC");
+    }
+
+    void TearDown() override { std::filesystem::remove_all(directory); }
+
+    void expect_equal(const AccessArray& expected, const AccessArray& actual)
+    {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (const auto& [idPair, risesets] : expected) {
+            ASSERT_TRUE(actual.contains(idPair));
+            ASSERT_EQ(actual.at(idPair.sender, idPair.receiver), risesets);
+        }
+    }
+
+    std::string read_file(const std::filesystem::path& file)
+    {
+        std::ifstream stream(file);
+        std::stringstream contents;
+        contents << stream.rdbuf();
+        return contents.str();
+    }
+
+    std::filesystem::path directory;
+    AccessArray accesses;
+    PlatformNameIndex names;
+};
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST_F(AccessSinkTest, PlatformNameIndex)
+{
+    ASSERT_EQ(names.size(), 2);
+    ASSERT_TRUE(names.contains(1));
+    ASSERT_FALSE(names.contains(3));
+    ASSERT_EQ(names.get_name(2), "Washington DC");
+    ASSERT_ANY_THROW(names.get_name(3));
+}
+
+TEST_F(AccessSinkTest, Csv)
+{
+    const std::filesystem::path file = directory / "accesses.csv";
+    AccessArray pair;
+    pair[1, 2] = RiseSetArray({ 0.04 * s, 12.25 * s, 60.0 * s, 90.06 * s });
+    pair[2, 1]; // Empty pairs are skipped
+
+    CsvAccessSink sink(file, names);
+    sink.write(pair);
+    sink.close();
+
+    // Names with commas or quotes are quoted, and times have one decimal like RiseSetArray::to_string_vector
+    ASSERT_EQ(read_file(file), "Sender,Receiver,Rise - Set Times (s)\n\"Sat, \"\"One\"\"\",Washington DC,0.0,12.2,60.0,90.1\n");
+    ASSERT_EQ(sink.get_pair_count(), 1);
+    ASSERT_EQ(sink.get_interval_count(), 2);
+}
+
+TEST_F(AccessSinkTest, CsvMissingName)
+{
+    CsvAccessSink sink(directory / "accesses.csv", names);
+    ASSERT_ANY_THROW(sink.write(1, 3, RiseSetArray({ 0.0 * s, 1.0 * s })));
+}
+
+TEST_F(AccessSinkTest, Binary)
+{
+    const std::filesystem::path file = directory / "accesses.bin";
+    {
+        BinaryAccessSink sink(file, 256);
+        sink.write(accesses);
+        ASSERT_EQ(sink.get_pair_count(), accesses.size());
+        ASSERT_EQ(sink.get_interval_count(), accesses.size() * 7);
+    } // Closed on destruction
+
+    expect_equal(accesses, BinaryAccessSink::read(file));
+    ASSERT_ANY_THROW(ColumnarAccessSink::read(file));
+}
+
+TEST_F(AccessSinkTest, Columnar)
+{
+    const std::filesystem::path file = directory / "accesses.col";
+    {
+        ColumnarAccessSink sink(file, 16);
+        sink.write(accesses);
+    }
+    expect_equal(accesses, ColumnarAccessSink::read(file));
+    ASSERT_ANY_THROW(BinaryAccessSink::read(file));
+
+    // No intervals still makes a readable file
+    {
+        ColumnarAccessSink sink(file);
+    }
+    ASSERT_EQ(ColumnarAccessSink::read(file).size(), 0);
+
+    ASSERT_ANY_THROW(ColumnarAccessSink(file, 0));
+}
+
+TEST_F(AccessSinkTest, Closed)
+{
+    BinaryAccessSink sink(directory / "accesses.bin");
+    sink.close();
+    ASSERT_TRUE(sink.is_closed());
+    ASSERT_NO_THROW(sink.close());
+    ASSERT_ANY_THROW(sink.write(accesses));
+}
+
+TEST_F(AccessSinkTest, BadPath)
+{
+    const std::filesystem::path file = directory / "missing" / "accesses.bin";
+    ASSERT_ANY_THROW(BinaryAccessSink sink(file));
+    ASSERT_ANY_THROW(BinaryAccessSink::read(file));
+}
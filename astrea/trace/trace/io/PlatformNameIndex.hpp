@@ -0,0 +1,95 @@
+/**
+ * @file PlatformNameIndex.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief PlatformNameIndex class definition
+ * @version 0.1
+ * @date 2025-08-06
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+namespace astrea {
+namespace trace {
+
+/**
+ * @brief Index from platform IDs to platform names.
+ *
+ * Access results only carry IDs, so writers look names up here in constant time instead of searching the
+ * constellation and ground architecture for every pair.
+ */
+class PlatformNameIndex {
+  public:
+    /**
+     * @brief Default constructor for PlatformNameIndex.
+     */
+    PlatformNameIndex() = default;
+
+    /**
+     * @brief Default destructor for PlatformNameIndex.
+     */
+    ~PlatformNameIndex() = default;
+
+    /**
+     * @brief Add a name for an ID, replacing any existing name.
+     *
+     * @param id The platform ID.
+     * @param name The platform name.
+     */
+    void add(const std::size_t& id, const std::string& name) { _names[id] = name; }
+
+    /**
+     * @brief Add every platform in a range.
+     *
+     * @tparam Range_T Range of platforms with get_id() and get_name().
+     * @param platforms The platforms to add.
+     */
+    template <class Range_T>
+    void add_all(const Range_T& platforms)
+    {
+        for (const auto& platform : platforms) {
+            add(platform.get_id(), platform.get_name());
+        }
+    }
+
+    /**
+     * @brief Check if the index has a name for an ID.
+     *
+     * @param id The platform ID.
+     * @return true If the ID has a name.
+     * @return false Otherwise.
+     */
+    bool contains(const std::size_t& id) const { return _names.contains(id); }
+
+    /**
+     * @brief Get the name for an ID.
+     *
+     * @param id The platform ID.
+     * @return const std::string& The platform name.
+     * @throws std::runtime_error If the ID has no name.
+     */
+    const std::string& get_name(const std::size_t& id) const
+    {
+        const auto name = _names.find(id);
+        if (name == _names.end()) { throw std::runtime_error("No platform name found for ID " + std::to_string(id) + "."); }
+        return name->second;
+    }
+
+    /**
+     * @brief Returns the number of names in the index.
+     *
+     * @return std::size_t The number of names.
+     */
+    std::size_t size() const { return _names.size(); }
+
+  private:
+    std::unordered_map<std::size_t, std::string> _names; //!< Platform names by ID
+};
+
+} // namespace trace
+} // namespace astrea
@@ -35,6 +35,26 @@ class AccessObject {
      */
     virtual ~AccessObject() = default;
 
+    /**
+     * @brief Copy constructor for AccessObject.
+     */
+    AccessObject(const AccessObject&) = default;
+
+    /**
+     * @brief Move constructor for AccessObject.
+     */
+    AccessObject(AccessObject&&) = default;
+
+    /**
+     * @brief Copy assignment operator for AccessObject.
+     */
+    AccessObject& operator=(const AccessObject&) = default;
+
+    /**
+     * @brief Move assignment operator for AccessObject.
+     */
+    AccessObject& operator=(AccessObject&&) = default;
+
   public:
     /**
      * @brief Adds access times for a specific receiver.
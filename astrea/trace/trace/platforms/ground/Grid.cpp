@@ -1,12 +1,94 @@
 #include <trace/platforms/ground/Grid.hpp>
 
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <numbers>
+#include <numeric>
 #include <ranges>
+#include <stdexcept>
+#include <string>
 
 #include <mp-units/math.h>
 
 namespace astrea {
 namespace trace {
 
+using mp_units::angular::unit_symbols::deg;
+using mp_units::angular::unit_symbols::rad;
+
+Grid::Grid(const astro::CelestialBody* parent, const std::filesystem::path& rasterFile, const double& minValue) :
+    _parent(parent),
+    _gridType(GridType::RASTER)
+{
+    std::ifstream file(rasterFile);
+    if (!file) { throw std::runtime_error("Unable to open raster file " + rasterFile.string() + "."); }
+
+    // Read the header, which is a set of keys in any order before the first value
+    std::size_t nCols = 0;
+    std::size_t nRows = 0;
+    double xLowerLeft = 0.0;
+    double yLowerLeft = 0.0;
+    double cellSize   = 0.0;
+    double noData     = -9999.0;
+    bool isCentered   = false;
+    while ((file >> std::ws) && std::isalpha(file.peek())) {
+        std::string key;
+        double value;
+        if (!(file >> key >> value)) {
+            throw std::runtime_error("Malformed header in raster file " + rasterFile.string() + ".");
+        }
+        std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c) { return std::tolower(c); });
+
+        if (key == "ncols") { nCols = static_cast<std::size_t>(value); }
+        else if (key == "nrows") {
+            nRows = static_cast<std::size_t>(value);
+        }
+        else if (key == "xllcorner" || key == "xllcenter") {
+            xLowerLeft = value;
+            isCentered = (key == "xllcenter");
+        }
+        else if (key == "yllcorner" || key == "yllcenter") {
+            yLowerLeft = value;
+        }
+        else if (key == "cellsize") {
+            cellSize = value;
+        }
+        else if (key == "nodata_value") {
+            noData = value;
+        }
+        else {
+            throw std::runtime_error("Unrecognized key " + key + " in raster file " + rasterFile.string() + ".");
+        }
+    }
+    if (nCols == 0 || nRows == 0 || cellSize <= 0.0) {
+        throw std::runtime_error("Raster file " + rasterFile.string() + " must define ncols, nrows, and cellsize.");
+    }
+
+    // Cell centers, with the first row in the file at the top of the raster
+    const double offset = isCentered ? 0.0 : cellSize / 2.0;
+    std::vector<double> weights;
+    for (std::size_t iRow = 0; iRow < nRows; ++iRow) {
+        const double lat = yLowerLeft + offset + static_cast<double>(nRows - 1 - iRow) * cellSize;
+        for (std::size_t iCol = 0; iCol < nCols; ++iCol) {
+            double value;
+            if (!(file >> value)) {
+                throw std::runtime_error("Raster file " + rasterFile.string() + " has fewer values than ncols*nrows.");
+            }
+            if (value == noData || value <= minValue) { continue; }
+
+            const double lon = xLowerLeft + offset + static_cast<double>(iCol) * cellSize;
+            _groundStations.emplace_back(GroundPoint(_parent, lat * deg, lon * deg));
+            weights.push_back(value);
+        }
+    }
+    if (_groundStations.empty()) {
+        throw std::runtime_error("Raster file " + rasterFile.string() + " has no cells above the minimum value.");
+    }
+    _weights = normalize_weights(weights);
+}
+
 std::vector<GroundPoint>
     Grid::build_grid(const LatLon& corner1, const LatLon& corner4, const GridType& gridType, const Angle& spacing, const Unitless& weight) const
 {
@@ -15,6 +97,7 @@ std::vector<GroundPoint>
         case (GridType::EQUAL_AREA): return build_equal_area_grid(corner1, corner4, spacing); break;
         case (GridType::WEIGHTED_NS):
         case (GridType::WEIGHTED_EW): return build_weighted_grid(corner1, corner4, gridType, spacing, weight); break;
+        case (GridType::RASTER): throw std::runtime_error("Raster grids can only be constructed from a raster file.");
         case (GridType::MANUAL):
             throw std::runtime_error("Manual grids can only be constructed from a vector of GroundPoints.");
         default: throw std::runtime_error("Unrecognized GridType.");
@@ -33,17 +116,52 @@ std::vector<GroundPoint> Grid::build_uniform_grid(const LatLon& corner1, const L
     std::vector<Angle> lats = create_uniformly_spaced_vector(lat1, lat4, spacing);
     std::vector<Angle> lons = create_uniformly_spaced_vector(lon1, lon4, spacing);
 
-    // Iterate and store
+    // Iterate and store. Every longitude at a pole is the same place, so a pole row is a single point.
     std::vector<GroundPoint> grounds;
-    for (const auto& [lat, lon] : std::views::cartesian_product(lats, lons)) {
-        grounds.emplace_back(GroundPoint(_parent, lat, lon));
+    for (const auto& lat : lats) {
+        if (is_pole(lat)) {
+            grounds.emplace_back(GroundPoint(_parent, lat, lons.front()));
+            continue;
+        }
+        for (const auto& lon : lons) {
+            grounds.emplace_back(GroundPoint(_parent, lat, lon));
+        }
     }
     return grounds;
 }
 
 std::vector<GroundPoint> Grid::build_equal_area_grid(const LatLon& corner1, const LatLon& corner4, const Angle& spacing) const
 {
-    throw std::runtime_error("Equal area grids have not been implemented yet.");
+    // Setup
+    const double minLat = std::min(corner1.first, corner4.first).numerical_value_in(deg);
+    const double maxLat = std::max(corner1.first, corner4.first).numerical_value_in(deg);
+    const double minLon = std::min(corner1.second, corner4.second).numerical_value_in(deg);
+    const double maxLon = std::max(corner1.second, corner4.second).numerical_value_in(deg);
+
+    // One point for every spacing^2 of the sphere
+    const double spacingRad = spacing.numerical_value_in(rad);
+    if (spacingRad <= 0.0) { throw std::runtime_error("Grid spacing must be positive."); }
+    const std::size_t nPoints = std::ceil(4.0 * std::numbers::pi / (spacingRad * spacingRad));
+
+    // Fibonacci lattice: equal steps in sin(lat), golden angle steps in longitude. Point ii sits at
+    // sin(lat) = 1 - (2ii + 1)/nPoints, so only the indices within the sin(lat) band of the region are generated,
+    // padded by one on each side for rounding at the edges.
+    const double n          = static_cast<double>(nPoints);
+    const double sinMaxLat  = std::sin(maxLat * std::numbers::pi / 180.0);
+    const double sinMinLat  = std::sin(minLat * std::numbers::pi / 180.0);
+    const std::size_t first = static_cast<std::size_t>(std::max(std::floor((n * (1.0 - sinMaxLat) - 1.0) / 2.0), 0.0));
+    const std::size_t last  = static_cast<std::size_t>(std::clamp(std::ceil((n * (1.0 - sinMinLat) - 1.0) / 2.0), 0.0, n - 1.0));
+
+    const double goldenAngle = 360.0 * (2.0 - std::numbers::phi);
+    std::vector<GroundPoint> grounds;
+    for (std::size_t ii = first; ii <= last; ++ii) {
+        const double lat = std::asin(1.0 - (2.0 * ii + 1.0) / nPoints) * 180.0 / std::numbers::pi;
+        const double lon = std::remainder(goldenAngle * ii, 360.0);
+        if (lat < minLat || lat > maxLat || lon < minLon || lon > maxLon) { continue; }
+
+        grounds.emplace_back(GroundPoint(_parent, lat * deg, lon * deg));
+    }
+    return grounds;
 }
 
 std::vector<GroundPoint>
@@ -52,6 +170,42 @@ std::vector<GroundPoint>
     throw std::runtime_error("Weighted grids have not been implemented yet.");
 }
 
+std::vector<Unitless> Grid::build_weights(const LatLon& corner1, const LatLon& corner4, const GridType& gridType, const Angle& spacing) const
+{
+    std::vector<double> weights(_groundStations.size(), 1.0);
+    if (gridType == GridType::UNIFORM) {
+        // Each point represents the latitude band within half a spacing of it, which shrinks toward the poles, over one
+        // longitude step. A pole point stands in for the whole row, so it covers the cap over every longitude step.
+        const double nLons       = static_cast<double>(create_uniformly_spaced_vector(corner1.second, corner4.second, spacing).size());
+        const double halfSpacing = spacing.numerical_value_in(rad) / 2.0;
+        for (std::size_t ii = 0; ii < _groundStations.size(); ++ii) {
+            const Angle& latitude = _groundStations[ii].get_latitude();
+            const double lat      = latitude.numerical_value_in(rad);
+            const double upper    = std::min(lat + halfSpacing, std::numbers::pi / 2.0);
+            const double lower    = std::max(lat - halfSpacing, -std::numbers::pi / 2.0);
+            weights[ii]           = (std::sin(upper) - std::sin(lower)) * (is_pole(latitude) ? nLons : 1.0);
+        }
+    }
+    return normalize_weights(weights);
+}
+
+bool Grid::is_pole(const Angle& latitude)
+{
+    // Latitudes built up in steps of the spacing can land a rounding error short of the pole
+    return std::abs(latitude.numerical_value_in(rad)) >= std::numbers::pi / 2.0 - 1.0e-9;
+}
+
+std::vector<Unitless> Grid::normalize_weights(const std::vector<double>& weights)
+{
+    const double total = std::accumulate(weights.begin(), weights.end(), 0.0);
+    std::vector<Unitless> normalized;
+    normalized.reserve(weights.size());
+    for (const auto& weight : weights) {
+        normalized.push_back(weight / total * mp_units::one);
+    }
+    return normalized;
+}
+
 std::vector<Angle> Grid::create_uniformly_spaced_vector(const Angle& first, const Angle& second, const Angle& spacing) const
 {
     const std::size_t nAngles = std::ceil((abs(second - first) / spacing).numerical_value_in(mp_units::one)) + 1;
@@ -10,6 +10,7 @@
  */
 #pragma once
 
+#include <filesystem>
 #include <vector>
 
 #include <astro/systems/CelestialBody.hpp>
@@ -28,6 +29,7 @@ enum class GridType : EnumType {
     EQUAL_AREA,  //!< Equal area grid with varying spacing
     WEIGHTED_NS, //!< Weighted grid with North-South emphasis
     WEIGHTED_EW, //!< Weighted grid with East-West emphasis
+    RASTER,      //!< Weighted grid loaded from a raster file
     MANUAL       //!< Manual grid with user-defined points
 };
 
@@ -44,6 +46,10 @@ using LatLon = std::pair<Angle, Angle>;
  * The Grid class manages a collection of ground points, allowing for various grid configurations
  * such as uniform, equal area, and weighted grids. It provides methods to iterate over the ground
  * stations and access their properties.
+ *
+ * Every point carries a weight, normalized so the weights of the grid sum to one. For generated grids this is the
+ * fraction of the covered surface area the point represents, so statistics averaged with these weights are not
+ * biased toward densely sampled regions.
  */
 class Grid {
   public:
@@ -54,6 +60,7 @@ class Grid {
      */
     Grid(const std::vector<GroundPoint>& groundStations = {}) :
         _groundStations(groundStations),
+        _weights(groundStations.size(), 1.0 / static_cast<double>(groundStations.size()) * mp_units::one),
         _gridType(GridType::MANUAL)
     {
     }
@@ -77,10 +84,24 @@ class Grid {
     ) :
         _parent(parent),
         _groundStations(build_grid(corner1, corner4, gridType, spacing, weight)),
+        _weights(build_weights(corner1, corner4, gridType, spacing)),
         _gridType(gridType)
     {
     }
 
+    /**
+     * @brief Construct a weighted Grid from an ESRI ASCII raster file.
+     *
+     * Each cell above the minimum value becomes a point at the center of the cell, weighted by the cell value. This
+     * is intended for population or demand rasters, where the points should follow the data rather than the area.
+     *
+     * @param parent Pointer to the parent celestial body.
+     * @param rasterFile Path to the raster file.
+     * @param minValue Cells with values at or below this are skipped (default is 0).
+     * @throws std::runtime_error If the file cannot be read, is malformed, or contains no cells above the minimum value.
+     */
+    Grid(const astro::CelestialBody* parent, const std::filesystem::path& rasterFile, const double& minValue = 0.0);
+
     /**
      * @brief Default destructor for the Grid class.
      */
@@ -154,9 +175,39 @@ class Grid {
      */
     const GroundPoint& operator[](const std::size_t index) const { return _groundStations[index]; }
 
+    /**
+     * @brief Returns the number of ground points in the grid.
+     *
+     * @return std::size_t The number of ground points.
+     */
+    std::size_t size() const { return _groundStations.size(); }
+
+    /**
+     * @brief Returns the type of the grid.
+     *
+     * @return const GridType& The type of the grid.
+     */
+    const GridType& get_grid_type() const { return _gridType; }
+
+    /**
+     * @brief Returns the normalized weight of a ground point.
+     *
+     * @param index Index of the ground point.
+     * @return const Unitless& The weight of the ground point.
+     */
+    const Unitless& get_weight(const std::size_t index) const { return _weights[index]; }
+
+    /**
+     * @brief Returns the normalized weights of every ground point, in grid order.
+     *
+     * @return const std::vector<Unitless>& The weights of the ground points.
+     */
+    const std::vector<Unitless>& get_weights() const { return _weights; }
+
   private:
     const astro::CelestialBody* _parent;      //!< Pointer to the parent celestial body
     std::vector<GroundPoint> _groundStations; //!< Vector of ground points in the grid
+    std::vector<Unitless> _weights;           //!< Normalized weight of each ground point
     GridType _gridType;                       //!< Type of grid (uniform, equal area, etc.)
 
     /**
@@ -175,6 +226,8 @@ class Grid {
     /**
      * @brief Builds a grid of ground points based on the specified corner points and spacing.
      *
+     * A row at either pole is a single point, since every longitude there is the same place.
+     *
      * @param corner1 First corner point of the grid (latitude, longitude).
      * @param corner4 Fourth corner point of the grid (latitude, longitude).
      * @param spacing Spacing between points in the grid.
@@ -185,6 +238,11 @@ class Grid {
     /**
      * @brief Builds an equal area grid of ground points based on the specified corner points and spacing.
      *
+     * Points are taken from a Fibonacci lattice over the whole sphere, with one point per spacing^2 of area, and
+     * those inside the corners are kept. Only the lattice points in the latitude band of the corners are generated,
+     * so the cost follows the size of the region rather than the sphere. This needs roughly 2/pi as many points as a
+     * uniform grid for the same spacing at the equator.
+     *
      * @param corner1 First corner point of the grid (latitude, longitude).
      * @param corner4 Fourth corner point of the grid (latitude, longitude).
      * @param spacing Spacing between points in the grid.
@@ -205,6 +263,33 @@ class Grid {
     std::vector<GroundPoint>
         build_weighted_grid(const LatLon& corner1, const LatLon& corner4, const GridType& gridType, const Angle& initialSpacing, const Unitless& weight) const;
 
+    /**
+     * @brief Builds the normalized area weights of the generated ground points.
+     *
+     * @param corner1 First corner point of the grid (latitude, longitude).
+     * @param corner4 Fourth corner point of the grid (latitude, longitude).
+     * @param gridType Type of grid that was generated.
+     * @param spacing Spacing between points in the grid.
+     * @return std::vector<Unitless> The normalized weight of each ground point.
+     */
+    std::vector<Unitless> build_weights(const LatLon& corner1, const LatLon& corner4, const GridType& gridType, const Angle& spacing) const;
+
+    /**
+     * @brief Checks whether a latitude is at either pole.
+     *
+     * @param latitude The latitude to check.
+     * @return true if the latitude is at +/-90 degrees.
+     */
+    static bool is_pole(const Angle& latitude);
+
+    /**
+     * @brief Normalizes a set of weights so they sum to one.
+     *
+     * @param weights The weights to normalize.
+     * @return std::vector<Unitless> The normalized weights.
+     */
+    static std::vector<Unitless> normalize_weights(const std::vector<double>& weights);
+
     /**
      * @brief Creates a uniformly spaced vector of angles between two points.
      *
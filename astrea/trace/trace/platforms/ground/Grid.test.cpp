@@ -1,3 +1,8 @@
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <numbers>
+
 #include <gtest/gtest.h>
 
 #include <astro/astro.hpp>
@@ -63,9 +68,10 @@ TEST_F(GridTest, ManualConstructor)
 TEST_F(GridTest, TypedConstructors)
 {
     ASSERT_NO_THROW(Grid(parent, corner1, corner4, GridType::UNIFORM, spacing, weight));
-    ASSERT_ANY_THROW(Grid(parent, corner1, corner4, GridType::EQUAL_AREA, spacing, weight));  // Not implemented
+    ASSERT_NO_THROW(Grid(parent, corner1, corner4, GridType::EQUAL_AREA, spacing, weight));
     ASSERT_ANY_THROW(Grid(parent, corner1, corner4, GridType::WEIGHTED_NS, spacing, weight)); // Not implemented
     ASSERT_ANY_THROW(Grid(parent, corner1, corner4, GridType::WEIGHTED_EW, spacing, weight)); // Not implemented
+    ASSERT_ANY_THROW(Grid(parent, corner1, corner4, GridType::RASTER, spacing, weight));      // Needs a file
 }
 
 TEST_F(GridTest, Iterators)
@@ -73,3 +79,102 @@ TEST_F(GridTest, Iterators)
     ASSERT_NO_THROW(for (auto& point : grid){});
     ASSERT_NO_THROW(for (const auto& point : grid){});
 }
+
+TEST_F(GridTest, EqualArea)
+{
+    using mp_units::angular::unit_symbols::deg;
+
+    // Fewer points than a uniform grid at the same spacing, by roughly 2/pi
+    const Grid uniform(parent, { -90.0 * deg, -180.0 * deg }, { 90.0 * deg, 180.0 * deg }, GridType::UNIFORM, spacing);
+    const Grid equalArea(parent, { -90.0 * deg, -180.0 * deg }, { 90.0 * deg, 180.0 * deg }, GridType::EQUAL_AREA, spacing);
+    ASSERT_EQ(equalArea.size(), 1651);
+    ASSERT_LT(equalArea.size(), uniform.size());
+
+    // Equal area points share the weight evenly
+    for (const auto& pointWeight : equalArea.get_weights()) {
+        ASSERT_DOUBLE_EQ(pointWeight.numerical_value_in(mp_units::one), 1.0 / 1651.0);
+    }
+
+    // Only points inside the corners are kept
+    const Grid partial(parent, corner1, corner4, GridType::EQUAL_AREA, spacing);
+    for (const auto& point : partial) {
+        ASSERT_GE(point.get_latitude(), corner1.first);
+        ASSERT_LE(point.get_latitude(), corner4.first);
+        ASSERT_GE(point.get_longitude(), corner1.second);
+        ASSERT_LE(point.get_longitude(), corner4.second);
+    }
+
+    // And no lattice point inside the corners is missed, against a sweep of the whole lattice
+    const auto count_lattice = [](const double& minLat, const double& maxLat, const double& minLon, const double& maxLon) {
+        const std::size_t nPoints = 1651;
+        std::size_t count         = 0;
+        for (std::size_t ii = 0; ii < nPoints; ++ii) {
+            const double lat = std::asin(1.0 - (2.0 * ii + 1.0) / nPoints) * 180.0 / std::numbers::pi;
+            const double lon = std::remainder(360.0 * (2.0 - std::numbers::phi) * ii, 360.0);
+            if (lat >= minLat && lat <= maxLat && lon >= minLon && lon <= maxLon) { ++count; }
+        }
+        return count;
+    };
+    ASSERT_EQ(partial.size(), count_lattice(0.0, 10.0, 0.0, 10.0));
+
+    const Grid band(parent, { 60.0 * deg, -30.0 * deg }, { 20.0 * deg, 30.0 * deg }, GridType::EQUAL_AREA, spacing);
+    ASSERT_EQ(band.size(), count_lattice(20.0, 60.0, -30.0, 30.0));
+
+    const Grid southernCap(parent, { -90.0 * deg, -180.0 * deg }, { -70.0 * deg, 180.0 * deg }, GridType::EQUAL_AREA, spacing);
+    ASSERT_EQ(southernCap.size(), count_lattice(-90.0, -70.0, -180.0, 180.0));
+}
+
+TEST_F(GridTest, Weights)
+{
+    using mp_units::angular::unit_symbols::deg;
+
+    const Grid uniform(parent, { 0.0 * deg, 0.0 * deg }, { 90.0 * deg, 0.0 * deg }, GridType::UNIFORM, spacing);
+    double total = 0.0;
+    for (std::size_t ii = 0; ii < uniform.size(); ++ii) {
+        total += uniform.get_weight(ii).numerical_value_in(mp_units::one);
+        if (ii > 0) { ASSERT_LT(uniform.get_weight(ii), uniform.get_weight(ii - 1)); } // Smaller toward the pole
+    }
+    ASSERT_NEAR(total, 1.0, 1.0e-12);
+
+    // Each pole is a single point, weighted by the area of the cap within half a spacing of it
+    const Grid global(parent, { -90.0 * deg, -180.0 * deg }, { 90.0 * deg, 180.0 * deg }, GridType::UNIFORM, spacing);
+    ASSERT_EQ(global.size(), 35 * 73 + 2);
+    ASSERT_NEAR(global[0].get_latitude().numerical_value_in(deg), -90.0, 1.0e-9);
+    ASSERT_NEAR(global[global.size() - 1].get_latitude().numerical_value_in(deg), 90.0, 1.0e-9);
+    ASSERT_GT(global[1].get_latitude(), global[0].get_latitude());
+
+    const double capFraction = (1.0 - std::cos(2.5 * std::numbers::pi / 180.0)) / 2.0;
+    ASSERT_NEAR(global.get_weight(0).numerical_value_in(mp_units::one), capFraction, 1.0e-12);
+    ASSERT_NEAR(global.get_weight(global.size() - 1).numerical_value_in(mp_units::one), capFraction, 1.0e-12);
+
+    const Grid manual(groundStations);
+    ASSERT_DOUBLE_EQ(manual.get_weight(0).numerical_value_in(mp_units::one), 0.5);
+    ASSERT_EQ(manual.get_grid_type(), GridType::MANUAL);
+}
+
+TEST_F(GridTest, Raster)
+{
+    const std::filesystem::path rasterFile = std::filesystem::temp_directory_path() / "astrea_grid_test.asc";
+    {
+        std::ofstream file(rasterFile);
+        file << "ncols 3\nnrows 2\nxllcorner -180\nyllcorner -90\ncellsize 90\nNODATA_value -9999\n";
+        file << "1 0 -9999\n2 5 2\n";
+    }
+
+    // Zero and no-data cells are skipped, and rows are read from the top down
+    const Grid raster(parent, rasterFile);
+    ASSERT_EQ(raster.size(), 4);
+    ASSERT_EQ(raster.get_grid_type(), GridType::RASTER);
+    ASSERT_DOUBLE_EQ(raster[0].get_latitude().numerical_value_in(mp_units::angular::unit_symbols::deg), 45.0);
+    ASSERT_DOUBLE_EQ(raster[0].get_longitude().numerical_value_in(mp_units::angular::unit_symbols::deg), -135.0);
+    ASSERT_DOUBLE_EQ(raster[2].get_latitude().numerical_value_in(mp_units::angular::unit_symbols::deg), -45.0);
+    ASSERT_DOUBLE_EQ(raster[2].get_longitude().numerical_value_in(mp_units::angular::unit_symbols::deg), -45.0);
+    ASSERT_DOUBLE_EQ(raster.get_weight(2).numerical_value_in(mp_units::one), 0.5);
+
+    const Grid thresholded(parent, rasterFile, 1.5);
+    ASSERT_EQ(thresholded.size(), 3);
+
+    ASSERT_ANY_THROW(Grid(parent, rasterFile, 10.0));
+    ASSERT_ANY_THROW(Grid(parent, rasterFile.string() + ".missing"));
+    std::filesystem::remove(rasterFile);
+}
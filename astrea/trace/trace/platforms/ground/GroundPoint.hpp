@@ -93,6 +93,13 @@ class GroundPoint : virtual public AccessObject {
 
     const astro::CelestialBody* get_parent() const { return _parent; }
 
+    /**
+     * @brief Gets the position of the ground point in the body-fixed frame of its parent.
+     *
+     * @return RadiusVector<ECEF> The body-fixed position of the ground point.
+     */
+    astro::RadiusVector<astro::ECEF> get_earth_fixed_position() const { return _lla.get_position(_parent); }
+
     /**
      * @brief Get the unique identifier for the ground station.
      *
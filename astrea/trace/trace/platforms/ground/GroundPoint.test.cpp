@@ -50,6 +50,11 @@ TEST_F(GroundPointTest, GetAltitude) { ASSERT_EQ(point.get_altitude(), altitude)
 
 TEST_F(GroundPointTest, GetParent) { ASSERT_EQ(point.get_parent(), sys.get("Earth").get()); }
 
+TEST_F(GroundPointTest, GetEarthFixedPosition)
+{
+    ASSERT_EQ(point.get_earth_fixed_position(), Geodetic(latitude, longitude, altitude).get_position(parent));
+}
+
 TEST_F(GroundPointTest, GetId)
 {
     ASSERT_EQ(point.get_id(), GroundPoint(sys.get("Earth").get(), latitude, longitude, altitude).get_id());
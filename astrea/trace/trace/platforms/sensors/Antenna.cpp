@@ -1,5 +1,6 @@
 #include <trace/platforms/sensors/Antenna.hpp>
 
+#include <cmath>
 #include <stdexcept>
 
 #include <mp-units/math.h>
@@ -10,6 +11,8 @@
 #include <astro/state/CartesianVector.hpp>
 #include <astro/state/frames/frames.hpp>
 
+#include <trace/platforms/sensors/AtmosphericLossTable.hpp>
+
 namespace astrea {
 namespace trace {
 
@@ -17,22 +20,46 @@ using mp_units::one;
 using mp_units::pow;
 using mp_units::angular::sin;
 using mp_units::isq_angle::cotes_angle;
+using mp_units::si::unit_symbols::Hz;
+using mp_units::si::unit_symbols::J;
+using mp_units::si::unit_symbols::K;
+using mp_units::si::unit_symbols::W;
+
+namespace {
 
-CNR Antenna::carrier_to_noise_ratio(const Antenna& receiver, const Distance& range, const Angle& offsetAngle) const
+// Isolation between opposite circular polarizations
+constexpr double CROSS_POLARIZATION_ISOLATION = 0.01;
+
+// Noise power spectral density k*T of a receiver, in W/Hz
+double get_noise_density(const Antenna& receiver)
 {
-    throw std::runtime_error("CNR calculation not yet implemented.");
-    // return recieved_power(receiver, range, offsetAngle) / receiver.system_noise_temperature() / boltzmann_constant * _noiseBandwidth;
+    const double temperature = receiver.system_noise_temperature().quantity_from(mp_units::si::absolute_zero).numerical_value_in(K);
+    if (temperature <= 0.0) { throw std::runtime_error("Carrier-to-noise requires a positive receiver system noise temperature."); }
+    return boltzmann_constant.numerical_value_in(J / K) * temperature;
 }
 
-CNR Antenna::carrier_to_noise_density(const Antenna& receiver, const Distance& range, const Angle& offsetAngle) const
+} // namespace
+
+
+CNR Antenna::carrier_to_noise_ratio(const Antenna& receiver, const Distance& range, const Angle& offsetAngle, const Gain& atmosphericLoss) const
 {
-    throw std::runtime_error("CND calculation not yet implemented.");
-    // return recieved_power(receiver, range, offsetAngle) / receiver.system_noise_temperature() / boltzmann_constant;
+    const double bandwidth = receiver.get_antenna_parameters().get_noise_bandwidth().numerical_value_in(Hz);
+    if (bandwidth <= 0.0) { throw std::runtime_error("Carrier-to-noise ratio requires a positive receiver noise bandwidth."); }
+
+    const double received = recieved_power(receiver, range, offsetAngle, atmosphericLoss).numerical_value_in(W);
+    return received / (get_noise_density(receiver) * bandwidth) * one;
 }
 
-Power Antenna::recieved_power(const Antenna& receiver, const Distance& range, const Angle& offsetAngle) const
+Frequency
+    Antenna::carrier_to_noise_density(const Antenna& receiver, const Distance& range, const Angle& offsetAngle, const Gain& atmosphericLoss) const
 {
-    return _parameters.get_eirp() * receiver.gain() * free_space_loss(range) * system_loss(receiver, offsetAngle);
+    const double received = recieved_power(receiver, range, offsetAngle, atmosphericLoss).numerical_value_in(W);
+    return received / get_noise_density(receiver) * Hz;
+}
+
+Power Antenna::recieved_power(const Antenna& receiver, const Distance& range, const Angle& offsetAngle, const Gain& atmosphericLoss) const
+{
+    return _parameters.get_eirp() * receiver.gain() * free_space_loss(range) * system_loss(receiver, offsetAngle, atmosphericLoss);
 }
 
 Gain Antenna::free_space_loss(const Distance& range) const
@@ -41,14 +68,19 @@ Gain Antenna::free_space_loss(const Distance& range) const
     return fixedLoss * pow<2>(_parameters.get_wavelength() / range);
 }
 
-Gain Antenna::system_loss(const Antenna& receiver, const Angle& offsetAngle) const
+Gain Antenna::system_loss(const Antenna& receiver, const Angle& offsetAngle, const Gain& atmosphericLoss) const
 {
-    return _parameters.get_transmit_loss() * mispointing_loss(receiver, offsetAngle) * atmospheric_loss() * receiver.receiver_loss();
+    return _parameters.get_transmit_loss() * mispointing_loss(receiver, offsetAngle) * atmosphericLoss * receiver.receiver_loss();
 }
 
 Gain Antenna::mispointing_loss(const Antenna& receiver, const Angle& offsetAngle) const
 {
     // Including polarization losses here
+    return pattern_loss(offsetAngle) * polarization_loss(receiver);
+}
+
+Gain Antenna::pattern_loss(const Angle& offsetAngle) const
+{
     Gain mispointingLoss;
     switch (_parameters.get_pattern()) {
         case (PatternApproximation::BESSEL): {
@@ -61,17 +93,21 @@ Gain Antenna::mispointing_loss(const Antenna& receiver, const Angle& offsetAngle
         }
         default: throw std::runtime_error("Unrecognized pattern approximation for mispointing losses.");
     }
-    return mispointingLoss * polarization_loss(receiver);
+    return mispointingLoss;
 }
 
 Gain Antenna::polarization_loss(const Antenna& receiver) const
 {
-    return 1.0; // Ideal, but generally considered true as they are typically small or zero (exactly zero for circular polarization)
+    const Polarization transmit = _parameters.get_polarization();
+    const Polarization receive  = receiver.get_antenna_parameters().get_polarization();
+    if (transmit == receive) { return 1.0 * one; }
+    if (transmit == Polarization::LINEAR || receive == Polarization::LINEAR) { return 0.5 * one; }
+    return CROSS_POLARIZATION_ISOLATION * one;
 }
 
-Gain Antenna::atmospheric_loss() const
+Gain Antenna::atmospheric_loss(const Angle& elevation) const
 {
-    return 1.0; // Ideal, definitely not true
+    return AtmosphericLossTable::standard().get_loss(_parameters.get_frequency(), elevation);
 }
 
 Gain Antenna::gain() const { return _parameters.get_gain(); }
@@ -85,6 +121,9 @@ void Antenna::set_pattern_approximation(const PatternApproximation& pattern) { _
 Gain Antenna::bessel_loss_approximation(const Angle& offsetAngle) const
 {
     const auto u = mispointing_loss_approximation_argument(offsetAngle);
+
+    // J2(u) / u^2 -> 1/8 on boresight, but the ratio is 0/0 there
+    if (abs(u) < 1.0e-4 * one) { return 1.0 * one; }
     return 64.0 * pow<2>(math::cyl_bessel_j(2.0, u) / pow<2>(u));
 }
 
@@ -97,7 +136,7 @@ Gain Antenna::sinc_loss_approximation(const Angle& offsetAngle) const
 
 Gain Antenna::mispointing_loss_approximation_argument(const Angle& offsetAngle) const
 {
-    static const auto ratio = std::numbers::pi * _parameters.get_diameter() / _parameters.get_wavelength();
+    const auto ratio = std::numbers::pi * _parameters.get_diameter() / _parameters.get_wavelength();
     return ratio * sin(offsetAngle);
 }
 
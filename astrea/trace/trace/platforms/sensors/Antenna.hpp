@@ -31,6 +31,15 @@ enum class PatternApproximation {
     SINC_SQUARED //!< Sinc-squared approximation
 };
 
+/**
+ * @brief Enum class for antenna polarizations.
+ */
+enum class Polarization {
+    RIGHT_HAND_CIRCULAR, //!< Right-hand circular polarization
+    LEFT_HAND_CIRCULAR,  //!< Left-hand circular polarization
+    LINEAR               //!< Linear polarization
+};
+
 /**
  * @brief Class for storing and managing antenna parameters.
  */
@@ -162,6 +171,13 @@ class AntennaParameters : public SensorParameters {
      */
     Temperature get_system_noise_temperature() const { return _sysNoiseTemp; }
 
+    /**
+     * @brief Get the polarization of the antenna.
+     *
+     * @return Polarization Polarization of the antenna.
+     */
+    Polarization get_polarization() const { return _polarization; }
+
     /**
      * @brief Get the wavelength of the antenna.
      *
@@ -225,6 +241,20 @@ class AntennaParameters : public SensorParameters {
      */
     void set_pattern(const PatternApproximation& pattern) { _pattern = pattern; }
 
+    /**
+     * @brief Set the system noise temperature of the antenna.
+     *
+     * @param sysNoiseTemp Temperature System noise temperature of the antenna.
+     */
+    void set_system_noise_temperature(const Temperature& sysNoiseTemp) { _sysNoiseTemp = sysNoiseTemp; }
+
+    /**
+     * @brief Set the polarization of the antenna.
+     *
+     * @param polarization Polarization Polarization of the antenna.
+     */
+    void set_polarization(const Polarization& polarization) { _polarization = polarization; }
+
   private:
     Length _diameter;              //!< Reflector diameter
     Unitless _efficiency;          //!< Aperture illumination efficiency
@@ -238,7 +268,8 @@ class AntennaParameters : public SensorParameters {
     Gain _gain;                    //!< Peak isotropic power gain
     Power _eirp;                   //!< Equivalent isotropic radiator power
 
-    Temperature _sysNoiseTemp = mp_units::absolute<mp_units::si::unit_symbols::deg_C>(0.0); //!< System noise temperature
+    Temperature _sysNoiseTemp  = mp_units::absolute<mp_units::si::unit_symbols::deg_C>(0.0); //!< System noise temperature
+    Polarization _polarization = Polarization::RIGHT_HAND_CIRCULAR;                         //!< Polarization
 };
 
 /**
@@ -260,15 +291,31 @@ class Antenna : public Sensor {
     {
     }
 
+    /**
+     * @brief Get the parameters of the antenna.
+     *
+     * @return const AntennaParameters& The antenna parameters.
+     */
+    const AntennaParameters& get_antenna_parameters() const { return _parameters; }
+
     /**
      * @brief Calculate the carrier-to-noise ratio (CNR) for the antenna.
      *
+     * Noise is taken from the receiver's system noise temperature and noise bandwidth.
+     *
      * @param receiver Antenna object representing the receiver.
      * @param range Distance to the receiver.
      * @param offsetAngle Angle offset from the boresight.
+     * @param atmosphericLoss Atmospheric loss along the path (default is 1.0, no atmosphere).
      * @return CNR The calculated carrier-to-noise ratio.
+     * @throws std::runtime_error If the receiver noise bandwidth or system noise temperature is not positive.
      */
-    CNR carrier_to_noise_ratio(const Antenna& receiver, const Distance& range, const Angle& offsetAngle) const;
+    CNR carrier_to_noise_ratio(
+        const Antenna& receiver,
+        const Distance& range,
+        const Angle& offsetAngle,
+        const Gain& atmosphericLoss = 1.0 * mp_units::one
+    ) const;
 
     /**
      * @brief Calculate the carrier-to-noise density (CND) for the antenna.
@@ -276,9 +323,16 @@ class Antenna : public Sensor {
      * @param receiver Antenna object representing the receiver.
      * @param range Distance to the receiver.
      * @param offsetAngle Angle offset from the boresight.
-     * @return CNR The calculated carrier-to-noise density.
+     * @param atmosphericLoss Atmospheric loss along the path (default is 1.0, no atmosphere).
+     * @return Frequency The calculated carrier-to-noise density.
+     * @throws std::runtime_error If the receiver system noise temperature is not positive.
      */
-    CNR carrier_to_noise_density(const Antenna& receiver, const Distance& range, const Angle& offsetAngle) const;
+    Frequency carrier_to_noise_density(
+        const Antenna& receiver,
+        const Distance& range,
+        const Angle& offsetAngle,
+        const Gain& atmosphericLoss = 1.0 * mp_units::one
+    ) const;
 
     /**
      * @brief Calculate the received power at the receiver.
@@ -286,9 +340,15 @@ class Antenna : public Sensor {
      * @param receiver Antenna object representing the receiver.
      * @param range Distance to the receiver.
      * @param offsetAngle Angle offset from the boresight.
+     * @param atmosphericLoss Atmospheric loss along the path (default is 1.0, no atmosphere).
      * @return Power The calculated received power.
      */
-    Power recieved_power(const Antenna& receiver, const Distance& range, const Angle& offsetAngle) const;
+    Power recieved_power(
+        const Antenna& receiver,
+        const Distance& range,
+        const Angle& offsetAngle,
+        const Gain& atmosphericLoss = 1.0 * mp_units::one
+    ) const;
 
     /**
      * @brief Calculate the free space loss for the antenna.
@@ -303,9 +363,10 @@ class Antenna : public Sensor {
      *
      * @param receiver Antenna object representing the receiver.
      * @param offsetAngle Angle offset from the boresight.
+     * @param atmosphericLoss Atmospheric loss along the path (default is 1.0, no atmosphere).
      * @return Gain The calculated system loss.
      */
-    Gain system_loss(const Antenna& receiver, const Angle& offsetAngle) const;
+    Gain system_loss(const Antenna& receiver, const Angle& offsetAngle, const Gain& atmosphericLoss = 1.0 * mp_units::one) const;
 
     /**
      * @brief Calculate the mispointing loss for the antenna.
@@ -317,7 +378,19 @@ class Antenna : public Sensor {
     Gain mispointing_loss(const Antenna& receiver, const Angle& offsetAngle) const;
 
     /**
-     * @brief Calculate the polarization loss for the antenna.
+     * @brief Calculate the off-boresight loss of the antenna pattern alone.
+     *
+     * @param offsetAngle Angle offset from the boresight.
+     * @return Gain The pattern loss, 1 on boresight.
+     * @throws std::runtime_error If the pattern approximation is not recognized.
+     */
+    Gain pattern_loss(const Angle& offsetAngle) const;
+
+    /**
+     * @brief Calculate the polarization mismatch loss for the antenna.
+     *
+     * Matched polarizations have no loss, and circular against linear loses half the power. Opposite circular
+     * polarizations are limited by cross-polarization isolation, taken as 20 dB. Linear antennas are assumed aligned.
      *
      * @param receiver Antenna object representing the receiver.
      * @return Gain The calculated polarization loss.
@@ -325,11 +398,13 @@ class Antenna : public Sensor {
     Gain polarization_loss(const Antenna& receiver) const;
 
     /**
-     * @brief Calculate the atmospheric loss for the antenna.
+     * @brief Calculate the atmospheric loss at the antenna frequency from the standard atmospheric loss table.
      *
+     * @param elevation Elevation of the path above the local horizon at the ground end.
      * @return Gain The calculated atmospheric loss.
+     * @throws std::runtime_error If the antenna frequency is above the table.
      */
-    Gain atmospheric_loss() const;
+    Gain atmospheric_loss(const Angle& elevation) const;
 
     /**
      * @brief Get antenna gain.
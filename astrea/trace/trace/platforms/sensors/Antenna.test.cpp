@@ -17,6 +17,10 @@ using mp_units::one;
 using mp_units::angular::unit_symbols::deg;
 using mp_units::angular::unit_symbols::rad;
 using mp_units::si::unit_symbols::GHz;
+using mp_units::si::unit_symbols::Hz;
+using mp_units::si::unit_symbols::J;
+using mp_units::si::unit_symbols::K;
+using mp_units::si::unit_symbols::MHz;
 using mp_units::si::unit_symbols::km;
 using mp_units::si::unit_symbols::m;
 using mp_units::si::unit_symbols::W;
@@ -153,16 +157,91 @@ TEST(AntennaTest, LossAndGainMethods)
     Angle offset   = 0.1 * rad;
 
     // whatever, just make sure they run
-    ASSERT_ANY_THROW(antenna.carrier_to_noise_ratio(receiver, range, offset));
-    ASSERT_ANY_THROW(antenna.carrier_to_noise_density(receiver, range, offset));
+    ASSERT_ANY_THROW(antenna.carrier_to_noise_ratio(receiver, range, offset)); // No noise bandwidth
+    ASSERT_NO_THROW(antenna.carrier_to_noise_density(receiver, range, offset));
     ASSERT_NO_THROW(antenna.recieved_power(receiver, range, offset));
     ASSERT_NO_THROW(antenna.free_space_loss(range));
     ASSERT_NO_THROW(antenna.system_loss(receiver, offset));
     ASSERT_NO_THROW(antenna.mispointing_loss(receiver, offset));
     ASSERT_NO_THROW(antenna.polarization_loss(receiver));
-    ASSERT_NO_THROW(antenna.atmospheric_loss());
+    ASSERT_NO_THROW(antenna.atmospheric_loss(30.0 * deg));
     ASSERT_NO_THROW(antenna.gain());
     ASSERT_NO_THROW(antenna.system_noise_temperature());
     ASSERT_NO_THROW(antenna.receiver_loss());
     ASSERT_NO_THROW(antenna.transmit_loss());
 }
+
+TEST(AntennaTest, CarrierToNoise)
+{
+    Viewer sc;
+    CircularFieldOfView fov;
+    AntennaParameters params(&fov, 2.0 * m, 0.5 * one, 10.0 * GHz, 5.0 * W);
+    params.set_noise_bandwidth(1.0 * MHz);
+    params.set_system_noise_temperature(absolute<K>(290.0));
+    Antenna antenna(sc, params);
+    Antenna receiver(sc, params);
+    Distance range = 1000.0 * km;
+
+    // C/N = C / (k * T * B)
+    const double noise    = boltzmann_constant.numerical_value_in(J / K) * 290.0 * 1.0e6;
+    const double received = antenna.recieved_power(receiver, range, 0.0 * rad).numerical_value_in(W);
+    ASSERT_NEAR(antenna.carrier_to_noise_ratio(receiver, range, 0.0 * rad).numerical_value_in(one), received / noise, received / noise * 1.0e-9);
+    ASSERT_NEAR(
+        antenna.carrier_to_noise_density(receiver, range, 0.0 * rad).numerical_value_in(Hz) / 1.0e6,
+        antenna.carrier_to_noise_ratio(receiver, range, 0.0 * rad).numerical_value_in(one),
+        received / noise * 1.0e-9
+    );
+
+    // Atmospheric loss scales the link directly
+    const Gain atmosphericLoss = antenna.atmospheric_loss(10.0 * deg);
+    compare_unit_values(
+        to_db(antenna.carrier_to_noise_ratio(receiver, range, 0.0 * rad, atmosphericLoss)),
+        to_db(antenna.carrier_to_noise_ratio(receiver, range, 0.0 * rad)) + to_db(atmosphericLoss),
+        1.0e-9
+    );
+
+    // No noise temperature
+    params.set_system_noise_temperature(absolute<K>(0.0));
+    Antenna noiseless(sc, params);
+    ASSERT_ANY_THROW(antenna.carrier_to_noise_ratio(noiseless, range, 0.0 * rad));
+}
+
+TEST(AntennaTest, PolarizationLoss)
+{
+    Viewer sc;
+    CircularFieldOfView fov;
+    AntennaParameters rightParams(&fov, 2.0 * m, 0.5 * one, 10.0 * GHz, 5.0 * W);
+    AntennaParameters leftParams   = rightParams;
+    AntennaParameters linearParams = rightParams;
+    leftParams.set_polarization(Polarization::LEFT_HAND_CIRCULAR);
+    linearParams.set_polarization(Polarization::LINEAR);
+
+    Antenna right(sc, rightParams);
+    Antenna left(sc, leftParams);
+    Antenna linear(sc, linearParams);
+
+    compare_unit_values(to_db(right.polarization_loss(right)), 0.0 * dB);
+    compare_unit_values(to_db(right.polarization_loss(left)), -20.0 * dB);
+    compare_unit_values(to_db(right.polarization_loss(linear)), -3.01 * dB);
+    compare_unit_values(to_db(linear.polarization_loss(left)), -3.01 * dB);
+}
+
+TEST(AntennaTest, PatternLoss)
+{
+    Viewer sc;
+    CircularFieldOfView fov;
+    AntennaParameters smallParams(&fov, 1.0 * m, 1.0 * one, 12.0 * GHz, 1.0 * W);
+    AntennaParameters largeParams(&fov, 3.0 * m, 0.55 * one, 12.0 * GHz, 1.0 * W);
+
+    Antenna small(sc, smallParams);
+    Antenna large(sc, largeParams);
+
+    // No loss on boresight
+    compare_unit_values(to_db(small.pattern_loss(0.0 * deg)), 0.0 * dB, 1.0e-9);
+    compare_unit_values(to_db(large.pattern_loss(0.0 * deg)), 0.0 * dB, 1.0e-9);
+
+    // Each antenna uses its own beamwidth, whichever is evaluated first
+    compare_unit_values(to_db(small.pattern_loss(0.0707 * deg)), -0.02 * dB);
+    compare_unit_values(to_db(large.pattern_loss(0.0707 * deg)), -0.16 * dB);
+    ASSERT_GT(small.pattern_loss(0.0707 * deg), large.pattern_loss(0.0707 * deg));
+}
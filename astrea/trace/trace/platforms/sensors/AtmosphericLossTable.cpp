@@ -0,0 +1,120 @@
+#include <trace/platforms/sensors/AtmosphericLossTable.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include <mp-units/systems/angular/math.h>
+#include <mp-units/systems/si.h>
+
+namespace astrea {
+namespace trace {
+
+using mp_units::one;
+using mp_units::angular::unit_symbols::deg;
+using mp_units::si::unit_symbols::GHz;
+
+namespace {
+
+// Read "frequency attenuation" rows, in GHz and dB, skipping empty lines and comments
+AtmosphericLossTable read_loss_table(const std::filesystem::path& file, const Angle& minimumElevation)
+{
+    std::ifstream stream(file);
+    if (!stream) { throw std::runtime_error("Unable to open atmospheric loss table: " + file.string()); }
+
+    std::vector<Frequency> frequencies;
+    std::vector<Unitless> zenithAttenuations;
+    std::string line;
+    while (std::getline(stream, line)) {
+        if (line.empty() || line[0] == '#') { continue; }
+
+        std::istringstream lineStream(line);
+        double frequency, attenuation;
+        if (!(lineStream >> frequency >> attenuation)) {
+            throw std::runtime_error("Malformed line in " + file.string() + ": " + line);
+        }
+        frequencies.push_back(frequency * GHz);
+        zenithAttenuations.push_back(attenuation * one);
+    }
+    return AtmosphericLossTable(frequencies, zenithAttenuations, minimumElevation);
+}
+
+} // namespace
+
+AtmosphericLossTable::AtmosphericLossTable(
+    const std::vector<Frequency>& frequencies,
+    const std::vector<Unitless>& zenithAttenuations,
+    const Angle& minimumElevation
+)
+{
+    if (frequencies.empty() || frequencies.size() != zenithAttenuations.size()) {
+        throw std::runtime_error("Atmospheric loss tables require the same, non-zero number of frequencies and attenuations.");
+    }
+    if (minimumElevation <= 0.0 * deg || minimumElevation > 90.0 * deg) {
+        throw std::runtime_error("The minimum elevation of an atmospheric loss table must be between 0 and 90 degrees.");
+    }
+
+    for (std::size_t ii = 0; ii < frequencies.size(); ++ii) {
+        _frequencies.push_back(frequencies[ii].numerical_value_in(GHz));
+        _zenithAttenuations.push_back(zenithAttenuations[ii].numerical_value_in(one));
+
+        if (ii > 0 && _frequencies[ii] <= _frequencies[ii - 1]) {
+            throw std::runtime_error("Atmospheric loss table frequencies must be strictly ascending.");
+        }
+        if (_zenithAttenuations[ii] < 0.0) { throw std::runtime_error("Atmospheric loss table attenuations cannot be negative."); }
+    }
+    _minSinElevation = mp_units::angular::sin(minimumElevation).numerical_value_in(one);
+}
+
+AtmosphericLossTable::AtmosphericLossTable(const std::filesystem::path& file, const Angle& minimumElevation) :
+    AtmosphericLossTable(read_loss_table(file, minimumElevation))
+{
+}
+
+const AtmosphericLossTable& AtmosphericLossTable::standard()
+{
+    static const AtmosphericLossTable table(
+        { 1.0 * GHz,  2.0 * GHz,  4.0 * GHz,  6.0 * GHz,  8.0 * GHz,  10.0 * GHz, 12.0 * GHz,
+          14.0 * GHz, 16.0 * GHz, 18.0 * GHz, 20.0 * GHz, 22.0 * GHz, 24.0 * GHz, 26.0 * GHz,
+          28.0 * GHz, 30.0 * GHz, 35.0 * GHz, 40.0 * GHz, 45.0 * GHz, 50.0 * GHz },
+        { 0.035 * one, 0.038 * one, 0.040 * one, 0.043 * one, 0.047 * one, 0.053 * one, 0.062 * one,
+          0.075 * one, 0.095 * one, 0.140 * one, 0.220 * one, 0.320 * one, 0.270 * one, 0.210 * one,
+          0.190 * one, 0.190 * one, 0.240 * one, 0.340 * one, 0.580 * one, 1.800 * one }
+    );
+    return table;
+}
+
+Unitless AtmosphericLossTable::get_zenith_attenuation(const Frequency& frequency) const
+{
+    const double value = frequency.numerical_value_in(GHz);
+    if (value > _frequencies.back()) { throw std::runtime_error("Frequency is above the range of the atmospheric loss table."); }
+
+    // Absorption is negligible and nearly flat below the table, so hold the first entry
+    if (value <= _frequencies.front() || _frequencies.size() == 1) { return _zenithAttenuations[0] * one; }
+
+    // Linear interpolation between the bracketing entries
+    const std::size_t upper = std::clamp<std::size_t>(
+        std::upper_bound(_frequencies.begin(), _frequencies.end(), value) - _frequencies.begin(), 1, _frequencies.size() - 1
+    );
+    const std::size_t lower = upper - 1;
+
+    const double fraction = (value - _frequencies[lower]) / (_frequencies[upper] - _frequencies[lower]);
+    return (_zenithAttenuations[lower] + fraction * (_zenithAttenuations[upper] - _zenithAttenuations[lower])) * one;
+}
+
+Unitless AtmosphericLossTable::get_attenuation(const Frequency& frequency, const Angle& elevation) const
+{
+    const double sinElevation = std::max(mp_units::angular::sin(elevation).numerical_value_in(one), _minSinElevation);
+    return get_zenith_attenuation(frequency) / sinElevation;
+}
+
+Gain AtmosphericLossTable::get_loss(const Frequency& frequency, const Angle& elevation) const
+{
+    return std::pow(10.0, -get_attenuation(frequency, elevation).numerical_value_in(one) / 10.0) * one;
+}
+
+} // namespace trace
+} // namespace astrea
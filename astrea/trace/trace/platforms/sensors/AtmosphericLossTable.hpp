@@ -0,0 +1,125 @@
+/**
+ * @file AtmosphericLossTable.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief Table-driven atmospheric attenuation for link budgets.
+ * @version 0.1
+ * @date 2025-08-06
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <filesystem>
+#include <vector>
+
+#include <mp-units/systems/angular.h>
+
+#include <units/units.hpp>
+
+namespace astrea {
+namespace trace {
+
+/**
+ * @brief Class for looking up gaseous atmospheric attenuation by frequency and elevation.
+ *
+ * The table holds the total zenith attenuation in dB at a set of frequencies, and is linearly interpolated between
+ * them. Slant paths are scaled from zenith by the cosecant of the elevation, following ITU-R P.618. The cosecant law
+ * overstates the loss near the horizon, so elevations are clamped to a minimum.
+ *
+ * Below the first frequency the attenuation is held at the first entry. Gaseous absorption flattens out and becomes
+ * negligible at low frequencies, so this is a small overestimate. Above the last frequency the table throws, since the
+ * attenuation there depends on absorption lines the table does not describe.
+ */
+class AtmosphericLossTable {
+  public:
+    /**
+     * @brief Constructs an AtmosphericLossTable from zenith attenuations.
+     *
+     * @param frequencies The table frequencies, in ascending order.
+     * @param zenithAttenuations The total zenith attenuation at each frequency, in dB.
+     * @param minimumElevation The lowest elevation used for the slant path scaling.
+     * @throws std::runtime_error If the table is empty, the sizes do not match, the frequencies are not ascending, any
+     * attenuation is negative, or the minimum elevation is not between 0 and 90 degrees.
+     */
+    AtmosphericLossTable(
+        const std::vector<Frequency>& frequencies,
+        const std::vector<Unitless>& zenithAttenuations,
+        const Angle& minimumElevation = 5.0 * mp_units::angular::unit_symbols::deg
+    );
+
+    /**
+     * @brief Constructs an AtmosphericLossTable from a data file.
+     *
+     * The file holds one "frequency attenuation" pair per line, in GHz and dB, in ascending order of frequency. Empty
+     * lines and lines starting with '#' are ignored.
+     *
+     * @param file The path to the table file.
+     * @param minimumElevation The lowest elevation used for the slant path scaling.
+     * @throws std::runtime_error If the file cannot be read or is malformed, or for any reason the table itself is
+     * rejected.
+     */
+    AtmosphericLossTable(
+        const std::filesystem::path& file,
+        const Angle& minimumElevation = 5.0 * mp_units::angular::unit_symbols::deg
+    );
+
+    /**
+     * @brief Default destructor for AtmosphericLossTable.
+     */
+    ~AtmosphericLossTable() = default;
+
+    /**
+     * @brief Get the table for a sea-level ground station in a mean annual reference atmosphere.
+     *
+     * Values approximate the ITU-R P.676 total gaseous zenith attenuation for a 7.5 g/m^3 water vapour density, from 1
+     * to 50 GHz. Rain and cloud losses are not included. Supply a table for the site when precision matters.
+     *
+     * @return const AtmosphericLossTable& The reference table.
+     */
+    static const AtmosphericLossTable& standard();
+
+    /**
+     * @brief Get the zenith attenuation at a frequency.
+     *
+     * @param frequency The carrier frequency.
+     * @return Unitless The zenith attenuation, in dB.
+     * @throws std::runtime_error If the frequency is above the last table entry.
+     */
+    Unitless get_zenith_attenuation(const Frequency& frequency) const;
+
+    /**
+     * @brief Get the attenuation along a slant path.
+     *
+     * @param frequency The carrier frequency.
+     * @param elevation The elevation of the path above the local horizon.
+     * @return Unitless The slant path attenuation, in dB.
+     * @throws std::runtime_error If the frequency is above the last table entry.
+     */
+    Unitless get_attenuation(const Frequency& frequency, const Angle& elevation) const;
+
+    /**
+     * @brief Get the loss along a slant path as a linear gain.
+     *
+     * @param frequency The carrier frequency.
+     * @param elevation The elevation of the path above the local horizon.
+     * @return Gain The slant path loss, between 0 and 1.
+     * @throws std::runtime_error If the frequency is above the last table entry.
+     */
+    Gain get_loss(const Frequency& frequency, const Angle& elevation) const;
+
+    /**
+     * @brief Get the sine of the minimum elevation used for slant path scaling.
+     *
+     * @return double The sine of the minimum elevation.
+     */
+    double get_minimum_sin_elevation() const { return _minSinElevation; }
+
+  private:
+    std::vector<double> _frequencies;        //!< Table frequencies, in GHz
+    std::vector<double> _zenithAttenuations; //!< Zenith attenuation at each frequency, in dB
+    double _minSinElevation;                 //!< Sine of the minimum elevation for slant path scaling
+};
+
+} // namespace trace
+} // namespace astrea
@@ -0,0 +1,116 @@
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <numbers>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <trace/platforms/sensors/AtmosphericLossTable.hpp>
+
+using namespace astrea;
+using namespace trace;
+
+using namespace mp_units;
+using mp_units::one;
+using mp_units::angular::unit_symbols::deg;
+using mp_units::si::unit_symbols::GHz;
+
+class AtmosphericLossTableTest : public testing::Test {
+  public:
+    AtmosphericLossTableTest() = default;
+
+    void SetUp() override { temporaryFile = std::filesystem::temp_directory_path() / "astrea_atmospheric_loss_test.dat"; }
+
+    void TearDown() override { std::filesystem::remove(temporaryFile); }
+
+    std::filesystem::path temporaryFile;
+
+    const AtmosphericLossTable table = AtmosphericLossTable({ 10.0 * GHz, 20.0 * GHz, 30.0 * GHz }, { 0.1 * one, 0.3 * one, 0.2 * one });
+};
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST_F(AtmosphericLossTableTest, Constructor)
+{
+    ASSERT_NO_THROW(AtmosphericLossTable({ 10.0 * GHz }, { 0.1 * one }));
+    ASSERT_NO_THROW(AtmosphericLossTable::standard());
+
+    ASSERT_ANY_THROW(AtmosphericLossTable(std::vector<Frequency>{}, std::vector<Unitless>{}));
+    ASSERT_ANY_THROW(AtmosphericLossTable({ 10.0 * GHz, 20.0 * GHz }, { 0.1 * one }));
+    ASSERT_ANY_THROW(AtmosphericLossTable({ 20.0 * GHz, 10.0 * GHz }, { 0.1 * one, 0.2 * one }));
+    ASSERT_ANY_THROW(AtmosphericLossTable({ 10.0 * GHz }, { -0.1 * one }));
+    ASSERT_ANY_THROW(AtmosphericLossTable({ 10.0 * GHz }, { 0.1 * one }, 0.0 * deg));
+    ASSERT_ANY_THROW(AtmosphericLossTable({ 10.0 * GHz }, { 0.1 * one }, 91.0 * deg));
+}
+
+TEST_F(AtmosphericLossTableTest, ZenithAttenuation)
+{
+    // Table entries and linear interpolation between them
+    ASSERT_NEAR(table.get_zenith_attenuation(10.0 * GHz).numerical_value_in(one), 0.1, 1.0e-12);
+    ASSERT_NEAR(table.get_zenith_attenuation(15.0 * GHz).numerical_value_in(one), 0.2, 1.0e-12);
+    ASSERT_NEAR(table.get_zenith_attenuation(25.0 * GHz).numerical_value_in(one), 0.25, 1.0e-12);
+    ASSERT_NEAR(table.get_zenith_attenuation(30.0 * GHz).numerical_value_in(one), 0.2, 1.0e-12);
+
+    // Held at the first entry below the table, and rejected above it
+    ASSERT_NEAR(table.get_zenith_attenuation(5.0 * GHz).numerical_value_in(one), 0.1, 1.0e-12);
+    ASSERT_NEAR(table.get_zenith_attenuation(0.1 * GHz).numerical_value_in(one), 0.1, 1.0e-12);
+    ASSERT_NEAR(AtmosphericLossTable::standard().get_zenith_attenuation(0.4 * GHz).numerical_value_in(one), 0.035, 1.0e-12);
+    ASSERT_ANY_THROW(table.get_zenith_attenuation(35.0 * GHz));
+}
+
+TEST_F(AtmosphericLossTableTest, FromFile)
+{
+    {
+        std::ofstream file(temporaryFile);
+        file << "# GHz dB
+10.0 0.1
+
+20.0 0.3
+30.0 0.2
+";
+    }
+    const AtmosphericLossTable fromFile(temporaryFile);
+    for (const double frequency : { 5.0, 10.0, 15.0, 25.0, 30.0 }) {
+        ASSERT_EQ(fromFile.get_zenith_attenuation(frequency * GHz), table.get_zenith_attenuation(frequency * GHz));
+    }
+    ASSERT_EQ(fromFile.get_minimum_sin_elevation(), table.get_minimum_sin_elevation());
+
+    {
+        std::ofstream file(temporaryFile);
+        file << "10.0 0.1
+20.0
+";
+    }
+    ASSERT_ANY_THROW(AtmosphericLossTable{ temporaryFile });
+
+    {
+        std::ofstream file(temporaryFile);
+        file << "20.0 0.1
+10.0 0.3
+";
+    }
+    ASSERT_ANY_THROW(AtmosphericLossTable{ temporaryFile });
+    ASSERT_ANY_THROW(AtmosphericLossTable{ temporaryFile / "missing.dat" });
+}
+
+TEST_F(AtmosphericLossTableTest, SlantPath)
+{
+    // Cosecant scaling from zenith
+    ASSERT_NEAR(table.get_attenuation(20.0 * GHz, 90.0 * deg).numerical_value_in(one), 0.3, 1.0e-12);
+    ASSERT_NEAR(table.get_attenuation(20.0 * GHz, 30.0 * deg).numerical_value_in(one), 0.6, 1.0e-12);
+
+    // Clamped at the minimum elevation
+    const double minimum = 0.3 / std::sin(5.0 * std::numbers::pi / 180.0);
+    ASSERT_NEAR(table.get_attenuation(20.0 * GHz, 5.0 * deg).numerical_value_in(one), minimum, 1.0e-9);
+    ASSERT_NEAR(table.get_attenuation(20.0 * GHz, 1.0 * deg).numerical_value_in(one), minimum, 1.0e-9);
+    ASSERT_NEAR(table.get_attenuation(20.0 * GHz, -10.0 * deg).numerical_value_in(one), minimum, 1.0e-9);
+
+    // Linear loss
+    ASSERT_NEAR(table.get_loss(20.0 * GHz, 30.0 * deg).numerical_value_in(one), std::pow(10.0, -0.06), 1.0e-12);
+    ASSERT_LT(AtmosphericLossTable::standard().get_loss(22.0 * GHz, 10.0 * deg), AtmosphericLossTable::standard().get_loss(12.0 * GHz, 10.0 * deg));
+}
@@ -7,12 +7,35 @@
 namespace astrea {
 namespace trace {
 
+SensorFrame::SensorFrame(const astro::RadiusVector<astro::ECI>& position, const astro::VelocityVector<astro::ECI>& velocity) :
+    ricToEci(astro::RIC::instantaneous(position, velocity).get_dcm(astro::Date()).transpose())
+{
+}
+
+SensorFrame::SensorFrame(const astro::FrameReference& platform, const astro::Date& date) :
+    SensorFrame(platform.get_inertial_position(date), platform.get_inertial_velocity(date))
+{
+}
+
 bool Sensor::contains(const astro::RadiusVector<astro::ECI>& sensor2target, const astro::Date& date) const
 {
     if (!_parameters.get_fov()) { return false; }
-    const astro::RIC frame(_parent);
-    const astro::RadiusVector<astro::ECI> boresightEci = frame.convert_from_this_frame(_parameters.get_boresight(), date);
-    return _parameters.get_fov()->contains(boresightEci, sensor2target);
+    return contains(sensor2target, SensorFrame(*_parent, date));
+}
+
+bool Sensor::contains(const astro::RadiusVector<astro::ECI>& sensor2target, const SensorFrame& frame) const
+{
+    if (!_parameters.get_fov()) { return false; }
+
+    // The boresight is a direction, so it is only rotated into ECI
+    const astro::RadiusVector<astro::ECI> boresightEci = frame.ricToEci * _parameters.get_boresight();
+
+    // Clock angles are measured from the in-track direction
+    static const astro::RadiusVector<astro::RIC> inTrack = { 0.0 * astrea::detail::distance_unit,
+                                                             1.0 * astrea::detail::distance_unit,
+                                                             0.0 * astrea::detail::distance_unit };
+    const astro::RadiusVector<astro::ECI> referenceEci = frame.ricToEci * inTrack;
+    return _parameters.get_fov()->contains(boresightEci, referenceEci, sensor2target);
 }
 
 } // namespace trace
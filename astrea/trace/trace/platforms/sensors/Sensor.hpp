@@ -14,6 +14,8 @@
 
 #include <astro/astro.fwd.hpp>
 #include <astro/platforms/Payload.hpp>
+#include <astro/state/CartesianVector.hpp>
+#include <astro/state/frames/frames.hpp>
 #include <astro/types/typedefs.hpp>
 
 #include <trace/platforms/AccessObject.hpp>
@@ -69,6 +71,37 @@ class SensorParameters : public astro::PayloadParameters {
     const FieldOfView* _fov; //!< Field of view of the sensor, defining its coverage area
 };
 
+/**
+ * @brief Orientation of a sensor platform at a single time.
+ *
+ * Building the RIC frame needs the state of the platform, so it is built once per platform per time and shared by
+ * every sensor on that platform.
+ */
+struct SensorFrame {
+    /**
+     * @brief Default constructor for SensorFrame.
+     */
+    SensorFrame() = default;
+
+    /**
+     * @brief Constructs the frame of a platform from its inertial state.
+     *
+     * @param position The inertial position of the platform.
+     * @param velocity The inertial velocity of the platform.
+     */
+    SensorFrame(const astro::RadiusVector<astro::ECI>& position, const astro::VelocityVector<astro::ECI>& velocity);
+
+    /**
+     * @brief Constructs the frame of a platform at a given date.
+     *
+     * @param platform The platform the sensors are attached to.
+     * @param date The date of the frame.
+     */
+    SensorFrame(const astro::FrameReference& platform, const astro::Date& date);
+
+    astro::DCM<astro::RIC, astro::ECI> ricToEci; //!< Rotation from the platform RIC frame to ECI
+};
+
 /**
  * @brief Sensor class representing a sensor on a platform
  *
@@ -118,6 +151,16 @@ class Sensor : public AccessObject, public astro::Payload<Sensor, SensorParamete
      */
     bool contains(const astro::RadiusVector<astro::ECI>& sensor2target, const astro::Date& date) const;
 
+    /**
+     * @brief Check if the sensor can see a target, given the frame of its platform.
+     *
+     * @param sensor2target Vector from the sensor to the target.
+     * @param frame The frame of the parent platform at the time of the check.
+     * @return true If the target is within the sensor's field of view.
+     * @return false If the target is outside the sensor's field of view.
+     */
+    bool contains(const astro::RadiusVector<astro::ECI>& sensor2target, const SensorFrame& frame) const;
+
   private:
     /**
      * @brief Generate a hash for the sensor ID.
@@ -8,6 +8,9 @@ using namespace astrea;
 using namespace astro;
 using namespace trace;
 
+using mp_units::si::unit_symbols::km;
+using mp_units::si::unit_symbols::s;
+
 class SensorTest : public testing::Test {
   public:
     SensorTest() = default;
@@ -43,6 +46,20 @@ TEST_F(SensorTest, GetId) { ASSERT_NO_THROW(sensor->get_id()); }
 //     mp_units::si::unit_symbols::km); ASSERT_TRUE(sensor->contains(sensor2target, Date()));
 // }
 
+TEST_F(SensorTest, ContainsInFrame)
+{
+    // Radial along x and in-track along y, so the nadir boresight points along -x
+    const SensorFrame frame(RadiusVector<ECI>(7000.0 * km, 0.0 * km, 0.0 * km), VelocityVector<ECI>(0.0 * km / s, 7.5 * km / s, 0.0 * km / s));
+    ASSERT_TRUE(sensor->contains(RadiusVector<ECI>(-1000.0 * km, 100.0 * km, 0.0 * km), frame));
+    ASSERT_TRUE(sensor->contains(RadiusVector<ECI>(-1000.0 * km, 0.0 * km, -900.0 * km), frame));
+    ASSERT_FALSE(sensor->contains(RadiusVector<ECI>(1000.0 * km, 0.0 * km, 0.0 * km), frame));
+    ASSERT_FALSE(sensor->contains(RadiusVector<ECI>(0.0 * km, 1000.0 * km, 0.0 * km), frame));
+
+    // Sensors without a field of view see nothing
+    const Sensor blind(viewer, SensorParameters());
+    ASSERT_FALSE(blind.contains(RadiusVector<ECI>(-1000.0 * km, 0.0 * km, 0.0 * km), frame));
+}
+
 TEST_F(SensorTest, GetFov) { ASSERT_EQ(parameters.get_fov(), static_cast<const FieldOfView*>(&fov)); }
 
 TEST_F(SensorTest, SetFov)
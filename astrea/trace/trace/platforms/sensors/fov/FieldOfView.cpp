@@ -1,5 +1,6 @@
 #include <trace/platforms/sensors/fov/FieldOfView.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
 
@@ -19,6 +20,7 @@ namespace trace {
 
 using namespace mp_units;
 using namespace mp_units::angular;
+using mp_units::angular::unit_symbols::rad;
 
 Angle calculate_angle_between_vectors(const RadiusVector<ECI>& vector1, const RadiusVector<ECI>& vector2)
 {
@@ -32,32 +34,205 @@ Angle calculate_angle_between_vectors(const RadiusVector<ECI>& vector1, const Ra
     return acos(ratio);
 }
 
+std::vector<bool> FieldOfView::contains(
+    const RadiusVector<ECI>& boresight,
+    const RadiusVector<ECI>& reference,
+    std::span<const RadiusVector<ECI>> targets
+) const
+{
+    std::vector<bool> inside(targets.size());
+    for (std::size_t ii = 0; ii < targets.size(); ++ii) {
+        inside[ii] = contains(boresight, reference, targets[ii]);
+    }
+    return inside;
+}
+
+CircularFieldOfView::CircularFieldOfView(const Angle& halfConeAngle) :
+    _cosHalfConeAngle(std::cos(halfConeAngle.numerical_value_in(rad)))
+{
+}
+
 bool CircularFieldOfView::contains(const RadiusVector<ECI>& boresight, const RadiusVector<ECI>& target) const
 {
-    return (calculate_angle_between_vectors(boresight, target) <= _halfConeAngle);
+    const double bx = boresight.get_x().numerical_value_in(astrea::detail::distance_unit);
+    const double by = boresight.get_y().numerical_value_in(astrea::detail::distance_unit);
+    const double bz = boresight.get_z().numerical_value_in(astrea::detail::distance_unit);
+    const double tx = target.get_x().numerical_value_in(astrea::detail::distance_unit);
+    const double ty = target.get_y().numerical_value_in(astrea::detail::distance_unit);
+    const double tz = target.get_z().numerical_value_in(astrea::detail::distance_unit);
+
+    // angle <= halfCone is equivalent to b.t >= cos(halfCone)|b||t| since cos is decreasing on [0, pi]
+    const double dot = bx * tx + by * ty + bz * tz;
+    return dot >= _cosHalfConeAngle * std::sqrt((bx * bx + by * by + bz * bz) * (tx * tx + ty * ty + tz * tz));
 }
 
 
 PolygonalFieldOfView::PolygonalFieldOfView(const Angle& halfConeAngle, const int& nPoints)
 {
-    for (Angle theta = 0.0 * astrea::detail::angle_unit; theta < TWO_PI; theta += (TWO_PI / nPoints)) {
-        _points[theta] = halfConeAngle;
+    if (nPoints < 3) { throw std::runtime_error("Polygonal fields of view require at least 3 points."); }
+
+    const double cone = halfConeAngle.numerical_value_in(rad);
+    for (int ii = 0; ii < nPoints; ++ii) {
+        const double clock = 2.0 * std::numbers::pi * ii / nPoints;
+        _vertices.push_back({ std::sin(cone) * std::cos(clock), std::sin(cone) * std::sin(clock), std::cos(cone) });
+    }
+    build();
+}
+
+PolygonalFieldOfView::PolygonalFieldOfView(const Angle& halfConeWidth, const Angle& halfConeHeight)
+{
+    const double width  = halfConeWidth.numerical_value_in(rad);
+    const double height = halfConeHeight.numerical_value_in(rad);
+    if (width <= 0.0 || width >= std::numbers::pi / 2.0 || height <= 0.0 || height >= std::numbers::pi / 2.0) {
+        throw std::runtime_error("Rectangular fields of view require half-cone angles between 0 and 90 degrees.");
+    }
+
+    // Corners on the plane one unit along the boresight, in order of increasing clock angle
+    const double x = std::tan(width);
+    const double y = std::tan(height);
+    for (const auto& [cornerX, cornerY] : { std::pair{ x, y }, std::pair{ -x, y }, std::pair{ -x, -y }, std::pair{ x, -y } }) {
+        const double norm = std::sqrt(cornerX * cornerX + cornerY * cornerY + 1.0);
+        _vertices.push_back({ cornerX / norm, cornerY / norm, 1.0 / norm });
+    }
+    build();
+}
+
+PolygonalFieldOfView::PolygonalFieldOfView(const std::map<Angle, Angle>& points)
+{
+    if (!points.empty() && points.rbegin()->first - points.begin()->first >= TWO_PI) {
+        throw std::runtime_error("Polygonal field of view clock angles must lie within a single revolution.");
+    }
+    for (const auto& [clockAngle, coneAngle] : points) {
+        const double clock = clockAngle.numerical_value_in(rad);
+        const double cone  = coneAngle.numerical_value_in(rad);
+        _vertices.push_back({ std::sin(cone) * std::cos(clock), std::sin(cone) * std::sin(clock), std::cos(cone) });
+    }
+    build();
+}
+
+bool PolygonalFieldOfView::contains(const RadiusVector<ECI>& boresight, const RadiusVector<ECI>& reference, const RadiusVector<ECI>& target) const
+{
+    return contains_in_frame(build_frame(boresight, reference), target);
+}
+
+std::vector<bool> PolygonalFieldOfView::contains(
+    const RadiusVector<ECI>& boresight,
+    const RadiusVector<ECI>& reference,
+    std::span<const RadiusVector<ECI>> targets
+) const
+{
+    const Frame frame = build_frame(boresight, reference);
+
+    std::vector<bool> inside(targets.size());
+    for (std::size_t ii = 0; ii < targets.size(); ++ii) {
+        inside[ii] = contains_in_frame(frame, targets[ii]);
     }
+    return inside;
 }
 
-PolygonalFieldOfView::PolygonalFieldOfView(const Angle& halfConeWidth, const Angle& halfConeHeight, const int& nPoints)
+void PolygonalFieldOfView::build()
 {
+    const std::size_t nVertices = _vertices.size();
+    if (nVertices < 3) { throw std::runtime_error("Polygonal fields of view require at least 3 points."); }
+
+    _cosMaxCone = 1.0;
+    _cosMinCone = 0.0;
+    for (std::size_t ii = 0; ii < nVertices; ++ii) {
+        const Vector3& vertex = _vertices[ii];
+        const Vector3& next   = _vertices[(ii + 1) % nVertices];
+        if (vertex[2] <= 0.0 || vertex[2] >= 1.0) {
+            throw std::runtime_error("Polygonal field of view cone angles must be between 0 and 90 degrees.");
+        }
 
-    throw std::logic_error("This function has not been properly updated and is not currently functional.");
+        // Consecutive vertices less than 180 degrees apart in clock have a normal with a positive boresight component
+        const Vector3 normal = { vertex[1] * next[2] - vertex[2] * next[1],
+                                 vertex[2] * next[0] - vertex[0] * next[2],
+                                 vertex[0] * next[1] - vertex[1] * next[0] };
+        if (normal[2] <= 0.0) {
+            throw std::runtime_error(
+                "Polygonal field of view vertices must be ordered by clock angle and less than 180 degrees apart."
+            );
+        }
+        _edgeNormals.push_back(normal);
+        _wedgeNormals.push_back({ -vertex[1], vertex[0], 0.0 });
 
-    /*
-    const Angle sinw = sin(halfConeWidth);
-    const Angle sinh = sin(halfConeHeight);
+        // The widest cone inside the polygon stops at the nearest edge
+        const double sinDistance = normal[2] / std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+        _cosMaxCone              = std::min(_cosMaxCone, vertex[2]);
+        _cosMinCone              = std::max(_cosMinCone, std::sqrt(1.0 - sinDistance * sinDistance));
+    }
+
+    // Convex polygons have every vertex inside every edge
+    _isConvex = true;
+    for (const auto& normal : _edgeNormals) {
+        for (const auto& vertex : _vertices) {
+            if (normal[0] * vertex[0] + normal[1] * vertex[1] + normal[2] * vertex[2] < -1.0e-12) { _isConvex = false; }
+        }
+    }
+}
+
+PolygonalFieldOfView::Frame PolygonalFieldOfView::build_frame(const RadiusVector<ECI>& boresight, const RadiusVector<ECI>& reference)
+{
+    const double bx    = boresight.get_x().numerical_value_in(astrea::detail::distance_unit);
+    const double by    = boresight.get_y().numerical_value_in(astrea::detail::distance_unit);
+    const double bz    = boresight.get_z().numerical_value_in(astrea::detail::distance_unit);
+    const double bNorm = std::sqrt(bx * bx + by * by + bz * bz);
+    const Vector3 z    = { bx / bNorm, by / bNorm, bz / bNorm };
 
-    for (Angle theta = 0.0; theta < TWO_PI; theta += (TWO_PI/nPoints)) {
-        points[theta] = 0.0;
+    // Remove the boresight component from the reference
+    const double rx    = reference.get_x().numerical_value_in(astrea::detail::distance_unit);
+    const double ry    = reference.get_y().numerical_value_in(astrea::detail::distance_unit);
+    const double rz    = reference.get_z().numerical_value_in(astrea::detail::distance_unit);
+    const double rDot  = rx * z[0] + ry * z[1] + rz * z[2];
+    Vector3 x          = { rx - rDot * z[0], ry - rDot * z[1], rz - rDot * z[2] };
+    const double xNorm = std::sqrt(x[0] * x[0] + x[1] * x[1] + x[2] * x[2]);
+    if (xNorm <= 1.0e-12 * std::sqrt(rx * rx + ry * ry + rz * rz)) {
+        throw std::runtime_error("The field of view reference direction cannot be parallel to the boresight.");
     }
-    */
+    x = { x[0] / xNorm, x[1] / xNorm, x[2] / xNorm };
+
+    const Vector3 y = { z[1] * x[2] - z[2] * x[1], z[2] * x[0] - z[0] * x[2], z[0] * x[1] - z[1] * x[0] };
+    return { x, y, z };
+}
+
+bool PolygonalFieldOfView::contains_direction(const double& x, const double& y, const double& z) const
+{
+    // Quick checks against the cones bounding the polygon
+    if (z <= 0.0) { return false; }
+    const double norm = std::sqrt(x * x + y * y + z * z);
+    if (z < _cosMaxCone * norm) { return false; }
+    if (z >= _cosMinCone * norm) { return true; }
+
+    if (_isConvex) {
+        for (const auto& normal : _edgeNormals) {
+            if (normal[0] * x + normal[1] * y + normal[2] * z < 0.0) { return false; }
+        }
+        return true;
+    }
+
+    // Otherwise, only the edge in the same clock wedge as the target matters
+    const std::size_t nVertices = _vertices.size();
+    for (std::size_t ii = 0; ii < nVertices; ++ii) {
+        const Vector3& wedge = _wedgeNormals[ii];
+        const Vector3& next  = _wedgeNormals[(ii + 1) % nVertices];
+        if (wedge[0] * x + wedge[1] * y >= 0.0 && next[0] * x + next[1] * y < 0.0) {
+            const Vector3& normal = _edgeNormals[ii];
+            return normal[0] * x + normal[1] * y + normal[2] * z >= 0.0;
+        }
+    }
+    return false;
+}
+
+bool PolygonalFieldOfView::contains_in_frame(const Frame& frame, const RadiusVector<ECI>& target) const
+{
+    const double tx = target.get_x().numerical_value_in(astrea::detail::distance_unit);
+    const double ty = target.get_y().numerical_value_in(astrea::detail::distance_unit);
+    const double tz = target.get_z().numerical_value_in(astrea::detail::distance_unit);
+    return contains_direction(
+        frame[0][0] * tx + frame[0][1] * ty + frame[0][2] * tz,
+        frame[1][0] * tx + frame[1][1] * ty + frame[1][2] * tz,
+        frame[2][0] * tx + frame[2][1] * ty + frame[2][2] * tz
+    );
 }
 
 } // namespace trace
@@ -10,8 +10,11 @@
  */
 #pragma once
 
+#include <array>
+#include <map>
 #include <numbers>
-#include <unordered_map>
+#include <span>
+#include <vector>
 
 #include <units/units.hpp>
 
@@ -52,17 +55,36 @@ class FieldOfView {
     ~FieldOfView() = default;
 
     /**
-     * @brief Checks if a target is within the field of view.
+     * @brief Checks if a target is within the field of view, given the direction of zero clock angle.
+     *
+     * The reference fixes the roll of the field of view about the boresight, so it is required for any field of view
+     * that is not symmetric about the boresight. Fields of view that are symmetric ignore it.
      *
      * @param boresight The boresight vector of the sensor.
+     * @param reference The direction of zero clock angle about the boresight.
      * @param target The target vector to check.
      * @return true If the target is within the field of view.
      * @return false If the target is outside the field of view.
      */
     virtual bool contains(
         const astro::CartesianVector<Distance, astro::EarthCenteredInertial>& boresight,
+        const astro::CartesianVector<Distance, astro::EarthCenteredInertial>& reference,
         const astro::CartesianVector<Distance, astro::EarthCenteredInertial>& target
     ) const = 0;
+
+    /**
+     * @brief Checks which of a set of targets are within the field of view.
+     *
+     * @param boresight The boresight vector of the sensor.
+     * @param reference The direction of zero clock angle about the boresight.
+     * @param targets The target vectors to check.
+     * @return std::vector<bool> Whether each target is within the field of view.
+     */
+    virtual std::vector<bool> contains(
+        const astro::CartesianVector<Distance, astro::EarthCenteredInertial>& boresight,
+        const astro::CartesianVector<Distance, astro::EarthCenteredInertial>& reference,
+        std::span<const astro::CartesianVector<Distance, astro::EarthCenteredInertial>> targets
+    ) const;
 };
 
 /**
@@ -77,19 +99,21 @@ class CircularFieldOfView : public FieldOfView {
      *
      * @param halfConeAngle The half-cone angle defining the field of view.
      */
-    CircularFieldOfView(const Angle& halfConeAngle = std::numbers::pi / 4.0 * mp_units::angular::unit_symbols::rad) :
-        _halfConeAngle(halfConeAngle)
-    {
-    }
+    CircularFieldOfView(const Angle& halfConeAngle = std::numbers::pi / 4.0 * mp_units::angular::unit_symbols::rad);
 
     /**
      * @brief Default destructor for CircularFieldOfView.
      */
     ~CircularFieldOfView() = default;
 
+    using FieldOfView::contains;
+
     /**
      * @brief Checks if a target is within the circular field of view.
      *
+     * Compares the dot product against the precomputed cosine of the half-cone angle, so no inverse trig is needed. The
+     * cone is symmetric about the boresight, so no reference direction is needed.
+     *
      * @param boresight The boresight vector of the sensor.
      * @param target The target vector to check.
      * @return true If the target is within the circular field of view.
@@ -100,14 +124,38 @@ class CircularFieldOfView : public FieldOfView {
         const astro::CartesianVector<Distance, astro::EarthCenteredInertial>& target
     ) const;
 
+    /**
+     * @brief Checks if a target is within the circular field of view. The reference is ignored.
+     *
+     * @param boresight The boresight vector of the sensor.
+     * @param reference The direction of zero clock angle about the boresight, unused.
+     * @param target The target vector to check.
+     * @return true If the target is within the circular field of view.
+     * @return false If the target is outside the circular field of view.
+     */
+    bool contains(
+        const astro::CartesianVector<Distance, astro::EarthCenteredInertial>& boresight,
+        const astro::CartesianVector<Distance, astro::EarthCenteredInertial>& reference,
+        const astro::CartesianVector<Distance, astro::EarthCenteredInertial>& target
+    ) const
+    {
+        return contains(boresight, target);
+    }
+
   private:
-    Angle _halfConeAngle; // Half-cone angle defining the circular field of view
+    double _cosHalfConeAngle; //!< Cosine of the half-cone angle defining the circular field of view
 };
 
 /**
  * @brief Polygonal field of view implementation.
  *
- * This class represents a polygonal field of view defined by a set of points.
+ * This class represents a polygonal field of view on the unit sphere. Vertices are given as (clock, cone) angle pairs
+ * about the boresight, where clock angles are measured from a reference direction toward the boresight cross the
+ * reference. Edges are great circle arcs between consecutive vertices.
+ *
+ * The polygon must be star-shaped about the boresight. All edge normals are precomputed, so containment only needs
+ * dot products and a single square root. Containment depends on the roll of the polygon, so every check takes the
+ * reference direction.
  */
 class PolygonalFieldOfView : public FieldOfView {
   public:
@@ -116,27 +164,29 @@ class PolygonalFieldOfView : public FieldOfView {
      *
      * @param halfConeAngle The half-cone angle defining the field of view.
      * @param nPoints The number of points defining the polygon.
+     * @throws std::runtime_error If the polygon is invalid.
      */
     PolygonalFieldOfView(const Angle& halfConeAngle = std::numbers::pi / 4.0 * mp_units::angular::unit_symbols::rad, const int& nPoints = 72);
 
     /**
-     * @brief Constructor for PolygonalFieldOfView with specified half-cone width and height.
+     * @brief Constructor for a rectangular PolygonalFieldOfView with specified half-cone width and height.
+     *
+     * The width is measured along the reference direction and the height perpendicular to it, so a push-broom sensor
+     * is a rectangle with a small half-cone width.
      *
      * @param halfConeWidth The half-cone width angle.
      * @param halfConeHeight The half-cone height angle.
-     * @param nPoints The number of points defining the polygon.
+     * @throws std::runtime_error If either angle is not between 0 and 90 degrees.
      */
-    PolygonalFieldOfView(const Angle& halfConeWidth, const Angle& halfConeHeight, const int& nPoints = 72);
+    PolygonalFieldOfView(const Angle& halfConeWidth, const Angle& halfConeHeight);
 
     /**
      * @brief Constructor for PolygonalFieldOfView with a set of points.
      *
-     * @param points A map of angles defining the polygonal field of view.
+     * @param points A map of clock angles to cone angles defining the vertices of the polygon.
+     * @throws std::runtime_error If the polygon is invalid.
      */
-    PolygonalFieldOfView(const std::unordered_map<Angle, Angle>& points) :
-        _points(points)
-    {
-    }
+    PolygonalFieldOfView(const std::map<Angle, Angle>& points);
 
     /**
      * @brief Default destructor for PolygonalFieldOfView.
@@ -144,23 +194,95 @@ class PolygonalFieldOfView : public FieldOfView {
     ~PolygonalFieldOfView() = default;
 
     /**
-     * @brief Checks if a target is within the polygonal field of view.
+     * @brief Checks if a target is within the polygonal field of view, given the direction of zero clock angle.
      *
      * @param boresight The boresight vector of the sensor.
+     * @param reference The direction of zero clock angle about the boresight.
      * @param target The target vector to check.
      * @return true If the target is within the polygonal field of view.
      * @return false If the target is outside the polygonal field of view.
      */
     bool contains(
         const astro::CartesianVector<Distance, astro::EarthCenteredInertial>& boresight,
+        const astro::CartesianVector<Distance, astro::EarthCenteredInertial>& reference,
         const astro::CartesianVector<Distance, astro::EarthCenteredInertial>& target
-    ) const
-    {
-        return false;
-    };
+    ) const;
+
+    /**
+     * @brief Checks which of a set of targets are within the polygonal field of view.
+     *
+     * The sensor frame is built once for the whole set.
+     *
+     * @param boresight The boresight vector of the sensor.
+     * @param reference The direction of zero clock angle about the boresight.
+     * @param targets The target vectors to check.
+     * @return std::vector<bool> Whether each target is within the polygonal field of view.
+     */
+    std::vector<bool> contains(
+        const astro::CartesianVector<Distance, astro::EarthCenteredInertial>& boresight,
+        const astro::CartesianVector<Distance, astro::EarthCenteredInertial>& reference,
+        std::span<const astro::CartesianVector<Distance, astro::EarthCenteredInertial>> targets
+    ) const;
+
+    /**
+     * @brief Returns whether the polygon is convex.
+     *
+     * @return true If the polygon is convex.
+     * @return false If the polygon is only star-shaped about the boresight.
+     */
+    bool is_convex() const { return _isConvex; }
 
   private:
-    std::unordered_map<Angle, Angle> _points; // Map of angles defining the polygonal field of view
+    using Vector3 = std::array<double, 3>;  //!< Raw double 3-vector
+    using Frame   = std::array<Vector3, 3>; //!< Sensor frame axes, with the boresight last
+
+    std::vector<Vector3> _vertices;     //!< Unit vertex directions in the sensor frame
+    std::vector<Vector3> _edgeNormals;  //!< Normals of the edge from each vertex to the next, pointing inward
+    std::vector<Vector3> _wedgeNormals; //!< Normals of the plane through the boresight and each vertex
+    double _cosMaxCone = 0.0;           //!< Cosine of the largest vertex cone angle
+    double _cosMinCone = 1.0;           //!< Cosine of the largest cone fully inside the polygon
+    bool _isConvex     = true;          //!< Whether every edge test can be applied directly
+
+    /**
+     * @brief Precomputes the edge and wedge normals from the vertices.
+     *
+     * @throws std::runtime_error If there are fewer than 3 vertices, a cone angle is not between 0 and 90 degrees, or
+     * consecutive clock angles are 180 degrees or more apart.
+     */
+    void build();
+
+    /**
+     * @brief Builds the sensor frame from the boresight and the reference direction.
+     *
+     * @param boresight The boresight vector of the sensor.
+     * @param reference The direction of zero clock angle about the boresight.
+     * @return Frame The sensor frame axes, expressed in the inertial frame.
+     */
+    static Frame build_frame(
+        const astro::CartesianVector<Distance, astro::EarthCenteredInertial>& boresight,
+        const astro::CartesianVector<Distance, astro::EarthCenteredInertial>& reference
+    );
+
+    /**
+     * @brief Checks if a direction in the sensor frame is within the polygon.
+     *
+     * @param x The x component of the direction.
+     * @param y The y component of the direction.
+     * @param z The z component of the direction, along the boresight.
+     * @return true If the direction is within the polygon.
+     * @return false If the direction is outside the polygon.
+     */
+    bool contains_direction(const double& x, const double& y, const double& z) const;
+
+    /**
+     * @brief Checks if a target is within the polygon, given the sensor frame.
+     *
+     * @param frame The sensor frame axes.
+     * @param target The target vector to check.
+     * @return true If the target is within the polygon.
+     * @return false If the target is outside the polygon.
+     */
+    bool contains_in_frame(const Frame& frame, const astro::CartesianVector<Distance, astro::EarthCenteredInertial>& target) const;
 };
 
 } // namespace trace
@@ -1,3 +1,5 @@
+#include <cmath>
+
 #include <gtest/gtest.h>
 
 #include <astro/astro.hpp>
@@ -8,6 +10,10 @@ using namespace astrea;
 using namespace astro;
 using namespace trace;
 
+using mp_units::angular::unit_symbols::deg;
+using mp_units::angular::unit_symbols::rad;
+using mp_units::si::unit_symbols::km;
+
 class FieldOfViewTest : public testing::Test {
   public:
     FieldOfViewTest() = default;
@@ -37,7 +43,7 @@ class FieldOfViewTest : public testing::Test {
 
     Angle halfCone;
     CircularFieldOfView circFov;
-    std::unordered_map<Angle, Angle> points;
+    std::map<Angle, Angle> points;
     PolygonalFieldOfView polyFovPoints;
 };
 
@@ -56,8 +62,14 @@ TEST_F(FieldOfViewTest, CircularFieldOfViewConstructor)
 TEST_F(FieldOfViewTest, PolygonalFieldOfViewConstructors)
 {
     ASSERT_NO_THROW(PolygonalFieldOfView(halfCone, 8));
-    ASSERT_ANY_THROW(PolygonalFieldOfView(halfCone, halfCone, 8)); // Not implemented
+    ASSERT_NO_THROW(PolygonalFieldOfView(halfCone, halfCone));
     ASSERT_NO_THROW(PolygonalFieldOfView(points));
+
+    ASSERT_ANY_THROW(PolygonalFieldOfView(halfCone, 2));                         // Too few points
+    ASSERT_ANY_THROW(PolygonalFieldOfView(2.0 * halfCone, halfCone));            // Not less than 90 degrees
+    ASSERT_ANY_THROW(PolygonalFieldOfView(std::map<Angle, Angle>{ { 0.0 * rad, halfCone },
+                                                                  { 0.5 * rad, halfCone },
+                                                                  { 1.0 * rad, halfCone } })); // Gap of 180 degrees or more
 }
 
 TEST_F(FieldOfViewTest, CircularFieldOfViewContains)
@@ -66,8 +78,96 @@ TEST_F(FieldOfViewTest, CircularFieldOfViewContains)
     ASSERT_FALSE(circFov.contains(boresight, targetOutside));
 }
 
+TEST_F(FieldOfViewTest, CircularFieldOfViewCones)
+{
+    // Containment must not depend on vector lengths
+    const RadiusVector<ECI> farInside(9000.0 * km, 1000.0 * km, 0.0 * km);
+    ASSERT_TRUE(circFov.contains(1000.0 * boresight, farInside));
+
+    // Cones wider than a hemisphere contain targets behind the boresight plane
+    const CircularFieldOfView wideFov(120.0 * deg);
+    const RadiusVector<ECI> behind(-0.4 * km, 1.0 * km, 0.0 * km);
+    const RadiusVector<ECI> opposite(-1.0 * km, 0.1 * km, 0.0 * km);
+    ASSERT_TRUE(wideFov.contains(boresight, targetOutside));
+    ASSERT_TRUE(wideFov.contains(boresight, behind));
+    ASSERT_FALSE(wideFov.contains(boresight, opposite));
+
+    // Angles just either side of the half-cone
+    const CircularFieldOfView narrowFov(10.0 * deg);
+    const double justInside  = std::tan(9.99 * std::numbers::pi / 180.0);
+    const double justOutside = std::tan(10.01 * std::numbers::pi / 180.0);
+    ASSERT_TRUE(narrowFov.contains(boresight, RadiusVector<ECI>(1.0 * km, justInside * km, 0.0 * km)));
+    ASSERT_FALSE(narrowFov.contains(boresight, RadiusVector<ECI>(1.0 * km, justOutside * km, 0.0 * km)));
+}
+
 TEST_F(FieldOfViewTest, PolygonalFieldOfViewContains)
 {
-    ASSERT_FALSE(polyFovPoints.contains(boresight, targetInside));
-    ASSERT_FALSE(polyFovPoints.contains(boresight, targetOutside));
+    const RadiusVector<ECI> reference(0.0 * km, 1.0 * km, 0.0 * km);
+    ASSERT_TRUE(polyFovPoints.contains(boresight, reference, targetInside));
+    ASSERT_FALSE(polyFovPoints.contains(boresight, reference, targetOutside));
+    ASSERT_TRUE(polyFovPoints.is_convex());
+
+    // Inside the circle inscribed in a regular polygon is always inside the polygon
+    const PolygonalFieldOfView octagon(halfCone, 8);
+    const double inscribed = std::atan(std::tan(std::numbers::pi / 4.0) * std::cos(std::numbers::pi / 8.0)) - 1.0e-6;
+    for (int ii = 0; ii < 64; ++ii) {
+        const double clock = ii / 64.0 * 2.0 * std::numbers::pi;
+        const RadiusVector<ECI> target(
+            std::cos(inscribed) * km, std::sin(inscribed) * std::cos(clock) * km, std::sin(inscribed) * std::sin(clock) * km
+        );
+        ASSERT_TRUE(octagon.contains(boresight, reference, target));
+        ASSERT_FALSE(octagon.contains(boresight, reference, -target));
+    }
+}
+
+TEST_F(FieldOfViewTest, RectangularFieldOfView)
+{
+    // A push-broom with a narrow width along the reference and a wide height across it
+    const PolygonalFieldOfView pushBroom(1.0 * deg, 30.0 * deg);
+    const RadiusVector<ECI> reference(0.0 * km, 0.0 * km, 1.0 * km);
+    const RadiusVector<ECI> alongWidth(1.0 * km, 0.0 * km, 0.1 * km);  // ~5.7 degrees along the reference
+    const RadiusVector<ECI> alongHeight(1.0 * km, 0.5 * km, 0.0 * km); // ~26.6 degrees across it
+    const RadiusVector<ECI> corner(1.0 * km, 0.5 * km, 0.01 * km);
+
+    ASSERT_FALSE(pushBroom.contains(boresight, reference, alongWidth));
+    ASSERT_TRUE(pushBroom.contains(boresight, reference, alongHeight));
+    ASSERT_TRUE(pushBroom.contains(boresight, reference, corner));
+
+    // Rotating the reference rotates the field of view
+    const RadiusVector<ECI> rotatedReference(0.0 * km, 1.0 * km, 0.0 * km);
+    ASSERT_TRUE(pushBroom.contains(boresight, rotatedReference, alongWidth));
+    ASSERT_FALSE(pushBroom.contains(boresight, rotatedReference, alongHeight));
+
+    ASSERT_ANY_THROW(pushBroom.contains(boresight, boresight, alongWidth)); // Reference along the boresight
+}
+
+TEST_F(FieldOfViewTest, NonConvexFieldOfView)
+{
+    // A four-pointed star, alternating between wide and narrow cone angles
+    std::map<Angle, Angle> star;
+    for (int ii = 0; ii < 8; ++ii) {
+        star[ii / 8.0 * TWO_PI] = (ii % 2 == 0) ? 40.0 * deg : 10.0 * deg;
+    }
+    const PolygonalFieldOfView starFov(star);
+    ASSERT_FALSE(starFov.is_convex());
+
+    const RadiusVector<ECI> reference(0.0 * km, 1.0 * km, 0.0 * km);
+    const RadiusVector<ECI> alongPoint(1.0 * km, 0.5 * km, 0.0 * km);   // ~26.6 degrees toward a point
+    const RadiusVector<ECI> betweenPoints(1.0 * km, 0.35 * km, 0.35 * km); // ~26.3 degrees between two points
+    ASSERT_TRUE(starFov.contains(boresight, reference, alongPoint));
+    ASSERT_FALSE(starFov.contains(boresight, reference, betweenPoints));
+}
+
+TEST_F(FieldOfViewTest, BatchedContains)
+{
+    const RadiusVector<ECI> reference(0.0 * km, 0.0 * km, 1.0 * km);
+    const std::vector<RadiusVector<ECI>> targets = { targetInside, targetOutside, boresight, -boresight };
+
+    const std::vector<bool> polyInside = polyFovPoints.contains(boresight, reference, targets);
+    const std::vector<bool> circInside = circFov.contains(boresight, reference, targets);
+    ASSERT_EQ(polyInside, std::vector<bool>({ true, false, true, false }));
+    ASSERT_EQ(circInside, std::vector<bool>({ true, false, true, false }));
+    for (std::size_t ii = 0; ii < targets.size(); ++ii) {
+        ASSERT_EQ(polyInside[ii], polyFovPoints.contains(boresight, reference, targets[ii]));
+    }
 }
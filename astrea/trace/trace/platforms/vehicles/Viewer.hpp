@@ -64,6 +64,26 @@ class Viewer : public astro::Spacecraft, public AccessObject, public SensorPlatf
      */
     ~Viewer() = default;
 
+    /**
+     * @brief Copy constructor for Viewer.
+     */
+    Viewer(const Viewer&) = default;
+
+    /**
+     * @brief Move constructor for Viewer.
+     */
+    Viewer(Viewer&&) = default;
+
+    /**
+     * @brief Copy assignment operator for Viewer.
+     */
+    Viewer& operator=(const Viewer&) = default;
+
+    /**
+     * @brief Move assignment operator for Viewer.
+     */
+    Viewer& operator=(Viewer&&) = default;
+
     /**
      * @brief Get the viewer ID.
      *
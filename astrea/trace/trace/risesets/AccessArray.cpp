@@ -22,10 +22,44 @@ void AccessArray::erase(const std::size_t& senderId, const std::size_t& receiver
 
 std::size_t AccessArray::size() const { return _accesses.size(); }
 
+void AccessArray::reserve(const std::size_t& nPairs) { _accesses.reserve(nPairs); }
+
+void AccessArray::merge(AccessArray&& shard)
+{
+    // Take the shard's table whole, unless space has already been reserved here that moving it would throw away
+    if (_accesses.empty() && _accesses.bucket_count() <= shard._accesses.bucket_count()) {
+        _accesses = std::move(shard._accesses);
+        shard._accesses.clear();
+        return;
+    }
+
+    for (auto& [ids, risesets] : shard._accesses) {
+        const auto [access, inserted] = _accesses.try_emplace(ids, std::move(risesets));
+        if (!inserted) { access->second |= risesets; }
+    }
+    shard._accesses.clear();
+}
+
+AccessArray AccessArray::merge(std::vector<AccessArray>&& shards)
+{
+    std::size_t nPairs = 0;
+    for (const auto& shard : shards) {
+        nPairs += shard.size();
+    }
+
+    AccessArray merged;
+    merged.reserve(nPairs);
+    for (auto& shard : shards) {
+        merged.merge(std::move(shard));
+    }
+    return merged;
+}
+
 AccessArray& AccessArray::operator|(const AccessArray& other)
 {
     for (const auto& [ids, risesets] : other) {
-        if (contains(ids)) { _accesses[ids] = (risesets | _accesses[ids]); } // TODO: Should this modify in place? Copy?
+        const auto [access, inserted] = _accesses.try_emplace(ids, risesets);
+        if (!inserted) { access->second |= risesets; }
     }
     return *this;
 }
@@ -39,8 +73,14 @@ AccessArray AccessArray::operator|(const AccessArray& other) const
 
 AccessArray& AccessArray::operator&(const AccessArray& other)
 {
-    for (const auto& [ids, risesets] : other) {
-        if (contains(ids)) { _accesses[ids] = (risesets & _accesses[ids]); }
+    for (auto access = _accesses.begin(); access != _accesses.end();) {
+        const auto match = other._accesses.find(access->first);
+        if (match != other._accesses.end()) { access->second &= match->second; }
+
+        if (match == other._accesses.end() || access->second.size() == 0) { access = _accesses.erase(access); }
+        else {
+            ++access;
+        }
     }
     return *this;
 }
@@ -11,7 +11,10 @@
  */
 #pragma once
 
-#include <parallel_hashmap/btree.h>
+#include <cstdint>
+#include <vector>
+
+#include <parallel_hashmap/phmap.h>
 
 #include <trace/risesets/RiseSetArray.hpp>
 
@@ -74,12 +77,25 @@ template <>
 struct std::hash<astrea::trace::IdPair> {
     /**
      * @brief Computes a hash value for an IdPair.
+     *
+     * Both IDs are mixed through a 64-bit finalizer, so (a, b) and (b, a) hash differently and small sequential IDs
+     * spread over every bit. An XOR of the IDs sends every symmetric pair to the same value.
+     *
      * @param k The IdPair to hash.
      * @return A hash value for the IdPair.
      */
     std::size_t operator()(const astrea::trace::IdPair& k) const
     {
-        return (std::hash<std::size_t>()(k.sender)) ^ (std::hash<std::size_t>()(k.receiver));
+        std::uint64_t hash = static_cast<std::uint64_t>(k.sender) * 0x9E3779B97F4A7C15ull;
+        hash ^= static_cast<std::uint64_t>(k.receiver) + 0x632BE59BD9B4E019ull + (hash << 6) + (hash >> 2);
+
+        // splitmix64 finalizer
+        hash ^= hash >> 30;
+        hash *= 0xBF58476D1CE4E5B9ull;
+        hash ^= hash >> 27;
+        hash *= 0x94D049BB133111EBull;
+        hash ^= hash >> 31;
+        return static_cast<std::size_t>(hash);
     }
 };
 
@@ -109,6 +125,9 @@ namespace trace {
 /**
  * @brief Represents a collection of access times indexed by sender and receiver IDs.
  * This class provides methods to manipulate and query access times for different sender-receiver pairs.
+ *
+ * Pairs are stored in a flat, open-addressed hash map, so iteration order is unspecified. Inserting a pair may
+ * invalidate references to other pairs.
  */
 class AccessArray {
 
@@ -167,9 +186,38 @@ class AccessArray {
      */
     std::size_t size() const;
 
+    /**
+     * @brief Reserves space for a number of pairs so inserting them does not rehash.
+     *
+     * @param nPairs The number of pairs to reserve space for.
+     */
+    void reserve(const std::size_t& nPairs);
+
+    /**
+     * @brief Merges a shard into this AccessArray, moving its accesses in.
+     *
+     * Pairs only in the shard are moved over, and pairs in both are replaced by the union of their accesses. Space
+     * reserved on this AccessArray is kept.
+     *
+     * @param shard The AccessArray to merge in. It is left empty.
+     */
+    void merge(AccessArray&& shard);
+
+    /**
+     * @brief Merges a set of shards, such as per-thread results, into a single AccessArray.
+     *
+     * Space for every pair is reserved up front, so the result is only sized once.
+     *
+     * @param shards The AccessArrays to merge. They are left empty.
+     * @return AccessArray The union of every shard.
+     */
+    static AccessArray merge(std::vector<AccessArray>&& shards);
+
     /**
      * @brief Union operator for AccessArray.
      *
+     * Pairs in either AccessArray are kept, and pairs in both hold the union of their accesses.
+     *
      * @param other The AccessArray to union with.
      */
     AccessArray& operator|(const AccessArray& other);
@@ -185,6 +233,9 @@ class AccessArray {
     /**
      * @brief Intersection operator for AccessArray.
      *
+     * Only pairs in both AccessArrays are kept, holding the intersection of their accesses. Pairs whose accesses do
+     * not overlap are removed.
+     *
      * @param other The AccessArray to intersect with.
      */
     AccessArray& operator&(const AccessArray& other);
@@ -197,15 +248,20 @@ class AccessArray {
      */
     AccessArray operator&(const AccessArray& other) const;
 
+    /**
+     * @brief Map type used to store accesses.
+     */
+    using AccessMap = phmap::flat_hash_map<IdPair, RiseSetArray, std::hash<IdPair>>;
+
     /**
      * @brief Iterator type for AccessArray.
      */
-    using iterator = phmap::btree_map<IdPair, RiseSetArray>::iterator;
+    using iterator = AccessMap::iterator;
 
     /**
      * @brief Const iterator type for AccessArray.
      */
-    using const_iterator = phmap::btree_map<IdPair, RiseSetArray>::const_iterator;
+    using const_iterator = AccessMap::const_iterator;
 
     /**
      * @brief Returns an iterator to the beginning of the AccessArray.
@@ -250,7 +306,7 @@ class AccessArray {
     const_iterator cend() const { return _accesses.cend(); }
 
   private:
-    phmap::btree_map<IdPair, RiseSetArray> _accesses; //!< A map that associates IdPairs with their corresponding RiseSetArrays.
+    AccessMap _accesses; //!< A map that associates IdPairs with their corresponding RiseSetArrays.
 };
 
 } // namespace trace
@@ -1,3 +1,5 @@
+#include <vector>
+
 #include <gtest/gtest.h>
 #include <trace/risesets/AccessArray.hpp>
 #include <units/units.hpp>
@@ -79,6 +81,67 @@ TEST_F(AccessArrayTest, IntersectionOperator)
     ASSERT_NO_THROW(static_cast<const AccessArray&>(access1) & access2);
 }
 
+TEST_F(AccessArrayTest, UnionKeepsEveryPair)
+{
+    AccessArray other;
+    other[senderId, receiverId] = arr2;
+    other[receiverId, senderId] = arr2;
+
+    const AccessArray res = static_cast<const AccessArray&>(access1) | other;
+    ASSERT_EQ(res.size(), 2);
+    ASSERT_EQ(res.at(senderId, receiverId), (arr1 | arr2));
+    ASSERT_EQ(res.at(receiverId, senderId), arr2);
+}
+
+TEST_F(AccessArrayTest, IntersectionDropsPairs)
+{
+    AccessArray other;
+    other[senderId, receiverId] = RiseSetArray({ t1, t3 });
+    other[receiverId, senderId] = arr2;
+
+    AccessArray lhs             = access1;
+    lhs[senderId, senderId]     = arr1; // Only in lhs
+    lhs[receiverId, senderId]   = arr1; // In both, but no overlap
+
+    const AccessArray res = static_cast<const AccessArray&>(lhs) & other;
+    ASSERT_EQ(res.size(), 1);
+    ASSERT_EQ(res.at(senderId, receiverId), arr1);
+}
+
+TEST_F(AccessArrayTest, Merge)
+{
+    std::vector<AccessArray> shards(3);
+    shards[0][senderId, receiverId] = arr1;
+    shards[1][senderId, receiverId] = arr2;
+    shards[2][receiverId, senderId] = arr2;
+
+    const AccessArray merged = AccessArray::merge(std::move(shards));
+    ASSERT_EQ(merged.size(), 2);
+    ASSERT_EQ(merged.at(senderId, receiverId), (arr1 | arr2));
+    ASSERT_EQ(merged.at(receiverId, senderId), arr2);
+    ASSERT_EQ(shards[1].size(), 0);
+
+    AccessArray empty;
+    empty.merge(std::move(access1));
+    ASSERT_EQ(empty.at(senderId, receiverId), arr1);
+    ASSERT_EQ(access1.size(), 0);
+
+    AccessArray reserved;
+    reserved.reserve(100);
+    reserved.merge(std::move(empty));
+    ASSERT_EQ(reserved.at(senderId, receiverId), arr1);
+    ASSERT_EQ(empty.size(), 0);
+}
+
+TEST_F(AccessArrayTest, Hash)
+{
+    // Symmetric and diagonal pairs, which all collide under an XOR of the IDs
+    const std::hash<IdPair> hash;
+    ASSERT_NE(hash(IdPair(1, 2)), hash(IdPair(2, 1)));
+    ASSERT_NE(hash(IdPair(1, 1)), hash(IdPair(2, 2)));
+    ASSERT_EQ(hash(IdPair(1, 2)), hash(IdPair(1, 2)));
+}
+
 TEST_F(AccessArrayTest, Iterators)
 {
     ASSERT_NO_THROW(for (auto& access : access1){});
@@ -13,6 +13,12 @@ RiseSetArray::RiseSetArray(const std::vector<Time>& risesets)
     _risesets = risesets;
 }
 
+RiseSetArray::RiseSetArray(std::vector<Time>&& risesets)
+{
+    validate_risesets(risesets);
+    _risesets = std::move(risesets);
+}
+
 
 RiseSetArray::RiseSetArray(const RiseSetArray& other) :
     _risesets(other._risesets)
@@ -52,17 +58,34 @@ RiseSetArray& RiseSetArray::operator=(const RiseSetArray& other) { return *this
 
 RiseSetArray RiseSetArray::operator|(const RiseSetArray& other) const { return riseset_union(*this, other); }
 
-RiseSetArray& RiseSetArray::operator|=(const RiseSetArray& other) { return *this = riseset_union(*this, other); }
+RiseSetArray& RiseSetArray::operator|=(const RiseSetArray& other)
+{
+    if (other.size() == 0) { return *this; }
+    detail::riseset_union(*this, other, compound_scratch());
+    _risesets.swap(compound_scratch());
+    return *this;
+}
 
 RiseSetArray RiseSetArray::operator&(const RiseSetArray& other) const { return riseset_intersection(*this, other); }
 
-RiseSetArray& RiseSetArray::operator&=(const RiseSetArray& other) { return *this = riseset_intersection(*this, other); }
+RiseSetArray& RiseSetArray::operator&=(const RiseSetArray& other)
+{
+    if (other.size() == 0) {
+        _risesets.clear();
+        return *this;
+    }
+    detail::riseset_intersection(*this, other, compound_scratch());
+    _risesets.swap(compound_scratch());
+    return *this;
+}
 
 RiseSetArray RiseSetArray::operator-(const RiseSetArray& other) const { return riseset_difference(*this, other); }
 
 RiseSetArray& RiseSetArray::operator-=(const RiseSetArray& other)
 {
-    *this = riseset_difference(*this, other);
+    if (other.size() == 0) { return *this; }
+    detail::riseset_difference(*this, other, compound_scratch());
+    _risesets.swap(compound_scratch());
     return *this;
 }
 
@@ -71,6 +94,14 @@ const Time& RiseSetArray::operator[](const std::size_t& ind) const { return _ris
 
 std::size_t RiseSetArray::size() const { return _risesets.size(); }
 
+std::vector<Time>& RiseSetArray::compound_scratch()
+{
+    // The old storage is swapped into the scratch buffer after each compound assignment, so repeated updates reuse
+    // the same two allocations
+    thread_local std::vector<Time> scratch;
+    return scratch;
+}
+
 void RiseSetArray::validate_risesets(const std::vector<Time>& risesets) const
 {
     if (risesets.size() % 2) {
@@ -110,15 +141,14 @@ void RiseSetArray::prepend(const Time& rise, const Time& set)
     }
     validate_riseset(rise, set);
 
-    _risesets.insert(_risesets.begin(), set);
-    _risesets.insert(_risesets.begin(), rise);
+    _risesets.insert(_risesets.begin(), { rise, set });
 }
 
 void RiseSetArray::insert(const Time& rise, const Time& set)
 {
     validate_riseset(rise, set);
 
-    *this = (*this) | RiseSetArray({ rise, set });
+    *this |= RiseSetArray({ rise, set });
 }
 
 std::vector<std::string> RiseSetArray::to_string_vector() const
@@ -58,6 +58,13 @@ class RiseSetArray {
      */
     RiseSetArray(const std::vector<Time>& risesets);
 
+    /**
+     * @brief Constructs a RiseSetArray by taking ownership of a vector of Time objects.
+     *
+     * @param risesets A vector of Time objects representing rise and set times.
+     */
+    RiseSetArray(std::vector<Time>&& risesets);
+
     /**
      * @brief Copy constructor for RiseSetArray.
      *
@@ -299,6 +306,13 @@ class RiseSetArray {
      */
     void validate_risesets(const std::vector<Time>& risesets) const;
 
+    /**
+     * @brief Get the per-thread buffer the compound assignment operators sweep into before swapping it in.
+     *
+     * @return std::vector<Time>& The scratch buffer.
+     */
+    static std::vector<Time>& compound_scratch();
+
     /**
      * @brief Converts a Time object to a formatted string.
      *
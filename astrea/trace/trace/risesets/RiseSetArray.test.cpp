@@ -103,6 +103,42 @@ TEST_F(RiseSetArrayTest, IntersectionOperator) { ASSERT_NO_THROW(arr1 & arr2); }
 
 TEST_F(RiseSetArrayTest, InPlaceIntersectionOperator) { ASSERT_NO_THROW(arr1 &= arr2); }
 
+TEST_F(RiseSetArrayTest, InPlaceOperatorsMatchBinary)
+{
+    using mp_units::si::unit_symbols::s;
+    const RiseSetArray a({ 0.0 * s, 2.0 * s, 4.0 * s, 6.0 * s, 8.0 * s, 10.0 * s });
+    const RiseSetArray b({ 1.0 * s, 5.0 * s, 6.0 * s, 7.0 * s, 9.0 * s, 12.0 * s });
+
+    // Repeated updates sweep through the shared scratch buffer, so each result must be independent of the last
+    for (std::size_t ii = 0; ii < 3; ++ii) {
+        RiseSetArray result(a);
+        result |= b;
+        ASSERT_EQ(result, a | b);
+
+        result = a;
+        result &= b;
+        ASSERT_EQ(result, a & b);
+
+        result = a;
+        result -= b;
+        ASSERT_EQ(result, a - b);
+    }
+
+    // Empty operands and self-assignment
+    RiseSetArray result(a);
+    result |= RiseSetArray();
+    ASSERT_EQ(result, a);
+    result -= RiseSetArray();
+    ASSERT_EQ(result, a);
+    result |= result;
+    ASSERT_EQ(result, a);
+    result -= result;
+    ASSERT_EQ(result.size(), 0);
+    result = a;
+    result &= RiseSetArray();
+    ASSERT_EQ(result.size(), 0);
+}
+
 TEST_F(RiseSetArrayTest, Gap)
 {
     auto arr = arr1 | arr2;
@@ -0,0 +1,199 @@
+#include <trace/risesets/VisibilityBitset.hpp>
+
+#include <bit>
+#include <stdexcept>
+
+namespace astrea {
+namespace trace {
+
+VisibilityBitset::VisibilityBitset(const std::size_t& nSamples, const bool& value) :
+    _nSamples(nSamples),
+    _words((nSamples + WORD_SIZE - 1) / WORD_SIZE, value ? ~std::uint64_t(0) : std::uint64_t(0))
+{
+    clear_tail();
+}
+
+VisibilityBitset::VisibilityBitset(const RiseSetArray& risesets, std::span<const Time> times) :
+    VisibilityBitset(times.size())
+{
+    // Both the times and the rise/set pairs are sorted, so a single merge pass covers every sample
+    std::size_t iTime = 0;
+    for (std::size_t ii = 0; ii < risesets.size(); ii += 2) {
+        while (iTime < times.size() && times[iTime] < risesets[ii]) {
+            ++iTime;
+        }
+        while (iTime < times.size() && times[iTime] <= risesets[ii + 1]) {
+            set(iTime);
+            ++iTime;
+        }
+    }
+}
+
+void VisibilityBitset::set(const std::size_t& index, const bool& value)
+{
+    const std::uint64_t mask = std::uint64_t(1) << (index % WORD_SIZE);
+    if (value) { _words[index / WORD_SIZE] |= mask; }
+    else {
+        _words[index / WORD_SIZE] &= ~mask;
+    }
+}
+
+std::size_t VisibilityBitset::count() const
+{
+    std::size_t count = 0;
+    for (const auto& word : _words) {
+        count += std::popcount(word);
+    }
+    return count;
+}
+
+bool VisibilityBitset::any() const
+{
+    for (const auto& word : _words) {
+        if (word) { return true; }
+    }
+    return false;
+}
+
+VisibilityBitset VisibilityBitset::operator|(const VisibilityBitset& other) const
+{
+    VisibilityBitset result = *this;
+    return result |= other;
+}
+
+VisibilityBitset& VisibilityBitset::operator|=(const VisibilityBitset& other)
+{
+    validate_size(other);
+    for (std::size_t ii = 0; ii < _words.size(); ++ii) {
+        _words[ii] |= other._words[ii];
+    }
+    return *this;
+}
+
+VisibilityBitset VisibilityBitset::operator&(const VisibilityBitset& other) const
+{
+    VisibilityBitset result = *this;
+    return result &= other;
+}
+
+VisibilityBitset& VisibilityBitset::operator&=(const VisibilityBitset& other)
+{
+    validate_size(other);
+    for (std::size_t ii = 0; ii < _words.size(); ++ii) {
+        _words[ii] &= other._words[ii];
+    }
+    return *this;
+}
+
+VisibilityBitset VisibilityBitset::operator~() const
+{
+    VisibilityBitset result = *this;
+    for (auto& word : result._words) {
+        word = ~word;
+    }
+    result.clear_tail();
+    return result;
+}
+
+RiseSetArray VisibilityBitset::to_risesets(std::span<const Time> times) const
+{
+    if (times.size() != _nSamples) {
+        throw std::runtime_error("The number of times must match the number of samples in the VisibilityBitset.");
+    }
+
+    std::vector<Time> risesets;
+    std::size_t index = 0;
+    while (index < _nSamples) {
+        // Skip to the start of the next run, a whole word at a time
+        std::uint64_t word = _words[index / WORD_SIZE] >> (index % WORD_SIZE);
+        if (!word) {
+            index = (index / WORD_SIZE + 1) * WORD_SIZE;
+            continue;
+        }
+        index += std::countr_zero(word);
+
+        // Find the end of the run
+        std::size_t end = index;
+        while (end < _nSamples) {
+            const std::size_t nOnes = std::countr_one(_words[end / WORD_SIZE] >> (end % WORD_SIZE));
+            end += nOnes;
+            if ((end % WORD_SIZE) != 0 || nOnes == 0) { break; }
+        }
+        if (end > _nSamples) { end = _nSamples; }
+
+        // Single-sample runs have no duration
+        if (end - index > 1) {
+            risesets.push_back(times[index]);
+            risesets.push_back(times[end - 1]);
+        }
+        index = end;
+    }
+    return RiseSetArray(std::move(risesets));
+}
+
+void VisibilityBitset::validate_size(const VisibilityBitset& other) const
+{
+    if (_nSamples != other._nSamples) {
+        throw std::runtime_error("VisibilityBitsets must be on time grids of the same size.");
+    }
+}
+
+void VisibilityBitset::clear_tail()
+{
+    if (_nSamples % WORD_SIZE) { _words.back() &= (std::uint64_t(1) << (_nSamples % WORD_SIZE)) - 1; }
+}
+
+
+std::vector<std::size_t> count_visible(std::span<const VisibilityBitset> bitsets)
+{
+    if (bitsets.empty()) { return {}; }
+
+    std::vector<std::size_t> counts(bitsets.front().size(), 0);
+    for (const auto& bitset : bitsets) {
+        if (bitset.size() != counts.size()) {
+            throw std::runtime_error("VisibilityBitsets must be on time grids of the same size.");
+        }
+
+        // Only visit the set bits
+        const auto& words = bitset.get_words();
+        for (std::size_t ii = 0; ii < words.size(); ++ii) {
+            std::uint64_t word = words[ii];
+            while (word) {
+                ++counts[ii * VisibilityBitset::WORD_SIZE + std::countr_zero(word)];
+                word &= word - 1;
+            }
+        }
+    }
+    return counts;
+}
+
+VisibilityBitset at_least_visible(std::span<const VisibilityBitset> bitsets, const std::size_t& minCount)
+{
+    if (bitsets.empty()) { return VisibilityBitset(); }
+
+    // The common cases reduce to word-wise operations
+    if (minCount == 1) {
+        VisibilityBitset result = bitsets.front();
+        for (const auto& bitset : bitsets.subspan(1)) {
+            result |= bitset;
+        }
+        return result;
+    }
+    else if (minCount == bitsets.size()) {
+        VisibilityBitset result = bitsets.front();
+        for (const auto& bitset : bitsets.subspan(1)) {
+            result &= bitset;
+        }
+        return result;
+    }
+
+    const std::vector<std::size_t> counts = count_visible(bitsets);
+    VisibilityBitset result(counts.size());
+    for (std::size_t ii = 0; ii < counts.size(); ++ii) {
+        if (counts[ii] >= minCount) { result.set(ii); }
+    }
+    return result;
+}
+
+} // namespace trace
+} // namespace astrea
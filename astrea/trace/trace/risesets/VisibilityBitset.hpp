@@ -0,0 +1,211 @@
+/**
+ * @file VisibilityBitset.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief Contains the VisibilityBitset class, which represents visibility on a fixed time grid as packed bits.
+ * @version 0.1
+ * @date 2025-08-06
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <units/units.hpp>
+
+#include <trace/risesets/RiseSetArray.hpp>
+
+namespace astrea {
+namespace trace {
+
+/**
+ * @brief Represents visibility on a fixed time grid as one bit per sample.
+ *
+ * This sits alongside RiseSetArray for studies that evaluate many targets on a common grid. Set operations work on
+ * 64 samples per word, in loops the compiler can vectorize, and counts use hardware popcount.
+ */
+class VisibilityBitset {
+  public:
+    /**
+     * @brief Default constructor for VisibilityBitset.
+     *
+     * Initializes an empty VisibilityBitset.
+     */
+    VisibilityBitset() = default;
+
+    /**
+     * @brief Constructs a VisibilityBitset with every sample set to the same value.
+     *
+     * @param nSamples The number of samples on the time grid.
+     * @param value The initial visibility of every sample.
+     */
+    VisibilityBitset(const std::size_t& nSamples, const bool& value = false);
+
+    /**
+     * @brief Constructs a VisibilityBitset by sampling a RiseSetArray.
+     *
+     * A sample is visible if its time lies within a rise/set pair, inclusive of both ends.
+     *
+     * @param risesets The RiseSetArray to sample.
+     * @param times The sample times, in ascending order.
+     */
+    VisibilityBitset(const RiseSetArray& risesets, std::span<const Time> times);
+
+    /**
+     * @brief Destructor for VisibilityBitset.
+     */
+    ~VisibilityBitset() = default;
+
+    /**
+     * @brief Returns the number of samples.
+     *
+     * @return std::size_t The number of samples.
+     */
+    std::size_t size() const { return _nSamples; }
+
+    /**
+     * @brief Returns the visibility of a sample.
+     *
+     * @param index The index of the sample.
+     * @return bool True if the sample is visible.
+     */
+    bool operator[](const std::size_t& index) const { return (_words[index / WORD_SIZE] >> (index % WORD_SIZE)) & 1; }
+
+    /**
+     * @brief Sets the visibility of a sample.
+     *
+     * @param index The index of the sample.
+     * @param value The visibility of the sample.
+     */
+    void set(const std::size_t& index, const bool& value = true);
+
+    /**
+     * @brief Returns the number of visible samples.
+     *
+     * @return std::size_t The number of visible samples.
+     */
+    std::size_t count() const;
+
+    /**
+     * @brief Checks if any sample is visible.
+     *
+     * @return true If at least one sample is visible.
+     * @return false If no samples are visible.
+     */
+    bool any() const;
+
+    /**
+     * @brief Equality operator to compare two VisibilityBitset objects.
+     *
+     * @param other The other VisibilityBitset to compare against.
+     * @return true If the two VisibilityBitset objects are equal.
+     * @return false If the two VisibilityBitset objects are not equal.
+     */
+    bool operator==(const VisibilityBitset& other) const = default;
+
+    /**
+     * @brief Union operator to combine two VisibilityBitset objects.
+     *
+     * @param other The other VisibilityBitset to combine with this one.
+     * @return VisibilityBitset A new VisibilityBitset containing the union of the two.
+     * @throws std::runtime_error If the two VisibilityBitset objects have different sizes.
+     */
+    VisibilityBitset operator|(const VisibilityBitset& other) const;
+
+    /**
+     * @brief In-place union operator to combine two VisibilityBitset objects.
+     *
+     * @param other The other VisibilityBitset to combine with this one.
+     * @return VisibilityBitset& Reference to this VisibilityBitset after the union.
+     * @throws std::runtime_error If the two VisibilityBitset objects have different sizes.
+     */
+    VisibilityBitset& operator|=(const VisibilityBitset& other);
+
+    /**
+     * @brief Intersection operator to find common visibility between two VisibilityBitset objects.
+     *
+     * @param other The other VisibilityBitset to intersect with this one.
+     * @return VisibilityBitset A new VisibilityBitset containing the intersection of the two.
+     * @throws std::runtime_error If the two VisibilityBitset objects have different sizes.
+     */
+    VisibilityBitset operator&(const VisibilityBitset& other) const;
+
+    /**
+     * @brief In-place intersection operator to find common visibility between two VisibilityBitset objects.
+     *
+     * @param other The other VisibilityBitset to intersect with this one.
+     * @return VisibilityBitset& Reference to this VisibilityBitset after the intersection.
+     * @throws std::runtime_error If the two VisibilityBitset objects have different sizes.
+     */
+    VisibilityBitset& operator&=(const VisibilityBitset& other);
+
+    /**
+     * @brief Complement operator.
+     *
+     * @return VisibilityBitset A new VisibilityBitset visible wherever this one is not.
+     */
+    VisibilityBitset operator~() const;
+
+    /**
+     * @brief Converts the VisibilityBitset to a RiseSetArray.
+     *
+     * Each run of visible samples becomes a rise/set pair from the first to the last sample of the run. Runs of a
+     * single sample are dropped, matching the rise/set output of the access analysis.
+     *
+     * @param times The sample times, in ascending order.
+     * @return RiseSetArray The rise/set pairs of the visible runs.
+     * @throws std::runtime_error If the number of times does not match the number of samples.
+     */
+    RiseSetArray to_risesets(std::span<const Time> times) const;
+
+    /**
+     * @brief Returns the packed words backing the VisibilityBitset.
+     *
+     * @return const std::vector<std::uint64_t>& The packed words, 64 samples per word with the first sample in the lowest bit.
+     */
+    const std::vector<std::uint64_t>& get_words() const { return _words; }
+
+    static constexpr std::size_t WORD_SIZE = 64; //!< Number of samples per word
+
+  private:
+    std::size_t _nSamples = 0;         //!< Number of samples on the time grid
+    std::vector<std::uint64_t> _words; //!< Packed visibility, 64 samples per word
+
+    /**
+     * @brief Validates that another VisibilityBitset is on a grid of the same size.
+     *
+     * @param other The other VisibilityBitset.
+     * @throws std::runtime_error If the two VisibilityBitset objects have different sizes.
+     */
+    void validate_size(const VisibilityBitset& other) const;
+
+    /**
+     * @brief Clears the unused bits of the last word so counts and comparisons stay exact.
+     */
+    void clear_tail();
+};
+
+/**
+ * @brief Counts how many VisibilityBitsets are visible at each sample.
+ *
+ * @param bitsets The VisibilityBitsets, all on the same time grid.
+ * @return std::vector<std::size_t> The number of visible VisibilityBitsets at each sample.
+ * @throws std::runtime_error If the VisibilityBitsets have different sizes.
+ */
+std::vector<std::size_t> count_visible(std::span<const VisibilityBitset> bitsets);
+
+/**
+ * @brief Finds the samples where at least a given number of VisibilityBitsets are visible.
+ *
+ * @param bitsets The VisibilityBitsets, all on the same time grid.
+ * @param minCount The minimum number of visible VisibilityBitsets.
+ * @return VisibilityBitset The samples where at least minCount VisibilityBitsets are visible.
+ * @throws std::runtime_error If the VisibilityBitsets have different sizes.
+ */
+VisibilityBitset at_least_visible(std::span<const VisibilityBitset> bitsets, const std::size_t& minCount);
+
+} // namespace trace
+} // namespace astrea
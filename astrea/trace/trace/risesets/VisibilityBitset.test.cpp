@@ -0,0 +1,203 @@
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <trace/trace.hpp>
+
+using namespace astrea;
+using namespace trace;
+
+using namespace mp_units;
+using mp_units::si::unit_symbols::s;
+
+
+TimeVector make_times(const std::size_t& nSamples)
+{
+    TimeVector times;
+    for (std::size_t ii = 0; ii < nSamples; ++ii) {
+        times.push_back(static_cast<double>(ii) * s);
+    }
+    return times;
+}
+
+VisibilityBitset random_bitset(std::mt19937& generator, const std::size_t& nSamples)
+{
+    std::bernoulli_distribution visible(0.5);
+
+    VisibilityBitset bitset(nSamples);
+    for (std::size_t ii = 0; ii < nSamples; ++ii) {
+        bitset.set(ii, visible(generator));
+    }
+    return bitset;
+}
+
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+
+TEST(VisibilityBitset, Construction)
+{
+    const VisibilityBitset empty;
+    ASSERT_EQ(empty.size(), 0);
+    ASSERT_FALSE(empty.any());
+
+    // Span several words with a partial last word
+    const VisibilityBitset hidden(130);
+    ASSERT_EQ(hidden.size(), 130);
+    ASSERT_EQ(hidden.count(), 0);
+    ASSERT_FALSE(hidden.any());
+
+    const VisibilityBitset visible(130, true);
+    ASSERT_EQ(visible.count(), 130);
+    ASSERT_TRUE(visible.any());
+    ASSERT_EQ(visible.get_words().size(), 3);
+}
+
+TEST(VisibilityBitset, SetAndGet)
+{
+    VisibilityBitset bitset(100);
+    bitset.set(0);
+    bitset.set(63);
+    bitset.set(64);
+    bitset.set(99);
+    ASSERT_TRUE(bitset[0]);
+    ASSERT_TRUE(bitset[63]);
+    ASSERT_TRUE(bitset[64]);
+    ASSERT_TRUE(bitset[99]);
+    ASSERT_FALSE(bitset[1]);
+    ASSERT_EQ(bitset.count(), 4);
+
+    bitset.set(63, false);
+    ASSERT_FALSE(bitset[63]);
+    ASSERT_EQ(bitset.count(), 3);
+}
+
+TEST(VisibilityBitset, Operators)
+{
+    std::mt19937 generator(42);
+    const VisibilityBitset a = random_bitset(generator, 200);
+    const VisibilityBitset b = random_bitset(generator, 200);
+
+    const VisibilityBitset unionAB        = a | b;
+    const VisibilityBitset intersectionAB = a & b;
+    const VisibilityBitset complementA    = ~a;
+    for (std::size_t ii = 0; ii < 200; ++ii) {
+        ASSERT_EQ(unionAB[ii], a[ii] || b[ii]);
+        ASSERT_EQ(intersectionAB[ii], a[ii] && b[ii]);
+        ASSERT_EQ(complementA[ii], !a[ii]);
+    }
+
+    // The complement must not count the unused bits of the last word
+    ASSERT_EQ(a.count() + complementA.count(), 200);
+    ASSERT_EQ(~complementA, a);
+
+    VisibilityBitset c = a;
+    c |= b;
+    ASSERT_EQ(c, unionAB);
+
+    c = a;
+    c &= b;
+    ASSERT_EQ(c, intersectionAB);
+}
+
+TEST(VisibilityBitset, SizeMismatch)
+{
+    VisibilityBitset a(10);
+    const VisibilityBitset b(11);
+    ASSERT_ANY_THROW(a | b);
+    ASSERT_ANY_THROW(a & b);
+    ASSERT_ANY_THROW(a |= b);
+    ASSERT_ANY_THROW(a &= b);
+    ASSERT_ANY_THROW(a.to_risesets(make_times(11)));
+
+    const std::vector<VisibilityBitset> bitsets = { a, b, a };
+    ASSERT_ANY_THROW(count_visible(bitsets));
+    ASSERT_ANY_THROW(at_least_visible(bitsets, 2));
+}
+
+TEST(VisibilityBitset, FromRiseSets)
+{
+    const TimeVector times = make_times(10);
+    const RiseSetArray risesets({ 1.5 * s, 3.0 * s, 5.0 * s, 5.5 * s, 8.0 * s, 20.0 * s });
+
+    // Bounds are inclusive, and intervals between samples are not visible
+    const VisibilityBitset bitset(risesets, times);
+    const std::vector<bool> expected = { false, false, true, true, false, true, false, false, true, true };
+    for (std::size_t ii = 0; ii < times.size(); ++ii) {
+        ASSERT_EQ(bitset[ii], expected[ii]);
+    }
+}
+
+TEST(VisibilityBitset, ToRiseSets)
+{
+    const TimeVector times = make_times(10);
+
+    VisibilityBitset bitset(10);
+    bitset.set(0);
+    bitset.set(1);
+    bitset.set(2);
+    bitset.set(5); // single samples have no duration
+    bitset.set(8);
+    bitset.set(9);
+
+    const RiseSetArray expected({ 0.0 * s, 2.0 * s, 8.0 * s, 9.0 * s });
+    ASSERT_EQ(bitset.to_risesets(times), expected);
+    ASSERT_EQ(VisibilityBitset(10).to_risesets(times), RiseSetArray());
+}
+
+TEST(VisibilityBitset, RoundTrip)
+{
+    // Runs crossing word boundaries must come back as a single rise/set pair
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<std::size_t> nSamples(1, 300);
+    for (std::size_t ii = 0; ii < 1000; ++ii) {
+        const std::size_t n    = nSamples(generator);
+        const TimeVector times = make_times(n);
+
+        // Drop single-sample runs so every sample survives the conversion
+        VisibilityBitset bitset = random_bitset(generator, n);
+        for (std::size_t jj = 0; jj < n; ++jj) {
+            const bool before = jj > 0 && bitset[jj - 1];
+            const bool after  = jj + 1 < n && bitset[jj + 1];
+            if (!before && !after) { bitset.set(jj, false); }
+        }
+
+        const RiseSetArray risesets = bitset.to_risesets(times);
+        ASSERT_EQ(VisibilityBitset(risesets, times), bitset);
+        ASSERT_EQ(VisibilityBitset(risesets, times).to_risesets(times), risesets);
+    }
+}
+
+TEST(VisibilityBitset, CountVisible)
+{
+    std::mt19937 generator(42);
+    std::vector<VisibilityBitset> bitsets;
+    for (std::size_t ii = 0; ii < 7; ++ii) {
+        bitsets.push_back(random_bitset(generator, 150));
+    }
+
+    const std::vector<std::size_t> counts = count_visible(bitsets);
+    ASSERT_EQ(counts.size(), 150);
+    for (std::size_t ii = 0; ii < 150; ++ii) {
+        std::size_t expected = 0;
+        for (const auto& bitset : bitsets) {
+            expected += bitset[ii];
+        }
+        ASSERT_EQ(counts[ii], expected);
+    }
+
+    for (std::size_t minCount = 1; minCount <= bitsets.size(); ++minCount) {
+        const VisibilityBitset atLeast = at_least_visible(bitsets, minCount);
+        for (std::size_t ii = 0; ii < 150; ++ii) {
+            ASSERT_EQ(atLeast[ii], counts[ii] >= minCount);
+        }
+    }
+
+    ASSERT_TRUE(count_visible({}).empty());
+    ASSERT_EQ(at_least_visible({}, 1).size(), 0);
+}
@@ -1,6 +1,9 @@
 #include <trace/risesets/riseset_utils.hpp>
 
-#include <limits>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 #include <mp-units/systems/si.h>
@@ -13,245 +16,177 @@
 namespace astrea {
 namespace trace {
 
-RiseSetArray riseset_union(const RiseSetArray& a, const RiseSetArray& b)
+namespace {
+
+/**
+ * @brief Sweep the boundaries of two RiseSetArrays in a single linear pass.
+ *
+ * All boundaries at the same time are consumed together before the predicate is evaluated, so touching intervals
+ * are merged and zero-length intervals are never emitted. A boundary is only written when the predicate changes, so
+ * the output never needs duplicates removed.
+ *
+ * @tparam Predicate_T Callable taking whether the sweep is inside a and inside b.
+ * @param a The first RiseSetArray.
+ * @param b The second RiseSetArray.
+ * @param inside The predicate deciding whether a time is part of the result.
+ * @param c The rise/set times of the result. Existing contents are replaced, but the capacity is kept.
+ */
+template <class Predicate_T>
+void sweep(const RiseSetArray& a, const RiseSetArray& b, Predicate_T&& inside, std::vector<Time>& c)
 {
-    // If one is empty, union is the other
-    if (a.size() == 0) { return b; }
-    else if (b.size() == 0) {
-        return a;
-    }
-
-    // Setup
-    std::size_t aIdx = 0;
-    std::size_t bIdx = 0;
-    std::size_t cIdx = 0;
-
     const std::size_t lenA = a.size();
     const std::size_t lenB = b.size();
 
-    // Max size
-    std::vector<Time> c;
-    c.resize(lenA + lenB);
+    c.clear();
+    c.reserve(lenA + lenB);
 
-    // Loop and insert
+    std::size_t aIdx = 0;
+    std::size_t bIdx = 0;
+    bool state       = false;
     while (aIdx < lenA || bIdx < lenB) {
+        const Time time = (bIdx == lenB || (aIdx < lenA && a[aIdx] <= b[bIdx])) ? a[aIdx] : b[bIdx];
 
-        // Compare values
-        Time diff;
-        if (aIdx >= lenA) { diff = 1 * detail::time_unit; } // unit is arbitrary here
-        else if (bIdx >= lenB) {
-            diff = -1 * detail::time_unit;
-        }
-        else {
-            diff = a[aIdx] - b[bIdx];
-        }
+        // Values within a RiseSetArray are strictly increasing, so each array has at most one boundary here
+        if (aIdx < lenA && a[aIdx] == time) { ++aIdx; }
+        if (bIdx < lenB && b[bIdx] == time) { ++bIdx; }
 
-        // a > b
-        if (diff < 0 * detail::time_unit) {
-            if (!(bIdx & 1)) {
-                c[cIdx] = a[aIdx];
-                ++cIdx;
-            }
-            ++aIdx;
-        }
-        // b > a
-        else if (diff > 0 * detail::time_unit) {
-            if (!(aIdx & 1)) {
-                c[cIdx] = b[bIdx];
-                ++cIdx;
-            }
-            ++bIdx;
+        // An odd index means the sweep is between a rise and a set
+        const bool next = inside(aIdx & 1, bIdx & 1);
+        if (next != state) {
+            c.push_back(time);
+            state = next;
         }
-        // a = b
-        else {
-            if ((aIdx & 1) == (bIdx & 1)) {
-                c[cIdx] = b[bIdx];
-                ++cIdx;
-            }
-            ++bIdx;
-            ++aIdx;
-        }
-    }
-
-    // Get length
-    const std::size_t lenC = (cIdx % 2) ? cIdx + 1 : cIdx;
-    c.resize(lenC);
-
-    // Remove duplicates
-    const auto cc = c;
-    for (std::size_t ii = c.size() - 1; ii > 0; --ii) {
-        if (c[ii] == c[ii - 1]) { c.erase(c.begin() + ii); }
     }
-
-    return RiseSetArray(c);
 }
 
-RiseSetArray riseset_intersection(const RiseSetArray& a, const RiseSetArray& b)
+// Predicates for the two-array sweeps
+bool in_union(const bool& inA, const bool& inB) { return inA || inB; }
+bool in_intersection(const bool& inA, const bool& inB) { return inA && inB; }
+bool in_difference(const bool& inA, const bool& inB) { return inA && !inB; }
+
+/**
+ * @brief Sweep the boundaries of many RiseSetArrays, keeping times where at least minCount are active.
+ *
+ * The arrays are merged through a min-heap of cursors, so the sweep is O(n log k) for n total boundaries across k
+ * arrays.
+ *
+ * @param arrays The RiseSetArrays to sweep.
+ * @param minCount The minimum number of active arrays for a time to be part of the result.
+ * @return std::vector<Time> The rise/set times of the result.
+ */
+std::vector<Time> sweep(const std::vector<RiseSetArray>& arrays, const std::size_t& minCount)
 {
-    // If one is empty, intersection is empty
-    if (a.size() == 0 || b.size() == 0) { return RiseSetArray(); }
-
-    // Setup
-    std::size_t aIdx = 0;
-    std::size_t bIdx = 0;
-    std::size_t cIdx = 0;
+    using Cursor = std::pair<Time, std::size_t>;
+    std::priority_queue<Cursor, std::vector<Cursor>, std::greater<Cursor>> heap;
 
-    const std::size_t lenA = a.size();
-    const std::size_t lenB = b.size();
+    std::size_t total = 0;
+    for (std::size_t ii = 0; ii < arrays.size(); ++ii) {
+        if (arrays[ii].size() > 0) { heap.emplace(arrays[ii][0], ii); }
+        total += arrays[ii].size();
+    }
 
-    // Max size
     std::vector<Time> c;
-    c.resize(lenA + lenB);
+    c.reserve(total);
 
-    // Loop and insert
-    while (aIdx < lenA && bIdx < lenB) {
+    std::vector<std::size_t> indices(arrays.size(), 0);
+    std::size_t count = 0;
+    bool state        = false;
+    while (!heap.empty()) {
+        const Time time = heap.top().first;
 
-        // Left and right interval bounds
-        const Time left  = (a[aIdx] < b[bIdx]) ? b[bIdx] : a[aIdx];
-        const Time right = (a[aIdx + 1] > b[bIdx + 1]) ? b[bIdx + 1] : a[aIdx + 1];
+        // Consume every boundary at this time before checking the count
+        while (!heap.empty() && heap.top().first == time) {
+            const std::size_t iArray = heap.top().second;
+            heap.pop();
+
+            const std::size_t index = indices[iArray]++;
+            if (index & 1) { --count; }
+            else {
+                ++count;
+            }
 
-        // Only store if it's valid
-        if (left < right) {
-            c[cIdx]     = left;
-            c[cIdx + 1] = right;
-            cIdx += 2;
+            if (index + 1 < arrays[iArray].size()) { heap.emplace(arrays[iArray][index + 1], iArray); }
         }
 
-        // Increment
-        if (a[aIdx + 1] <= b[bIdx + 1]) { aIdx += 2; }
-        else {
-            bIdx += 2;
+        const bool next = (count >= minCount);
+        if (next != state) {
+            c.push_back(time);
+            state = next;
         }
     }
-    c.resize(cIdx);
-
-    return RiseSetArray(c);
+    return c;
 }
 
+} // namespace
 
-RiseSetArray riseset_difference(const RiseSetArray& a0, const RiseSetArray& b0)
-{
-    // c = a - b
-
-    // Check for empty arrays
-    if (a0.size() == 0 || b0.size() == 0) { return a0; }
-
-    // Setup
-    std::size_t aIdx = 0;
-    std::size_t bIdx = 0;
-    std::size_t cIdx = 0;
-
-    const std::size_t lenA = a0.size();
-    const std::size_t lenB = b0.size();
-
-    RiseSetArray a = a0;
-    RiseSetArray b = b0;
 
-    // Max size
+RiseSetArray riseset_union(const RiseSetArray& a, const RiseSetArray& b)
+{
+    // If one is empty, union is the other
+    if (a.size() == 0) { return b; }
+    else if (b.size() == 0) {
+        return a;
+    }
     std::vector<Time> c;
-    c.resize(lenA + lenB);
-
-    // Loop and insert
-    while (aIdx < lenA) {
-
-        /*
-
-        1)
-        a:      |-----|
-        b:   |------------|
-
-        2)
-        a:   |------------|
-        b:      |-----|
-
-        3)
-        a:   |------|
-        b:      |-----|
-
-            3.5)
-            a:   |------|
-            b:             |-----|
-
-        4)
-        a:      |-----|
-        b:   |------|
-
-            4.5)
-            a:             |-----|
-            b:   |------|
-
-        */
-
-        // TODO: There's gotta be a way to optimize this
-        if (bIdx == lenB) {
-            // Done with b, store everything else
-            c[cIdx]     = a[aIdx];
-            c[cIdx + 1] = a[aIdx + 1];
-            cIdx += 2;
-            aIdx += 2;
-        }
-        else if (a[aIdx] >= b[bIdx] && a[aIdx + 1] <= b[bIdx + 1]) {
-            // Case 1: b envelopes a
-
-            // truncate b
-            b[bIdx] = a[aIdx + 1];
+    sweep(a, b, in_union, c);
+    return RiseSetArray(std::move(c));
+}
 
-            // Move to next a riseset
-            aIdx += 2;
-        }
-        else if (a[aIdx] < b[bIdx] && a[aIdx + 1] > b[bIdx + 1]) {
-            // Case 2: a envelopes b
+RiseSetArray riseset_intersection(const RiseSetArray& a, const RiseSetArray& b)
+{
+    // If one is empty, intersection is empty
+    if (a.size() == 0 || b.size() == 0) { return RiseSetArray(); }
+    std::vector<Time> c;
+    sweep(a, b, in_intersection, c);
+    return RiseSetArray(std::move(c));
+}
 
-            // Store a rise to b rise
-            c[cIdx]     = a[aIdx];
-            c[cIdx + 1] = b[bIdx];
-            cIdx += 2;
+RiseSetArray riseset_difference(const RiseSetArray& a, const RiseSetArray& b)
+{
+    // Check for empty arrays
+    if (a.size() == 0 || b.size() == 0) { return a; }
+    std::vector<Time> c;
+    sweep(a, b, in_difference, c);
+    return RiseSetArray(std::move(c));
+}
 
-            // truncate a
-            a[aIdx] = b[bIdx + 1];
+RiseSetArray riseset_union(const std::vector<RiseSetArray>& arrays) { return riseset_coverage(arrays, 1); }
 
-            // Move to next b riseset
-            bIdx += 2;
-        }
-        else if (a[aIdx] < b[bIdx] && a[aIdx + 1] <= b[bIdx + 1]) {
-            // Case 3: a starts, b ends
+RiseSetArray riseset_intersection(const std::vector<RiseSetArray>& arrays)
+{
+    if (arrays.empty()) { return RiseSetArray(); }
+    for (const auto& array : arrays) {
+        if (array.size() == 0) { return RiseSetArray(); }
+    }
+    return riseset_coverage(arrays, arrays.size());
+}
 
-            c[cIdx] = a[aIdx];
-            if (b[bIdx] > a[aIdx + 1]) { // Case 3.5: b completely after a
-                c[cIdx + 1] = a[aIdx + 1];
-            }
-            else {
-                // Store a rise to b rise
-                c[cIdx + 1] = b[bIdx];
+RiseSetArray riseset_coverage(const std::vector<RiseSetArray>& arrays, const std::size_t& minCount)
+{
+    if (minCount == 0) { throw std::runtime_error("RiseSetArray coverage requires a minimum count of at least one."); }
+    if (minCount > arrays.size()) { return RiseSetArray(); }
+    return RiseSetArray(sweep(arrays, minCount));
+}
 
-                // truncate b
-                b[bIdx] = a[aIdx + 1];
-            }
 
-            // Increment
-            cIdx += 2;
-            aIdx += 2;
-        }
-        else if (a[aIdx] >= b[bIdx] && a[aIdx + 1] > b[bIdx + 1]) {
-            // Case 4: b starts, a ends
+namespace detail {
 
-            if (a[aIdx] > b[bIdx + 1]) {
-                // Case 4.5: a completely after b
-            }
-            else {
-                // truncate a
-                a[aIdx] = b[bIdx + 1];
-            }
+void riseset_union(const RiseSetArray& a, const RiseSetArray& b, std::vector<Time>& risesets)
+{
+    sweep(a, b, in_union, risesets);
+}
 
-            // Move to next b riseset
-            bIdx += 2;
-        }
-    }
-    c.resize(cIdx);
+void riseset_intersection(const RiseSetArray& a, const RiseSetArray& b, std::vector<Time>& risesets)
+{
+    sweep(a, b, in_intersection, risesets);
+}
 
-    return RiseSetArray(c);
+void riseset_difference(const RiseSetArray& a, const RiseSetArray& b, std::vector<Time>& risesets)
+{
+    sweep(a, b, in_difference, risesets);
 }
 
+} // namespace detail
 
 } // namespace trace
-} // namespace astrea
\ No newline at end of file
+} // namespace astrea
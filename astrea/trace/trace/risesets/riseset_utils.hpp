@@ -10,6 +10,11 @@
  */
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
+#include <units/units.hpp>
+
 #include <trace/trace.fwd.hpp>
 
 namespace astrea {
@@ -42,5 +47,66 @@ RiseSetArray riseset_intersection(const RiseSetArray& a, const RiseSetArray& b);
  */
 RiseSetArray riseset_difference(const RiseSetArray& a, const RiseSetArray& b);
 
+/**
+ * @brief Union of many RiseSetArray objects.
+ *
+ * @param arrays The RiseSetArray objects.
+ * @return RiseSetArray The times when at least one of the RiseSetArray objects is active.
+ */
+RiseSetArray riseset_union(const std::vector<RiseSetArray>& arrays);
+
+/**
+ * @brief Intersection of many RiseSetArray objects.
+ *
+ * @param arrays The RiseSetArray objects.
+ * @return RiseSetArray The times when all of the RiseSetArray objects are active.
+ */
+RiseSetArray riseset_intersection(const std::vector<RiseSetArray>& arrays);
+
+/**
+ * @brief Times when at least a given number of RiseSetArray objects are active.
+ *
+ * This answers questions like "when are at least N satellites in view" in a single O(n log k) pass.
+ *
+ * @param arrays The RiseSetArray objects.
+ * @param minCount The minimum number of active RiseSetArray objects.
+ * @return RiseSetArray The times when at least minCount of the RiseSetArray objects are active.
+ * @throws std::runtime_error If minCount is zero.
+ */
+RiseSetArray riseset_coverage(const std::vector<RiseSetArray>& arrays, const std::size_t& minCount);
+
+namespace detail {
+
+/**
+ * @brief Union of two RiseSetArray objects, written over the contents of a vector.
+ *
+ * The output keeps its capacity, so a reused buffer does not reallocate. It must not be the storage of a or b.
+ *
+ * @param a The first RiseSetArray.
+ * @param b The second RiseSetArray.
+ * @param risesets The rise/set times of the union.
+ */
+void riseset_union(const RiseSetArray& a, const RiseSetArray& b, std::vector<Time>& risesets);
+
+/**
+ * @brief Intersection of two RiseSetArray objects, written over the contents of a vector.
+ *
+ * @param a The first RiseSetArray.
+ * @param b The second RiseSetArray.
+ * @param risesets The rise/set times of the intersection.
+ */
+void riseset_intersection(const RiseSetArray& a, const RiseSetArray& b, std::vector<Time>& risesets);
+
+/**
+ * @brief Difference of two RiseSetArray objects, written over the contents of a vector.
+ *
+ * @param a The first RiseSetArray.
+ * @param b The second RiseSetArray.
+ * @param risesets The rise/set times of the difference.
+ */
+void riseset_difference(const RiseSetArray& a, const RiseSetArray& b, std::vector<Time>& risesets);
+
+} // namespace detail
+
 } // namespace trace
 } // namespace astrea
\ No newline at end of file
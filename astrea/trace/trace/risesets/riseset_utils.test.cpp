@@ -13,6 +13,279 @@ using namespace mp_units;
 using mp_units::si::unit_symbols::s;
 
 
+// The original pairwise implementations, kept as the reference for the property tests
+namespace legacy {
+
+RiseSetArray union_of(const RiseSetArray& a, const RiseSetArray& b)
+{
+    // If one is empty, union is the other
+    if (a.size() == 0) { return b; }
+    else if (b.size() == 0) {
+        return a;
+    }
+
+    // Setup
+    std::size_t aIdx = 0;
+    std::size_t bIdx = 0;
+    std::size_t cIdx = 0;
+
+    const std::size_t lenA = a.size();
+    const std::size_t lenB = b.size();
+
+    // Max size
+    std::vector<Time> c;
+    c.resize(lenA + lenB);
+
+    // Loop and insert
+    while (aIdx < lenA || bIdx < lenB) {
+
+        // Compare values
+        Time diff;
+        if (aIdx >= lenA) { diff = 1 * detail::time_unit; } // unit is arbitrary here
+        else if (bIdx >= lenB) {
+            diff = -1 * detail::time_unit;
+        }
+        else {
+            diff = a[aIdx] - b[bIdx];
+        }
+
+        // a > b
+        if (diff < 0 * detail::time_unit) {
+            if (!(bIdx & 1)) {
+                c[cIdx] = a[aIdx];
+                ++cIdx;
+            }
+            ++aIdx;
+        }
+        // b > a
+        else if (diff > 0 * detail::time_unit) {
+            if (!(aIdx & 1)) {
+                c[cIdx] = b[bIdx];
+                ++cIdx;
+            }
+            ++bIdx;
+        }
+        // a = b
+        else {
+            if ((aIdx & 1) == (bIdx & 1)) {
+                c[cIdx] = b[bIdx];
+                ++cIdx;
+            }
+            ++bIdx;
+            ++aIdx;
+        }
+    }
+
+    // Get length
+    const std::size_t lenC = (cIdx % 2) ? cIdx + 1 : cIdx;
+    c.resize(lenC);
+
+    // Remove duplicates
+    const auto cc = c;
+    for (std::size_t ii = c.size() - 1; ii > 0; --ii) {
+        if (c[ii] == c[ii - 1]) { c.erase(c.begin() + ii); }
+    }
+
+    return RiseSetArray(c);
+}
+
+RiseSetArray intersection_of(const RiseSetArray& a, const RiseSetArray& b)
+{
+    // If one is empty, intersection is empty
+    if (a.size() == 0 || b.size() == 0) { return RiseSetArray(); }
+
+    // Setup
+    std::size_t aIdx = 0;
+    std::size_t bIdx = 0;
+    std::size_t cIdx = 0;
+
+    const std::size_t lenA = a.size();
+    const std::size_t lenB = b.size();
+
+    // Max size
+    std::vector<Time> c;
+    c.resize(lenA + lenB);
+
+    // Loop and insert
+    while (aIdx < lenA && bIdx < lenB) {
+
+        // Left and right interval bounds
+        const Time left  = (a[aIdx] < b[bIdx]) ? b[bIdx] : a[aIdx];
+        const Time right = (a[aIdx + 1] > b[bIdx + 1]) ? b[bIdx + 1] : a[aIdx + 1];
+
+        // Only store if it's valid
+        if (left < right) {
+            c[cIdx]     = left;
+            c[cIdx + 1] = right;
+            cIdx += 2;
+        }
+
+        // Increment
+        if (a[aIdx + 1] <= b[bIdx + 1]) { aIdx += 2; }
+        else {
+            bIdx += 2;
+        }
+    }
+    c.resize(cIdx);
+
+    return RiseSetArray(c);
+}
+
+
+RiseSetArray difference_of(const RiseSetArray& a0, const RiseSetArray& b0)
+{
+    // c = a - b
+
+    // Check for empty arrays
+    if (a0.size() == 0 || b0.size() == 0) { return a0; }
+
+    // Setup
+    std::size_t aIdx = 0;
+    std::size_t bIdx = 0;
+    std::size_t cIdx = 0;
+
+    const std::size_t lenA = a0.size();
+    const std::size_t lenB = b0.size();
+
+    RiseSetArray a = a0;
+    RiseSetArray b = b0;
+
+    // Max size
+    std::vector<Time> c;
+    c.resize(lenA + lenB);
+
+    // Loop and insert
+    while (aIdx < lenA) {
+
+        /*
+
+        1)
+        a:      |-----|
+        b:   |------------|
+
+        2)
+        a:   |------------|
+        b:      |-----|
+
+        3)
+        a:   |------|
+        b:      |-----|
+
+            3.5)
+            a:   |------|
+            b:             |-----|
+
+        4)
+        a:      |-----|
+        b:   |------|
+
+            4.5)
+            a:             |-----|
+            b:   |------|
+
+        */
+
+        // TODO: There's gotta be a way to optimize this
+        if (bIdx == lenB) {
+            // Done with b, store everything else
+            c[cIdx]     = a[aIdx];
+            c[cIdx + 1] = a[aIdx + 1];
+            cIdx += 2;
+            aIdx += 2;
+        }
+        else if (a[aIdx] >= b[bIdx] && a[aIdx + 1] <= b[bIdx + 1]) {
+            // Case 1: b envelopes a
+
+            // truncate b
+            b[bIdx] = a[aIdx + 1];
+
+            // Move to next a riseset
+            aIdx += 2;
+        }
+        else if (a[aIdx] < b[bIdx] && a[aIdx + 1] > b[bIdx + 1]) {
+            // Case 2: a envelopes b
+
+            // Store a rise to b rise
+            c[cIdx]     = a[aIdx];
+            c[cIdx + 1] = b[bIdx];
+            cIdx += 2;
+
+            // truncate a
+            a[aIdx] = b[bIdx + 1];
+
+            // Move to next b riseset
+            bIdx += 2;
+        }
+        else if (a[aIdx] < b[bIdx] && a[aIdx + 1] <= b[bIdx + 1]) {
+            // Case 3: a starts, b ends
+
+            c[cIdx] = a[aIdx];
+            if (b[bIdx] > a[aIdx + 1]) { // Case 3.5: b completely after a
+                c[cIdx + 1] = a[aIdx + 1];
+            }
+            else {
+                // Store a rise to b rise
+                c[cIdx + 1] = b[bIdx];
+
+                // truncate b
+                b[bIdx] = a[aIdx + 1];
+            }
+
+            // Increment
+            cIdx += 2;
+            aIdx += 2;
+        }
+        else if (a[aIdx] >= b[bIdx] && a[aIdx + 1] > b[bIdx + 1]) {
+            // Case 4: b starts, a ends
+
+            if (a[aIdx] > b[bIdx + 1]) {
+                // Case 4.5: a completely after b
+            }
+            else {
+                // truncate a
+                a[aIdx] = b[bIdx + 1];
+            }
+
+            // Move to next b riseset
+            bIdx += 2;
+        }
+    }
+    c.resize(cIdx);
+
+    return RiseSetArray(c);
+}
+
+} // namespace legacy
+
+
+// Random RiseSetArray on an integer grid so that boundaries frequently coincide
+RiseSetArray random_risesets(std::mt19937& generator, const std::size_t& nPairs)
+{
+    std::uniform_int_distribution<int> firstStep(0, 3);
+    std::uniform_int_distribution<int> step(1, 3);
+
+    std::vector<Time> risesets;
+    double time = 0.0;
+    for (std::size_t ii = 0; ii < 2 * nPairs; ++ii) {
+        time += (ii == 0) ? firstStep(generator) : step(generator);
+        risesets.push_back(time * s);
+    }
+    return RiseSetArray(risesets);
+}
+
+// Number of arrays active at a time
+std::size_t count_active(const std::vector<RiseSetArray>& arrays, const Time& time)
+{
+    std::size_t count = 0;
+    for (const auto& array : arrays) {
+        for (std::size_t ii = 0; ii < array.size(); ii += 2) {
+            if (array[ii] < time && time < array[ii + 1]) { ++count; }
+        }
+    }
+    return count;
+}
+
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -190,3 +463,104 @@ TEST(RiseSetUtilities, DifferenceEmpty)
     c    = riseset_difference(b, a);
     ASSERT_EQ(c, cExp);
 }
+
+
+TEST(RiseSetUtilities, MatchesLegacy)
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<std::size_t> nPairs(0, 6);
+    for (std::size_t ii = 0; ii < 10000; ++ii) {
+        const RiseSetArray a = random_risesets(generator, nPairs(generator));
+        const RiseSetArray b = random_risesets(generator, nPairs(generator));
+
+        ASSERT_EQ(riseset_union(a, b), legacy::union_of(a, b));
+        ASSERT_EQ(riseset_intersection(a, b), legacy::intersection_of(a, b));
+        ASSERT_EQ(riseset_difference(a, b), legacy::difference_of(a, b));
+        ASSERT_EQ(riseset_difference(b, a), legacy::difference_of(b, a));
+    }
+}
+
+
+TEST(RiseSetUtilities, InPlaceMatchesLegacy)
+{
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<std::size_t> nPairs(0, 6);
+    for (std::size_t ii = 0; ii < 1000; ++ii) {
+        const RiseSetArray a = random_risesets(generator, nPairs(generator));
+        const RiseSetArray b = random_risesets(generator, nPairs(generator));
+
+        RiseSetArray c = a;
+        c |= b;
+        ASSERT_EQ(c, legacy::union_of(a, b));
+
+        c = a;
+        c &= b;
+        ASSERT_EQ(c, legacy::intersection_of(a, b));
+
+        c = a;
+        c -= b;
+        ASSERT_EQ(c, legacy::difference_of(a, b));
+    }
+}
+
+
+TEST(RiseSetUtilities, KWayMatchesPairwise)
+{
+    std::mt19937 generator(1234);
+    std::uniform_int_distribution<std::size_t> nPairs(0, 8);
+    std::uniform_int_distribution<std::size_t> nArrays(1, 6);
+    for (std::size_t ii = 0; ii < 2000; ++ii) {
+        std::vector<RiseSetArray> arrays;
+        for (std::size_t jj = nArrays(generator); jj > 0; --jj) {
+            arrays.push_back(random_risesets(generator, nPairs(generator)));
+        }
+
+        RiseSetArray unionExp        = arrays[0];
+        RiseSetArray intersectionExp = arrays[0];
+        for (std::size_t jj = 1; jj < arrays.size(); ++jj) {
+            unionExp        = legacy::union_of(unionExp, arrays[jj]);
+            intersectionExp = legacy::intersection_of(intersectionExp, arrays[jj]);
+        }
+
+        ASSERT_EQ(riseset_union(arrays), unionExp);
+        ASSERT_EQ(riseset_intersection(arrays), intersectionExp);
+    }
+}
+
+
+TEST(RiseSetUtilities, Coverage)
+{
+    std::mt19937 generator(99);
+    std::uniform_int_distribution<std::size_t> nPairs(0, 8);
+    for (std::size_t ii = 0; ii < 500; ++ii) {
+        std::vector<RiseSetArray> arrays;
+        for (std::size_t jj = 0; jj < 5; ++jj) {
+            arrays.push_back(random_risesets(generator, nPairs(generator)));
+        }
+
+        // Boundaries are integers, so sampling the half seconds checks every piece of the timeline
+        for (std::size_t minCount = 1; minCount <= arrays.size(); ++minCount) {
+            const RiseSetArray coverage = riseset_coverage(arrays, minCount);
+            for (double time = 0.5; time < 60.0; time += 1.0) {
+                const bool covered = count_active({ coverage }, time * s) == 1;
+                ASSERT_EQ(covered, count_active(arrays, time * s) >= minCount);
+            }
+        }
+    }
+}
+
+
+TEST(RiseSetUtilities, CoverageEdgeCases)
+{
+    RiseSetArray a({ 0 * s, 2 * s });
+    RiseSetArray b({ 2 * s, 4 * s });
+
+    ASSERT_ANY_THROW(riseset_coverage({ a, b }, 0));
+    ASSERT_EQ(riseset_coverage({ a, b }, 3), RiseSetArray());
+    ASSERT_EQ(riseset_union(std::vector<RiseSetArray>{}), RiseSetArray());
+    ASSERT_EQ(riseset_intersection(std::vector<RiseSetArray>{}), RiseSetArray());
+
+    // Touching intervals merge in a union and vanish in an intersection
+    ASSERT_EQ(riseset_union({ a, b }), RiseSetArray({ 0 * s, 4 * s }));
+    ASSERT_EQ(riseset_intersection({ a, b }), RiseSetArray());
+}
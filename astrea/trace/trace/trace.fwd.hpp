@@ -4,11 +4,17 @@ namespace astrea {
 namespace trace {
 
 class AccessArray;
+class AccessSink;
+class Antenna;
+class AtmosphericLossTable;
+class EllipsoidOcculter;
 class GroundArchitecture;
+class Grid;
 class GroundStation;
 class Sensor;
 class Viewer;
 class RiseSetArray;
+class VisibilityBitset;
 
 } // namespace trace
 } // namespace astrea
\ No newline at end of file
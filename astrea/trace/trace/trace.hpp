@@ -11,6 +11,13 @@
 #pragma once
 
 #include <trace/analysis/access_analysis.hpp>
+#include <trace/analysis/conjunction_screening.hpp>
+#include <trace/analysis/coverage_analysis.hpp>
+#include <trace/analysis/link_budget.hpp>
+#include <trace/analysis/occultation.hpp>
+
+#include <trace/io/AccessSink.hpp>
+#include <trace/io/PlatformNameIndex.hpp>
 
 #include <trace/platforms/ground/Grid.hpp>
 #include <trace/platforms/ground/GroundArchitecture.hpp>
@@ -18,6 +25,7 @@
 #include <trace/platforms/ground/GroundStation.hpp>
 
 #include <trace/platforms/sensors/Antenna.hpp>
+#include <trace/platforms/sensors/AtmosphericLossTable.hpp>
 #include <trace/platforms/sensors/Sensor.hpp>
 #include <trace/platforms/sensors/fov/FieldOfView.hpp>
 
@@ -26,5 +34,6 @@
 #include <trace/risesets/AccessArray.hpp>
 #include <trace/risesets/RiseSetArray.hpp>
 #include <trace/risesets/riseset_utils.hpp>
+#include <trace/risesets/VisibilityBitset.hpp>
 
 #include <trace/types/typedefs.hpp>
@@ -0,0 +1,83 @@
+/**
+ * @file parallel.hpp
+ * @author Jay Iuliano (iuliano.jay@gmail.com)
+ * @brief Simple helpers for splitting loops across threads.
+ * @version 0.1
+ * @date 2025-08-02
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace astrea {
+namespace utilities {
+
+/**
+ * @brief Get the number of threads to use for a parallel loop.
+ *
+ * @param n The number of indices in the loop.
+ * @param nThreads The number of threads requested. Zero uses the hardware concurrency.
+ * @return std::size_t The number of threads, at least one and at most n.
+ */
+inline std::size_t get_worker_count(const std::size_t& n, const std::size_t& nThreads = 0)
+{
+    const std::size_t nWorkers = nThreads ? nThreads : std::max(1u, std::thread::hardware_concurrency());
+    return std::max<std::size_t>(1, std::min(nWorkers, n));
+}
+
+/**
+ * @brief Run a function over a range of indices, split into contiguous blocks across threads.
+ *
+ * The first exception thrown by any call is rethrown on the calling thread once every thread has finished. Blocks
+ * already started run to completion.
+ *
+ * @tparam Function_T Callable taking an index.
+ * @param n The number of indices.
+ * @param nThreads The number of threads to use. Zero uses the hardware concurrency.
+ * @param function The function to run for each index.
+ */
+template <class Function_T>
+void parallel_for(const std::size_t& n, const std::size_t& nThreads, Function_T&& function)
+{
+    const std::size_t nWorkers = get_worker_count(n, nThreads);
+    if (nWorkers <= 1) {
+        for (std::size_t ii = 0; ii < n; ++ii) {
+            function(ii);
+        }
+        return;
+    }
+
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    {
+        const std::size_t blockSize = (n + nWorkers - 1) / nWorkers;
+        std::vector<std::jthread> workers;
+        workers.reserve(nWorkers);
+        for (std::size_t begin = 0; begin < n; begin += blockSize) {
+            const std::size_t end = std::min(begin + blockSize, n);
+            workers.emplace_back([&function, &error, &errorMutex, begin, end]() {
+                try {
+                    for (std::size_t ii = begin; ii < end; ++ii) {
+                        function(ii);
+                    }
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (!error) { error = std::current_exception(); }
+                }
+            });
+        }
+    }
+    if (error) { std::rethrow_exception(error); }
+}
+
+} // namespace utilities
+} // namespace astrea
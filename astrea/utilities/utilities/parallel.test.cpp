@@ -0,0 +1,48 @@
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <utilities/utilities.hpp>
+
+using namespace astrea;
+using namespace utilities;
+
+int main(int argc, char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+TEST(ParallelUtilities, WorkerCount)
+{
+    ASSERT_EQ(get_worker_count(100, 4), 4);
+    ASSERT_EQ(get_worker_count(3, 4), 3);
+    ASSERT_EQ(get_worker_count(0, 4), 1);
+    ASSERT_GE(get_worker_count(100), 1);
+}
+
+TEST(ParallelUtilities, ParallelFor)
+{
+    for (const std::size_t nThreads : { 0, 1, 3, 8 }) {
+        std::vector<int> visits(1001, 0);
+        parallel_for(visits.size(), nThreads, [&](const std::size_t& ii) { visits[ii] += 1; });
+        for (const auto& count : visits) {
+            ASSERT_EQ(count, 1);
+        }
+    }
+
+    std::atomic<std::size_t> nCalls = 0;
+    parallel_for(0, 4, [&](const std::size_t&) { ++nCalls; });
+    ASSERT_EQ(nCalls, 0);
+}
+
+TEST(ParallelUtilities, Exceptions)
+{
+    const auto failOnSeven = [](const std::size_t& ii) {
+        if (ii == 7) { throw std::runtime_error("Seven."); }
+    };
+    ASSERT_THROW(parallel_for(100, 4, failOnSeven), std::runtime_error);
+    ASSERT_THROW(parallel_for(100, 1, failOnSeven), std::runtime_error);
+}
@@ -2,4 +2,5 @@
 
 #include <utilities/ProgressBar.hpp>
 #include <utilities/json_util.hpp>
+#include <utilities/parallel.hpp>
 #include <utilities/string_util.hpp>
\ No newline at end of file